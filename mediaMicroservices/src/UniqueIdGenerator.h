@@ -0,0 +1,201 @@
+#ifndef MEDIA_MICROSERVICES_UNIQUEIDGENERATOR_H
+#define MEDIA_MICROSERVICES_UNIQUEIDGENERATOR_H
+
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "logger.h"
+
+// Custom Epoch (January 1, 2018 Midnight GMT = 2018-01-01T00:00:00Z)
+#define CUSTOM_EPOCH 1514764800000
+
+#define UNIQUE_ID_COUNTER_BITS 12
+#define UNIQUE_ID_TIMESTAMP_BITS 40
+// Most ids a single millisecond can hand out, and so the largest block
+#define UNIQUE_ID_MAX_BLOCK (1 << UNIQUE_ID_COUNTER_BITS)
+// How far the clock may step back before NextIds gives up instead of waiting
+#define UNIQUE_ID_MAX_CLOCK_SKEW_MS 1000
+
+namespace media_service {
+
+// 64-bit unique ids
+//
+// ------------------------------------------------------------------------
+// |0| 11 bit machine ID |      40-bit timestamp         | 12-bit counter |
+// ------------------------------------------------------------------------
+//
+// The last issued millisecond and the next free counter value are packed
+// into one atomic word, (timestamp << 13) | counter, and advanced with a
+// compare-and-swap, so threads never block each other. The counter gets one
+// spare bit so that a fully used millisecond (4096) is representable.
+//
+// If the clock steps back, ids keep coming from the last issued millisecond
+// while its counter lasts; only then does the caller wait for the clock to
+// catch up, and only for up to max_clock_skew_ms.
+class UniqueIdGenerator {
+ public:
+  explicit UniqueIdGenerator(
+      uint16_t machine_id,
+      int64_t max_clock_skew_ms = UNIQUE_ID_MAX_CLOCK_SKEW_MS);
+
+  // Return false if the clock went back by more than max_clock_skew_ms
+  bool NextId(int64_t *id);
+  // Reserves the num_ids consecutive ids *first_id .. *first_id + num_ids - 1,
+  // 1 <= num_ids <= UNIQUE_ID_MAX_BLOCK
+  bool NextIds(int num_ids, int64_t *first_id);
+
+ private:
+  static int64_t _Now();
+
+  int64_t _machine_bits;
+  int64_t _max_clock_skew_ms;
+  std::atomic<uint64_t> _state;
+};
+
+UniqueIdGenerator::UniqueIdGenerator(uint16_t machine_id,
+                                     int64_t max_clock_skew_ms) {
+  _machine_bits =
+      (int64_t)(machine_id & 0x7FF)
+      << (UNIQUE_ID_TIMESTAMP_BITS + UNIQUE_ID_COUNTER_BITS);
+  _max_clock_skew_ms = max_clock_skew_ms;
+  _state = 0;
+}
+
+bool UniqueIdGenerator::NextId(int64_t *id) { return NextIds(1, id); }
+
+bool UniqueIdGenerator::NextIds(int num_ids, int64_t *first_id) {
+  const int state_counter_bits = UNIQUE_ID_COUNTER_BITS + 1;
+  const uint64_t state_counter_mask = (1ULL << state_counter_bits) - 1;
+
+  uint64_t state = _state.load(std::memory_order_relaxed);
+  while (true) {
+    int64_t last_timestamp = state >> state_counter_bits;
+    int64_t counter = state & state_counter_mask;
+    int64_t now = _Now();
+
+    int64_t timestamp;
+    int64_t first_counter;
+    if (now > last_timestamp) {
+      timestamp = now;
+      first_counter = 0;
+    } else if (counter + num_ids <= UNIQUE_ID_MAX_BLOCK) {
+      timestamp = last_timestamp;
+      first_counter = counter;
+    } else {
+      // This millisecond is used up, wait for the next one
+      if (last_timestamp - now > _max_clock_skew_ms) {
+        LOG(error) << "Clock is " << last_timestamp - now
+                   << " ms behind the last issued id";
+        return false;
+      }
+      if (now < last_timestamp) {
+        std::this_thread::sleep_for(
+            std::chrono::milliseconds(last_timestamp - now));
+      } else {
+        std::this_thread::yield();
+      }
+      state = _state.load(std::memory_order_relaxed);
+      continue;
+    }
+
+    uint64_t next_state = ((uint64_t)timestamp << state_counter_bits) |
+                          (uint64_t)(first_counter + num_ids);
+    if (_state.compare_exchange_weak(state, next_state,
+                                     std::memory_order_relaxed)) {
+      int64_t timestamp_bits =
+          timestamp & ((1LL << UNIQUE_ID_TIMESTAMP_BITS) - 1);
+      *first_id = _machine_bits | (timestamp_bits << UNIQUE_ID_COUNTER_BITS) |
+                  first_counter;
+      return true;
+    }
+  }
+}
+
+int64_t UniqueIdGenerator::_Now() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+             .count() -
+         CUSTOM_EPOCH;
+}
+
+/*
+ * The following code which obtaines machine ID from machine's MAC address was
+ * inspired from https://stackoverflow.com/a/16859693.
+ */
+inline u_int16_t HashMacAddressPid(const std::string &mac)
+{
+  u_int16_t hash = 0;
+  std::string mac_pid = mac + std::to_string(getpid());
+  for ( unsigned int i = 0; i < mac_pid.size(); i++ ) {
+    hash += ( mac_pid[i] << (( i & 1 ) * 8 ));
+  }
+  return hash;
+}
+
+inline int GetMachineId (std::string *mac_hash) {
+  std::string mac;
+  int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_IP );
+  if ( sock < 0 ) {
+    LOG(error) << "Unable to obtain MAC address";
+    return -1;
+  }
+
+  struct ifconf conf{};
+  char ifconfbuf[ 128 * sizeof(struct ifreq)  ];
+  memset( ifconfbuf, 0, sizeof( ifconfbuf ));
+  conf.ifc_buf = ifconfbuf;
+  conf.ifc_len = sizeof( ifconfbuf );
+  if ( ioctl( sock, SIOCGIFCONF, &conf ))
+  {
+    LOG(error) << "Unable to obtain MAC address";
+    return -1;
+  }
+
+  struct ifreq* ifr;
+  for (
+      ifr = conf.ifc_req;
+      reinterpret_cast<char *>(ifr) <
+          reinterpret_cast<char *>(conf.ifc_req) + conf.ifc_len;
+      ifr++) {
+    if ( ifr->ifr_addr.sa_data == (ifr+1)->ifr_addr.sa_data ) {
+      continue;  // duplicate, skip it
+    }
+
+    if ( ioctl( sock, SIOCGIFFLAGS, ifr )) {
+      continue;  // failed to get flags, skip it
+    }
+    if ( ioctl( sock, SIOCGIFHWADDR, ifr ) == 0 ) {
+      mac = std::string(ifr->ifr_addr.sa_data);
+      if (!mac.empty()) {
+        break;
+      }
+    }
+  }
+  close(sock);
+
+  std::stringstream stream;
+  stream << std::hex << HashMacAddressPid(mac);
+  *mac_hash = stream.str();
+
+  if (mac_hash->size() > 3) {
+    mac_hash->erase(0, mac_hash->size() - 3);
+  } else if (mac_hash->size() < 3) {
+    *mac_hash = std::string(3 - mac_hash->size(), '0') + *mac_hash;
+  }
+  return 0;
+}
+
+}  // namespace media_service
+
+#endif  // MEDIA_MICROSERVICES_UNIQUEIDGENERATOR_H
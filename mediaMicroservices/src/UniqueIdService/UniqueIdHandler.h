@@ -3,71 +3,36 @@
 
 #include <iostream>
 #include <string>
-#include <chrono>
-#include <mutex>
-#include <sstream>
-#include <iomanip>
-#include <arpa/inet.h>
-#include <net/if.h>
-#include <sys/ioctl.h>
-#include <sys/socket.h>
 
 #include "../../gen-cpp/UniqueIdService.h"
 #include "../../gen-cpp/ComposeReviewService.h"
 #include "../../gen-cpp/media_service_types.h"
 #include "../ClientPool.h"
 #include "../ThriftClient.h"
+#include "../UniqueIdGenerator.h"
 #include "../logger.h"
 #include "../tracing.h"
 
-// Custom Epoch (January 1, 2018 Midnight GMT = 2018-01-01T00:00:00Z)
-#define CUSTOM_EPOCH 1514764800000
-
 namespace media_service {
 
-using std::chrono::milliseconds;
-using std::chrono::duration_cast;
-using std::chrono::system_clock;
-
-static int64_t current_timestamp = -1;
-static int counter = 0;
-
-static int GetCounter(int64_t timestamp) {
-  if (current_timestamp > timestamp) {
-    LOG(fatal) << "Timestamps are not incremental.";
-    exit(EXIT_FAILURE);
-  }
-  if (current_timestamp == timestamp) {
-    return counter++;
-  } else {
-    current_timestamp = timestamp;
-    counter = 0;
-    return counter++;
-  }
-}
-
 class UniqueIdHandler : public UniqueIdServiceIf {
  public:
   ~UniqueIdHandler() override = default;
   UniqueIdHandler(
-      std::mutex *,
-      const std::string &,
+      UniqueIdGenerator *,
       ClientPool<ThriftClient<ComposeReviewServiceClient>> *);
 
   void UploadUniqueId(int64_t, const std::map<std::string, std::string> &) override;
 
  private:
-  std::mutex *_thread_lock;
-  std::string _machine_id;
+  UniqueIdGenerator *_id_generator;
   ClientPool<ThriftClient<ComposeReviewServiceClient>> *_compose_client_pool;
 };
 
 UniqueIdHandler::UniqueIdHandler(
-    std::mutex *thread_lock,
-    const std::string &machine_id,
+    UniqueIdGenerator *id_generator,
     ClientPool<ThriftClient<ComposeReviewServiceClient>> *compose_client_pool) {
-  _thread_lock = thread_lock;
-  _machine_id = machine_id;
+  _id_generator = id_generator;
   _compose_client_pool = compose_client_pool;
 }
 
@@ -85,37 +50,13 @@ void UniqueIdHandler::UploadUniqueId(
       { opentracing::ChildOf(parent_span->get()) });
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
-  _thread_lock->lock();
-  int64_t timestamp = duration_cast<milliseconds>(
-      system_clock::now().time_since_epoch()).count() - CUSTOM_EPOCH;
-  int counter = GetCounter(timestamp);
-  _thread_lock->unlock();
-
-  std::stringstream sstream;
-  sstream << std::hex << timestamp;
-  std::string timestamp_hex(sstream.str());
-
-  if (timestamp_hex.size() > 10) {
-    timestamp_hex.erase(0, timestamp_hex.size() - 10);
-  } else if (timestamp_hex.size() < 10) {
-    timestamp_hex = std::string(10 - timestamp_hex.size(), '0') + timestamp_hex;
-  }
-
-  // Empty the sstream buffer.
-  sstream.clear();
-  sstream.str(std::string());
-
-  sstream << std::hex << counter;
-  std::string counter_hex(sstream.str());
-
-  if (counter_hex.size() > 3) {
-    counter_hex.erase(0, counter_hex.size() - 3);
-  } else if (counter_hex.size() < 3) {
-    counter_hex = std::string(3 - counter_hex.size(), '0') + counter_hex;
+  int64_t review_id;
+  if (!_id_generator->NextId(&review_id)) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "Clock moved backwards, cannot compose a review_id";
+    throw se;
   }
-
-  std::string review_id_str = _machine_id + timestamp_hex + counter_hex;
-  int64_t review_id = stoul(review_id_str, nullptr, 16) & 0x7FFFFFFFFFFFFFFF;
   LOG(debug) << "The review_id of the request "
       << req_id << " is " << review_id;
 
@@ -139,73 +80,6 @@ void UniqueIdHandler::UploadUniqueId(
   span->Finish();
 }
 
-/*
- * The following code which obtaines machine ID from machine's MAC address was
- * inspired from https://stackoverflow.com/a/16859693.
- */
-u_int16_t HashMacAddressPid(const std::string &mac)
-{
-  u_int16_t hash = 0;
-  std::string mac_pid = mac + std::to_string(getpid());
-  for ( unsigned int i = 0; i < mac_pid.size(); i++ ) {
-    hash += ( mac[i] << (( i & 1 ) * 8 ));
-  }
-  return hash;
-}
-
-int GetMachineId (std::string *mac_hash) {
-  std::string mac;
-  int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_IP );
-  if ( sock < 0 ) {
-    LOG(error) << "Unable to obtain MAC address";
-    return -1;
-  }
-
-  struct ifconf conf{};
-  char ifconfbuf[ 128 * sizeof(struct ifreq)  ];
-  memset( ifconfbuf, 0, sizeof( ifconfbuf ));
-  conf.ifc_buf = ifconfbuf;
-  conf.ifc_len = sizeof( ifconfbuf );
-  if ( ioctl( sock, SIOCGIFCONF, &conf ))
-  {
-    LOG(error) << "Unable to obtain MAC address";
-    return -1;
-  }
-
-  struct ifreq* ifr;
-  for (
-      ifr = conf.ifc_req;
-      reinterpret_cast<char *>(ifr) <
-          reinterpret_cast<char *>(conf.ifc_req) + conf.ifc_len;
-      ifr++) {
-    if ( ifr->ifr_addr.sa_data == (ifr+1)->ifr_addr.sa_data ) {
-      continue;  // duplicate, skip it
-    }
-
-    if ( ioctl( sock, SIOCGIFFLAGS, ifr )) {
-      continue;  // failed to get flags, skip it
-    }
-    if ( ioctl( sock, SIOCGIFHWADDR, ifr ) == 0 ) {
-      mac = std::string(ifr->ifr_addr.sa_data);
-      if (!mac.empty()) {
-        break;
-      }
-    }
-  }
-  close(sock);
-
-  std::stringstream stream;
-  stream << std::hex << HashMacAddressPid(mac);
-  *mac_hash = stream.str();
-
-  if (mac_hash->size() > 3) {
-    mac_hash->erase(0, mac_hash->size() - 3);
-  } else if (mac_hash->size() < 3) {
-    *mac_hash = std::string(3 - mac_hash->size(), '0') + *mac_hash;
-  }
-  return 0;
-}
-
 } // namespace media_service
 
 #endif //MEDIA_MICROSERVICES_UNIQUEIDHANDLER_H
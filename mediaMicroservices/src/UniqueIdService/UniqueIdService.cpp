@@ -54,14 +54,14 @@ int main(int argc, char *argv[]) {
     exit(EXIT_FAILURE);
   }
 
-  std::mutex thread_lock;
+  UniqueIdGenerator id_generator(std::stoul(machine_id, nullptr, 16));
   ClientPool<ThriftClient<ComposeReviewServiceClient>> compose_client_pool(
       "compose-review-client", compose_addr, compose_port, 0, 128, 1000);
 
   TThreadedServer server (
       std::make_shared<UniqueIdServiceProcessor>(
           std::make_shared<UniqueIdHandler>(
-              &thread_lock, machine_id, &compose_client_pool)),
+              &id_generator, &compose_client_pool)),
       std::make_shared<TServerSocket>("0.0.0.0", port),
       std::make_shared<TFramedTransportFactory>(),
       std::make_shared<TBinaryProtocolFactory>()
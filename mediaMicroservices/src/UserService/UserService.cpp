@@ -52,7 +52,7 @@ int main(int argc, char *argv[]) {
     exit(EXIT_FAILURE);
   }
 
-  std::mutex thread_lock;
+  UniqueIdGenerator id_generator(std::stoul(machine_id, nullptr, 16));
 
   ClientPool<ThriftClient<ComposeReviewServiceClient>> compose_client_pool(
       "compose-review-client", compose_addr, compose_port, 0, 128, 1000);
@@ -60,8 +60,7 @@ int main(int argc, char *argv[]) {
   TThreadedServer server(
       std::make_shared<UserServiceProcessor>(
           std::make_shared<UserHandler>(
-              &thread_lock,
-              machine_id,
+              &id_generator,
               secret,
               memcached_client_pool,
               mongodb_client_pool,
@@ -0,0 +1,14 @@
+# - Find the zstd compression library
+#  ZSTD_FOUND - system has zstd
+#  ZSTD_INCLUDE_DIR - the zstd include directory
+#  ZSTD_LIBRARIES - the libraries needed to use zstd
+
+find_path(ZSTD_INCLUDE_DIR zstd.h PATHS /usr/local/include /usr/include)
+find_library(ZSTD_LIBRARIES NAMES zstd PATHS /usr/local/lib /usr/local/lib64 /usr/lib /usr/lib64)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(
+    ZSTD DEFAULT_MSG
+    ZSTD_LIBRARIES
+    ZSTD_INCLUDE_DIR)
+mark_as_advanced(ZSTD_INCLUDE_DIR ZSTD_LIBRARIES)
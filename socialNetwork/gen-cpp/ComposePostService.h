@@ -22,6 +22,7 @@ class ComposePostServiceIf {
  public:
   virtual ~ComposePostServiceIf() {}
   virtual void ComposePost(const int64_t req_id, const std::string& username, const int64_t user_id, const std::string& text, const std::vector<int64_t> & media_ids, const std::vector<std::string> & media_types, const PostType::type post_type, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void ComposePosts(std::vector<PostCompositionResult> & _return, const int64_t req_id, const std::vector<PostComposition> & posts, const std::map<std::string, std::string> & carrier) = 0;
 };
 
 class ComposePostServiceIfFactory {
@@ -54,6 +55,9 @@ class ComposePostServiceNull : virtual public ComposePostServiceIf {
   void ComposePost(const int64_t /* req_id */, const std::string& /* username */, const int64_t /* user_id */, const std::string& /* text */, const std::vector<int64_t> & /* media_ids */, const std::vector<std::string> & /* media_types */, const PostType::type /* post_type */, const std::map<std::string, std::string> & /* carrier */) {
     return;
   }
+  void ComposePosts(std::vector<PostCompositionResult> & /* _return */, const int64_t /* req_id */, const std::vector<PostComposition> & /* posts */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
 };
 
 typedef struct _ComposePostService_ComposePost_args__isset {
@@ -209,6 +213,132 @@ class ComposePostService_ComposePost_presult {
 
 };
 
+typedef struct _ComposePostService_ComposePosts_args__isset {
+  _ComposePostService_ComposePosts_args__isset() : req_id(false), posts(false), carrier(false) {}
+  bool req_id :1;
+  bool posts :1;
+  bool carrier :1;
+} _ComposePostService_ComposePosts_args__isset;
+
+class ComposePostService_ComposePosts_args {
+ public:
+
+  ComposePostService_ComposePosts_args(const ComposePostService_ComposePosts_args&);
+  ComposePostService_ComposePosts_args& operator=(const ComposePostService_ComposePosts_args&);
+  ComposePostService_ComposePosts_args() : req_id(0) {
+  }
+
+  virtual ~ComposePostService_ComposePosts_args() throw();
+  int64_t req_id;
+  std::vector<PostComposition>  posts;
+  std::map<std::string, std::string>  carrier;
+
+  _ComposePostService_ComposePosts_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_posts(const std::vector<PostComposition> & val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const ComposePostService_ComposePosts_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(posts == rhs.posts))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const ComposePostService_ComposePosts_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ComposePostService_ComposePosts_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class ComposePostService_ComposePosts_pargs {
+ public:
+
+
+  virtual ~ComposePostService_ComposePosts_pargs() throw();
+  const int64_t* req_id;
+  const std::vector<PostComposition> * posts;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _ComposePostService_ComposePosts_result__isset {
+  _ComposePostService_ComposePosts_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _ComposePostService_ComposePosts_result__isset;
+
+class ComposePostService_ComposePosts_result {
+ public:
+
+  ComposePostService_ComposePosts_result(const ComposePostService_ComposePosts_result&);
+  ComposePostService_ComposePosts_result& operator=(const ComposePostService_ComposePosts_result&);
+  ComposePostService_ComposePosts_result() {
+  }
+
+  virtual ~ComposePostService_ComposePosts_result() throw();
+  std::vector<PostCompositionResult>  success;
+  ServiceException se;
+
+  _ComposePostService_ComposePosts_result__isset __isset;
+
+  void __set_success(const std::vector<PostCompositionResult> & val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const ComposePostService_ComposePosts_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const ComposePostService_ComposePosts_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ComposePostService_ComposePosts_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _ComposePostService_ComposePosts_presult__isset {
+  _ComposePostService_ComposePosts_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _ComposePostService_ComposePosts_presult__isset;
+
+class ComposePostService_ComposePosts_presult {
+ public:
+
+
+  virtual ~ComposePostService_ComposePosts_presult() throw();
+  std::vector<PostCompositionResult> * success;
+  ServiceException se;
+
+  _ComposePostService_ComposePosts_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class ComposePostServiceClient : virtual public ComposePostServiceIf {
  public:
   ComposePostServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
@@ -237,6 +367,9 @@ class ComposePostServiceClient : virtual public ComposePostServiceIf {
   void ComposePost(const int64_t req_id, const std::string& username, const int64_t user_id, const std::string& text, const std::vector<int64_t> & media_ids, const std::vector<std::string> & media_types, const PostType::type post_type, const std::map<std::string, std::string> & carrier);
   void send_ComposePost(const int64_t req_id, const std::string& username, const int64_t user_id, const std::string& text, const std::vector<int64_t> & media_ids, const std::vector<std::string> & media_types, const PostType::type post_type, const std::map<std::string, std::string> & carrier);
   void recv_ComposePost();
+  void ComposePosts(std::vector<PostCompositionResult> & _return, const int64_t req_id, const std::vector<PostComposition> & posts, const std::map<std::string, std::string> & carrier);
+  void send_ComposePosts(const int64_t req_id, const std::vector<PostComposition> & posts, const std::map<std::string, std::string> & carrier);
+  void recv_ComposePosts(std::vector<PostCompositionResult> & _return);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -253,10 +386,12 @@ class ComposePostServiceProcessor : public ::apache::thrift::TDispatchProcessor
   typedef std::map<std::string, ProcessFunction> ProcessMap;
   ProcessMap processMap_;
   void process_ComposePost(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_ComposePosts(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   ComposePostServiceProcessor(::apache::thrift::stdcxx::shared_ptr<ComposePostServiceIf> iface) :
     iface_(iface) {
     processMap_["ComposePost"] = &ComposePostServiceProcessor::process_ComposePost;
+    processMap_["ComposePosts"] = &ComposePostServiceProcessor::process_ComposePosts;
   }
 
   virtual ~ComposePostServiceProcessor() {}
@@ -294,6 +429,16 @@ class ComposePostServiceMultiface : virtual public ComposePostServiceIf {
     ifaces_[i]->ComposePost(req_id, username, user_id, text, media_ids, media_types, post_type, carrier);
   }
 
+  void ComposePosts(std::vector<PostCompositionResult> & _return, const int64_t req_id, const std::vector<PostComposition> & posts, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->ComposePosts(_return, req_id, posts, carrier);
+    }
+    ifaces_[i]->ComposePosts(_return, req_id, posts, carrier);
+    return;
+  }
+
 };
 
 // The 'concurrent' client is a thread safe client that correctly handles
@@ -327,6 +472,9 @@ class ComposePostServiceConcurrentClient : virtual public ComposePostServiceIf {
   void ComposePost(const int64_t req_id, const std::string& username, const int64_t user_id, const std::string& text, const std::vector<int64_t> & media_ids, const std::vector<std::string> & media_types, const PostType::type post_type, const std::map<std::string, std::string> & carrier);
   int32_t send_ComposePost(const int64_t req_id, const std::string& username, const int64_t user_id, const std::string& text, const std::vector<int64_t> & media_ids, const std::vector<std::string> & media_types, const PostType::type post_type, const std::map<std::string, std::string> & carrier);
   void recv_ComposePost(const int32_t seqid);
+  void ComposePosts(std::vector<PostCompositionResult> & _return, const int64_t req_id, const std::vector<PostComposition> & posts, const std::map<std::string, std::string> & carrier);
+  int32_t send_ComposePosts(const int64_t req_id, const std::vector<PostComposition> & posts, const std::map<std::string, std::string> & carrier);
+  void recv_ComposePosts(std::vector<PostCompositionResult> & _return, const int32_t seqid);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
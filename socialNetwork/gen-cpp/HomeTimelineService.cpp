@@ -89,6 +89,14 @@ uint32_t HomeTimelineService_ReadHomeTimeline_args::read(::apache::thrift::proto
           xfer += iprot->skip(ftype);
         }
         break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->fields);
+          this->__isset.fields = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -135,6 +143,10 @@ uint32_t HomeTimelineService_ReadHomeTimeline_args::write(::apache::thrift::prot
   }
   xfer += oprot->writeFieldEnd();
 
+  xfer += oprot->writeFieldBegin("fields", ::apache::thrift::protocol::T_I32, 6);
+  xfer += oprot->writeI32(this->fields);
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -179,6 +191,10 @@ uint32_t HomeTimelineService_ReadHomeTimeline_pargs::write(::apache::thrift::pro
   }
   xfer += oprot->writeFieldEnd();
 
+  xfer += oprot->writeFieldBegin("fields", ::apache::thrift::protocol::T_I32, 6);
+  xfer += oprot->writeI32((*(this->fields)));
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -672,13 +688,453 @@ uint32_t HomeTimelineService_WriteHomeTimeline_presult::read(::apache::thrift::p
   return xfer;
 }
 
-void HomeTimelineServiceClient::ReadHomeTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier)
+
+HomeTimelineService_WriteHomeTimelines_args::~HomeTimelineService_WriteHomeTimelines_args() throw() {
+}
+
+
+uint32_t HomeTimelineService_WriteHomeTimelines_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->req_id);
+          this->__isset.req_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->post_ids.clear();
+            uint32_t _size400;
+            ::apache::thrift::protocol::TType _etype403;
+            xfer += iprot->readListBegin(_etype403, _size400);
+            this->post_ids.resize(_size400);
+            uint32_t _i404;
+            for (_i404 = 0; _i404 < _size400; ++_i404)
+            {
+              xfer += iprot->readI64(this->post_ids[_i404]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.post_ids = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->user_ids.clear();
+            uint32_t _size405;
+            ::apache::thrift::protocol::TType _etype408;
+            xfer += iprot->readListBegin(_etype408, _size405);
+            this->user_ids.resize(_size405);
+            uint32_t _i409;
+            for (_i409 = 0; _i409 < _size405; ++_i409)
+            {
+              xfer += iprot->readI64(this->user_ids[_i409]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.user_ids = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->timestamps.clear();
+            uint32_t _size410;
+            ::apache::thrift::protocol::TType _etype413;
+            xfer += iprot->readListBegin(_etype413, _size410);
+            this->timestamps.resize(_size410);
+            uint32_t _i414;
+            for (_i414 = 0; _i414 < _size410; ++_i414)
+            {
+              xfer += iprot->readI64(this->timestamps[_i414]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.timestamps = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->user_mentions_ids.clear();
+            uint32_t _size415;
+            ::apache::thrift::protocol::TType _etype418;
+            xfer += iprot->readListBegin(_etype418, _size415);
+            this->user_mentions_ids.resize(_size415);
+            uint32_t _i419;
+            for (_i419 = 0; _i419 < _size415; ++_i419)
+            {
+              {
+                this->user_mentions_ids[_i419].clear();
+                uint32_t _size420;
+                ::apache::thrift::protocol::TType _etype423;
+                xfer += iprot->readListBegin(_etype423, _size420);
+                this->user_mentions_ids[_i419].resize(_size420);
+                uint32_t _i424;
+                for (_i424 = 0; _i424 < _size420; ++_i424)
+                {
+                  xfer += iprot->readI64(this->user_mentions_ids[_i419][_i424]);
+                }
+                xfer += iprot->readListEnd();
+              }
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.user_mentions_ids = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            this->carrier.clear();
+            uint32_t _size425;
+            ::apache::thrift::protocol::TType _ktype426;
+            ::apache::thrift::protocol::TType _vtype427;
+            xfer += iprot->readMapBegin(_ktype426, _vtype427, _size425);
+            uint32_t _i429;
+            for (_i429 = 0; _i429 < _size425; ++_i429)
+            {
+              std::string _key430;
+              xfer += iprot->readString(_key430);
+              std::string& _val431 = this->carrier[_key430];
+              xfer += iprot->readString(_val431);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.carrier = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t HomeTimelineService_WriteHomeTimelines_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("HomeTimelineService_WriteHomeTimelines_args");
+
+  xfer += oprot->writeFieldBegin("req_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->req_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("post_ids", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->post_ids.size()));
+    std::vector<int64_t> ::const_iterator _iter432;
+    for (_iter432 = this->post_ids.begin(); _iter432 != this->post_ids.end(); ++_iter432)
+    {
+      xfer += oprot->writeI64((*_iter432));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("user_ids", ::apache::thrift::protocol::T_LIST, 3);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->user_ids.size()));
+    std::vector<int64_t> ::const_iterator _iter433;
+    for (_iter433 = this->user_ids.begin(); _iter433 != this->user_ids.end(); ++_iter433)
+    {
+      xfer += oprot->writeI64((*_iter433));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("timestamps", ::apache::thrift::protocol::T_LIST, 4);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->timestamps.size()));
+    std::vector<int64_t> ::const_iterator _iter434;
+    for (_iter434 = this->timestamps.begin(); _iter434 != this->timestamps.end(); ++_iter434)
+    {
+      xfer += oprot->writeI64((*_iter434));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("user_mentions_ids", ::apache::thrift::protocol::T_LIST, 5);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_LIST, static_cast<uint32_t>(this->user_mentions_ids.size()));
+    std::vector<std::vector<int64_t> > ::const_iterator _iter435;
+    for (_iter435 = this->user_mentions_ids.begin(); _iter435 != this->user_mentions_ids.end(); ++_iter435)
+    {
+      {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>((*_iter435).size()));
+        std::vector<int64_t> ::const_iterator _iter436;
+        for (_iter436 = (*_iter435).begin(); _iter436 != (*_iter435).end(); ++_iter436)
+        {
+          xfer += oprot->writeI64((*_iter436));
+        }
+        xfer += oprot->writeListEnd();
+      }
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 6);
+  {
+    xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
+    std::map<std::string, std::string> ::const_iterator _iter437;
+    for (_iter437 = this->carrier.begin(); _iter437 != this->carrier.end(); ++_iter437)
+    {
+      xfer += oprot->writeString(_iter437->first);
+      xfer += oprot->writeString(_iter437->second);
+    }
+    xfer += oprot->writeMapEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+HomeTimelineService_WriteHomeTimelines_pargs::~HomeTimelineService_WriteHomeTimelines_pargs() throw() {
+}
+
+
+uint32_t HomeTimelineService_WriteHomeTimelines_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("HomeTimelineService_WriteHomeTimelines_pargs");
+
+  xfer += oprot->writeFieldBegin("req_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64((*(this->req_id)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("post_ids", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>((*(this->post_ids)).size()));
+    std::vector<int64_t> ::const_iterator _iter438;
+    for (_iter438 = (*(this->post_ids)).begin(); _iter438 != (*(this->post_ids)).end(); ++_iter438)
+    {
+      xfer += oprot->writeI64((*_iter438));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("user_ids", ::apache::thrift::protocol::T_LIST, 3);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>((*(this->user_ids)).size()));
+    std::vector<int64_t> ::const_iterator _iter439;
+    for (_iter439 = (*(this->user_ids)).begin(); _iter439 != (*(this->user_ids)).end(); ++_iter439)
+    {
+      xfer += oprot->writeI64((*_iter439));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("timestamps", ::apache::thrift::protocol::T_LIST, 4);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>((*(this->timestamps)).size()));
+    std::vector<int64_t> ::const_iterator _iter440;
+    for (_iter440 = (*(this->timestamps)).begin(); _iter440 != (*(this->timestamps)).end(); ++_iter440)
+    {
+      xfer += oprot->writeI64((*_iter440));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("user_mentions_ids", ::apache::thrift::protocol::T_LIST, 5);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_LIST, static_cast<uint32_t>((*(this->user_mentions_ids)).size()));
+    std::vector<std::vector<int64_t> > ::const_iterator _iter441;
+    for (_iter441 = (*(this->user_mentions_ids)).begin(); _iter441 != (*(this->user_mentions_ids)).end(); ++_iter441)
+    {
+      {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>((*_iter441).size()));
+        std::vector<int64_t> ::const_iterator _iter442;
+        for (_iter442 = (*_iter441).begin(); _iter442 != (*_iter441).end(); ++_iter442)
+        {
+          xfer += oprot->writeI64((*_iter442));
+        }
+        xfer += oprot->writeListEnd();
+      }
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 6);
+  {
+    xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
+    std::map<std::string, std::string> ::const_iterator _iter443;
+    for (_iter443 = (*(this->carrier)).begin(); _iter443 != (*(this->carrier)).end(); ++_iter443)
+    {
+      xfer += oprot->writeString(_iter443->first);
+      xfer += oprot->writeString(_iter443->second);
+    }
+    xfer += oprot->writeMapEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+HomeTimelineService_WriteHomeTimelines_result::~HomeTimelineService_WriteHomeTimelines_result() throw() {
+}
+
+
+uint32_t HomeTimelineService_WriteHomeTimelines_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->se.read(iprot);
+          this->__isset.se = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t HomeTimelineService_WriteHomeTimelines_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("HomeTimelineService_WriteHomeTimelines_result");
+
+  if (this->__isset.se) {
+    xfer += oprot->writeFieldBegin("se", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->se.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+HomeTimelineService_WriteHomeTimelines_presult::~HomeTimelineService_WriteHomeTimelines_presult() throw() {
+}
+
+
+uint32_t HomeTimelineService_WriteHomeTimelines_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->se.read(iprot);
+          this->__isset.se = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+void HomeTimelineServiceClient::ReadHomeTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields)
 {
-  send_ReadHomeTimeline(req_id, user_id, start, stop, carrier);
+  send_ReadHomeTimeline(req_id, user_id, start, stop, carrier, fields);
   recv_ReadHomeTimeline(_return);
 }
 
-void HomeTimelineServiceClient::send_ReadHomeTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier)
+void HomeTimelineServiceClient::send_ReadHomeTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields)
 {
   int32_t cseqid = 0;
   oprot_->writeMessageBegin("ReadHomeTimeline", ::apache::thrift::protocol::T_CALL, cseqid);
@@ -689,6 +1145,7 @@ void HomeTimelineServiceClient::send_ReadHomeTimeline(const int64_t req_id, cons
   args.start = &start;
   args.stop = &stop;
   args.carrier = &carrier;
+  args.fields = &fields;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -798,6 +1255,67 @@ void HomeTimelineServiceClient::recv_WriteHomeTimeline()
   return;
 }
 
+void HomeTimelineServiceClient::WriteHomeTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::vector<std::vector<int64_t> > & user_mentions_ids, const std::map<std::string, std::string> & carrier)
+{
+  send_WriteHomeTimelines(req_id, post_ids, user_ids, timestamps, user_mentions_ids, carrier);
+  recv_WriteHomeTimelines();
+}
+
+void HomeTimelineServiceClient::send_WriteHomeTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::vector<std::vector<int64_t> > & user_mentions_ids, const std::map<std::string, std::string> & carrier)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("WriteHomeTimelines", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  HomeTimelineService_WriteHomeTimelines_pargs args;
+  args.req_id = &req_id;
+  args.post_ids = &post_ids;
+  args.user_ids = &user_ids;
+  args.timestamps = &timestamps;
+  args.user_mentions_ids = &user_mentions_ids;
+  args.carrier = &carrier;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void HomeTimelineServiceClient::recv_WriteHomeTimelines()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("WriteHomeTimelines") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  HomeTimelineService_WriteHomeTimelines_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.se) {
+    throw result.se;
+  }
+  return;
+}
+
 bool HomeTimelineServiceProcessor::dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext) {
   ProcessMap::iterator pfn;
   pfn = processMap_.find(fname);
@@ -840,7 +1358,7 @@ void HomeTimelineServiceProcessor::process_ReadHomeTimeline(int32_t seqid, ::apa
 
   HomeTimelineService_ReadHomeTimeline_result result;
   try {
-    iface_->ReadHomeTimeline(result.success, args.req_id, args.user_id, args.start, args.stop, args.carrier);
+    iface_->ReadHomeTimeline(result.success, args.req_id, args.user_id, args.start, args.stop, args.carrier, args.fields);
     result.__isset.success = true;
   } catch (ServiceException &se) {
     result.se = se;
@@ -930,6 +1448,62 @@ void HomeTimelineServiceProcessor::process_WriteHomeTimeline(int32_t seqid, ::ap
   }
 }
 
+void HomeTimelineServiceProcessor::process_WriteHomeTimelines(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("HomeTimelineService.WriteHomeTimelines", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "HomeTimelineService.WriteHomeTimelines");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "HomeTimelineService.WriteHomeTimelines");
+  }
+
+  HomeTimelineService_WriteHomeTimelines_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "HomeTimelineService.WriteHomeTimelines", bytes);
+  }
+
+  HomeTimelineService_WriteHomeTimelines_result result;
+  try {
+    iface_->WriteHomeTimelines(args.req_id, args.post_ids, args.user_ids, args.timestamps, args.user_mentions_ids, args.carrier);
+  } catch (ServiceException &se) {
+    result.se = se;
+    result.__isset.se = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "HomeTimelineService.WriteHomeTimelines");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("WriteHomeTimelines", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "HomeTimelineService.WriteHomeTimelines");
+  }
+
+  oprot->writeMessageBegin("WriteHomeTimelines", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "HomeTimelineService.WriteHomeTimelines", bytes);
+  }
+}
+
 ::apache::thrift::stdcxx::shared_ptr< ::apache::thrift::TProcessor > HomeTimelineServiceProcessorFactory::getProcessor(const ::apache::thrift::TConnectionInfo& connInfo) {
   ::apache::thrift::ReleaseHandler< HomeTimelineServiceIfFactory > cleanup(handlerFactory_);
   ::apache::thrift::stdcxx::shared_ptr< HomeTimelineServiceIf > handler(handlerFactory_->getHandler(connInfo), cleanup);
@@ -937,13 +1511,13 @@ void HomeTimelineServiceProcessor::process_WriteHomeTimeline(int32_t seqid, ::ap
   return processor;
 }
 
-void HomeTimelineServiceConcurrentClient::ReadHomeTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier)
+void HomeTimelineServiceConcurrentClient::ReadHomeTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields)
 {
-  int32_t seqid = send_ReadHomeTimeline(req_id, user_id, start, stop, carrier);
+  int32_t seqid = send_ReadHomeTimeline(req_id, user_id, start, stop, carrier, fields);
   recv_ReadHomeTimeline(_return, seqid);
 }
 
-int32_t HomeTimelineServiceConcurrentClient::send_ReadHomeTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier)
+int32_t HomeTimelineServiceConcurrentClient::send_ReadHomeTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields)
 {
   int32_t cseqid = this->sync_.generateSeqId();
   ::apache::thrift::async::TConcurrentSendSentry sentry(&this->sync_);
@@ -955,6 +1529,7 @@ int32_t HomeTimelineServiceConcurrentClient::send_ReadHomeTimeline(const int64_t
   args.start = &start;
   args.stop = &stop;
   args.carrier = &carrier;
+  args.fields = &fields;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -1116,5 +1691,92 @@ void HomeTimelineServiceConcurrentClient::recv_WriteHomeTimeline(const int32_t s
   } // end while(true)
 }
 
+void HomeTimelineServiceConcurrentClient::WriteHomeTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::vector<std::vector<int64_t> > & user_mentions_ids, const std::map<std::string, std::string> & carrier)
+{
+  int32_t seqid = send_WriteHomeTimelines(req_id, post_ids, user_ids, timestamps, user_mentions_ids, carrier);
+  recv_WriteHomeTimelines(seqid);
+}
+
+int32_t HomeTimelineServiceConcurrentClient::send_WriteHomeTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::vector<std::vector<int64_t> > & user_mentions_ids, const std::map<std::string, std::string> & carrier)
+{
+  int32_t cseqid = this->sync_.generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(&this->sync_);
+  oprot_->writeMessageBegin("WriteHomeTimelines", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  HomeTimelineService_WriteHomeTimelines_pargs args;
+  args.req_id = &req_id;
+  args.post_ids = &post_ids;
+  args.user_ids = &user_ids;
+  args.timestamps = &timestamps;
+  args.user_mentions_ids = &user_mentions_ids;
+  args.carrier = &carrier;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void HomeTimelineServiceConcurrentClient::recv_WriteHomeTimelines(const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(&this->sync_, seqid);
+
+  while(true) {
+    if(!this->sync_.getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("WriteHomeTimelines") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      HomeTimelineService_WriteHomeTimelines_presult result;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.se) {
+        sentry.commit();
+        throw result.se;
+      }
+      sentry.commit();
+      return;
+    }
+    // seqid != rseqid
+    this->sync_.updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_.waitForWork(seqid);
+  } // end while(true)
+}
+
 } // namespace
 
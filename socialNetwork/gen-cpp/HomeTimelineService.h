@@ -21,8 +21,9 @@ namespace social_network {
 class HomeTimelineServiceIf {
  public:
   virtual ~HomeTimelineServiceIf() {}
-  virtual void ReadHomeTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void ReadHomeTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields) = 0;
   virtual void WriteHomeTimeline(const int64_t req_id, const int64_t post_id, const int64_t user_id, const int64_t timestamp, const std::vector<int64_t> & user_mentions_id, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void WriteHomeTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::vector<std::vector<int64_t> > & user_mentions_ids, const std::map<std::string, std::string> & carrier) = 0;
 };
 
 class HomeTimelineServiceIfFactory {
@@ -52,21 +53,25 @@ class HomeTimelineServiceIfSingletonFactory : virtual public HomeTimelineService
 class HomeTimelineServiceNull : virtual public HomeTimelineServiceIf {
  public:
   virtual ~HomeTimelineServiceNull() {}
-  void ReadHomeTimeline(std::vector<Post> & /* _return */, const int64_t /* req_id */, const int64_t /* user_id */, const int32_t /* start */, const int32_t /* stop */, const std::map<std::string, std::string> & /* carrier */) {
+  void ReadHomeTimeline(std::vector<Post> & /* _return */, const int64_t /* req_id */, const int64_t /* user_id */, const int32_t /* start */, const int32_t /* stop */, const std::map<std::string, std::string> & /* carrier */, const int32_t /* fields */) {
     return;
   }
   void WriteHomeTimeline(const int64_t /* req_id */, const int64_t /* post_id */, const int64_t /* user_id */, const int64_t /* timestamp */, const std::vector<int64_t> & /* user_mentions_id */, const std::map<std::string, std::string> & /* carrier */) {
     return;
   }
+  void WriteHomeTimelines(const int64_t /* req_id */, const std::vector<int64_t> & /* post_ids */, const std::vector<int64_t> & /* user_ids */, const std::vector<int64_t> & /* timestamps */, const std::vector<std::vector<int64_t> > & /* user_mentions_ids */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
 };
 
 typedef struct _HomeTimelineService_ReadHomeTimeline_args__isset {
-  _HomeTimelineService_ReadHomeTimeline_args__isset() : req_id(false), user_id(false), start(false), stop(false), carrier(false) {}
+  _HomeTimelineService_ReadHomeTimeline_args__isset() : req_id(false), user_id(false), start(false), stop(false), carrier(false), fields(true) {}
   bool req_id :1;
   bool user_id :1;
   bool start :1;
   bool stop :1;
   bool carrier :1;
+  bool fields :1;
 } _HomeTimelineService_ReadHomeTimeline_args__isset;
 
 class HomeTimelineService_ReadHomeTimeline_args {
@@ -74,7 +79,7 @@ class HomeTimelineService_ReadHomeTimeline_args {
 
   HomeTimelineService_ReadHomeTimeline_args(const HomeTimelineService_ReadHomeTimeline_args&);
   HomeTimelineService_ReadHomeTimeline_args& operator=(const HomeTimelineService_ReadHomeTimeline_args&);
-  HomeTimelineService_ReadHomeTimeline_args() : req_id(0), user_id(0), start(0), stop(0) {
+  HomeTimelineService_ReadHomeTimeline_args() : req_id(0), user_id(0), start(0), stop(0), fields(511) {
   }
 
   virtual ~HomeTimelineService_ReadHomeTimeline_args() throw();
@@ -83,6 +88,7 @@ class HomeTimelineService_ReadHomeTimeline_args {
   int32_t start;
   int32_t stop;
   std::map<std::string, std::string>  carrier;
+  int32_t fields;
 
   _HomeTimelineService_ReadHomeTimeline_args__isset __isset;
 
@@ -96,6 +102,8 @@ class HomeTimelineService_ReadHomeTimeline_args {
 
   void __set_carrier(const std::map<std::string, std::string> & val);
 
+  void __set_fields(const int32_t val);
+
   bool operator == (const HomeTimelineService_ReadHomeTimeline_args & rhs) const
   {
     if (!(req_id == rhs.req_id))
@@ -108,6 +116,8 @@ class HomeTimelineService_ReadHomeTimeline_args {
       return false;
     if (!(carrier == rhs.carrier))
       return false;
+    if (!(fields == rhs.fields))
+      return false;
     return true;
   }
   bool operator != (const HomeTimelineService_ReadHomeTimeline_args &rhs) const {
@@ -132,6 +142,7 @@ class HomeTimelineService_ReadHomeTimeline_pargs {
   const int32_t* start;
   const int32_t* stop;
   const std::map<std::string, std::string> * carrier;
+  const int32_t* fields;
 
   uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
 
@@ -339,6 +350,145 @@ class HomeTimelineService_WriteHomeTimeline_presult {
 
 };
 
+typedef struct _HomeTimelineService_WriteHomeTimelines_args__isset {
+  _HomeTimelineService_WriteHomeTimelines_args__isset() : req_id(false), post_ids(false), user_ids(false), timestamps(false), user_mentions_ids(false), carrier(false) {}
+  bool req_id :1;
+  bool post_ids :1;
+  bool user_ids :1;
+  bool timestamps :1;
+  bool user_mentions_ids :1;
+  bool carrier :1;
+} _HomeTimelineService_WriteHomeTimelines_args__isset;
+
+class HomeTimelineService_WriteHomeTimelines_args {
+ public:
+
+  HomeTimelineService_WriteHomeTimelines_args(const HomeTimelineService_WriteHomeTimelines_args&);
+  HomeTimelineService_WriteHomeTimelines_args& operator=(const HomeTimelineService_WriteHomeTimelines_args&);
+  HomeTimelineService_WriteHomeTimelines_args() : req_id(0) {
+  }
+
+  virtual ~HomeTimelineService_WriteHomeTimelines_args() throw();
+  int64_t req_id;
+  std::vector<int64_t>  post_ids;
+  std::vector<int64_t>  user_ids;
+  std::vector<int64_t>  timestamps;
+  std::vector<std::vector<int64_t> >  user_mentions_ids;
+  std::map<std::string, std::string>  carrier;
+
+  _HomeTimelineService_WriteHomeTimelines_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_post_ids(const std::vector<int64_t> & val);
+
+  void __set_user_ids(const std::vector<int64_t> & val);
+
+  void __set_timestamps(const std::vector<int64_t> & val);
+
+  void __set_user_mentions_ids(const std::vector<std::vector<int64_t> > & val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const HomeTimelineService_WriteHomeTimelines_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(post_ids == rhs.post_ids))
+      return false;
+    if (!(user_ids == rhs.user_ids))
+      return false;
+    if (!(timestamps == rhs.timestamps))
+      return false;
+    if (!(user_mentions_ids == rhs.user_mentions_ids))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const HomeTimelineService_WriteHomeTimelines_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const HomeTimelineService_WriteHomeTimelines_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class HomeTimelineService_WriteHomeTimelines_pargs {
+ public:
+
+
+  virtual ~HomeTimelineService_WriteHomeTimelines_pargs() throw();
+  const int64_t* req_id;
+  const std::vector<int64_t> * post_ids;
+  const std::vector<int64_t> * user_ids;
+  const std::vector<int64_t> * timestamps;
+  const std::vector<std::vector<int64_t> > * user_mentions_ids;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _HomeTimelineService_WriteHomeTimelines_result__isset {
+  _HomeTimelineService_WriteHomeTimelines_result__isset() : se(false) {}
+  bool se :1;
+} _HomeTimelineService_WriteHomeTimelines_result__isset;
+
+class HomeTimelineService_WriteHomeTimelines_result {
+ public:
+
+  HomeTimelineService_WriteHomeTimelines_result(const HomeTimelineService_WriteHomeTimelines_result&);
+  HomeTimelineService_WriteHomeTimelines_result& operator=(const HomeTimelineService_WriteHomeTimelines_result&);
+  HomeTimelineService_WriteHomeTimelines_result() {
+  }
+
+  virtual ~HomeTimelineService_WriteHomeTimelines_result() throw();
+  ServiceException se;
+
+  _HomeTimelineService_WriteHomeTimelines_result__isset __isset;
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const HomeTimelineService_WriteHomeTimelines_result & rhs) const
+  {
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const HomeTimelineService_WriteHomeTimelines_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const HomeTimelineService_WriteHomeTimelines_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _HomeTimelineService_WriteHomeTimelines_presult__isset {
+  _HomeTimelineService_WriteHomeTimelines_presult__isset() : se(false) {}
+  bool se :1;
+} _HomeTimelineService_WriteHomeTimelines_presult__isset;
+
+class HomeTimelineService_WriteHomeTimelines_presult {
+ public:
+
+
+  virtual ~HomeTimelineService_WriteHomeTimelines_presult() throw();
+  ServiceException se;
+
+  _HomeTimelineService_WriteHomeTimelines_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class HomeTimelineServiceClient : virtual public HomeTimelineServiceIf {
  public:
   HomeTimelineServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
@@ -364,12 +514,15 @@ class HomeTimelineServiceClient : virtual public HomeTimelineServiceIf {
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> getOutputProtocol() {
     return poprot_;
   }
-  void ReadHomeTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
-  void send_ReadHomeTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
+  void ReadHomeTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields);
+  void send_ReadHomeTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields);
   void recv_ReadHomeTimeline(std::vector<Post> & _return);
   void WriteHomeTimeline(const int64_t req_id, const int64_t post_id, const int64_t user_id, const int64_t timestamp, const std::vector<int64_t> & user_mentions_id, const std::map<std::string, std::string> & carrier);
   void send_WriteHomeTimeline(const int64_t req_id, const int64_t post_id, const int64_t user_id, const int64_t timestamp, const std::vector<int64_t> & user_mentions_id, const std::map<std::string, std::string> & carrier);
   void recv_WriteHomeTimeline();
+  void WriteHomeTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::vector<std::vector<int64_t> > & user_mentions_ids, const std::map<std::string, std::string> & carrier);
+  void send_WriteHomeTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::vector<std::vector<int64_t> > & user_mentions_ids, const std::map<std::string, std::string> & carrier);
+  void recv_WriteHomeTimelines();
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -387,11 +540,13 @@ class HomeTimelineServiceProcessor : public ::apache::thrift::TDispatchProcessor
   ProcessMap processMap_;
   void process_ReadHomeTimeline(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_WriteHomeTimeline(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_WriteHomeTimelines(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   HomeTimelineServiceProcessor(::apache::thrift::stdcxx::shared_ptr<HomeTimelineServiceIf> iface) :
     iface_(iface) {
     processMap_["ReadHomeTimeline"] = &HomeTimelineServiceProcessor::process_ReadHomeTimeline;
     processMap_["WriteHomeTimeline"] = &HomeTimelineServiceProcessor::process_WriteHomeTimeline;
+    processMap_["WriteHomeTimelines"] = &HomeTimelineServiceProcessor::process_WriteHomeTimelines;
   }
 
   virtual ~HomeTimelineServiceProcessor() {}
@@ -420,13 +575,13 @@ class HomeTimelineServiceMultiface : virtual public HomeTimelineServiceIf {
     ifaces_.push_back(iface);
   }
  public:
-  void ReadHomeTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier) {
+  void ReadHomeTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields) {
     size_t sz = ifaces_.size();
     size_t i = 0;
     for (; i < (sz - 1); ++i) {
-      ifaces_[i]->ReadHomeTimeline(_return, req_id, user_id, start, stop, carrier);
+      ifaces_[i]->ReadHomeTimeline(_return, req_id, user_id, start, stop, carrier, fields);
     }
-    ifaces_[i]->ReadHomeTimeline(_return, req_id, user_id, start, stop, carrier);
+    ifaces_[i]->ReadHomeTimeline(_return, req_id, user_id, start, stop, carrier, fields);
     return;
   }
 
@@ -439,6 +594,15 @@ class HomeTimelineServiceMultiface : virtual public HomeTimelineServiceIf {
     ifaces_[i]->WriteHomeTimeline(req_id, post_id, user_id, timestamp, user_mentions_id, carrier);
   }
 
+  void WriteHomeTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::vector<std::vector<int64_t> > & user_mentions_ids, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->WriteHomeTimelines(req_id, post_ids, user_ids, timestamps, user_mentions_ids, carrier);
+    }
+    ifaces_[i]->WriteHomeTimelines(req_id, post_ids, user_ids, timestamps, user_mentions_ids, carrier);
+  }
+
 };
 
 // The 'concurrent' client is a thread safe client that correctly handles
@@ -469,12 +633,15 @@ class HomeTimelineServiceConcurrentClient : virtual public HomeTimelineServiceIf
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> getOutputProtocol() {
     return poprot_;
   }
-  void ReadHomeTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
-  int32_t send_ReadHomeTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
+  void ReadHomeTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields);
+  int32_t send_ReadHomeTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields);
   void recv_ReadHomeTimeline(std::vector<Post> & _return, const int32_t seqid);
   void WriteHomeTimeline(const int64_t req_id, const int64_t post_id, const int64_t user_id, const int64_t timestamp, const std::vector<int64_t> & user_mentions_id, const std::map<std::string, std::string> & carrier);
   int32_t send_WriteHomeTimeline(const int64_t req_id, const int64_t post_id, const int64_t user_id, const int64_t timestamp, const std::vector<int64_t> & user_mentions_id, const std::map<std::string, std::string> & carrier);
   void recv_WriteHomeTimeline(const int32_t seqid);
+  void WriteHomeTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::vector<std::vector<int64_t> > & user_mentions_ids, const std::map<std::string, std::string> & carrier);
+  int32_t send_WriteHomeTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::vector<std::vector<int64_t> > & user_mentions_ids, const std::map<std::string, std::string> & carrier);
+  void recv_WriteHomeTimelines(const int32_t seqid);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -23,7 +23,8 @@ class PostStorageServiceIf {
   virtual ~PostStorageServiceIf() {}
   virtual void StorePost(const int64_t req_id, const Post& post, const std::map<std::string, std::string> & carrier) = 0;
   virtual void ReadPost(Post& _return, const int64_t req_id, const int64_t post_id, const std::map<std::string, std::string> & carrier) = 0;
-  virtual void ReadPosts(std::vector<Post> & _return, const int64_t req_id, const std::vector<int64_t> & post_ids, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void ReadPosts(std::vector<Post> & _return, const int64_t req_id, const std::vector<int64_t> & post_ids, const std::map<std::string, std::string> & carrier, const int32_t fields) = 0;
+  virtual void StorePosts(std::vector<std::string> & _return, const int64_t req_id, const std::vector<Post> & posts, const std::map<std::string, std::string> & carrier) = 0;
 };
 
 class PostStorageServiceIfFactory {
@@ -59,7 +60,10 @@ class PostStorageServiceNull : virtual public PostStorageServiceIf {
   void ReadPost(Post& /* _return */, const int64_t /* req_id */, const int64_t /* post_id */, const std::map<std::string, std::string> & /* carrier */) {
     return;
   }
-  void ReadPosts(std::vector<Post> & /* _return */, const int64_t /* req_id */, const std::vector<int64_t> & /* post_ids */, const std::map<std::string, std::string> & /* carrier */) {
+  void ReadPosts(std::vector<Post> & /* _return */, const int64_t /* req_id */, const std::vector<int64_t> & /* post_ids */, const std::map<std::string, std::string> & /* carrier */, const int32_t /* fields */) {
+    return;
+  }
+  void StorePosts(std::vector<std::string> & /* _return */, const int64_t /* req_id */, const std::vector<Post> & /* posts */, const std::map<std::string, std::string> & /* carrier */) {
     return;
   }
 };
@@ -309,10 +313,11 @@ class PostStorageService_ReadPost_presult {
 };
 
 typedef struct _PostStorageService_ReadPosts_args__isset {
-  _PostStorageService_ReadPosts_args__isset() : req_id(false), post_ids(false), carrier(false) {}
+  _PostStorageService_ReadPosts_args__isset() : req_id(false), post_ids(false), carrier(false), fields(true) {}
   bool req_id :1;
   bool post_ids :1;
   bool carrier :1;
+  bool fields :1;
 } _PostStorageService_ReadPosts_args__isset;
 
 class PostStorageService_ReadPosts_args {
@@ -320,13 +325,14 @@ class PostStorageService_ReadPosts_args {
 
   PostStorageService_ReadPosts_args(const PostStorageService_ReadPosts_args&);
   PostStorageService_ReadPosts_args& operator=(const PostStorageService_ReadPosts_args&);
-  PostStorageService_ReadPosts_args() : req_id(0) {
+  PostStorageService_ReadPosts_args() : req_id(0), fields(511) {
   }
 
   virtual ~PostStorageService_ReadPosts_args() throw();
   int64_t req_id;
   std::vector<int64_t>  post_ids;
   std::map<std::string, std::string>  carrier;
+  int32_t fields;
 
   _PostStorageService_ReadPosts_args__isset __isset;
 
@@ -336,6 +342,8 @@ class PostStorageService_ReadPosts_args {
 
   void __set_carrier(const std::map<std::string, std::string> & val);
 
+  void __set_fields(const int32_t val);
+
   bool operator == (const PostStorageService_ReadPosts_args & rhs) const
   {
     if (!(req_id == rhs.req_id))
@@ -344,6 +352,8 @@ class PostStorageService_ReadPosts_args {
       return false;
     if (!(carrier == rhs.carrier))
       return false;
+    if (!(fields == rhs.fields))
+      return false;
     return true;
   }
   bool operator != (const PostStorageService_ReadPosts_args &rhs) const {
@@ -366,6 +376,7 @@ class PostStorageService_ReadPosts_pargs {
   const int64_t* req_id;
   const std::vector<int64_t> * post_ids;
   const std::map<std::string, std::string> * carrier;
+  const int32_t* fields;
 
   uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
 
@@ -434,6 +445,132 @@ class PostStorageService_ReadPosts_presult {
 
 };
 
+typedef struct _PostStorageService_StorePosts_args__isset {
+  _PostStorageService_StorePosts_args__isset() : req_id(false), posts(false), carrier(false) {}
+  bool req_id :1;
+  bool posts :1;
+  bool carrier :1;
+} _PostStorageService_StorePosts_args__isset;
+
+class PostStorageService_StorePosts_args {
+ public:
+
+  PostStorageService_StorePosts_args(const PostStorageService_StorePosts_args&);
+  PostStorageService_StorePosts_args& operator=(const PostStorageService_StorePosts_args&);
+  PostStorageService_StorePosts_args() : req_id(0) {
+  }
+
+  virtual ~PostStorageService_StorePosts_args() throw();
+  int64_t req_id;
+  std::vector<Post>  posts;
+  std::map<std::string, std::string>  carrier;
+
+  _PostStorageService_StorePosts_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_posts(const std::vector<Post> & val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const PostStorageService_StorePosts_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(posts == rhs.posts))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const PostStorageService_StorePosts_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const PostStorageService_StorePosts_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class PostStorageService_StorePosts_pargs {
+ public:
+
+
+  virtual ~PostStorageService_StorePosts_pargs() throw();
+  const int64_t* req_id;
+  const std::vector<Post> * posts;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _PostStorageService_StorePosts_result__isset {
+  _PostStorageService_StorePosts_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _PostStorageService_StorePosts_result__isset;
+
+class PostStorageService_StorePosts_result {
+ public:
+
+  PostStorageService_StorePosts_result(const PostStorageService_StorePosts_result&);
+  PostStorageService_StorePosts_result& operator=(const PostStorageService_StorePosts_result&);
+  PostStorageService_StorePosts_result() {
+  }
+
+  virtual ~PostStorageService_StorePosts_result() throw();
+  std::vector<std::string>  success;
+  ServiceException se;
+
+  _PostStorageService_StorePosts_result__isset __isset;
+
+  void __set_success(const std::vector<std::string> & val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const PostStorageService_StorePosts_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const PostStorageService_StorePosts_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const PostStorageService_StorePosts_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _PostStorageService_StorePosts_presult__isset {
+  _PostStorageService_StorePosts_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _PostStorageService_StorePosts_presult__isset;
+
+class PostStorageService_StorePosts_presult {
+ public:
+
+
+  virtual ~PostStorageService_StorePosts_presult() throw();
+  std::vector<std::string> * success;
+  ServiceException se;
+
+  _PostStorageService_StorePosts_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class PostStorageServiceClient : virtual public PostStorageServiceIf {
  public:
   PostStorageServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
@@ -465,9 +602,12 @@ class PostStorageServiceClient : virtual public PostStorageServiceIf {
   void ReadPost(Post& _return, const int64_t req_id, const int64_t post_id, const std::map<std::string, std::string> & carrier);
   void send_ReadPost(const int64_t req_id, const int64_t post_id, const std::map<std::string, std::string> & carrier);
   void recv_ReadPost(Post& _return);
-  void ReadPosts(std::vector<Post> & _return, const int64_t req_id, const std::vector<int64_t> & post_ids, const std::map<std::string, std::string> & carrier);
-  void send_ReadPosts(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::map<std::string, std::string> & carrier);
+  void ReadPosts(std::vector<Post> & _return, const int64_t req_id, const std::vector<int64_t> & post_ids, const std::map<std::string, std::string> & carrier, const int32_t fields);
+  void send_ReadPosts(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::map<std::string, std::string> & carrier, const int32_t fields);
   void recv_ReadPosts(std::vector<Post> & _return);
+  void StorePosts(std::vector<std::string> & _return, const int64_t req_id, const std::vector<Post> & posts, const std::map<std::string, std::string> & carrier);
+  void send_StorePosts(const int64_t req_id, const std::vector<Post> & posts, const std::map<std::string, std::string> & carrier);
+  void recv_StorePosts(std::vector<std::string> & _return);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -486,12 +626,14 @@ class PostStorageServiceProcessor : public ::apache::thrift::TDispatchProcessor
   void process_StorePost(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_ReadPost(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_ReadPosts(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_StorePosts(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   PostStorageServiceProcessor(::apache::thrift::stdcxx::shared_ptr<PostStorageServiceIf> iface) :
     iface_(iface) {
     processMap_["StorePost"] = &PostStorageServiceProcessor::process_StorePost;
     processMap_["ReadPost"] = &PostStorageServiceProcessor::process_ReadPost;
     processMap_["ReadPosts"] = &PostStorageServiceProcessor::process_ReadPosts;
+    processMap_["StorePosts"] = &PostStorageServiceProcessor::process_StorePosts;
   }
 
   virtual ~PostStorageServiceProcessor() {}
@@ -539,13 +681,23 @@ class PostStorageServiceMultiface : virtual public PostStorageServiceIf {
     return;
   }
 
-  void ReadPosts(std::vector<Post> & _return, const int64_t req_id, const std::vector<int64_t> & post_ids, const std::map<std::string, std::string> & carrier) {
+  void ReadPosts(std::vector<Post> & _return, const int64_t req_id, const std::vector<int64_t> & post_ids, const std::map<std::string, std::string> & carrier, const int32_t fields) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->ReadPosts(_return, req_id, post_ids, carrier, fields);
+    }
+    ifaces_[i]->ReadPosts(_return, req_id, post_ids, carrier, fields);
+    return;
+  }
+
+  void StorePosts(std::vector<std::string> & _return, const int64_t req_id, const std::vector<Post> & posts, const std::map<std::string, std::string> & carrier) {
     size_t sz = ifaces_.size();
     size_t i = 0;
     for (; i < (sz - 1); ++i) {
-      ifaces_[i]->ReadPosts(_return, req_id, post_ids, carrier);
+      ifaces_[i]->StorePosts(_return, req_id, posts, carrier);
     }
-    ifaces_[i]->ReadPosts(_return, req_id, post_ids, carrier);
+    ifaces_[i]->StorePosts(_return, req_id, posts, carrier);
     return;
   }
 
@@ -585,9 +737,12 @@ class PostStorageServiceConcurrentClient : virtual public PostStorageServiceIf {
   void ReadPost(Post& _return, const int64_t req_id, const int64_t post_id, const std::map<std::string, std::string> & carrier);
   int32_t send_ReadPost(const int64_t req_id, const int64_t post_id, const std::map<std::string, std::string> & carrier);
   void recv_ReadPost(Post& _return, const int32_t seqid);
-  void ReadPosts(std::vector<Post> & _return, const int64_t req_id, const std::vector<int64_t> & post_ids, const std::map<std::string, std::string> & carrier);
-  int32_t send_ReadPosts(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::map<std::string, std::string> & carrier);
+  void ReadPosts(std::vector<Post> & _return, const int64_t req_id, const std::vector<int64_t> & post_ids, const std::map<std::string, std::string> & carrier, const int32_t fields);
+  int32_t send_ReadPosts(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::map<std::string, std::string> & carrier, const int32_t fields);
   void recv_ReadPosts(std::vector<Post> & _return, const int32_t seqid);
+  void StorePosts(std::vector<std::string> & _return, const int64_t req_id, const std::vector<Post> & posts, const std::map<std::string, std::string> & carrier);
+  int32_t send_StorePosts(const int64_t req_id, const std::vector<Post> & posts, const std::map<std::string, std::string> & carrier);
+  void recv_StorePosts(std::vector<std::string> & _return, const int32_t seqid);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
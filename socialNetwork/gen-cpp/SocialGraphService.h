@@ -28,6 +28,14 @@ class SocialGraphServiceIf {
   virtual void FollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier) = 0;
   virtual void UnfollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier) = 0;
   virtual void InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void FollowMany(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void UnfollowMany(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void GetMutualFollows(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t other_user_id, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void GetFollowersInCommon(std::vector<int64_t> & _return, const int64_t req_id, const std::vector<int64_t> & user_ids, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void IsFollowing(std::vector<bool> & _return, const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier) = 0;
+  virtual int64_t GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void GetFollowersPage(FollowersPage& _return, const int64_t req_id, const int64_t user_id, const int64_t after_timestamp, const int64_t after_user_id, const int32_t limit, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void InsertUsers(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::map<std::string, std::string> & carrier) = 0;
 };
 
 class SocialGraphServiceIfFactory {
@@ -78,6 +86,31 @@ class SocialGraphServiceNull : virtual public SocialGraphServiceIf {
   void InsertUser(const int64_t /* req_id */, const int64_t /* user_id */, const std::map<std::string, std::string> & /* carrier */) {
     return;
   }
+  void FollowMany(const int64_t /* req_id */, const std::vector<int64_t> & /* user_ids */, const std::vector<int64_t> & /* followee_ids */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
+  void UnfollowMany(const int64_t /* req_id */, const std::vector<int64_t> & /* user_ids */, const std::vector<int64_t> & /* followee_ids */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
+  void GetMutualFollows(std::vector<int64_t> & /* _return */, const int64_t /* req_id */, const int64_t /* user_id */, const int64_t /* other_user_id */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
+  void GetFollowersInCommon(std::vector<int64_t> & /* _return */, const int64_t /* req_id */, const std::vector<int64_t> & /* user_ids */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
+  void IsFollowing(std::vector<bool> & /* _return */, const int64_t /* req_id */, const std::vector<int64_t> & /* user_ids */, const std::vector<int64_t> & /* followee_ids */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
+  int64_t GetFollowerCount(const int64_t /* req_id */, const int64_t /* user_id */, const std::map<std::string, std::string> & /* carrier */) {
+    int64_t _return = 0;
+    return _return;
+  }
+  void GetFollowersPage(FollowersPage& /* _return */, const int64_t /* req_id */, const int64_t /* user_id */, const int64_t /* after_timestamp */, const int64_t /* after_user_id */, const int32_t /* limit */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
+  void InsertUsers(const int64_t /* req_id */, const std::vector<int64_t> & /* user_ids */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
 };
 
 typedef struct _SocialGraphService_GetFollowers_args__isset {
@@ -950,166 +983,1239 @@ class SocialGraphService_InsertUser_presult {
 
 };
 
-class SocialGraphServiceClient : virtual public SocialGraphServiceIf {
+typedef struct _SocialGraphService_FollowMany_args__isset {
+  _SocialGraphService_FollowMany_args__isset() : req_id(false), user_ids(false), followee_ids(false), carrier(false) {}
+  bool req_id :1;
+  bool user_ids :1;
+  bool followee_ids :1;
+  bool carrier :1;
+} _SocialGraphService_FollowMany_args__isset;
+
+class SocialGraphService_FollowMany_args {
  public:
-  SocialGraphServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
-    setProtocol(prot);
-  }
-  SocialGraphServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
-    setProtocol(iprot,oprot);
+
+  SocialGraphService_FollowMany_args(const SocialGraphService_FollowMany_args&);
+  SocialGraphService_FollowMany_args& operator=(const SocialGraphService_FollowMany_args&);
+  SocialGraphService_FollowMany_args() : req_id(0) {
   }
- private:
-  void setProtocol(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
-  setProtocol(prot,prot);
+
+  virtual ~SocialGraphService_FollowMany_args() throw();
+  int64_t req_id;
+  std::vector<int64_t>  user_ids;
+  std::vector<int64_t>  followee_ids;
+  std::map<std::string, std::string>  carrier;
+
+  _SocialGraphService_FollowMany_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_user_ids(const std::vector<int64_t> & val);
+
+  void __set_followee_ids(const std::vector<int64_t> & val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const SocialGraphService_FollowMany_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(user_ids == rhs.user_ids))
+      return false;
+    if (!(followee_ids == rhs.followee_ids))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
   }
-  void setProtocol(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
-    piprot_=iprot;
-    poprot_=oprot;
-    iprot_ = iprot.get();
-    oprot_ = oprot.get();
+  bool operator != (const SocialGraphService_FollowMany_args &rhs) const {
+    return !(*this == rhs);
   }
+
+  bool operator < (const SocialGraphService_FollowMany_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class SocialGraphService_FollowMany_pargs {
  public:
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> getInputProtocol() {
-    return piprot_;
-  }
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> getOutputProtocol() {
-    return poprot_;
-  }
-  void GetFollowers(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
-  void send_GetFollowers(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
-  void recv_GetFollowers(std::vector<int64_t> & _return);
-  void GetFollowees(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
-  void send_GetFollowees(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
-  void recv_GetFollowees(std::vector<int64_t> & _return);
-  void Follow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier);
-  void send_Follow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier);
-  void recv_Follow();
-  void Unfollow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier);
-  void send_Unfollow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier);
-  void recv_Unfollow();
-  void FollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier);
-  void send_FollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier);
-  void recv_FollowWithUsername();
-  void UnfollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier);
-  void send_UnfollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier);
-  void recv_UnfollowWithUsername();
-  void InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
-  void send_InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
-  void recv_InsertUser();
- protected:
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
-  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
-  ::apache::thrift::protocol::TProtocol* iprot_;
-  ::apache::thrift::protocol::TProtocol* oprot_;
+
+
+  virtual ~SocialGraphService_FollowMany_pargs() throw();
+  const int64_t* req_id;
+  const std::vector<int64_t> * user_ids;
+  const std::vector<int64_t> * followee_ids;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
 };
 
-class SocialGraphServiceProcessor : public ::apache::thrift::TDispatchProcessor {
- protected:
-  ::apache::thrift::stdcxx::shared_ptr<SocialGraphServiceIf> iface_;
-  virtual bool dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext);
- private:
-  typedef  void (SocialGraphServiceProcessor::*ProcessFunction)(int32_t, ::apache::thrift::protocol::TProtocol*, ::apache::thrift::protocol::TProtocol*, void*);
-  typedef std::map<std::string, ProcessFunction> ProcessMap;
-  ProcessMap processMap_;
-  void process_GetFollowers(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_GetFollowees(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_Follow(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_Unfollow(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_FollowWithUsername(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_UnfollowWithUsername(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
-  void process_InsertUser(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+typedef struct _SocialGraphService_FollowMany_result__isset {
+  _SocialGraphService_FollowMany_result__isset() : se(false) {}
+  bool se :1;
+} _SocialGraphService_FollowMany_result__isset;
+
+class SocialGraphService_FollowMany_result {
  public:
-  SocialGraphServiceProcessor(::apache::thrift::stdcxx::shared_ptr<SocialGraphServiceIf> iface) :
-    iface_(iface) {
-    processMap_["GetFollowers"] = &SocialGraphServiceProcessor::process_GetFollowers;
-    processMap_["GetFollowees"] = &SocialGraphServiceProcessor::process_GetFollowees;
-    processMap_["Follow"] = &SocialGraphServiceProcessor::process_Follow;
-    processMap_["Unfollow"] = &SocialGraphServiceProcessor::process_Unfollow;
-    processMap_["FollowWithUsername"] = &SocialGraphServiceProcessor::process_FollowWithUsername;
-    processMap_["UnfollowWithUsername"] = &SocialGraphServiceProcessor::process_UnfollowWithUsername;
-    processMap_["InsertUser"] = &SocialGraphServiceProcessor::process_InsertUser;
+
+  SocialGraphService_FollowMany_result(const SocialGraphService_FollowMany_result&);
+  SocialGraphService_FollowMany_result& operator=(const SocialGraphService_FollowMany_result&);
+  SocialGraphService_FollowMany_result() {
   }
 
-  virtual ~SocialGraphServiceProcessor() {}
+  virtual ~SocialGraphService_FollowMany_result() throw();
+  ServiceException se;
+
+  _SocialGraphService_FollowMany_result__isset __isset;
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const SocialGraphService_FollowMany_result & rhs) const
+  {
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_FollowMany_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_FollowMany_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
 };
 
-class SocialGraphServiceProcessorFactory : public ::apache::thrift::TProcessorFactory {
+typedef struct _SocialGraphService_FollowMany_presult__isset {
+  _SocialGraphService_FollowMany_presult__isset() : se(false) {}
+  bool se :1;
+} _SocialGraphService_FollowMany_presult__isset;
+
+class SocialGraphService_FollowMany_presult {
  public:
-  SocialGraphServiceProcessorFactory(const ::apache::thrift::stdcxx::shared_ptr< SocialGraphServiceIfFactory >& handlerFactory) :
-      handlerFactory_(handlerFactory) {}
 
-  ::apache::thrift::stdcxx::shared_ptr< ::apache::thrift::TProcessor > getProcessor(const ::apache::thrift::TConnectionInfo& connInfo);
 
- protected:
-  ::apache::thrift::stdcxx::shared_ptr< SocialGraphServiceIfFactory > handlerFactory_;
+  virtual ~SocialGraphService_FollowMany_presult() throw();
+  ServiceException se;
+
+  _SocialGraphService_FollowMany_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
 };
 
-class SocialGraphServiceMultiface : virtual public SocialGraphServiceIf {
+typedef struct _SocialGraphService_UnfollowMany_args__isset {
+  _SocialGraphService_UnfollowMany_args__isset() : req_id(false), user_ids(false), followee_ids(false), carrier(false) {}
+  bool req_id :1;
+  bool user_ids :1;
+  bool followee_ids :1;
+  bool carrier :1;
+} _SocialGraphService_UnfollowMany_args__isset;
+
+class SocialGraphService_UnfollowMany_args {
  public:
-  SocialGraphServiceMultiface(std::vector<apache::thrift::stdcxx::shared_ptr<SocialGraphServiceIf> >& ifaces) : ifaces_(ifaces) {
+
+  SocialGraphService_UnfollowMany_args(const SocialGraphService_UnfollowMany_args&);
+  SocialGraphService_UnfollowMany_args& operator=(const SocialGraphService_UnfollowMany_args&);
+  SocialGraphService_UnfollowMany_args() : req_id(0) {
   }
-  virtual ~SocialGraphServiceMultiface() {}
- protected:
-  std::vector<apache::thrift::stdcxx::shared_ptr<SocialGraphServiceIf> > ifaces_;
-  SocialGraphServiceMultiface() {}
-  void add(::apache::thrift::stdcxx::shared_ptr<SocialGraphServiceIf> iface) {
-    ifaces_.push_back(iface);
+
+  virtual ~SocialGraphService_UnfollowMany_args() throw();
+  int64_t req_id;
+  std::vector<int64_t>  user_ids;
+  std::vector<int64_t>  followee_ids;
+  std::map<std::string, std::string>  carrier;
+
+  _SocialGraphService_UnfollowMany_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_user_ids(const std::vector<int64_t> & val);
+
+  void __set_followee_ids(const std::vector<int64_t> & val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const SocialGraphService_UnfollowMany_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(user_ids == rhs.user_ids))
+      return false;
+    if (!(followee_ids == rhs.followee_ids))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
   }
- public:
-  void GetFollowers(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->GetFollowers(_return, req_id, user_id, carrier);
-    }
-    ifaces_[i]->GetFollowers(_return, req_id, user_id, carrier);
-    return;
+  bool operator != (const SocialGraphService_UnfollowMany_args &rhs) const {
+    return !(*this == rhs);
   }
 
-  void GetFollowees(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->GetFollowees(_return, req_id, user_id, carrier);
-    }
-    ifaces_[i]->GetFollowees(_return, req_id, user_id, carrier);
-    return;
-  }
+  bool operator < (const SocialGraphService_UnfollowMany_args & ) const;
 
-  void Follow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->Follow(req_id, user_id, followee_id, carrier);
-    }
-    ifaces_[i]->Follow(req_id, user_id, followee_id, carrier);
-  }
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
 
-  void Unfollow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->Unfollow(req_id, user_id, followee_id, carrier);
-    }
-    ifaces_[i]->Unfollow(req_id, user_id, followee_id, carrier);
-  }
+};
 
-  void FollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->FollowWithUsername(req_id, user_usernmae, followee_username, carrier);
-    }
-    ifaces_[i]->FollowWithUsername(req_id, user_usernmae, followee_username, carrier);
-  }
 
-  void UnfollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier) {
-    size_t sz = ifaces_.size();
-    size_t i = 0;
-    for (; i < (sz - 1); ++i) {
-      ifaces_[i]->UnfollowWithUsername(req_id, user_usernmae, followee_username, carrier);
-    }
-    ifaces_[i]->UnfollowWithUsername(req_id, user_usernmae, followee_username, carrier);
+class SocialGraphService_UnfollowMany_pargs {
+ public:
+
+
+  virtual ~SocialGraphService_UnfollowMany_pargs() throw();
+  const int64_t* req_id;
+  const std::vector<int64_t> * user_ids;
+  const std::vector<int64_t> * followee_ids;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_UnfollowMany_result__isset {
+  _SocialGraphService_UnfollowMany_result__isset() : se(false) {}
+  bool se :1;
+} _SocialGraphService_UnfollowMany_result__isset;
+
+class SocialGraphService_UnfollowMany_result {
+ public:
+
+  SocialGraphService_UnfollowMany_result(const SocialGraphService_UnfollowMany_result&);
+  SocialGraphService_UnfollowMany_result& operator=(const SocialGraphService_UnfollowMany_result&);
+  SocialGraphService_UnfollowMany_result() {
+  }
+
+  virtual ~SocialGraphService_UnfollowMany_result() throw();
+  ServiceException se;
+
+  _SocialGraphService_UnfollowMany_result__isset __isset;
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const SocialGraphService_UnfollowMany_result & rhs) const
+  {
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_UnfollowMany_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_UnfollowMany_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_UnfollowMany_presult__isset {
+  _SocialGraphService_UnfollowMany_presult__isset() : se(false) {}
+  bool se :1;
+} _SocialGraphService_UnfollowMany_presult__isset;
+
+class SocialGraphService_UnfollowMany_presult {
+ public:
+
+
+  virtual ~SocialGraphService_UnfollowMany_presult() throw();
+  ServiceException se;
+
+  _SocialGraphService_UnfollowMany_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _SocialGraphService_GetMutualFollows_args__isset {
+  _SocialGraphService_GetMutualFollows_args__isset() : req_id(false), user_id(false), other_user_id(false), carrier(false) {}
+  bool req_id :1;
+  bool user_id :1;
+  bool other_user_id :1;
+  bool carrier :1;
+} _SocialGraphService_GetMutualFollows_args__isset;
+
+class SocialGraphService_GetMutualFollows_args {
+ public:
+
+  SocialGraphService_GetMutualFollows_args(const SocialGraphService_GetMutualFollows_args&);
+  SocialGraphService_GetMutualFollows_args& operator=(const SocialGraphService_GetMutualFollows_args&);
+  SocialGraphService_GetMutualFollows_args() : req_id(0), user_id(0), other_user_id(0) {
+  }
+
+  virtual ~SocialGraphService_GetMutualFollows_args() throw();
+  int64_t req_id;
+  int64_t user_id;
+  int64_t other_user_id;
+  std::map<std::string, std::string>  carrier;
+
+  _SocialGraphService_GetMutualFollows_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_user_id(const int64_t val);
+
+  void __set_other_user_id(const int64_t val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const SocialGraphService_GetMutualFollows_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(user_id == rhs.user_id))
+      return false;
+    if (!(other_user_id == rhs.other_user_id))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_GetMutualFollows_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_GetMutualFollows_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class SocialGraphService_GetMutualFollows_pargs {
+ public:
+
+
+  virtual ~SocialGraphService_GetMutualFollows_pargs() throw();
+  const int64_t* req_id;
+  const int64_t* user_id;
+  const int64_t* other_user_id;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_GetMutualFollows_result__isset {
+  _SocialGraphService_GetMutualFollows_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_GetMutualFollows_result__isset;
+
+class SocialGraphService_GetMutualFollows_result {
+ public:
+
+  SocialGraphService_GetMutualFollows_result(const SocialGraphService_GetMutualFollows_result&);
+  SocialGraphService_GetMutualFollows_result& operator=(const SocialGraphService_GetMutualFollows_result&);
+  SocialGraphService_GetMutualFollows_result() {
+  }
+
+  virtual ~SocialGraphService_GetMutualFollows_result() throw();
+  std::vector<int64_t>  success;
+  ServiceException se;
+
+  _SocialGraphService_GetMutualFollows_result__isset __isset;
+
+  void __set_success(const std::vector<int64_t> & val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const SocialGraphService_GetMutualFollows_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_GetMutualFollows_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_GetMutualFollows_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_GetMutualFollows_presult__isset {
+  _SocialGraphService_GetMutualFollows_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_GetMutualFollows_presult__isset;
+
+class SocialGraphService_GetMutualFollows_presult {
+ public:
+
+
+  virtual ~SocialGraphService_GetMutualFollows_presult() throw();
+  std::vector<int64_t> * success;
+  ServiceException se;
+
+  _SocialGraphService_GetMutualFollows_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _SocialGraphService_GetFollowersInCommon_args__isset {
+  _SocialGraphService_GetFollowersInCommon_args__isset() : req_id(false), user_ids(false), carrier(false) {}
+  bool req_id :1;
+  bool user_ids :1;
+  bool carrier :1;
+} _SocialGraphService_GetFollowersInCommon_args__isset;
+
+class SocialGraphService_GetFollowersInCommon_args {
+ public:
+
+  SocialGraphService_GetFollowersInCommon_args(const SocialGraphService_GetFollowersInCommon_args&);
+  SocialGraphService_GetFollowersInCommon_args& operator=(const SocialGraphService_GetFollowersInCommon_args&);
+  SocialGraphService_GetFollowersInCommon_args() : req_id(0) {
+  }
+
+  virtual ~SocialGraphService_GetFollowersInCommon_args() throw();
+  int64_t req_id;
+  std::vector<int64_t>  user_ids;
+  std::map<std::string, std::string>  carrier;
+
+  _SocialGraphService_GetFollowersInCommon_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_user_ids(const std::vector<int64_t> & val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const SocialGraphService_GetFollowersInCommon_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(user_ids == rhs.user_ids))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_GetFollowersInCommon_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_GetFollowersInCommon_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class SocialGraphService_GetFollowersInCommon_pargs {
+ public:
+
+
+  virtual ~SocialGraphService_GetFollowersInCommon_pargs() throw();
+  const int64_t* req_id;
+  const std::vector<int64_t> * user_ids;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_GetFollowersInCommon_result__isset {
+  _SocialGraphService_GetFollowersInCommon_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_GetFollowersInCommon_result__isset;
+
+class SocialGraphService_GetFollowersInCommon_result {
+ public:
+
+  SocialGraphService_GetFollowersInCommon_result(const SocialGraphService_GetFollowersInCommon_result&);
+  SocialGraphService_GetFollowersInCommon_result& operator=(const SocialGraphService_GetFollowersInCommon_result&);
+  SocialGraphService_GetFollowersInCommon_result() {
+  }
+
+  virtual ~SocialGraphService_GetFollowersInCommon_result() throw();
+  std::vector<int64_t>  success;
+  ServiceException se;
+
+  _SocialGraphService_GetFollowersInCommon_result__isset __isset;
+
+  void __set_success(const std::vector<int64_t> & val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const SocialGraphService_GetFollowersInCommon_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_GetFollowersInCommon_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_GetFollowersInCommon_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_GetFollowersInCommon_presult__isset {
+  _SocialGraphService_GetFollowersInCommon_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_GetFollowersInCommon_presult__isset;
+
+class SocialGraphService_GetFollowersInCommon_presult {
+ public:
+
+
+  virtual ~SocialGraphService_GetFollowersInCommon_presult() throw();
+  std::vector<int64_t> * success;
+  ServiceException se;
+
+  _SocialGraphService_GetFollowersInCommon_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _SocialGraphService_IsFollowing_args__isset {
+  _SocialGraphService_IsFollowing_args__isset() : req_id(false), user_ids(false), followee_ids(false), carrier(false) {}
+  bool req_id :1;
+  bool user_ids :1;
+  bool followee_ids :1;
+  bool carrier :1;
+} _SocialGraphService_IsFollowing_args__isset;
+
+class SocialGraphService_IsFollowing_args {
+ public:
+
+  SocialGraphService_IsFollowing_args(const SocialGraphService_IsFollowing_args&);
+  SocialGraphService_IsFollowing_args& operator=(const SocialGraphService_IsFollowing_args&);
+  SocialGraphService_IsFollowing_args() : req_id(0) {
+  }
+
+  virtual ~SocialGraphService_IsFollowing_args() throw();
+  int64_t req_id;
+  std::vector<int64_t>  user_ids;
+  std::vector<int64_t>  followee_ids;
+  std::map<std::string, std::string>  carrier;
+
+  _SocialGraphService_IsFollowing_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_user_ids(const std::vector<int64_t> & val);
+
+  void __set_followee_ids(const std::vector<int64_t> & val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const SocialGraphService_IsFollowing_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(user_ids == rhs.user_ids))
+      return false;
+    if (!(followee_ids == rhs.followee_ids))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_IsFollowing_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_IsFollowing_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class SocialGraphService_IsFollowing_pargs {
+ public:
+
+
+  virtual ~SocialGraphService_IsFollowing_pargs() throw();
+  const int64_t* req_id;
+  const std::vector<int64_t> * user_ids;
+  const std::vector<int64_t> * followee_ids;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_IsFollowing_result__isset {
+  _SocialGraphService_IsFollowing_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_IsFollowing_result__isset;
+
+class SocialGraphService_IsFollowing_result {
+ public:
+
+  SocialGraphService_IsFollowing_result(const SocialGraphService_IsFollowing_result&);
+  SocialGraphService_IsFollowing_result& operator=(const SocialGraphService_IsFollowing_result&);
+  SocialGraphService_IsFollowing_result() {
+  }
+
+  virtual ~SocialGraphService_IsFollowing_result() throw();
+  std::vector<bool>  success;
+  ServiceException se;
+
+  _SocialGraphService_IsFollowing_result__isset __isset;
+
+  void __set_success(const std::vector<bool> & val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const SocialGraphService_IsFollowing_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_IsFollowing_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_IsFollowing_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_IsFollowing_presult__isset {
+  _SocialGraphService_IsFollowing_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_IsFollowing_presult__isset;
+
+class SocialGraphService_IsFollowing_presult {
+ public:
+
+
+  virtual ~SocialGraphService_IsFollowing_presult() throw();
+  std::vector<bool> * success;
+  ServiceException se;
+
+  _SocialGraphService_IsFollowing_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _SocialGraphService_GetFollowerCount_args__isset {
+  _SocialGraphService_GetFollowerCount_args__isset() : req_id(false), user_id(false), carrier(false) {}
+  bool req_id :1;
+  bool user_id :1;
+  bool carrier :1;
+} _SocialGraphService_GetFollowerCount_args__isset;
+
+class SocialGraphService_GetFollowerCount_args {
+ public:
+
+  SocialGraphService_GetFollowerCount_args(const SocialGraphService_GetFollowerCount_args&);
+  SocialGraphService_GetFollowerCount_args& operator=(const SocialGraphService_GetFollowerCount_args&);
+  SocialGraphService_GetFollowerCount_args() : req_id(0), user_id(0) {
+  }
+
+  virtual ~SocialGraphService_GetFollowerCount_args() throw();
+  int64_t req_id;
+  int64_t user_id;
+  std::map<std::string, std::string>  carrier;
+
+  _SocialGraphService_GetFollowerCount_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_user_id(const int64_t val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const SocialGraphService_GetFollowerCount_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(user_id == rhs.user_id))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_GetFollowerCount_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_GetFollowerCount_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class SocialGraphService_GetFollowerCount_pargs {
+ public:
+
+
+  virtual ~SocialGraphService_GetFollowerCount_pargs() throw();
+  const int64_t* req_id;
+  const int64_t* user_id;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_GetFollowerCount_result__isset {
+  _SocialGraphService_GetFollowerCount_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_GetFollowerCount_result__isset;
+
+class SocialGraphService_GetFollowerCount_result {
+ public:
+
+  SocialGraphService_GetFollowerCount_result(const SocialGraphService_GetFollowerCount_result&);
+  SocialGraphService_GetFollowerCount_result& operator=(const SocialGraphService_GetFollowerCount_result&);
+  SocialGraphService_GetFollowerCount_result() : success(0) {
+  }
+
+  virtual ~SocialGraphService_GetFollowerCount_result() throw();
+  int64_t success;
+  ServiceException se;
+
+  _SocialGraphService_GetFollowerCount_result__isset __isset;
+
+  void __set_success(const int64_t val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const SocialGraphService_GetFollowerCount_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_GetFollowerCount_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_GetFollowerCount_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_GetFollowerCount_presult__isset {
+  _SocialGraphService_GetFollowerCount_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_GetFollowerCount_presult__isset;
+
+class SocialGraphService_GetFollowerCount_presult {
+ public:
+
+
+  virtual ~SocialGraphService_GetFollowerCount_presult() throw();
+  int64_t* success;
+  ServiceException se;
+
+  _SocialGraphService_GetFollowerCount_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _SocialGraphService_GetFollowersPage_args__isset {
+  _SocialGraphService_GetFollowersPage_args__isset() : req_id(false), user_id(false), after_timestamp(false), after_user_id(false), limit(false), carrier(false) {}
+  bool req_id :1;
+  bool user_id :1;
+  bool after_timestamp :1;
+  bool after_user_id :1;
+  bool limit :1;
+  bool carrier :1;
+} _SocialGraphService_GetFollowersPage_args__isset;
+
+class SocialGraphService_GetFollowersPage_args {
+ public:
+
+  SocialGraphService_GetFollowersPage_args(const SocialGraphService_GetFollowersPage_args&);
+  SocialGraphService_GetFollowersPage_args& operator=(const SocialGraphService_GetFollowersPage_args&);
+  SocialGraphService_GetFollowersPage_args() : req_id(0), user_id(0), after_timestamp(0), after_user_id(0), limit(0) {
+  }
+
+  virtual ~SocialGraphService_GetFollowersPage_args() throw();
+  int64_t req_id;
+  int64_t user_id;
+  int64_t after_timestamp;
+  int64_t after_user_id;
+  int32_t limit;
+  std::map<std::string, std::string>  carrier;
+
+  _SocialGraphService_GetFollowersPage_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_user_id(const int64_t val);
+
+  void __set_after_timestamp(const int64_t val);
+
+  void __set_after_user_id(const int64_t val);
+
+  void __set_limit(const int32_t val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const SocialGraphService_GetFollowersPage_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(user_id == rhs.user_id))
+      return false;
+    if (!(after_timestamp == rhs.after_timestamp))
+      return false;
+    if (!(after_user_id == rhs.after_user_id))
+      return false;
+    if (!(limit == rhs.limit))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_GetFollowersPage_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_GetFollowersPage_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class SocialGraphService_GetFollowersPage_pargs {
+ public:
+
+
+  virtual ~SocialGraphService_GetFollowersPage_pargs() throw();
+  const int64_t* req_id;
+  const int64_t* user_id;
+  const int64_t* after_timestamp;
+  const int64_t* after_user_id;
+  const int32_t* limit;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_GetFollowersPage_result__isset {
+  _SocialGraphService_GetFollowersPage_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_GetFollowersPage_result__isset;
+
+class SocialGraphService_GetFollowersPage_result {
+ public:
+
+  SocialGraphService_GetFollowersPage_result(const SocialGraphService_GetFollowersPage_result&);
+  SocialGraphService_GetFollowersPage_result& operator=(const SocialGraphService_GetFollowersPage_result&);
+  SocialGraphService_GetFollowersPage_result() {
+  }
+
+  virtual ~SocialGraphService_GetFollowersPage_result() throw();
+  FollowersPage success;
+  ServiceException se;
+
+  _SocialGraphService_GetFollowersPage_result__isset __isset;
+
+  void __set_success(const FollowersPage& val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const SocialGraphService_GetFollowersPage_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_GetFollowersPage_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_GetFollowersPage_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_GetFollowersPage_presult__isset {
+  _SocialGraphService_GetFollowersPage_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_GetFollowersPage_presult__isset;
+
+class SocialGraphService_GetFollowersPage_presult {
+ public:
+
+
+  virtual ~SocialGraphService_GetFollowersPage_presult() throw();
+  FollowersPage* success;
+  ServiceException se;
+
+  _SocialGraphService_GetFollowersPage_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _SocialGraphService_InsertUsers_args__isset {
+  _SocialGraphService_InsertUsers_args__isset() : req_id(false), user_ids(false), carrier(false) {}
+  bool req_id :1;
+  bool user_ids :1;
+  bool carrier :1;
+} _SocialGraphService_InsertUsers_args__isset;
+
+class SocialGraphService_InsertUsers_args {
+ public:
+
+  SocialGraphService_InsertUsers_args(const SocialGraphService_InsertUsers_args&);
+  SocialGraphService_InsertUsers_args& operator=(const SocialGraphService_InsertUsers_args&);
+  SocialGraphService_InsertUsers_args() : req_id(0) {
+  }
+
+  virtual ~SocialGraphService_InsertUsers_args() throw();
+  int64_t req_id;
+  std::vector<int64_t>  user_ids;
+  std::map<std::string, std::string>  carrier;
+
+  _SocialGraphService_InsertUsers_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_user_ids(const std::vector<int64_t> & val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const SocialGraphService_InsertUsers_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(user_ids == rhs.user_ids))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_InsertUsers_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_InsertUsers_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class SocialGraphService_InsertUsers_pargs {
+ public:
+
+
+  virtual ~SocialGraphService_InsertUsers_pargs() throw();
+  const int64_t* req_id;
+  const std::vector<int64_t> * user_ids;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_InsertUsers_result__isset {
+  _SocialGraphService_InsertUsers_result__isset() : se(false) {}
+  bool se :1;
+} _SocialGraphService_InsertUsers_result__isset;
+
+class SocialGraphService_InsertUsers_result {
+ public:
+
+  SocialGraphService_InsertUsers_result(const SocialGraphService_InsertUsers_result&);
+  SocialGraphService_InsertUsers_result& operator=(const SocialGraphService_InsertUsers_result&);
+  SocialGraphService_InsertUsers_result() {
+  }
+
+  virtual ~SocialGraphService_InsertUsers_result() throw();
+  ServiceException se;
+
+  _SocialGraphService_InsertUsers_result__isset __isset;
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const SocialGraphService_InsertUsers_result & rhs) const
+  {
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_InsertUsers_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_InsertUsers_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_InsertUsers_presult__isset {
+  _SocialGraphService_InsertUsers_presult__isset() : se(false) {}
+  bool se :1;
+} _SocialGraphService_InsertUsers_presult__isset;
+
+class SocialGraphService_InsertUsers_presult {
+ public:
+
+
+  virtual ~SocialGraphService_InsertUsers_presult() throw();
+  ServiceException se;
+
+  _SocialGraphService_InsertUsers_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+class SocialGraphServiceClient : virtual public SocialGraphServiceIf {
+ public:
+  SocialGraphServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
+    setProtocol(prot);
+  }
+  SocialGraphServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
+    setProtocol(iprot,oprot);
+  }
+ private:
+  void setProtocol(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
+  setProtocol(prot,prot);
+  }
+  void setProtocol(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> iprot, apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> oprot) {
+    piprot_=iprot;
+    poprot_=oprot;
+    iprot_ = iprot.get();
+    oprot_ = oprot.get();
+  }
+ public:
+  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> getInputProtocol() {
+    return piprot_;
+  }
+  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> getOutputProtocol() {
+    return poprot_;
+  }
+  void GetFollowers(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
+  void send_GetFollowers(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
+  void recv_GetFollowers(std::vector<int64_t> & _return);
+  void GetFollowees(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
+  void send_GetFollowees(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
+  void recv_GetFollowees(std::vector<int64_t> & _return);
+  void Follow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier);
+  void send_Follow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier);
+  void recv_Follow();
+  void Unfollow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier);
+  void send_Unfollow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier);
+  void recv_Unfollow();
+  void FollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier);
+  void send_FollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier);
+  void recv_FollowWithUsername();
+  void UnfollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier);
+  void send_UnfollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier);
+  void recv_UnfollowWithUsername();
+  void InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
+  void send_InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
+  void recv_InsertUser();
+  void FollowMany(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier);
+  void send_FollowMany(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier);
+  void recv_FollowMany();
+  void UnfollowMany(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier);
+  void send_UnfollowMany(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier);
+  void recv_UnfollowMany();
+  void GetMutualFollows(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t other_user_id, const std::map<std::string, std::string> & carrier);
+  void send_GetMutualFollows(const int64_t req_id, const int64_t user_id, const int64_t other_user_id, const std::map<std::string, std::string> & carrier);
+  void recv_GetMutualFollows(std::vector<int64_t> & _return);
+  void GetFollowersInCommon(std::vector<int64_t> & _return, const int64_t req_id, const std::vector<int64_t> & user_ids, const std::map<std::string, std::string> & carrier);
+  void send_GetFollowersInCommon(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::map<std::string, std::string> & carrier);
+  void recv_GetFollowersInCommon(std::vector<int64_t> & _return);
+  void IsFollowing(std::vector<bool> & _return, const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier);
+  void send_IsFollowing(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier);
+  void recv_IsFollowing(std::vector<bool> & _return);
+  int64_t GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
+  void send_GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
+  int64_t recv_GetFollowerCount();
+  void GetFollowersPage(FollowersPage& _return, const int64_t req_id, const int64_t user_id, const int64_t after_timestamp, const int64_t after_user_id, const int32_t limit, const std::map<std::string, std::string> & carrier);
+  void send_GetFollowersPage(const int64_t req_id, const int64_t user_id, const int64_t after_timestamp, const int64_t after_user_id, const int32_t limit, const std::map<std::string, std::string> & carrier);
+  void recv_GetFollowersPage(FollowersPage& _return);
+  void InsertUsers(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::map<std::string, std::string> & carrier);
+  void send_InsertUsers(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::map<std::string, std::string> & carrier);
+  void recv_InsertUsers();
+ protected:
+  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
+  apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
+  ::apache::thrift::protocol::TProtocol* iprot_;
+  ::apache::thrift::protocol::TProtocol* oprot_;
+};
+
+class SocialGraphServiceProcessor : public ::apache::thrift::TDispatchProcessor {
+ protected:
+  ::apache::thrift::stdcxx::shared_ptr<SocialGraphServiceIf> iface_;
+  virtual bool dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext);
+ private:
+  typedef  void (SocialGraphServiceProcessor::*ProcessFunction)(int32_t, ::apache::thrift::protocol::TProtocol*, ::apache::thrift::protocol::TProtocol*, void*);
+  typedef std::map<std::string, ProcessFunction> ProcessMap;
+  ProcessMap processMap_;
+  void process_GetFollowers(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_GetFollowees(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_Follow(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_Unfollow(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_FollowWithUsername(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_UnfollowWithUsername(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_InsertUser(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_FollowMany(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_UnfollowMany(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_GetMutualFollows(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_GetFollowersInCommon(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_IsFollowing(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_GetFollowerCount(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_GetFollowersPage(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_InsertUsers(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+ public:
+  SocialGraphServiceProcessor(::apache::thrift::stdcxx::shared_ptr<SocialGraphServiceIf> iface) :
+    iface_(iface) {
+    processMap_["GetFollowers"] = &SocialGraphServiceProcessor::process_GetFollowers;
+    processMap_["GetFollowees"] = &SocialGraphServiceProcessor::process_GetFollowees;
+    processMap_["Follow"] = &SocialGraphServiceProcessor::process_Follow;
+    processMap_["Unfollow"] = &SocialGraphServiceProcessor::process_Unfollow;
+    processMap_["FollowWithUsername"] = &SocialGraphServiceProcessor::process_FollowWithUsername;
+    processMap_["UnfollowWithUsername"] = &SocialGraphServiceProcessor::process_UnfollowWithUsername;
+    processMap_["InsertUser"] = &SocialGraphServiceProcessor::process_InsertUser;
+    processMap_["FollowMany"] = &SocialGraphServiceProcessor::process_FollowMany;
+    processMap_["UnfollowMany"] = &SocialGraphServiceProcessor::process_UnfollowMany;
+    processMap_["GetMutualFollows"] = &SocialGraphServiceProcessor::process_GetMutualFollows;
+    processMap_["GetFollowersInCommon"] = &SocialGraphServiceProcessor::process_GetFollowersInCommon;
+    processMap_["IsFollowing"] = &SocialGraphServiceProcessor::process_IsFollowing;
+    processMap_["GetFollowerCount"] = &SocialGraphServiceProcessor::process_GetFollowerCount;
+    processMap_["GetFollowersPage"] = &SocialGraphServiceProcessor::process_GetFollowersPage;
+    processMap_["InsertUsers"] = &SocialGraphServiceProcessor::process_InsertUsers;
+  }
+
+  virtual ~SocialGraphServiceProcessor() {}
+};
+
+class SocialGraphServiceProcessorFactory : public ::apache::thrift::TProcessorFactory {
+ public:
+  SocialGraphServiceProcessorFactory(const ::apache::thrift::stdcxx::shared_ptr< SocialGraphServiceIfFactory >& handlerFactory) :
+      handlerFactory_(handlerFactory) {}
+
+  ::apache::thrift::stdcxx::shared_ptr< ::apache::thrift::TProcessor > getProcessor(const ::apache::thrift::TConnectionInfo& connInfo);
+
+ protected:
+  ::apache::thrift::stdcxx::shared_ptr< SocialGraphServiceIfFactory > handlerFactory_;
+};
+
+class SocialGraphServiceMultiface : virtual public SocialGraphServiceIf {
+ public:
+  SocialGraphServiceMultiface(std::vector<apache::thrift::stdcxx::shared_ptr<SocialGraphServiceIf> >& ifaces) : ifaces_(ifaces) {
+  }
+  virtual ~SocialGraphServiceMultiface() {}
+ protected:
+  std::vector<apache::thrift::stdcxx::shared_ptr<SocialGraphServiceIf> > ifaces_;
+  SocialGraphServiceMultiface() {}
+  void add(::apache::thrift::stdcxx::shared_ptr<SocialGraphServiceIf> iface) {
+    ifaces_.push_back(iface);
+  }
+ public:
+  void GetFollowers(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->GetFollowers(_return, req_id, user_id, carrier);
+    }
+    ifaces_[i]->GetFollowers(_return, req_id, user_id, carrier);
+    return;
+  }
+
+  void GetFollowees(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->GetFollowees(_return, req_id, user_id, carrier);
+    }
+    ifaces_[i]->GetFollowees(_return, req_id, user_id, carrier);
+    return;
+  }
+
+  void Follow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->Follow(req_id, user_id, followee_id, carrier);
+    }
+    ifaces_[i]->Follow(req_id, user_id, followee_id, carrier);
+  }
+
+  void Unfollow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->Unfollow(req_id, user_id, followee_id, carrier);
+    }
+    ifaces_[i]->Unfollow(req_id, user_id, followee_id, carrier);
+  }
+
+  void FollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->FollowWithUsername(req_id, user_usernmae, followee_username, carrier);
+    }
+    ifaces_[i]->FollowWithUsername(req_id, user_usernmae, followee_username, carrier);
+  }
+
+  void UnfollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->UnfollowWithUsername(req_id, user_usernmae, followee_username, carrier);
+    }
+    ifaces_[i]->UnfollowWithUsername(req_id, user_usernmae, followee_username, carrier);
   }
 
   void InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier) {
@@ -1121,6 +2227,82 @@ class SocialGraphServiceMultiface : virtual public SocialGraphServiceIf {
     ifaces_[i]->InsertUser(req_id, user_id, carrier);
   }
 
+  void FollowMany(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->FollowMany(req_id, user_ids, followee_ids, carrier);
+    }
+    ifaces_[i]->FollowMany(req_id, user_ids, followee_ids, carrier);
+  }
+
+  void UnfollowMany(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->UnfollowMany(req_id, user_ids, followee_ids, carrier);
+    }
+    ifaces_[i]->UnfollowMany(req_id, user_ids, followee_ids, carrier);
+  }
+
+  void GetMutualFollows(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t other_user_id, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->GetMutualFollows(_return, req_id, user_id, other_user_id, carrier);
+    }
+    ifaces_[i]->GetMutualFollows(_return, req_id, user_id, other_user_id, carrier);
+    return;
+  }
+
+  void GetFollowersInCommon(std::vector<int64_t> & _return, const int64_t req_id, const std::vector<int64_t> & user_ids, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->GetFollowersInCommon(_return, req_id, user_ids, carrier);
+    }
+    ifaces_[i]->GetFollowersInCommon(_return, req_id, user_ids, carrier);
+    return;
+  }
+
+  void IsFollowing(std::vector<bool> & _return, const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->IsFollowing(_return, req_id, user_ids, followee_ids, carrier);
+    }
+    ifaces_[i]->IsFollowing(_return, req_id, user_ids, followee_ids, carrier);
+    return;
+  }
+
+  int64_t GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->GetFollowerCount(req_id, user_id, carrier);
+    }
+    return ifaces_[i]->GetFollowerCount(req_id, user_id, carrier);
+  }
+
+  void GetFollowersPage(FollowersPage& _return, const int64_t req_id, const int64_t user_id, const int64_t after_timestamp, const int64_t after_user_id, const int32_t limit, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->GetFollowersPage(_return, req_id, user_id, after_timestamp, after_user_id, limit, carrier);
+    }
+    ifaces_[i]->GetFollowersPage(_return, req_id, user_id, after_timestamp, after_user_id, limit, carrier);
+    return;
+  }
+
+  void InsertUsers(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->InsertUsers(req_id, user_ids, carrier);
+    }
+    ifaces_[i]->InsertUsers(req_id, user_ids, carrier);
+  }
+
 };
 
 // The 'concurrent' client is a thread safe client that correctly handles
@@ -1172,6 +2354,30 @@ class SocialGraphServiceConcurrentClient : virtual public SocialGraphServiceIf {
   void InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
   int32_t send_InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
   void recv_InsertUser(const int32_t seqid);
+  void FollowMany(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier);
+  int32_t send_FollowMany(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier);
+  void recv_FollowMany(const int32_t seqid);
+  void UnfollowMany(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier);
+  int32_t send_UnfollowMany(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier);
+  void recv_UnfollowMany(const int32_t seqid);
+  void GetMutualFollows(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t other_user_id, const std::map<std::string, std::string> & carrier);
+  int32_t send_GetMutualFollows(const int64_t req_id, const int64_t user_id, const int64_t other_user_id, const std::map<std::string, std::string> & carrier);
+  void recv_GetMutualFollows(std::vector<int64_t> & _return, const int32_t seqid);
+  void GetFollowersInCommon(std::vector<int64_t> & _return, const int64_t req_id, const std::vector<int64_t> & user_ids, const std::map<std::string, std::string> & carrier);
+  int32_t send_GetFollowersInCommon(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::map<std::string, std::string> & carrier);
+  void recv_GetFollowersInCommon(std::vector<int64_t> & _return, const int32_t seqid);
+  void IsFollowing(std::vector<bool> & _return, const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier);
+  int32_t send_IsFollowing(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & followee_ids, const std::map<std::string, std::string> & carrier);
+  void recv_IsFollowing(std::vector<bool> & _return, const int32_t seqid);
+  int64_t GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
+  int32_t send_GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
+  int64_t recv_GetFollowerCount(const int32_t seqid);
+  void GetFollowersPage(FollowersPage& _return, const int64_t req_id, const int64_t user_id, const int64_t after_timestamp, const int64_t after_user_id, const int32_t limit, const std::map<std::string, std::string> & carrier);
+  int32_t send_GetFollowersPage(const int64_t req_id, const int64_t user_id, const int64_t after_timestamp, const int64_t after_user_id, const int32_t limit, const std::map<std::string, std::string> & carrier);
+  void recv_GetFollowersPage(FollowersPage& _return, const int32_t seqid);
+  void InsertUsers(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::map<std::string, std::string> & carrier);
+  int32_t send_InsertUsers(const int64_t req_id, const std::vector<int64_t> & user_ids, const std::map<std::string, std::string> & carrier);
+  void recv_InsertUsers(const int32_t seqid);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -22,6 +22,7 @@ class TextServiceIf {
  public:
   virtual ~TextServiceIf() {}
   virtual void ComposeText(TextServiceReturn& _return, const int64_t req_id, const std::string& text, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void ComposeTexts(std::vector<TextServiceReturn> & _return, const int64_t req_id, const std::vector<std::string> & texts, const std::map<std::string, std::string> & carrier) = 0;
 };
 
 class TextServiceIfFactory {
@@ -54,6 +55,9 @@ class TextServiceNull : virtual public TextServiceIf {
   void ComposeText(TextServiceReturn& /* _return */, const int64_t /* req_id */, const std::string& /* text */, const std::map<std::string, std::string> & /* carrier */) {
     return;
   }
+  void ComposeTexts(std::vector<TextServiceReturn> & /* _return */, const int64_t /* req_id */, const std::vector<std::string> & /* texts */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
 };
 
 typedef struct _TextService_ComposeText_args__isset {
@@ -182,6 +186,132 @@ class TextService_ComposeText_presult {
 
 };
 
+typedef struct _TextService_ComposeTexts_args__isset {
+  _TextService_ComposeTexts_args__isset() : req_id(false), texts(false), carrier(false) {}
+  bool req_id :1;
+  bool texts :1;
+  bool carrier :1;
+} _TextService_ComposeTexts_args__isset;
+
+class TextService_ComposeTexts_args {
+ public:
+
+  TextService_ComposeTexts_args(const TextService_ComposeTexts_args&);
+  TextService_ComposeTexts_args& operator=(const TextService_ComposeTexts_args&);
+  TextService_ComposeTexts_args() : req_id(0) {
+  }
+
+  virtual ~TextService_ComposeTexts_args() throw();
+  int64_t req_id;
+  std::vector<std::string>  texts;
+  std::map<std::string, std::string>  carrier;
+
+  _TextService_ComposeTexts_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_texts(const std::vector<std::string> & val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const TextService_ComposeTexts_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(texts == rhs.texts))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const TextService_ComposeTexts_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const TextService_ComposeTexts_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class TextService_ComposeTexts_pargs {
+ public:
+
+
+  virtual ~TextService_ComposeTexts_pargs() throw();
+  const int64_t* req_id;
+  const std::vector<std::string> * texts;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _TextService_ComposeTexts_result__isset {
+  _TextService_ComposeTexts_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _TextService_ComposeTexts_result__isset;
+
+class TextService_ComposeTexts_result {
+ public:
+
+  TextService_ComposeTexts_result(const TextService_ComposeTexts_result&);
+  TextService_ComposeTexts_result& operator=(const TextService_ComposeTexts_result&);
+  TextService_ComposeTexts_result() {
+  }
+
+  virtual ~TextService_ComposeTexts_result() throw();
+  std::vector<TextServiceReturn>  success;
+  ServiceException se;
+
+  _TextService_ComposeTexts_result__isset __isset;
+
+  void __set_success(const std::vector<TextServiceReturn> & val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const TextService_ComposeTexts_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const TextService_ComposeTexts_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const TextService_ComposeTexts_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _TextService_ComposeTexts_presult__isset {
+  _TextService_ComposeTexts_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _TextService_ComposeTexts_presult__isset;
+
+class TextService_ComposeTexts_presult {
+ public:
+
+
+  virtual ~TextService_ComposeTexts_presult() throw();
+  std::vector<TextServiceReturn> * success;
+  ServiceException se;
+
+  _TextService_ComposeTexts_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class TextServiceClient : virtual public TextServiceIf {
  public:
   TextServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
@@ -210,6 +340,9 @@ class TextServiceClient : virtual public TextServiceIf {
   void ComposeText(TextServiceReturn& _return, const int64_t req_id, const std::string& text, const std::map<std::string, std::string> & carrier);
   void send_ComposeText(const int64_t req_id, const std::string& text, const std::map<std::string, std::string> & carrier);
   void recv_ComposeText(TextServiceReturn& _return);
+  void ComposeTexts(std::vector<TextServiceReturn> & _return, const int64_t req_id, const std::vector<std::string> & texts, const std::map<std::string, std::string> & carrier);
+  void send_ComposeTexts(const int64_t req_id, const std::vector<std::string> & texts, const std::map<std::string, std::string> & carrier);
+  void recv_ComposeTexts(std::vector<TextServiceReturn> & _return);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -226,10 +359,12 @@ class TextServiceProcessor : public ::apache::thrift::TDispatchProcessor {
   typedef std::map<std::string, ProcessFunction> ProcessMap;
   ProcessMap processMap_;
   void process_ComposeText(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_ComposeTexts(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   TextServiceProcessor(::apache::thrift::stdcxx::shared_ptr<TextServiceIf> iface) :
     iface_(iface) {
     processMap_["ComposeText"] = &TextServiceProcessor::process_ComposeText;
+    processMap_["ComposeTexts"] = &TextServiceProcessor::process_ComposeTexts;
   }
 
   virtual ~TextServiceProcessor() {}
@@ -268,6 +403,16 @@ class TextServiceMultiface : virtual public TextServiceIf {
     return;
   }
 
+  void ComposeTexts(std::vector<TextServiceReturn> & _return, const int64_t req_id, const std::vector<std::string> & texts, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->ComposeTexts(_return, req_id, texts, carrier);
+    }
+    ifaces_[i]->ComposeTexts(_return, req_id, texts, carrier);
+    return;
+  }
+
 };
 
 // The 'concurrent' client is a thread safe client that correctly handles
@@ -301,6 +446,9 @@ class TextServiceConcurrentClient : virtual public TextServiceIf {
   void ComposeText(TextServiceReturn& _return, const int64_t req_id, const std::string& text, const std::map<std::string, std::string> & carrier);
   int32_t send_ComposeText(const int64_t req_id, const std::string& text, const std::map<std::string, std::string> & carrier);
   void recv_ComposeText(TextServiceReturn& _return, const int32_t seqid);
+  void ComposeTexts(std::vector<TextServiceReturn> & _return, const int64_t req_id, const std::vector<std::string> & texts, const std::map<std::string, std::string> & carrier);
+  int32_t send_ComposeTexts(const int64_t req_id, const std::vector<std::string> & texts, const std::map<std::string, std::string> & carrier);
+  void recv_ComposeTexts(std::vector<TextServiceReturn> & _return, const int32_t seqid);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -22,6 +22,7 @@ class UniqueIdServiceIf {
  public:
   virtual ~UniqueIdServiceIf() {}
   virtual int64_t ComposeUniqueId(const int64_t req_id, const PostType::type post_type, const std::map<std::string, std::string> & carrier) = 0;
+  virtual int64_t ComposeUniqueIds(const int64_t req_id, const PostType::type post_type, const int32_t num_ids, const std::map<std::string, std::string> & carrier) = 0;
 };
 
 class UniqueIdServiceIfFactory {
@@ -55,6 +56,10 @@ class UniqueIdServiceNull : virtual public UniqueIdServiceIf {
     int64_t _return = 0;
     return _return;
   }
+  int64_t ComposeUniqueIds(const int64_t /* req_id */, const PostType::type /* post_type */, const int32_t /* num_ids */, const std::map<std::string, std::string> & /* carrier */) {
+    int64_t _return = 0;
+    return _return;
+  }
 };
 
 typedef struct _UniqueIdService_ComposeUniqueId_args__isset {
@@ -183,6 +188,139 @@ class UniqueIdService_ComposeUniqueId_presult {
 
 };
 
+typedef struct _UniqueIdService_ComposeUniqueIds_args__isset {
+  _UniqueIdService_ComposeUniqueIds_args__isset() : req_id(false), post_type(false), num_ids(false), carrier(false) {}
+  bool req_id :1;
+  bool post_type :1;
+  bool num_ids :1;
+  bool carrier :1;
+} _UniqueIdService_ComposeUniqueIds_args__isset;
+
+class UniqueIdService_ComposeUniqueIds_args {
+ public:
+
+  UniqueIdService_ComposeUniqueIds_args(const UniqueIdService_ComposeUniqueIds_args&);
+  UniqueIdService_ComposeUniqueIds_args& operator=(const UniqueIdService_ComposeUniqueIds_args&);
+  UniqueIdService_ComposeUniqueIds_args() : req_id(0), post_type((PostType::type)0), num_ids(0) {
+  }
+
+  virtual ~UniqueIdService_ComposeUniqueIds_args() throw();
+  int64_t req_id;
+  PostType::type post_type;
+  int32_t num_ids;
+  std::map<std::string, std::string>  carrier;
+
+  _UniqueIdService_ComposeUniqueIds_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_post_type(const PostType::type val);
+
+  void __set_num_ids(const int32_t val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const UniqueIdService_ComposeUniqueIds_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(post_type == rhs.post_type))
+      return false;
+    if (!(num_ids == rhs.num_ids))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const UniqueIdService_ComposeUniqueIds_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const UniqueIdService_ComposeUniqueIds_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class UniqueIdService_ComposeUniqueIds_pargs {
+ public:
+
+
+  virtual ~UniqueIdService_ComposeUniqueIds_pargs() throw();
+  const int64_t* req_id;
+  const PostType::type* post_type;
+  const int32_t* num_ids;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _UniqueIdService_ComposeUniqueIds_result__isset {
+  _UniqueIdService_ComposeUniqueIds_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _UniqueIdService_ComposeUniqueIds_result__isset;
+
+class UniqueIdService_ComposeUniqueIds_result {
+ public:
+
+  UniqueIdService_ComposeUniqueIds_result(const UniqueIdService_ComposeUniqueIds_result&);
+  UniqueIdService_ComposeUniqueIds_result& operator=(const UniqueIdService_ComposeUniqueIds_result&);
+  UniqueIdService_ComposeUniqueIds_result() : success(0) {
+  }
+
+  virtual ~UniqueIdService_ComposeUniqueIds_result() throw();
+  int64_t success;
+  ServiceException se;
+
+  _UniqueIdService_ComposeUniqueIds_result__isset __isset;
+
+  void __set_success(const int64_t val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const UniqueIdService_ComposeUniqueIds_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const UniqueIdService_ComposeUniqueIds_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const UniqueIdService_ComposeUniqueIds_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _UniqueIdService_ComposeUniqueIds_presult__isset {
+  _UniqueIdService_ComposeUniqueIds_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _UniqueIdService_ComposeUniqueIds_presult__isset;
+
+class UniqueIdService_ComposeUniqueIds_presult {
+ public:
+
+
+  virtual ~UniqueIdService_ComposeUniqueIds_presult() throw();
+  int64_t* success;
+  ServiceException se;
+
+  _UniqueIdService_ComposeUniqueIds_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class UniqueIdServiceClient : virtual public UniqueIdServiceIf {
  public:
   UniqueIdServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
@@ -211,6 +349,9 @@ class UniqueIdServiceClient : virtual public UniqueIdServiceIf {
   int64_t ComposeUniqueId(const int64_t req_id, const PostType::type post_type, const std::map<std::string, std::string> & carrier);
   void send_ComposeUniqueId(const int64_t req_id, const PostType::type post_type, const std::map<std::string, std::string> & carrier);
   int64_t recv_ComposeUniqueId();
+  int64_t ComposeUniqueIds(const int64_t req_id, const PostType::type post_type, const int32_t num_ids, const std::map<std::string, std::string> & carrier);
+  void send_ComposeUniqueIds(const int64_t req_id, const PostType::type post_type, const int32_t num_ids, const std::map<std::string, std::string> & carrier);
+  int64_t recv_ComposeUniqueIds();
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -227,10 +368,12 @@ class UniqueIdServiceProcessor : public ::apache::thrift::TDispatchProcessor {
   typedef std::map<std::string, ProcessFunction> ProcessMap;
   ProcessMap processMap_;
   void process_ComposeUniqueId(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_ComposeUniqueIds(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   UniqueIdServiceProcessor(::apache::thrift::stdcxx::shared_ptr<UniqueIdServiceIf> iface) :
     iface_(iface) {
     processMap_["ComposeUniqueId"] = &UniqueIdServiceProcessor::process_ComposeUniqueId;
+    processMap_["ComposeUniqueIds"] = &UniqueIdServiceProcessor::process_ComposeUniqueIds;
   }
 
   virtual ~UniqueIdServiceProcessor() {}
@@ -268,6 +411,15 @@ class UniqueIdServiceMultiface : virtual public UniqueIdServiceIf {
     return ifaces_[i]->ComposeUniqueId(req_id, post_type, carrier);
   }
 
+  int64_t ComposeUniqueIds(const int64_t req_id, const PostType::type post_type, const int32_t num_ids, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->ComposeUniqueIds(req_id, post_type, num_ids, carrier);
+    }
+    return ifaces_[i]->ComposeUniqueIds(req_id, post_type, num_ids, carrier);
+  }
+
 };
 
 // The 'concurrent' client is a thread safe client that correctly handles
@@ -301,6 +453,9 @@ class UniqueIdServiceConcurrentClient : virtual public UniqueIdServiceIf {
   int64_t ComposeUniqueId(const int64_t req_id, const PostType::type post_type, const std::map<std::string, std::string> & carrier);
   int32_t send_ComposeUniqueId(const int64_t req_id, const PostType::type post_type, const std::map<std::string, std::string> & carrier);
   int64_t recv_ComposeUniqueId(const int32_t seqid);
+  int64_t ComposeUniqueIds(const int64_t req_id, const PostType::type post_type, const int32_t num_ids, const std::map<std::string, std::string> & carrier);
+  int32_t send_ComposeUniqueIds(const int64_t req_id, const PostType::type post_type, const int32_t num_ids, const std::map<std::string, std::string> & carrier);
+  int64_t recv_ComposeUniqueIds(const int32_t seqid);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
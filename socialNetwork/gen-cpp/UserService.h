@@ -27,6 +27,9 @@ class UserServiceIf {
   virtual void ComposeCreatorWithUserId(Creator& _return, const int64_t req_id, const int64_t user_id, const std::string& username, const std::map<std::string, std::string> & carrier) = 0;
   virtual void ComposeCreatorWithUsername(Creator& _return, const int64_t req_id, const std::string& username, const std::map<std::string, std::string> & carrier) = 0;
   virtual int64_t GetUserId(const int64_t req_id, const std::string& username, const std::map<std::string, std::string> & carrier) = 0;
+  virtual int64_t VerifyToken(const int64_t req_id, const std::string& token, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void GetUserIds(std::map<std::string, int64_t> & _return, const int64_t req_id, const std::vector<std::string> & usernames, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void RegisterUsers(std::vector<UserRegistrationResult> & _return, const int64_t req_id, const std::vector<UserRegistration> & users, const std::map<std::string, std::string> & carrier) = 0;
 };
 
 class UserServiceIfFactory {
@@ -75,6 +78,16 @@ class UserServiceNull : virtual public UserServiceIf {
     int64_t _return = 0;
     return _return;
   }
+  int64_t VerifyToken(const int64_t /* req_id */, const std::string& /* token */, const std::map<std::string, std::string> & /* carrier */) {
+    int64_t _return = 0;
+    return _return;
+  }
+  void GetUserIds(std::map<std::string, int64_t> & /* _return */, const int64_t /* req_id */, const std::vector<std::string> & /* usernames */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
+  void RegisterUsers(std::vector<UserRegistrationResult> & /* _return */, const int64_t /* req_id */, const std::vector<UserRegistration> & /* users */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
 };
 
 typedef struct _UserService_RegisterUser_args__isset {
@@ -880,6 +893,384 @@ class UserService_GetUserId_presult {
 
 };
 
+typedef struct _UserService_VerifyToken_args__isset {
+  _UserService_VerifyToken_args__isset() : req_id(false), token(false), carrier(false) {}
+  bool req_id :1;
+  bool token :1;
+  bool carrier :1;
+} _UserService_VerifyToken_args__isset;
+
+class UserService_VerifyToken_args {
+ public:
+
+  UserService_VerifyToken_args(const UserService_VerifyToken_args&);
+  UserService_VerifyToken_args& operator=(const UserService_VerifyToken_args&);
+  UserService_VerifyToken_args() : req_id(0), token() {
+  }
+
+  virtual ~UserService_VerifyToken_args() throw();
+  int64_t req_id;
+  std::string token;
+  std::map<std::string, std::string>  carrier;
+
+  _UserService_VerifyToken_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_token(const std::string& val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const UserService_VerifyToken_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(token == rhs.token))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const UserService_VerifyToken_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const UserService_VerifyToken_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class UserService_VerifyToken_pargs {
+ public:
+
+
+  virtual ~UserService_VerifyToken_pargs() throw();
+  const int64_t* req_id;
+  const std::string* token;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _UserService_VerifyToken_result__isset {
+  _UserService_VerifyToken_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _UserService_VerifyToken_result__isset;
+
+class UserService_VerifyToken_result {
+ public:
+
+  UserService_VerifyToken_result(const UserService_VerifyToken_result&);
+  UserService_VerifyToken_result& operator=(const UserService_VerifyToken_result&);
+  UserService_VerifyToken_result() : success(0) {
+  }
+
+  virtual ~UserService_VerifyToken_result() throw();
+  int64_t success;
+  ServiceException se;
+
+  _UserService_VerifyToken_result__isset __isset;
+
+  void __set_success(const int64_t val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const UserService_VerifyToken_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const UserService_VerifyToken_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const UserService_VerifyToken_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _UserService_VerifyToken_presult__isset {
+  _UserService_VerifyToken_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _UserService_VerifyToken_presult__isset;
+
+class UserService_VerifyToken_presult {
+ public:
+
+
+  virtual ~UserService_VerifyToken_presult() throw();
+  int64_t* success;
+  ServiceException se;
+
+  _UserService_VerifyToken_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _UserService_GetUserIds_args__isset {
+  _UserService_GetUserIds_args__isset() : req_id(false), usernames(false), carrier(false) {}
+  bool req_id :1;
+  bool usernames :1;
+  bool carrier :1;
+} _UserService_GetUserIds_args__isset;
+
+class UserService_GetUserIds_args {
+ public:
+
+  UserService_GetUserIds_args(const UserService_GetUserIds_args&);
+  UserService_GetUserIds_args& operator=(const UserService_GetUserIds_args&);
+  UserService_GetUserIds_args() : req_id(0) {
+  }
+
+  virtual ~UserService_GetUserIds_args() throw();
+  int64_t req_id;
+  std::vector<std::string>  usernames;
+  std::map<std::string, std::string>  carrier;
+
+  _UserService_GetUserIds_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_usernames(const std::vector<std::string> & val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const UserService_GetUserIds_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(usernames == rhs.usernames))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const UserService_GetUserIds_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const UserService_GetUserIds_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class UserService_GetUserIds_pargs {
+ public:
+
+
+  virtual ~UserService_GetUserIds_pargs() throw();
+  const int64_t* req_id;
+  const std::vector<std::string> * usernames;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _UserService_GetUserIds_result__isset {
+  _UserService_GetUserIds_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _UserService_GetUserIds_result__isset;
+
+class UserService_GetUserIds_result {
+ public:
+
+  UserService_GetUserIds_result(const UserService_GetUserIds_result&);
+  UserService_GetUserIds_result& operator=(const UserService_GetUserIds_result&);
+  UserService_GetUserIds_result() {
+  }
+
+  virtual ~UserService_GetUserIds_result() throw();
+  std::map<std::string, int64_t>  success;
+  ServiceException se;
+
+  _UserService_GetUserIds_result__isset __isset;
+
+  void __set_success(const std::map<std::string, int64_t> & val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const UserService_GetUserIds_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const UserService_GetUserIds_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const UserService_GetUserIds_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _UserService_GetUserIds_presult__isset {
+  _UserService_GetUserIds_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _UserService_GetUserIds_presult__isset;
+
+class UserService_GetUserIds_presult {
+ public:
+
+
+  virtual ~UserService_GetUserIds_presult() throw();
+  std::map<std::string, int64_t> * success;
+  ServiceException se;
+
+  _UserService_GetUserIds_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _UserService_RegisterUsers_args__isset {
+  _UserService_RegisterUsers_args__isset() : req_id(false), users(false), carrier(false) {}
+  bool req_id :1;
+  bool users :1;
+  bool carrier :1;
+} _UserService_RegisterUsers_args__isset;
+
+class UserService_RegisterUsers_args {
+ public:
+
+  UserService_RegisterUsers_args(const UserService_RegisterUsers_args&);
+  UserService_RegisterUsers_args& operator=(const UserService_RegisterUsers_args&);
+  UserService_RegisterUsers_args() : req_id(0) {
+  }
+
+  virtual ~UserService_RegisterUsers_args() throw();
+  int64_t req_id;
+  std::vector<UserRegistration>  users;
+  std::map<std::string, std::string>  carrier;
+
+  _UserService_RegisterUsers_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_users(const std::vector<UserRegistration> & val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const UserService_RegisterUsers_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(users == rhs.users))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const UserService_RegisterUsers_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const UserService_RegisterUsers_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class UserService_RegisterUsers_pargs {
+ public:
+
+
+  virtual ~UserService_RegisterUsers_pargs() throw();
+  const int64_t* req_id;
+  const std::vector<UserRegistration> * users;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _UserService_RegisterUsers_result__isset {
+  _UserService_RegisterUsers_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _UserService_RegisterUsers_result__isset;
+
+class UserService_RegisterUsers_result {
+ public:
+
+  UserService_RegisterUsers_result(const UserService_RegisterUsers_result&);
+  UserService_RegisterUsers_result& operator=(const UserService_RegisterUsers_result&);
+  UserService_RegisterUsers_result() {
+  }
+
+  virtual ~UserService_RegisterUsers_result() throw();
+  std::vector<UserRegistrationResult>  success;
+  ServiceException se;
+
+  _UserService_RegisterUsers_result__isset __isset;
+
+  void __set_success(const std::vector<UserRegistrationResult> & val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const UserService_RegisterUsers_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const UserService_RegisterUsers_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const UserService_RegisterUsers_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _UserService_RegisterUsers_presult__isset {
+  _UserService_RegisterUsers_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _UserService_RegisterUsers_presult__isset;
+
+class UserService_RegisterUsers_presult {
+ public:
+
+
+  virtual ~UserService_RegisterUsers_presult() throw();
+  std::vector<UserRegistrationResult> * success;
+  ServiceException se;
+
+  _UserService_RegisterUsers_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class UserServiceClient : virtual public UserServiceIf {
  public:
   UserServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
@@ -923,6 +1314,15 @@ class UserServiceClient : virtual public UserServiceIf {
   int64_t GetUserId(const int64_t req_id, const std::string& username, const std::map<std::string, std::string> & carrier);
   void send_GetUserId(const int64_t req_id, const std::string& username, const std::map<std::string, std::string> & carrier);
   int64_t recv_GetUserId();
+  int64_t VerifyToken(const int64_t req_id, const std::string& token, const std::map<std::string, std::string> & carrier);
+  void send_VerifyToken(const int64_t req_id, const std::string& token, const std::map<std::string, std::string> & carrier);
+  int64_t recv_VerifyToken();
+  void GetUserIds(std::map<std::string, int64_t> & _return, const int64_t req_id, const std::vector<std::string> & usernames, const std::map<std::string, std::string> & carrier);
+  void send_GetUserIds(const int64_t req_id, const std::vector<std::string> & usernames, const std::map<std::string, std::string> & carrier);
+  void recv_GetUserIds(std::map<std::string, int64_t> & _return);
+  void RegisterUsers(std::vector<UserRegistrationResult> & _return, const int64_t req_id, const std::vector<UserRegistration> & users, const std::map<std::string, std::string> & carrier);
+  void send_RegisterUsers(const int64_t req_id, const std::vector<UserRegistration> & users, const std::map<std::string, std::string> & carrier);
+  void recv_RegisterUsers(std::vector<UserRegistrationResult> & _return);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -944,6 +1344,9 @@ class UserServiceProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_ComposeCreatorWithUserId(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_ComposeCreatorWithUsername(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_GetUserId(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_VerifyToken(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_GetUserIds(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_RegisterUsers(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   UserServiceProcessor(::apache::thrift::stdcxx::shared_ptr<UserServiceIf> iface) :
     iface_(iface) {
@@ -953,6 +1356,9 @@ class UserServiceProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["ComposeCreatorWithUserId"] = &UserServiceProcessor::process_ComposeCreatorWithUserId;
     processMap_["ComposeCreatorWithUsername"] = &UserServiceProcessor::process_ComposeCreatorWithUsername;
     processMap_["GetUserId"] = &UserServiceProcessor::process_GetUserId;
+    processMap_["VerifyToken"] = &UserServiceProcessor::process_VerifyToken;
+    processMap_["GetUserIds"] = &UserServiceProcessor::process_GetUserIds;
+    processMap_["RegisterUsers"] = &UserServiceProcessor::process_RegisterUsers;
   }
 
   virtual ~UserServiceProcessor() {}
@@ -1038,6 +1444,35 @@ class UserServiceMultiface : virtual public UserServiceIf {
     return ifaces_[i]->GetUserId(req_id, username, carrier);
   }
 
+  int64_t VerifyToken(const int64_t req_id, const std::string& token, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->VerifyToken(req_id, token, carrier);
+    }
+    return ifaces_[i]->VerifyToken(req_id, token, carrier);
+  }
+
+  void GetUserIds(std::map<std::string, int64_t> & _return, const int64_t req_id, const std::vector<std::string> & usernames, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->GetUserIds(_return, req_id, usernames, carrier);
+    }
+    ifaces_[i]->GetUserIds(_return, req_id, usernames, carrier);
+    return;
+  }
+
+  void RegisterUsers(std::vector<UserRegistrationResult> & _return, const int64_t req_id, const std::vector<UserRegistration> & users, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->RegisterUsers(_return, req_id, users, carrier);
+    }
+    ifaces_[i]->RegisterUsers(_return, req_id, users, carrier);
+    return;
+  }
+
 };
 
 // The 'concurrent' client is a thread safe client that correctly handles
@@ -1086,6 +1521,15 @@ class UserServiceConcurrentClient : virtual public UserServiceIf {
   int64_t GetUserId(const int64_t req_id, const std::string& username, const std::map<std::string, std::string> & carrier);
   int32_t send_GetUserId(const int64_t req_id, const std::string& username, const std::map<std::string, std::string> & carrier);
   int64_t recv_GetUserId(const int32_t seqid);
+  int64_t VerifyToken(const int64_t req_id, const std::string& token, const std::map<std::string, std::string> & carrier);
+  int32_t send_VerifyToken(const int64_t req_id, const std::string& token, const std::map<std::string, std::string> & carrier);
+  int64_t recv_VerifyToken(const int32_t seqid);
+  void GetUserIds(std::map<std::string, int64_t> & _return, const int64_t req_id, const std::vector<std::string> & usernames, const std::map<std::string, std::string> & carrier);
+  int32_t send_GetUserIds(const int64_t req_id, const std::vector<std::string> & usernames, const std::map<std::string, std::string> & carrier);
+  void recv_GetUserIds(std::map<std::string, int64_t> & _return, const int32_t seqid);
+  void RegisterUsers(std::vector<UserRegistrationResult> & _return, const int64_t req_id, const std::vector<UserRegistration> & users, const std::map<std::string, std::string> & carrier);
+  int32_t send_RegisterUsers(const int64_t req_id, const std::vector<UserRegistration> & users, const std::map<std::string, std::string> & carrier);
+  void recv_RegisterUsers(std::vector<UserRegistrationResult> & _return, const int32_t seqid);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -373,6 +373,14 @@ uint32_t UserTimelineService_ReadUserTimeline_args::read(::apache::thrift::proto
           xfer += iprot->skip(ftype);
         }
         break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->fields);
+          this->__isset.fields = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -419,6 +427,10 @@ uint32_t UserTimelineService_ReadUserTimeline_args::write(::apache::thrift::prot
   }
   xfer += oprot->writeFieldEnd();
 
+  xfer += oprot->writeFieldBegin("fields", ::apache::thrift::protocol::T_I32, 6);
+  xfer += oprot->writeI32(this->fields);
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -463,6 +475,10 @@ uint32_t UserTimelineService_ReadUserTimeline_pargs::write(::apache::thrift::pro
   }
   xfer += oprot->writeFieldEnd();
 
+  xfer += oprot->writeFieldBegin("fields", ::apache::thrift::protocol::T_I32, 6);
+  xfer += oprot->writeI32((*(this->fields)));
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -628,6 +644,374 @@ uint32_t UserTimelineService_ReadUserTimeline_presult::read(::apache::thrift::pr
   return xfer;
 }
 
+
+UserTimelineService_WriteUserTimelines_args::~UserTimelineService_WriteUserTimelines_args() throw() {
+}
+
+
+uint32_t UserTimelineService_WriteUserTimelines_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->req_id);
+          this->__isset.req_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->post_ids.clear();
+            uint32_t _size400;
+            ::apache::thrift::protocol::TType _etype403;
+            xfer += iprot->readListBegin(_etype403, _size400);
+            this->post_ids.resize(_size400);
+            uint32_t _i404;
+            for (_i404 = 0; _i404 < _size400; ++_i404)
+            {
+              xfer += iprot->readI64(this->post_ids[_i404]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.post_ids = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->user_ids.clear();
+            uint32_t _size405;
+            ::apache::thrift::protocol::TType _etype408;
+            xfer += iprot->readListBegin(_etype408, _size405);
+            this->user_ids.resize(_size405);
+            uint32_t _i409;
+            for (_i409 = 0; _i409 < _size405; ++_i409)
+            {
+              xfer += iprot->readI64(this->user_ids[_i409]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.user_ids = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->timestamps.clear();
+            uint32_t _size410;
+            ::apache::thrift::protocol::TType _etype413;
+            xfer += iprot->readListBegin(_etype413, _size410);
+            this->timestamps.resize(_size410);
+            uint32_t _i414;
+            for (_i414 = 0; _i414 < _size410; ++_i414)
+            {
+              xfer += iprot->readI64(this->timestamps[_i414]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.timestamps = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            this->carrier.clear();
+            uint32_t _size415;
+            ::apache::thrift::protocol::TType _ktype416;
+            ::apache::thrift::protocol::TType _vtype417;
+            xfer += iprot->readMapBegin(_ktype416, _vtype417, _size415);
+            uint32_t _i419;
+            for (_i419 = 0; _i419 < _size415; ++_i419)
+            {
+              std::string _key420;
+              xfer += iprot->readString(_key420);
+              std::string& _val421 = this->carrier[_key420];
+              xfer += iprot->readString(_val421);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.carrier = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t UserTimelineService_WriteUserTimelines_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("UserTimelineService_WriteUserTimelines_args");
+
+  xfer += oprot->writeFieldBegin("req_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->req_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("post_ids", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->post_ids.size()));
+    std::vector<int64_t> ::const_iterator _iter422;
+    for (_iter422 = this->post_ids.begin(); _iter422 != this->post_ids.end(); ++_iter422)
+    {
+      xfer += oprot->writeI64((*_iter422));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("user_ids", ::apache::thrift::protocol::T_LIST, 3);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->user_ids.size()));
+    std::vector<int64_t> ::const_iterator _iter423;
+    for (_iter423 = this->user_ids.begin(); _iter423 != this->user_ids.end(); ++_iter423)
+    {
+      xfer += oprot->writeI64((*_iter423));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("timestamps", ::apache::thrift::protocol::T_LIST, 4);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->timestamps.size()));
+    std::vector<int64_t> ::const_iterator _iter424;
+    for (_iter424 = this->timestamps.begin(); _iter424 != this->timestamps.end(); ++_iter424)
+    {
+      xfer += oprot->writeI64((*_iter424));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 5);
+  {
+    xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
+    std::map<std::string, std::string> ::const_iterator _iter425;
+    for (_iter425 = this->carrier.begin(); _iter425 != this->carrier.end(); ++_iter425)
+    {
+      xfer += oprot->writeString(_iter425->first);
+      xfer += oprot->writeString(_iter425->second);
+    }
+    xfer += oprot->writeMapEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+UserTimelineService_WriteUserTimelines_pargs::~UserTimelineService_WriteUserTimelines_pargs() throw() {
+}
+
+
+uint32_t UserTimelineService_WriteUserTimelines_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("UserTimelineService_WriteUserTimelines_pargs");
+
+  xfer += oprot->writeFieldBegin("req_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64((*(this->req_id)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("post_ids", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>((*(this->post_ids)).size()));
+    std::vector<int64_t> ::const_iterator _iter426;
+    for (_iter426 = (*(this->post_ids)).begin(); _iter426 != (*(this->post_ids)).end(); ++_iter426)
+    {
+      xfer += oprot->writeI64((*_iter426));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("user_ids", ::apache::thrift::protocol::T_LIST, 3);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>((*(this->user_ids)).size()));
+    std::vector<int64_t> ::const_iterator _iter427;
+    for (_iter427 = (*(this->user_ids)).begin(); _iter427 != (*(this->user_ids)).end(); ++_iter427)
+    {
+      xfer += oprot->writeI64((*_iter427));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("timestamps", ::apache::thrift::protocol::T_LIST, 4);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>((*(this->timestamps)).size()));
+    std::vector<int64_t> ::const_iterator _iter428;
+    for (_iter428 = (*(this->timestamps)).begin(); _iter428 != (*(this->timestamps)).end(); ++_iter428)
+    {
+      xfer += oprot->writeI64((*_iter428));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 5);
+  {
+    xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
+    std::map<std::string, std::string> ::const_iterator _iter429;
+    for (_iter429 = (*(this->carrier)).begin(); _iter429 != (*(this->carrier)).end(); ++_iter429)
+    {
+      xfer += oprot->writeString(_iter429->first);
+      xfer += oprot->writeString(_iter429->second);
+    }
+    xfer += oprot->writeMapEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+UserTimelineService_WriteUserTimelines_result::~UserTimelineService_WriteUserTimelines_result() throw() {
+}
+
+
+uint32_t UserTimelineService_WriteUserTimelines_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->se.read(iprot);
+          this->__isset.se = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t UserTimelineService_WriteUserTimelines_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("UserTimelineService_WriteUserTimelines_result");
+
+  if (this->__isset.se) {
+    xfer += oprot->writeFieldBegin("se", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->se.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+UserTimelineService_WriteUserTimelines_presult::~UserTimelineService_WriteUserTimelines_presult() throw() {
+}
+
+
+uint32_t UserTimelineService_WriteUserTimelines_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->se.read(iprot);
+          this->__isset.se = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
 void UserTimelineServiceClient::WriteUserTimeline(const int64_t req_id, const int64_t post_id, const int64_t user_id, const int64_t timestamp, const std::map<std::string, std::string> & carrier)
 {
   send_WriteUserTimeline(req_id, post_id, user_id, timestamp, carrier);
@@ -688,13 +1072,13 @@ void UserTimelineServiceClient::recv_WriteUserTimeline()
   return;
 }
 
-void UserTimelineServiceClient::ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier)
+void UserTimelineServiceClient::ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields)
 {
-  send_ReadUserTimeline(req_id, user_id, start, stop, carrier);
+  send_ReadUserTimeline(req_id, user_id, start, stop, carrier, fields);
   recv_ReadUserTimeline(_return);
 }
 
-void UserTimelineServiceClient::send_ReadUserTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier)
+void UserTimelineServiceClient::send_ReadUserTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields)
 {
   int32_t cseqid = 0;
   oprot_->writeMessageBegin("ReadUserTimeline", ::apache::thrift::protocol::T_CALL, cseqid);
@@ -705,6 +1089,7 @@ void UserTimelineServiceClient::send_ReadUserTimeline(const int64_t req_id, cons
   args.start = &start;
   args.stop = &stop;
   args.carrier = &carrier;
+  args.fields = &fields;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -753,6 +1138,66 @@ void UserTimelineServiceClient::recv_ReadUserTimeline(std::vector<Post> & _retur
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ReadUserTimeline failed: unknown result");
 }
 
+void UserTimelineServiceClient::WriteUserTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::map<std::string, std::string> & carrier)
+{
+  send_WriteUserTimelines(req_id, post_ids, user_ids, timestamps, carrier);
+  recv_WriteUserTimelines();
+}
+
+void UserTimelineServiceClient::send_WriteUserTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::map<std::string, std::string> & carrier)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("WriteUserTimelines", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  UserTimelineService_WriteUserTimelines_pargs args;
+  args.req_id = &req_id;
+  args.post_ids = &post_ids;
+  args.user_ids = &user_ids;
+  args.timestamps = &timestamps;
+  args.carrier = &carrier;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void UserTimelineServiceClient::recv_WriteUserTimelines()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("WriteUserTimelines") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  UserTimelineService_WriteUserTimelines_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.se) {
+    throw result.se;
+  }
+  return;
+}
+
 bool UserTimelineServiceProcessor::dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext) {
   ProcessMap::iterator pfn;
   pfn = processMap_.find(fname);
@@ -851,7 +1296,7 @@ void UserTimelineServiceProcessor::process_ReadUserTimeline(int32_t seqid, ::apa
 
   UserTimelineService_ReadUserTimeline_result result;
   try {
-    iface_->ReadUserTimeline(result.success, args.req_id, args.user_id, args.start, args.stop, args.carrier);
+    iface_->ReadUserTimeline(result.success, args.req_id, args.user_id, args.start, args.stop, args.carrier, args.fields);
     result.__isset.success = true;
   } catch (ServiceException &se) {
     result.se = se;
@@ -885,6 +1330,62 @@ void UserTimelineServiceProcessor::process_ReadUserTimeline(int32_t seqid, ::apa
   }
 }
 
+void UserTimelineServiceProcessor::process_WriteUserTimelines(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("UserTimelineService.WriteUserTimelines", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "UserTimelineService.WriteUserTimelines");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "UserTimelineService.WriteUserTimelines");
+  }
+
+  UserTimelineService_WriteUserTimelines_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "UserTimelineService.WriteUserTimelines", bytes);
+  }
+
+  UserTimelineService_WriteUserTimelines_result result;
+  try {
+    iface_->WriteUserTimelines(args.req_id, args.post_ids, args.user_ids, args.timestamps, args.carrier);
+  } catch (ServiceException &se) {
+    result.se = se;
+    result.__isset.se = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "UserTimelineService.WriteUserTimelines");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("WriteUserTimelines", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "UserTimelineService.WriteUserTimelines");
+  }
+
+  oprot->writeMessageBegin("WriteUserTimelines", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "UserTimelineService.WriteUserTimelines", bytes);
+  }
+}
+
 ::apache::thrift::stdcxx::shared_ptr< ::apache::thrift::TProcessor > UserTimelineServiceProcessorFactory::getProcessor(const ::apache::thrift::TConnectionInfo& connInfo) {
   ::apache::thrift::ReleaseHandler< UserTimelineServiceIfFactory > cleanup(handlerFactory_);
   ::apache::thrift::stdcxx::shared_ptr< UserTimelineServiceIf > handler(handlerFactory_->getHandler(connInfo), cleanup);
@@ -978,13 +1479,13 @@ void UserTimelineServiceConcurrentClient::recv_WriteUserTimeline(const int32_t s
   } // end while(true)
 }
 
-void UserTimelineServiceConcurrentClient::ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier)
+void UserTimelineServiceConcurrentClient::ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields)
 {
-  int32_t seqid = send_ReadUserTimeline(req_id, user_id, start, stop, carrier);
+  int32_t seqid = send_ReadUserTimeline(req_id, user_id, start, stop, carrier, fields);
   recv_ReadUserTimeline(_return, seqid);
 }
 
-int32_t UserTimelineServiceConcurrentClient::send_ReadUserTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier)
+int32_t UserTimelineServiceConcurrentClient::send_ReadUserTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields)
 {
   int32_t cseqid = this->sync_.generateSeqId();
   ::apache::thrift::async::TConcurrentSendSentry sentry(&this->sync_);
@@ -996,6 +1497,7 @@ int32_t UserTimelineServiceConcurrentClient::send_ReadUserTimeline(const int64_t
   args.start = &start;
   args.stop = &stop;
   args.carrier = &carrier;
+  args.fields = &fields;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -1070,5 +1572,91 @@ void UserTimelineServiceConcurrentClient::recv_ReadUserTimeline(std::vector<Post
   } // end while(true)
 }
 
+void UserTimelineServiceConcurrentClient::WriteUserTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::map<std::string, std::string> & carrier)
+{
+  int32_t seqid = send_WriteUserTimelines(req_id, post_ids, user_ids, timestamps, carrier);
+  recv_WriteUserTimelines(seqid);
+}
+
+int32_t UserTimelineServiceConcurrentClient::send_WriteUserTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::map<std::string, std::string> & carrier)
+{
+  int32_t cseqid = this->sync_.generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(&this->sync_);
+  oprot_->writeMessageBegin("WriteUserTimelines", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  UserTimelineService_WriteUserTimelines_pargs args;
+  args.req_id = &req_id;
+  args.post_ids = &post_ids;
+  args.user_ids = &user_ids;
+  args.timestamps = &timestamps;
+  args.carrier = &carrier;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void UserTimelineServiceConcurrentClient::recv_WriteUserTimelines(const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(&this->sync_, seqid);
+
+  while(true) {
+    if(!this->sync_.getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("WriteUserTimelines") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      UserTimelineService_WriteUserTimelines_presult result;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.se) {
+        sentry.commit();
+        throw result.se;
+      }
+      sentry.commit();
+      return;
+    }
+    // seqid != rseqid
+    this->sync_.updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_.waitForWork(seqid);
+  } // end while(true)
+}
+
 } // namespace
 
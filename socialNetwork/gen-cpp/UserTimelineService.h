@@ -22,7 +22,8 @@ class UserTimelineServiceIf {
  public:
   virtual ~UserTimelineServiceIf() {}
   virtual void WriteUserTimeline(const int64_t req_id, const int64_t post_id, const int64_t user_id, const int64_t timestamp, const std::map<std::string, std::string> & carrier) = 0;
-  virtual void ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields) = 0;
+  virtual void WriteUserTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::map<std::string, std::string> & carrier) = 0;
 };
 
 class UserTimelineServiceIfFactory {
@@ -55,7 +56,10 @@ class UserTimelineServiceNull : virtual public UserTimelineServiceIf {
   void WriteUserTimeline(const int64_t /* req_id */, const int64_t /* post_id */, const int64_t /* user_id */, const int64_t /* timestamp */, const std::map<std::string, std::string> & /* carrier */) {
     return;
   }
-  void ReadUserTimeline(std::vector<Post> & /* _return */, const int64_t /* req_id */, const int64_t /* user_id */, const int32_t /* start */, const int32_t /* stop */, const std::map<std::string, std::string> & /* carrier */) {
+  void ReadUserTimeline(std::vector<Post> & /* _return */, const int64_t /* req_id */, const int64_t /* user_id */, const int32_t /* start */, const int32_t /* stop */, const std::map<std::string, std::string> & /* carrier */, const int32_t /* fields */) {
+    return;
+  }
+  void WriteUserTimelines(const int64_t /* req_id */, const std::vector<int64_t> & /* post_ids */, const std::vector<int64_t> & /* user_ids */, const std::vector<int64_t> & /* timestamps */, const std::map<std::string, std::string> & /* carrier */) {
     return;
   }
 };
@@ -193,12 +197,13 @@ class UserTimelineService_WriteUserTimeline_presult {
 };
 
 typedef struct _UserTimelineService_ReadUserTimeline_args__isset {
-  _UserTimelineService_ReadUserTimeline_args__isset() : req_id(false), user_id(false), start(false), stop(false), carrier(false) {}
+  _UserTimelineService_ReadUserTimeline_args__isset() : req_id(false), user_id(false), start(false), stop(false), carrier(false), fields(true) {}
   bool req_id :1;
   bool user_id :1;
   bool start :1;
   bool stop :1;
   bool carrier :1;
+  bool fields :1;
 } _UserTimelineService_ReadUserTimeline_args__isset;
 
 class UserTimelineService_ReadUserTimeline_args {
@@ -206,7 +211,7 @@ class UserTimelineService_ReadUserTimeline_args {
 
   UserTimelineService_ReadUserTimeline_args(const UserTimelineService_ReadUserTimeline_args&);
   UserTimelineService_ReadUserTimeline_args& operator=(const UserTimelineService_ReadUserTimeline_args&);
-  UserTimelineService_ReadUserTimeline_args() : req_id(0), user_id(0), start(0), stop(0) {
+  UserTimelineService_ReadUserTimeline_args() : req_id(0), user_id(0), start(0), stop(0), fields(511) {
   }
 
   virtual ~UserTimelineService_ReadUserTimeline_args() throw();
@@ -215,6 +220,7 @@ class UserTimelineService_ReadUserTimeline_args {
   int32_t start;
   int32_t stop;
   std::map<std::string, std::string>  carrier;
+  int32_t fields;
 
   _UserTimelineService_ReadUserTimeline_args__isset __isset;
 
@@ -228,6 +234,8 @@ class UserTimelineService_ReadUserTimeline_args {
 
   void __set_carrier(const std::map<std::string, std::string> & val);
 
+  void __set_fields(const int32_t val);
+
   bool operator == (const UserTimelineService_ReadUserTimeline_args & rhs) const
   {
     if (!(req_id == rhs.req_id))
@@ -240,6 +248,8 @@ class UserTimelineService_ReadUserTimeline_args {
       return false;
     if (!(carrier == rhs.carrier))
       return false;
+    if (!(fields == rhs.fields))
+      return false;
     return true;
   }
   bool operator != (const UserTimelineService_ReadUserTimeline_args &rhs) const {
@@ -264,6 +274,7 @@ class UserTimelineService_ReadUserTimeline_pargs {
   const int32_t* start;
   const int32_t* stop;
   const std::map<std::string, std::string> * carrier;
+  const int32_t* fields;
 
   uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
 
@@ -332,6 +343,138 @@ class UserTimelineService_ReadUserTimeline_presult {
 
 };
 
+typedef struct _UserTimelineService_WriteUserTimelines_args__isset {
+  _UserTimelineService_WriteUserTimelines_args__isset() : req_id(false), post_ids(false), user_ids(false), timestamps(false), carrier(false) {}
+  bool req_id :1;
+  bool post_ids :1;
+  bool user_ids :1;
+  bool timestamps :1;
+  bool carrier :1;
+} _UserTimelineService_WriteUserTimelines_args__isset;
+
+class UserTimelineService_WriteUserTimelines_args {
+ public:
+
+  UserTimelineService_WriteUserTimelines_args(const UserTimelineService_WriteUserTimelines_args&);
+  UserTimelineService_WriteUserTimelines_args& operator=(const UserTimelineService_WriteUserTimelines_args&);
+  UserTimelineService_WriteUserTimelines_args() : req_id(0) {
+  }
+
+  virtual ~UserTimelineService_WriteUserTimelines_args() throw();
+  int64_t req_id;
+  std::vector<int64_t>  post_ids;
+  std::vector<int64_t>  user_ids;
+  std::vector<int64_t>  timestamps;
+  std::map<std::string, std::string>  carrier;
+
+  _UserTimelineService_WriteUserTimelines_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_post_ids(const std::vector<int64_t> & val);
+
+  void __set_user_ids(const std::vector<int64_t> & val);
+
+  void __set_timestamps(const std::vector<int64_t> & val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const UserTimelineService_WriteUserTimelines_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(post_ids == rhs.post_ids))
+      return false;
+    if (!(user_ids == rhs.user_ids))
+      return false;
+    if (!(timestamps == rhs.timestamps))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const UserTimelineService_WriteUserTimelines_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const UserTimelineService_WriteUserTimelines_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class UserTimelineService_WriteUserTimelines_pargs {
+ public:
+
+
+  virtual ~UserTimelineService_WriteUserTimelines_pargs() throw();
+  const int64_t* req_id;
+  const std::vector<int64_t> * post_ids;
+  const std::vector<int64_t> * user_ids;
+  const std::vector<int64_t> * timestamps;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _UserTimelineService_WriteUserTimelines_result__isset {
+  _UserTimelineService_WriteUserTimelines_result__isset() : se(false) {}
+  bool se :1;
+} _UserTimelineService_WriteUserTimelines_result__isset;
+
+class UserTimelineService_WriteUserTimelines_result {
+ public:
+
+  UserTimelineService_WriteUserTimelines_result(const UserTimelineService_WriteUserTimelines_result&);
+  UserTimelineService_WriteUserTimelines_result& operator=(const UserTimelineService_WriteUserTimelines_result&);
+  UserTimelineService_WriteUserTimelines_result() {
+  }
+
+  virtual ~UserTimelineService_WriteUserTimelines_result() throw();
+  ServiceException se;
+
+  _UserTimelineService_WriteUserTimelines_result__isset __isset;
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const UserTimelineService_WriteUserTimelines_result & rhs) const
+  {
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const UserTimelineService_WriteUserTimelines_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const UserTimelineService_WriteUserTimelines_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _UserTimelineService_WriteUserTimelines_presult__isset {
+  _UserTimelineService_WriteUserTimelines_presult__isset() : se(false) {}
+  bool se :1;
+} _UserTimelineService_WriteUserTimelines_presult__isset;
+
+class UserTimelineService_WriteUserTimelines_presult {
+ public:
+
+
+  virtual ~UserTimelineService_WriteUserTimelines_presult() throw();
+  ServiceException se;
+
+  _UserTimelineService_WriteUserTimelines_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class UserTimelineServiceClient : virtual public UserTimelineServiceIf {
  public:
   UserTimelineServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
@@ -360,9 +503,12 @@ class UserTimelineServiceClient : virtual public UserTimelineServiceIf {
   void WriteUserTimeline(const int64_t req_id, const int64_t post_id, const int64_t user_id, const int64_t timestamp, const std::map<std::string, std::string> & carrier);
   void send_WriteUserTimeline(const int64_t req_id, const int64_t post_id, const int64_t user_id, const int64_t timestamp, const std::map<std::string, std::string> & carrier);
   void recv_WriteUserTimeline();
-  void ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
-  void send_ReadUserTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
+  void ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields);
+  void send_ReadUserTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields);
   void recv_ReadUserTimeline(std::vector<Post> & _return);
+  void WriteUserTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::map<std::string, std::string> & carrier);
+  void send_WriteUserTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::map<std::string, std::string> & carrier);
+  void recv_WriteUserTimelines();
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -380,11 +526,13 @@ class UserTimelineServiceProcessor : public ::apache::thrift::TDispatchProcessor
   ProcessMap processMap_;
   void process_WriteUserTimeline(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_ReadUserTimeline(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_WriteUserTimelines(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   UserTimelineServiceProcessor(::apache::thrift::stdcxx::shared_ptr<UserTimelineServiceIf> iface) :
     iface_(iface) {
     processMap_["WriteUserTimeline"] = &UserTimelineServiceProcessor::process_WriteUserTimeline;
     processMap_["ReadUserTimeline"] = &UserTimelineServiceProcessor::process_ReadUserTimeline;
+    processMap_["WriteUserTimelines"] = &UserTimelineServiceProcessor::process_WriteUserTimelines;
   }
 
   virtual ~UserTimelineServiceProcessor() {}
@@ -422,16 +570,25 @@ class UserTimelineServiceMultiface : virtual public UserTimelineServiceIf {
     ifaces_[i]->WriteUserTimeline(req_id, post_id, user_id, timestamp, carrier);
   }
 
-  void ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier) {
+  void ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields) {
     size_t sz = ifaces_.size();
     size_t i = 0;
     for (; i < (sz - 1); ++i) {
-      ifaces_[i]->ReadUserTimeline(_return, req_id, user_id, start, stop, carrier);
+      ifaces_[i]->ReadUserTimeline(_return, req_id, user_id, start, stop, carrier, fields);
     }
-    ifaces_[i]->ReadUserTimeline(_return, req_id, user_id, start, stop, carrier);
+    ifaces_[i]->ReadUserTimeline(_return, req_id, user_id, start, stop, carrier, fields);
     return;
   }
 
+  void WriteUserTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->WriteUserTimelines(req_id, post_ids, user_ids, timestamps, carrier);
+    }
+    ifaces_[i]->WriteUserTimelines(req_id, post_ids, user_ids, timestamps, carrier);
+  }
+
 };
 
 // The 'concurrent' client is a thread safe client that correctly handles
@@ -465,9 +622,12 @@ class UserTimelineServiceConcurrentClient : virtual public UserTimelineServiceIf
   void WriteUserTimeline(const int64_t req_id, const int64_t post_id, const int64_t user_id, const int64_t timestamp, const std::map<std::string, std::string> & carrier);
   int32_t send_WriteUserTimeline(const int64_t req_id, const int64_t post_id, const int64_t user_id, const int64_t timestamp, const std::map<std::string, std::string> & carrier);
   void recv_WriteUserTimeline(const int32_t seqid);
-  void ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
-  int32_t send_ReadUserTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
+  void ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields);
+  int32_t send_ReadUserTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier, const int32_t fields);
   void recv_ReadUserTimeline(std::vector<Post> & _return, const int32_t seqid);
+  void WriteUserTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::map<std::string, std::string> & carrier);
+  int32_t send_WriteUserTimelines(const int64_t req_id, const std::vector<int64_t> & post_ids, const std::vector<int64_t> & user_ids, const std::vector<int64_t> & timestamps, const std::map<std::string, std::string> & carrier);
+  void recv_WriteUserTimelines(const int32_t seqid);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
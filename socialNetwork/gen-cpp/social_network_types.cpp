@@ -1017,34 +1017,42 @@ void Post::__set_post_id(const int64_t val) {
 
 void Post::__set_creator(const Creator& val) {
   this->creator = val;
+  __isset.creator = true;
 }
 
 void Post::__set_req_id(const int64_t val) {
   this->req_id = val;
+  __isset.req_id = true;
 }
 
 void Post::__set_text(const std::string& val) {
   this->text = val;
+  __isset.text = true;
 }
 
 void Post::__set_user_mentions(const std::vector<UserMention> & val) {
   this->user_mentions = val;
+  __isset.user_mentions = true;
 }
 
 void Post::__set_media(const std::vector<Media> & val) {
   this->media = val;
+  __isset.media = true;
 }
 
 void Post::__set_urls(const std::vector<Url> & val) {
   this->urls = val;
+  __isset.urls = true;
 }
 
 void Post::__set_timestamp(const int64_t val) {
   this->timestamp = val;
+  __isset.timestamp = true;
 }
 
 void Post::__set_post_type(const PostType::type val) {
   this->post_type = val;
+  __isset.post_type = true;
 }
 std::ostream& operator<<(std::ostream& out, const Post& obj)
 {
@@ -1205,61 +1213,77 @@ uint32_t Post::write(::apache::thrift::protocol::TProtocol* oprot) const {
   xfer += oprot->writeI64(this->post_id);
   xfer += oprot->writeFieldEnd();
 
-  xfer += oprot->writeFieldBegin("creator", ::apache::thrift::protocol::T_STRUCT, 2);
-  xfer += this->creator.write(oprot);
-  xfer += oprot->writeFieldEnd();
+  if (this->__isset.creator) {
+    xfer += oprot->writeFieldBegin("creator", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->creator.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
 
-  xfer += oprot->writeFieldBegin("req_id", ::apache::thrift::protocol::T_I64, 3);
-  xfer += oprot->writeI64(this->req_id);
-  xfer += oprot->writeFieldEnd();
+  if (this->__isset.req_id) {
+    xfer += oprot->writeFieldBegin("req_id", ::apache::thrift::protocol::T_I64, 3);
+    xfer += oprot->writeI64(this->req_id);
+    xfer += oprot->writeFieldEnd();
+  }
 
-  xfer += oprot->writeFieldBegin("text", ::apache::thrift::protocol::T_STRING, 4);
-  xfer += oprot->writeString(this->text);
-  xfer += oprot->writeFieldEnd();
+  if (this->__isset.text) {
+    xfer += oprot->writeFieldBegin("text", ::apache::thrift::protocol::T_STRING, 4);
+    xfer += oprot->writeString(this->text);
+    xfer += oprot->writeFieldEnd();
+  }
 
-  xfer += oprot->writeFieldBegin("user_mentions", ::apache::thrift::protocol::T_LIST, 5);
-  {
-    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->user_mentions.size()));
-    std::vector<UserMention> ::const_iterator _iter43;
-    for (_iter43 = this->user_mentions.begin(); _iter43 != this->user_mentions.end(); ++_iter43)
+  if (this->__isset.user_mentions) {
+    xfer += oprot->writeFieldBegin("user_mentions", ::apache::thrift::protocol::T_LIST, 5);
     {
-      xfer += (*_iter43).write(oprot);
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->user_mentions.size()));
+      std::vector<UserMention> ::const_iterator _iter43;
+      for (_iter43 = this->user_mentions.begin(); _iter43 != this->user_mentions.end(); ++_iter43)
+      {
+        xfer += (*_iter43).write(oprot);
+      }
+      xfer += oprot->writeListEnd();
     }
-    xfer += oprot->writeListEnd();
+    xfer += oprot->writeFieldEnd();
   }
-  xfer += oprot->writeFieldEnd();
 
-  xfer += oprot->writeFieldBegin("media", ::apache::thrift::protocol::T_LIST, 6);
-  {
-    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->media.size()));
-    std::vector<Media> ::const_iterator _iter44;
-    for (_iter44 = this->media.begin(); _iter44 != this->media.end(); ++_iter44)
+  if (this->__isset.media) {
+    xfer += oprot->writeFieldBegin("media", ::apache::thrift::protocol::T_LIST, 6);
     {
-      xfer += (*_iter44).write(oprot);
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->media.size()));
+      std::vector<Media> ::const_iterator _iter44;
+      for (_iter44 = this->media.begin(); _iter44 != this->media.end(); ++_iter44)
+      {
+        xfer += (*_iter44).write(oprot);
+      }
+      xfer += oprot->writeListEnd();
     }
-    xfer += oprot->writeListEnd();
+    xfer += oprot->writeFieldEnd();
   }
-  xfer += oprot->writeFieldEnd();
 
-  xfer += oprot->writeFieldBegin("urls", ::apache::thrift::protocol::T_LIST, 7);
-  {
-    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->urls.size()));
-    std::vector<Url> ::const_iterator _iter45;
-    for (_iter45 = this->urls.begin(); _iter45 != this->urls.end(); ++_iter45)
+  if (this->__isset.urls) {
+    xfer += oprot->writeFieldBegin("urls", ::apache::thrift::protocol::T_LIST, 7);
     {
-      xfer += (*_iter45).write(oprot);
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->urls.size()));
+      std::vector<Url> ::const_iterator _iter45;
+      for (_iter45 = this->urls.begin(); _iter45 != this->urls.end(); ++_iter45)
+      {
+        xfer += (*_iter45).write(oprot);
+      }
+      xfer += oprot->writeListEnd();
     }
-    xfer += oprot->writeListEnd();
+    xfer += oprot->writeFieldEnd();
   }
-  xfer += oprot->writeFieldEnd();
 
-  xfer += oprot->writeFieldBegin("timestamp", ::apache::thrift::protocol::T_I64, 8);
-  xfer += oprot->writeI64(this->timestamp);
-  xfer += oprot->writeFieldEnd();
+  if (this->__isset.timestamp) {
+    xfer += oprot->writeFieldBegin("timestamp", ::apache::thrift::protocol::T_I64, 8);
+    xfer += oprot->writeI64(this->timestamp);
+    xfer += oprot->writeFieldEnd();
+  }
 
-  xfer += oprot->writeFieldBegin("post_type", ::apache::thrift::protocol::T_I32, 9);
-  xfer += oprot->writeI32((int32_t)this->post_type);
-  xfer += oprot->writeFieldEnd();
+  if (this->__isset.post_type) {
+    xfer += oprot->writeFieldBegin("post_type", ::apache::thrift::protocol::T_I32, 9);
+    xfer += oprot->writeI32((int32_t)this->post_type);
+    xfer += oprot->writeFieldEnd();
+  }
 
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1309,15 +1333,817 @@ void Post::printTo(std::ostream& out) const {
   using ::apache::thrift::to_string;
   out << "Post(";
   out << "post_id=" << to_string(post_id);
-  out << ", " << "creator=" << to_string(creator);
-  out << ", " << "req_id=" << to_string(req_id);
-  out << ", " << "text=" << to_string(text);
-  out << ", " << "user_mentions=" << to_string(user_mentions);
-  out << ", " << "media=" << to_string(media);
-  out << ", " << "urls=" << to_string(urls);
-  out << ", " << "timestamp=" << to_string(timestamp);
-  out << ", " << "post_type=" << to_string(post_type);
+  out << ", " << "creator="; (__isset.creator ? (out << to_string(creator)) : (out << "<null>"));
+  out << ", " << "req_id="; (__isset.req_id ? (out << to_string(req_id)) : (out << "<null>"));
+  out << ", " << "text="; (__isset.text ? (out << to_string(text)) : (out << "<null>"));
+  out << ", " << "user_mentions="; (__isset.user_mentions ? (out << to_string(user_mentions)) : (out << "<null>"));
+  out << ", " << "media="; (__isset.media ? (out << to_string(media)) : (out << "<null>"));
+  out << ", " << "urls="; (__isset.urls ? (out << to_string(urls)) : (out << "<null>"));
+  out << ", " << "timestamp="; (__isset.timestamp ? (out << to_string(timestamp)) : (out << "<null>"));
+  out << ", " << "post_type="; (__isset.post_type ? (out << to_string(post_type)) : (out << "<null>"));
+  out << ")";
+}
+
+UserRegistration::~UserRegistration() throw() {
+}
+
+
+void UserRegistration::__set_user_id(const int64_t val) {
+  this->user_id = val;
+}
+
+void UserRegistration::__set_first_name(const std::string& val) {
+  this->first_name = val;
+}
+
+void UserRegistration::__set_last_name(const std::string& val) {
+  this->last_name = val;
+}
+
+void UserRegistration::__set_username(const std::string& val) {
+  this->username = val;
+}
+
+void UserRegistration::__set_password(const std::string& val) {
+  this->password = val;
+}
+std::ostream& operator<<(std::ostream& out, const UserRegistration& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t UserRegistration::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->user_id);
+          this->__isset.user_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->first_name);
+          this->__isset.first_name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->last_name);
+          this->__isset.last_name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->username);
+          this->__isset.username = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->password);
+          this->__isset.password = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t UserRegistration::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("UserRegistration");
+
+  xfer += oprot->writeFieldBegin("user_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->user_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("first_name", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->first_name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("last_name", ::apache::thrift::protocol::T_STRING, 3);
+  xfer += oprot->writeString(this->last_name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("username", ::apache::thrift::protocol::T_STRING, 4);
+  xfer += oprot->writeString(this->username);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("password", ::apache::thrift::protocol::T_STRING, 5);
+  xfer += oprot->writeString(this->password);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(UserRegistration &a, UserRegistration &b) {
+  using ::std::swap;
+  swap(a.user_id, b.user_id);
+  swap(a.first_name, b.first_name);
+  swap(a.last_name, b.last_name);
+  swap(a.username, b.username);
+  swap(a.password, b.password);
+  swap(a.__isset, b.__isset);
+}
+
+UserRegistration::UserRegistration(const UserRegistration& other48) {
+  user_id = other48.user_id;
+  first_name = other48.first_name;
+  last_name = other48.last_name;
+  username = other48.username;
+  password = other48.password;
+  __isset = other48.__isset;
+}
+UserRegistration& UserRegistration::operator=(const UserRegistration& other49) {
+  user_id = other49.user_id;
+  first_name = other49.first_name;
+  last_name = other49.last_name;
+  username = other49.username;
+  password = other49.password;
+  __isset = other49.__isset;
+  return *this;
+}
+void UserRegistration::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "UserRegistration(";
+  out << "user_id=" << to_string(user_id);
+  out << ", " << "first_name=" << to_string(first_name);
+  out << ", " << "last_name=" << to_string(last_name);
+  out << ", " << "username=" << to_string(username);
+  out << ", " << "password=" << to_string(password);
   out << ")";
 }
 
+
+UserRegistrationResult::~UserRegistrationResult() throw() {
+}
+
+
+void UserRegistrationResult::__set_user_id(const int64_t val) {
+  this->user_id = val;
+}
+
+void UserRegistrationResult::__set_message(const std::string& val) {
+  this->message = val;
+}
+std::ostream& operator<<(std::ostream& out, const UserRegistrationResult& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t UserRegistrationResult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->user_id);
+          this->__isset.user_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->message);
+          this->__isset.message = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t UserRegistrationResult::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("UserRegistrationResult");
+
+  xfer += oprot->writeFieldBegin("user_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->user_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("message", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->message);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(UserRegistrationResult &a, UserRegistrationResult &b) {
+  using ::std::swap;
+  swap(a.user_id, b.user_id);
+  swap(a.message, b.message);
+  swap(a.__isset, b.__isset);
+}
+
+UserRegistrationResult::UserRegistrationResult(const UserRegistrationResult& other50) {
+  user_id = other50.user_id;
+  message = other50.message;
+  __isset = other50.__isset;
+}
+UserRegistrationResult& UserRegistrationResult::operator=(const UserRegistrationResult& other51) {
+  user_id = other51.user_id;
+  message = other51.message;
+  __isset = other51.__isset;
+  return *this;
+}
+void UserRegistrationResult::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "UserRegistrationResult(";
+  out << "user_id=" << to_string(user_id);
+  out << ", " << "message=" << to_string(message);
+  out << ")";
+}
+
+
+PostComposition::~PostComposition() throw() {
+}
+
+
+void PostComposition::__set_username(const std::string& val) {
+  this->username = val;
+}
+
+void PostComposition::__set_user_id(const int64_t val) {
+  this->user_id = val;
+}
+
+void PostComposition::__set_text(const std::string& val) {
+  this->text = val;
+}
+
+void PostComposition::__set_media_ids(const std::vector<int64_t> & val) {
+  this->media_ids = val;
+}
+
+void PostComposition::__set_media_types(const std::vector<std::string> & val) {
+  this->media_types = val;
+}
+
+void PostComposition::__set_post_type(const PostType::type val) {
+  this->post_type = val;
+}
+
+void PostComposition::__set_timestamp(const int64_t val) {
+  this->timestamp = val;
+}
+std::ostream& operator<<(std::ostream& out, const PostComposition& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t PostComposition::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->username);
+          this->__isset.username = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->user_id);
+          this->__isset.user_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->text);
+          this->__isset.text = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->media_ids.clear();
+            uint32_t _size52;
+            ::apache::thrift::protocol::TType _etype55;
+            xfer += iprot->readListBegin(_etype55, _size52);
+            this->media_ids.resize(_size52);
+            uint32_t _i56;
+            for (_i56 = 0; _i56 < _size52; ++_i56)
+            {
+              xfer += iprot->readI64(this->media_ids[_i56]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.media_ids = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->media_types.clear();
+            uint32_t _size57;
+            ::apache::thrift::protocol::TType _etype60;
+            xfer += iprot->readListBegin(_etype60, _size57);
+            this->media_types.resize(_size57);
+            uint32_t _i61;
+            for (_i61 = 0; _i61 < _size57; ++_i61)
+            {
+              xfer += iprot->readString(this->media_types[_i61]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.media_types = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast62;
+          xfer += iprot->readI32(ecast62);
+          this->post_type = (PostType::type)ecast62;
+          this->__isset.post_type = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 7:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->timestamp);
+          this->__isset.timestamp = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t PostComposition::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("PostComposition");
+
+  xfer += oprot->writeFieldBegin("username", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->username);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("user_id", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->user_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("text", ::apache::thrift::protocol::T_STRING, 3);
+  xfer += oprot->writeString(this->text);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("media_ids", ::apache::thrift::protocol::T_LIST, 4);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->media_ids.size()));
+    std::vector<int64_t> ::const_iterator _iter63;
+    for (_iter63 = this->media_ids.begin(); _iter63 != this->media_ids.end(); ++_iter63)
+    {
+      xfer += oprot->writeI64((*_iter63));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("media_types", ::apache::thrift::protocol::T_LIST, 5);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->media_types.size()));
+    std::vector<std::string> ::const_iterator _iter64;
+    for (_iter64 = this->media_types.begin(); _iter64 != this->media_types.end(); ++_iter64)
+    {
+      xfer += oprot->writeString((*_iter64));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("post_type", ::apache::thrift::protocol::T_I32, 6);
+  xfer += oprot->writeI32((int32_t)this->post_type);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("timestamp", ::apache::thrift::protocol::T_I64, 7);
+  xfer += oprot->writeI64(this->timestamp);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(PostComposition &a, PostComposition &b) {
+  using ::std::swap;
+  swap(a.username, b.username);
+  swap(a.user_id, b.user_id);
+  swap(a.text, b.text);
+  swap(a.media_ids, b.media_ids);
+  swap(a.media_types, b.media_types);
+  swap(a.post_type, b.post_type);
+  swap(a.timestamp, b.timestamp);
+  swap(a.__isset, b.__isset);
+}
+
+PostComposition::PostComposition(const PostComposition& other65) {
+  username = other65.username;
+  user_id = other65.user_id;
+  text = other65.text;
+  media_ids = other65.media_ids;
+  media_types = other65.media_types;
+  post_type = other65.post_type;
+  timestamp = other65.timestamp;
+  __isset = other65.__isset;
+}
+PostComposition& PostComposition::operator=(const PostComposition& other66) {
+  username = other66.username;
+  user_id = other66.user_id;
+  text = other66.text;
+  media_ids = other66.media_ids;
+  media_types = other66.media_types;
+  post_type = other66.post_type;
+  timestamp = other66.timestamp;
+  __isset = other66.__isset;
+  return *this;
+}
+void PostComposition::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "PostComposition(";
+  out << "username=" << to_string(username);
+  out << ", " << "user_id=" << to_string(user_id);
+  out << ", " << "text=" << to_string(text);
+  out << ", " << "media_ids=" << to_string(media_ids);
+  out << ", " << "media_types=" << to_string(media_types);
+  out << ", " << "post_type=" << to_string(post_type);
+  out << ", " << "timestamp=" << to_string(timestamp);
+  out << ")";
+}
+
+
+PostCompositionResult::~PostCompositionResult() throw() {
+}
+
+
+void PostCompositionResult::__set_post_id(const int64_t val) {
+  this->post_id = val;
+}
+
+void PostCompositionResult::__set_message(const std::string& val) {
+  this->message = val;
+}
+std::ostream& operator<<(std::ostream& out, const PostCompositionResult& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t PostCompositionResult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->post_id);
+          this->__isset.post_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->message);
+          this->__isset.message = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t PostCompositionResult::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("PostCompositionResult");
+
+  xfer += oprot->writeFieldBegin("post_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->post_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("message", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->message);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(PostCompositionResult &a, PostCompositionResult &b) {
+  using ::std::swap;
+  swap(a.post_id, b.post_id);
+  swap(a.message, b.message);
+  swap(a.__isset, b.__isset);
+}
+
+PostCompositionResult::PostCompositionResult(const PostCompositionResult& other67) {
+  post_id = other67.post_id;
+  message = other67.message;
+  __isset = other67.__isset;
+}
+PostCompositionResult& PostCompositionResult::operator=(const PostCompositionResult& other68) {
+  post_id = other68.post_id;
+  message = other68.message;
+  __isset = other68.__isset;
+  return *this;
+}
+void PostCompositionResult::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "PostCompositionResult(";
+  out << "post_id=" << to_string(post_id);
+  out << ", " << "message=" << to_string(message);
+  out << ")";
+}
+
+
+FollowersPage::~FollowersPage() throw() {
+}
+
+
+void FollowersPage::__set_followers(const std::vector<int64_t> & val) {
+  this->followers = val;
+}
+
+void FollowersPage::__set_next_timestamp(const int64_t val) {
+  this->next_timestamp = val;
+}
+
+void FollowersPage::__set_next_user_id(const int64_t val) {
+  this->next_user_id = val;
+}
+std::ostream& operator<<(std::ostream& out, const FollowersPage& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t FollowersPage::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->followers.clear();
+            uint32_t _size69;
+            ::apache::thrift::protocol::TType _etype72;
+            xfer += iprot->readListBegin(_etype72, _size69);
+            this->followers.resize(_size69);
+            uint32_t _i73;
+            for (_i73 = 0; _i73 < _size69; ++_i73)
+            {
+              xfer += iprot->readI64(this->followers[_i73]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.followers = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->next_timestamp);
+          this->__isset.next_timestamp = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->next_user_id);
+          this->__isset.next_user_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t FollowersPage::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("FollowersPage");
+
+  xfer += oprot->writeFieldBegin("followers", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->followers.size()));
+    std::vector<int64_t> ::const_iterator _iter74;
+    for (_iter74 = this->followers.begin(); _iter74 != this->followers.end(); ++_iter74)
+    {
+      xfer += oprot->writeI64((*_iter74));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("next_timestamp", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->next_timestamp);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("next_user_id", ::apache::thrift::protocol::T_I64, 3);
+  xfer += oprot->writeI64(this->next_user_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(FollowersPage &a, FollowersPage &b) {
+  using ::std::swap;
+  swap(a.followers, b.followers);
+  swap(a.next_timestamp, b.next_timestamp);
+  swap(a.next_user_id, b.next_user_id);
+  swap(a.__isset, b.__isset);
+}
+
+FollowersPage::FollowersPage(const FollowersPage& other75) {
+  followers = other75.followers;
+  next_timestamp = other75.next_timestamp;
+  next_user_id = other75.next_user_id;
+  __isset = other75.__isset;
+}
+FollowersPage& FollowersPage::operator=(const FollowersPage& other76) {
+  followers = other76.followers;
+  next_timestamp = other76.next_timestamp;
+  next_user_id = other76.next_user_id;
+  __isset = other76.__isset;
+  return *this;
+}
+void FollowersPage::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "FollowersPage(";
+  out << "followers=" << to_string(followers);
+  out << ", " << "next_timestamp=" << to_string(next_timestamp);
+  out << ", " << "next_user_id=" << to_string(next_user_id);
+  out << ")";
+}
+
+
 } // namespace
@@ -66,6 +66,16 @@ class TextServiceReturn;
 
 class Post;
 
+class UserRegistration;
+
+class UserRegistrationResult;
+
+class PostComposition;
+
+class PostCompositionResult;
+
+class FollowersPage;
+
 typedef struct _User__isset {
   _User__isset() : user_id(false), first_name(false), last_name(false), username(false), password_hashed(false), salt(false) {}
   bool user_id :1;
@@ -490,21 +500,37 @@ class Post : public virtual ::apache::thrift::TBase {
   {
     if (!(post_id == rhs.post_id))
       return false;
-    if (!(creator == rhs.creator))
+    if (__isset.creator != rhs.__isset.creator)
       return false;
-    if (!(req_id == rhs.req_id))
+    else if (__isset.creator && !(creator == rhs.creator))
       return false;
-    if (!(text == rhs.text))
+    if (__isset.req_id != rhs.__isset.req_id)
       return false;
-    if (!(user_mentions == rhs.user_mentions))
+    else if (__isset.req_id && !(req_id == rhs.req_id))
       return false;
-    if (!(media == rhs.media))
+    if (__isset.text != rhs.__isset.text)
       return false;
-    if (!(urls == rhs.urls))
+    else if (__isset.text && !(text == rhs.text))
       return false;
-    if (!(timestamp == rhs.timestamp))
+    if (__isset.user_mentions != rhs.__isset.user_mentions)
       return false;
-    if (!(post_type == rhs.post_type))
+    else if (__isset.user_mentions && !(user_mentions == rhs.user_mentions))
+      return false;
+    if (__isset.media != rhs.__isset.media)
+      return false;
+    else if (__isset.media && !(media == rhs.media))
+      return false;
+    if (__isset.urls != rhs.__isset.urls)
+      return false;
+    else if (__isset.urls && !(urls == rhs.urls))
+      return false;
+    if (__isset.timestamp != rhs.__isset.timestamp)
+      return false;
+    else if (__isset.timestamp && !(timestamp == rhs.timestamp))
+      return false;
+    if (__isset.post_type != rhs.__isset.post_type)
+      return false;
+    else if (__isset.post_type && !(post_type == rhs.post_type))
       return false;
     return true;
   }
@@ -524,6 +550,300 @@ void swap(Post &a, Post &b);
 
 std::ostream& operator<<(std::ostream& out, const Post& obj);
 
+typedef struct _UserRegistration__isset {
+  _UserRegistration__isset() : user_id(false), first_name(false), last_name(false), username(false), password(false) {}
+  bool user_id :1;
+  bool first_name :1;
+  bool last_name :1;
+  bool username :1;
+  bool password :1;
+} _UserRegistration__isset;
+
+class UserRegistration : public virtual ::apache::thrift::TBase {
+ public:
+
+  UserRegistration(const UserRegistration&);
+  UserRegistration& operator=(const UserRegistration&);
+  UserRegistration() : user_id(0), first_name(), last_name(), username(), password() {
+  }
+
+  virtual ~UserRegistration() throw();
+  int64_t user_id;
+  std::string first_name;
+  std::string last_name;
+  std::string username;
+  std::string password;
+
+  _UserRegistration__isset __isset;
+
+  void __set_user_id(const int64_t val);
+
+  void __set_first_name(const std::string& val);
+
+  void __set_last_name(const std::string& val);
+
+  void __set_username(const std::string& val);
+
+  void __set_password(const std::string& val);
+
+  bool operator == (const UserRegistration & rhs) const
+  {
+    if (!(user_id == rhs.user_id))
+      return false;
+    if (!(first_name == rhs.first_name))
+      return false;
+    if (!(last_name == rhs.last_name))
+      return false;
+    if (!(username == rhs.username))
+      return false;
+    if (!(password == rhs.password))
+      return false;
+    return true;
+  }
+  bool operator != (const UserRegistration &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const UserRegistration & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(UserRegistration &a, UserRegistration &b);
+
+std::ostream& operator<<(std::ostream& out, const UserRegistration& obj);
+
+typedef struct _UserRegistrationResult__isset {
+  _UserRegistrationResult__isset() : user_id(false), message(false) {}
+  bool user_id :1;
+  bool message :1;
+} _UserRegistrationResult__isset;
+
+class UserRegistrationResult : public virtual ::apache::thrift::TBase {
+ public:
+
+  UserRegistrationResult(const UserRegistrationResult&);
+  UserRegistrationResult& operator=(const UserRegistrationResult&);
+  UserRegistrationResult() : user_id(0), message() {
+  }
+
+  virtual ~UserRegistrationResult() throw();
+  int64_t user_id;
+  std::string message;
+
+  _UserRegistrationResult__isset __isset;
+
+  void __set_user_id(const int64_t val);
+
+  void __set_message(const std::string& val);
+
+  bool operator == (const UserRegistrationResult & rhs) const
+  {
+    if (!(user_id == rhs.user_id))
+      return false;
+    if (!(message == rhs.message))
+      return false;
+    return true;
+  }
+  bool operator != (const UserRegistrationResult &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const UserRegistrationResult & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(UserRegistrationResult &a, UserRegistrationResult &b);
+
+std::ostream& operator<<(std::ostream& out, const UserRegistrationResult& obj);
+
+typedef struct _PostComposition__isset {
+  _PostComposition__isset() : username(false), user_id(false), text(false), media_ids(false), media_types(false), post_type(false), timestamp(false) {}
+  bool username :1;
+  bool user_id :1;
+  bool text :1;
+  bool media_ids :1;
+  bool media_types :1;
+  bool post_type :1;
+  bool timestamp :1;
+} _PostComposition__isset;
+
+class PostComposition : public virtual ::apache::thrift::TBase {
+ public:
+
+  PostComposition(const PostComposition&);
+  PostComposition& operator=(const PostComposition&);
+  PostComposition() : username(), user_id(0), text(), post_type((PostType::type)0), timestamp(0) {
+  }
+
+  virtual ~PostComposition() throw();
+  std::string username;
+  int64_t user_id;
+  std::string text;
+  std::vector<int64_t>  media_ids;
+  std::vector<std::string>  media_types;
+  PostType::type post_type;
+  int64_t timestamp;
+
+  _PostComposition__isset __isset;
+
+  void __set_username(const std::string& val);
+
+  void __set_user_id(const int64_t val);
+
+  void __set_text(const std::string& val);
+
+  void __set_media_ids(const std::vector<int64_t> & val);
+
+  void __set_media_types(const std::vector<std::string> & val);
+
+  void __set_post_type(const PostType::type val);
+
+  void __set_timestamp(const int64_t val);
+
+  bool operator == (const PostComposition & rhs) const
+  {
+    if (!(username == rhs.username))
+      return false;
+    if (!(user_id == rhs.user_id))
+      return false;
+    if (!(text == rhs.text))
+      return false;
+    if (!(media_ids == rhs.media_ids))
+      return false;
+    if (!(media_types == rhs.media_types))
+      return false;
+    if (!(post_type == rhs.post_type))
+      return false;
+    if (!(timestamp == rhs.timestamp))
+      return false;
+    return true;
+  }
+  bool operator != (const PostComposition &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const PostComposition & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(PostComposition &a, PostComposition &b);
+
+std::ostream& operator<<(std::ostream& out, const PostComposition& obj);
+
+typedef struct _PostCompositionResult__isset {
+  _PostCompositionResult__isset() : post_id(false), message(false) {}
+  bool post_id :1;
+  bool message :1;
+} _PostCompositionResult__isset;
+
+class PostCompositionResult : public virtual ::apache::thrift::TBase {
+ public:
+
+  PostCompositionResult(const PostCompositionResult&);
+  PostCompositionResult& operator=(const PostCompositionResult&);
+  PostCompositionResult() : post_id(0), message() {
+  }
+
+  virtual ~PostCompositionResult() throw();
+  int64_t post_id;
+  std::string message;
+
+  _PostCompositionResult__isset __isset;
+
+  void __set_post_id(const int64_t val);
+
+  void __set_message(const std::string& val);
+
+  bool operator == (const PostCompositionResult & rhs) const
+  {
+    if (!(post_id == rhs.post_id))
+      return false;
+    if (!(message == rhs.message))
+      return false;
+    return true;
+  }
+  bool operator != (const PostCompositionResult &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const PostCompositionResult & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(PostCompositionResult &a, PostCompositionResult &b);
+
+std::ostream& operator<<(std::ostream& out, const PostCompositionResult& obj);
+
+typedef struct _FollowersPage__isset {
+  _FollowersPage__isset() : followers(false), next_timestamp(false), next_user_id(false) {}
+  bool followers :1;
+  bool next_timestamp :1;
+  bool next_user_id :1;
+} _FollowersPage__isset;
+
+class FollowersPage : public virtual ::apache::thrift::TBase {
+ public:
+
+  FollowersPage(const FollowersPage&);
+  FollowersPage& operator=(const FollowersPage&);
+  FollowersPage() : next_timestamp(0), next_user_id(0) {
+  }
+
+  virtual ~FollowersPage() throw();
+  std::vector<int64_t>  followers;
+  int64_t next_timestamp;
+  int64_t next_user_id;
+
+  _FollowersPage__isset __isset;
+
+  void __set_followers(const std::vector<int64_t> & val);
+
+  void __set_next_timestamp(const int64_t val);
+
+  void __set_next_user_id(const int64_t val);
+
+  bool operator == (const FollowersPage & rhs) const
+  {
+    if (!(followers == rhs.followers))
+      return false;
+    if (!(next_timestamp == rhs.next_timestamp))
+      return false;
+    if (!(next_user_id == rhs.next_user_id))
+      return false;
+    return true;
+  }
+  bool operator != (const FollowersPage &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const FollowersPage & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(FollowersPage &a, FollowersPage &b);
+
+std::ostream& operator<<(std::ostream& out, const FollowersPage& obj);
+
 } // namespace
 
 #endif
@@ -26,7 +26,8 @@ local ReadHomeTimeline_args = __TObject:new{
   user_id,
   start,
   stop,
-  carrier
+  carrier,
+  fields = 511
 }
 
 function ReadHomeTimeline_args:read(iprot)
@@ -72,6 +73,12 @@ function ReadHomeTimeline_args:read(iprot)
       else
         iprot:skip(ftype)
       end
+    elseif fid == 6 then
+      if ftype == TType.I32 then
+        self.fields = iprot:readI32()
+      else
+        iprot:skip(ftype)
+      end
     else
       iprot:skip(ftype)
     end
@@ -112,6 +119,11 @@ function ReadHomeTimeline_args:write(oprot)
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
   end
+  if self.fields ~= nil then
+    oprot:writeFieldBegin('fields', TType.I32, 6)
+    oprot:writeI32(self.fields)
+    oprot:writeFieldEnd()
+  end
   oprot:writeFieldStop()
   oprot:writeStructEnd()
 end
@@ -332,12 +344,12 @@ local HomeTimelineServiceClient = __TObject.new(__TClient, {
   __type = 'HomeTimelineServiceClient'
 })
 
-function HomeTimelineServiceClient:ReadHomeTimeline(req_id, user_id, start, stop, carrier)
-  self:send_ReadHomeTimeline(req_id, user_id, start, stop, carrier)
-  return self:recv_ReadHomeTimeline(req_id, user_id, start, stop, carrier)
+function HomeTimelineServiceClient:ReadHomeTimeline(req_id, user_id, start, stop, carrier, fields)
+  self:send_ReadHomeTimeline(req_id, user_id, start, stop, carrier, fields)
+  return self:recv_ReadHomeTimeline(req_id, user_id, start, stop, carrier, fields)
 end
 
-function HomeTimelineServiceClient:send_ReadHomeTimeline(req_id, user_id, start, stop, carrier)
+function HomeTimelineServiceClient:send_ReadHomeTimeline(req_id, user_id, start, stop, carrier, fields)
   self.oprot:writeMessageBegin('ReadHomeTimeline', TMessageType.CALL, self._seqid)
   local args = ReadHomeTimeline_args:new{}
   args.req_id = req_id
@@ -345,12 +357,13 @@ function HomeTimelineServiceClient:send_ReadHomeTimeline(req_id, user_id, start,
   args.start = start
   args.stop = stop
   args.carrier = carrier
+  args.fields = fields
   args:write(self.oprot)
   self.oprot:writeMessageEnd()
   self.oprot.trans:flush()
 end
 
-function HomeTimelineServiceClient:recv_ReadHomeTimeline(req_id, user_id, start, stop, carrier)
+function HomeTimelineServiceClient:recv_ReadHomeTimeline(req_id, user_id, start, stop, carrier, fields)
   local fname, mtype, rseqid = self.iprot:readMessageBegin()
   if mtype == TMessageType.EXCEPTION then
     local x = TApplicationException:new{}
@@ -434,7 +447,7 @@ function HomeTimelineServiceProcessor:process_ReadHomeTimeline(seqid, iprot, opr
   args:read(iprot)
   iprot:readMessageEnd()
   local result = ReadHomeTimeline_result:new{}
-  local status, res = pcall(self.handler.ReadHomeTimeline, self.handler, args.req_id, args.user_id, args.start, args.stop, args.carrier)
+  local status, res = pcall(self.handler.ReadHomeTimeline, self.handler, args.req_id, args.user_id, args.start, args.stop, args.carrier, args.fields)
   if not status then
     reply_type = TMessageType.EXCEPTION
     result = TApplicationException:new{message = res}
@@ -77,23 +77,24 @@ function PostStorageServiceClient:recv_ReadPost(req_id, post_id, carrier)
   error(TApplicationException:new{errorCode = TApplicationException.MISSING_RESULT})
 end
 
-function PostStorageServiceClient:ReadPosts(req_id, post_ids, carrier)
-  self:send_ReadPosts(req_id, post_ids, carrier)
-  return self:recv_ReadPosts(req_id, post_ids, carrier)
+function PostStorageServiceClient:ReadPosts(req_id, post_ids, carrier, fields)
+  self:send_ReadPosts(req_id, post_ids, carrier, fields)
+  return self:recv_ReadPosts(req_id, post_ids, carrier, fields)
 end
 
-function PostStorageServiceClient:send_ReadPosts(req_id, post_ids, carrier)
+function PostStorageServiceClient:send_ReadPosts(req_id, post_ids, carrier, fields)
   self.oprot:writeMessageBegin('ReadPosts', TMessageType.CALL, self._seqid)
   local args = ReadPosts_args:new{}
   args.req_id = req_id
   args.post_ids = post_ids
   args.carrier = carrier
+  args.fields = fields
   args:write(self.oprot)
   self.oprot:writeMessageEnd()
   self.oprot.trans:flush()
 end
 
-function PostStorageServiceClient:recv_ReadPosts(req_id, post_ids, carrier)
+function PostStorageServiceClient:recv_ReadPosts(req_id, post_ids, carrier, fields)
   local fname, mtype, rseqid = self.iprot:readMessageBegin()
   if mtype == TMessageType.EXCEPTION then
     local x = TApplicationException:new{}
@@ -187,7 +188,7 @@ function PostStorageServiceProcessor:process_ReadPosts(seqid, iprot, oprot, serv
   args:read(iprot)
   iprot:readMessageEnd()
   local result = ReadPosts_result:new{}
-  local status, res = pcall(self.handler.ReadPosts, self.handler, args.req_id, args.post_ids, args.carrier)
+  local status, res = pcall(self.handler.ReadPosts, self.handler, args.req_id, args.post_ids, args.carrier, args.fields)
   if not status then
     reply_type = TMessageType.EXCEPTION
     result = TApplicationException:new{message = res}
@@ -435,7 +436,8 @@ end
 ReadPosts_args = __TObject:new{
   req_id,
   post_ids,
-  carrier
+  carrier,
+  fields = 511
 }
 
 function ReadPosts_args:read(iprot)
@@ -475,6 +477,12 @@ function ReadPosts_args:read(iprot)
       else
         iprot:skip(ftype)
       end
+    elseif fid == 4 then
+      if ftype == TType.I32 then
+        self.fields = iprot:readI32()
+      else
+        iprot:skip(ftype)
+      end
     else
       iprot:skip(ftype)
     end
@@ -509,6 +517,11 @@ function ReadPosts_args:write(oprot)
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
   end
+  if self.fields ~= nil then
+    oprot:writeFieldBegin('fields', TType.I32, 4)
+    oprot:writeI32(self.fields)
+    oprot:writeFieldEnd()
+  end
   oprot:writeFieldStop()
   oprot:writeStructEnd()
 end
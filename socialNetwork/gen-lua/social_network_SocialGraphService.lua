@@ -861,6 +861,284 @@ function InsertUser_result:write(oprot)
   oprot:writeStructEnd()
 end
 
+local FollowMany_args = __TObject:new{
+  req_id,
+  user_ids,
+  followee_ids,
+  carrier
+}
+
+function FollowMany_args:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 1 then
+      if ftype == TType.I64 then
+        self.req_id = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 2 then
+      if ftype == TType.LIST then
+        self.user_ids = {}
+        local _etype403, _size400 = iprot:readListBegin()
+        for _i=1,_size400 do
+          local _elem404 = iprot:readI64()
+          table.insert(self.user_ids, _elem404)
+        end
+        iprot:readListEnd()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 3 then
+      if ftype == TType.LIST then
+        self.followee_ids = {}
+        local _etype408, _size405 = iprot:readListBegin()
+        for _i=1,_size405 do
+          local _elem409 = iprot:readI64()
+          table.insert(self.followee_ids, _elem409)
+        end
+        iprot:readListEnd()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 4 then
+      if ftype == TType.MAP then
+        self.carrier = {}
+        local _ktype411, _vtype412, _size410 = iprot:readMapBegin()
+        for _i=1,_size410 do
+          local _key413 = iprot:readString()
+          local _val414 = iprot:readString()
+          self.carrier[_key413] = _val414
+        end
+        iprot:readMapEnd()
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function FollowMany_args:write(oprot)
+  oprot:writeStructBegin('FollowMany_args')
+  if self.req_id ~= nil then
+    oprot:writeFieldBegin('req_id', TType.I64, 1)
+    oprot:writeI64(self.req_id)
+    oprot:writeFieldEnd()
+  end
+  if self.user_ids ~= nil then
+    oprot:writeFieldBegin('user_ids', TType.LIST, 2)
+    oprot:writeListBegin(TType.I64, #self.user_ids)
+    for _,iter417 in ipairs(self.user_ids) do
+      oprot:writeI64(iter417)
+    end
+    oprot:writeListEnd()
+    oprot:writeFieldEnd()
+  end
+  if self.followee_ids ~= nil then
+    oprot:writeFieldBegin('followee_ids', TType.LIST, 3)
+    oprot:writeListBegin(TType.I64, #self.followee_ids)
+    for _,iter418 in ipairs(self.followee_ids) do
+      oprot:writeI64(iter418)
+    end
+    oprot:writeListEnd()
+    oprot:writeFieldEnd()
+  end
+  if self.carrier ~= nil then
+    oprot:writeFieldBegin('carrier', TType.MAP, 4)
+    oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
+    for kiter415,viter416 in pairs(self.carrier) do
+      oprot:writeString(kiter415)
+      oprot:writeString(viter416)
+    end
+    oprot:writeMapEnd()
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
+local FollowMany_result = __TObject:new{
+  se
+}
+
+function FollowMany_result:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 1 then
+      if ftype == TType.STRUCT then
+        self.se = ServiceException:new{}
+        self.se:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function FollowMany_result:write(oprot)
+  oprot:writeStructBegin('FollowMany_result')
+  if self.se ~= nil then
+    oprot:writeFieldBegin('se', TType.STRUCT, 1)
+    self.se:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
+local UnfollowMany_args = __TObject:new{
+  req_id,
+  user_ids,
+  followee_ids,
+  carrier
+}
+
+function UnfollowMany_args:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 1 then
+      if ftype == TType.I64 then
+        self.req_id = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 2 then
+      if ftype == TType.LIST then
+        self.user_ids = {}
+        local _etype422, _size419 = iprot:readListBegin()
+        for _i=1,_size419 do
+          local _elem423 = iprot:readI64()
+          table.insert(self.user_ids, _elem423)
+        end
+        iprot:readListEnd()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 3 then
+      if ftype == TType.LIST then
+        self.followee_ids = {}
+        local _etype427, _size424 = iprot:readListBegin()
+        for _i=1,_size424 do
+          local _elem428 = iprot:readI64()
+          table.insert(self.followee_ids, _elem428)
+        end
+        iprot:readListEnd()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 4 then
+      if ftype == TType.MAP then
+        self.carrier = {}
+        local _ktype430, _vtype431, _size429 = iprot:readMapBegin()
+        for _i=1,_size429 do
+          local _key432 = iprot:readString()
+          local _val433 = iprot:readString()
+          self.carrier[_key432] = _val433
+        end
+        iprot:readMapEnd()
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function UnfollowMany_args:write(oprot)
+  oprot:writeStructBegin('UnfollowMany_args')
+  if self.req_id ~= nil then
+    oprot:writeFieldBegin('req_id', TType.I64, 1)
+    oprot:writeI64(self.req_id)
+    oprot:writeFieldEnd()
+  end
+  if self.user_ids ~= nil then
+    oprot:writeFieldBegin('user_ids', TType.LIST, 2)
+    oprot:writeListBegin(TType.I64, #self.user_ids)
+    for _,iter436 in ipairs(self.user_ids) do
+      oprot:writeI64(iter436)
+    end
+    oprot:writeListEnd()
+    oprot:writeFieldEnd()
+  end
+  if self.followee_ids ~= nil then
+    oprot:writeFieldBegin('followee_ids', TType.LIST, 3)
+    oprot:writeListBegin(TType.I64, #self.followee_ids)
+    for _,iter437 in ipairs(self.followee_ids) do
+      oprot:writeI64(iter437)
+    end
+    oprot:writeListEnd()
+    oprot:writeFieldEnd()
+  end
+  if self.carrier ~= nil then
+    oprot:writeFieldBegin('carrier', TType.MAP, 4)
+    oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
+    for kiter434,viter435 in pairs(self.carrier) do
+      oprot:writeString(kiter434)
+      oprot:writeString(viter435)
+    end
+    oprot:writeMapEnd()
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
+local UnfollowMany_result = __TObject:new{
+  se
+}
+
+function UnfollowMany_result:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 1 then
+      if ftype == TType.STRUCT then
+        self.se = ServiceException:new{}
+        self.se:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function UnfollowMany_result:write(oprot)
+  oprot:writeStructBegin('UnfollowMany_result')
+  if self.se ~= nil then
+    oprot:writeFieldBegin('se', TType.STRUCT, 1)
+    self.se:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
 local SocialGraphServiceClient = __TObject.new(__TClient, {
   __type = 'SocialGraphServiceClient'
 })
@@ -1098,6 +1376,72 @@ function SocialGraphServiceClient:recv_InsertUser(req_id, user_id, carrier)
     error(result.se)
   end
 end
+
+function SocialGraphServiceClient:FollowMany(req_id, user_ids, followee_ids, carrier)
+  self:send_FollowMany(req_id, user_ids, followee_ids, carrier)
+  self:recv_FollowMany(req_id, user_ids, followee_ids, carrier)
+end
+
+function SocialGraphServiceClient:send_FollowMany(req_id, user_ids, followee_ids, carrier)
+  self.oprot:writeMessageBegin('FollowMany', TMessageType.CALL, self._seqid)
+  local args = FollowMany_args:new{}
+  args.req_id = req_id
+  args.user_ids = user_ids
+  args.followee_ids = followee_ids
+  args.carrier = carrier
+  args:write(self.oprot)
+  self.oprot:writeMessageEnd()
+  self.oprot.trans:flush()
+end
+
+function SocialGraphServiceClient:recv_FollowMany(req_id, user_ids, followee_ids, carrier)
+  local fname, mtype, rseqid = self.iprot:readMessageBegin()
+  if mtype == TMessageType.EXCEPTION then
+    local x = TApplicationException:new{}
+    x:read(self.iprot)
+    self.iprot:readMessageEnd()
+    error(x)
+  end
+  local result = FollowMany_result:new{}
+  result:read(self.iprot)
+  self.iprot:readMessageEnd()
+  if result.se then
+    error(result.se)
+  end
+end
+
+function SocialGraphServiceClient:UnfollowMany(req_id, user_ids, followee_ids, carrier)
+  self:send_UnfollowMany(req_id, user_ids, followee_ids, carrier)
+  self:recv_UnfollowMany(req_id, user_ids, followee_ids, carrier)
+end
+
+function SocialGraphServiceClient:send_UnfollowMany(req_id, user_ids, followee_ids, carrier)
+  self.oprot:writeMessageBegin('UnfollowMany', TMessageType.CALL, self._seqid)
+  local args = UnfollowMany_args:new{}
+  args.req_id = req_id
+  args.user_ids = user_ids
+  args.followee_ids = followee_ids
+  args.carrier = carrier
+  args:write(self.oprot)
+  self.oprot:writeMessageEnd()
+  self.oprot.trans:flush()
+end
+
+function SocialGraphServiceClient:recv_UnfollowMany(req_id, user_ids, followee_ids, carrier)
+  local fname, mtype, rseqid = self.iprot:readMessageBegin()
+  if mtype == TMessageType.EXCEPTION then
+    local x = TApplicationException:new{}
+    x:read(self.iprot)
+    self.iprot:readMessageEnd()
+    error(x)
+  end
+  local result = UnfollowMany_result:new{}
+  result:read(self.iprot)
+  self.iprot:readMessageEnd()
+  if result.se then
+    error(result.se)
+  end
+end
 local SocialGraphServiceIface = __TObject:new{
   __type = 'SocialGraphServiceIface'
 }
@@ -1273,6 +1617,48 @@ function SocialGraphServiceProcessor:process_InsertUser(seqid, iprot, oprot, ser
   oprot.trans:flush()
 end
 
+function SocialGraphServiceProcessor:process_FollowMany(seqid, iprot, oprot, server_ctx)
+  local args = FollowMany_args:new{}
+  local reply_type = TMessageType.REPLY
+  args:read(iprot)
+  iprot:readMessageEnd()
+  local result = FollowMany_result:new{}
+  local status, res = pcall(self.handler.FollowMany, self.handler, args.req_id, args.user_ids, args.followee_ids, args.carrier)
+  if not status then
+    reply_type = TMessageType.EXCEPTION
+    result = TApplicationException:new{message = res}
+  elseif ttype(res) == 'ServiceException' then
+    result.se = res
+  else
+    result.success = res
+  end
+  oprot:writeMessageBegin('FollowMany', reply_type, seqid)
+  result:write(oprot)
+  oprot:writeMessageEnd()
+  oprot.trans:flush()
+end
+
+function SocialGraphServiceProcessor:process_UnfollowMany(seqid, iprot, oprot, server_ctx)
+  local args = UnfollowMany_args:new{}
+  local reply_type = TMessageType.REPLY
+  args:read(iprot)
+  iprot:readMessageEnd()
+  local result = UnfollowMany_result:new{}
+  local status, res = pcall(self.handler.UnfollowMany, self.handler, args.req_id, args.user_ids, args.followee_ids, args.carrier)
+  if not status then
+    reply_type = TMessageType.EXCEPTION
+    result = TApplicationException:new{message = res}
+  elseif ttype(res) == 'ServiceException' then
+    result.se = res
+  else
+    result.success = res
+  end
+  oprot:writeMessageBegin('UnfollowMany', reply_type, seqid)
+  result:write(oprot)
+  oprot:writeMessageEnd()
+  oprot.trans:flush()
+end
+
 return {
   SocialGraphServiceClient = SocialGraphServiceClient
 }
\ No newline at end of file
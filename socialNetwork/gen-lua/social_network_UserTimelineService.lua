@@ -157,7 +157,8 @@ local ReadUserTimeline_args = __TObject:new{
   user_id,
   start,
   stop,
-  carrier
+  carrier,
+  fields = 511
 }
 
 function ReadUserTimeline_args:read(iprot)
@@ -203,6 +204,12 @@ function ReadUserTimeline_args:read(iprot)
       else
         iprot:skip(ftype)
       end
+    elseif fid == 6 then
+      if ftype == TType.I32 then
+        self.fields = iprot:readI32()
+      else
+        iprot:skip(ftype)
+      end
     else
       iprot:skip(ftype)
     end
@@ -243,6 +250,11 @@ function ReadUserTimeline_args:write(oprot)
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
   end
+  if self.fields ~= nil then
+    oprot:writeFieldBegin('fields', TType.I32, 6)
+    oprot:writeI32(self.fields)
+    oprot:writeFieldEnd()
+  end
   oprot:writeFieldStop()
   oprot:writeStructEnd()
 end
@@ -344,12 +356,12 @@ function UserTimelineServiceClient:recv_WriteUserTimeline(req_id, post_id, user_
   end
 end
 
-function UserTimelineServiceClient:ReadUserTimeline(req_id, user_id, start, stop, carrier)
-  self:send_ReadUserTimeline(req_id, user_id, start, stop, carrier)
-  return self:recv_ReadUserTimeline(req_id, user_id, start, stop, carrier)
+function UserTimelineServiceClient:ReadUserTimeline(req_id, user_id, start, stop, carrier, fields)
+  self:send_ReadUserTimeline(req_id, user_id, start, stop, carrier, fields)
+  return self:recv_ReadUserTimeline(req_id, user_id, start, stop, carrier, fields)
 end
 
-function UserTimelineServiceClient:send_ReadUserTimeline(req_id, user_id, start, stop, carrier)
+function UserTimelineServiceClient:send_ReadUserTimeline(req_id, user_id, start, stop, carrier, fields)
   self.oprot:writeMessageBegin('ReadUserTimeline', TMessageType.CALL, self._seqid)
   local args = ReadUserTimeline_args:new{}
   args.req_id = req_id
@@ -357,12 +369,13 @@ function UserTimelineServiceClient:send_ReadUserTimeline(req_id, user_id, start,
   args.start = start
   args.stop = stop
   args.carrier = carrier
+  args.fields = fields
   args:write(self.oprot)
   self.oprot:writeMessageEnd()
   self.oprot.trans:flush()
 end
 
-function UserTimelineServiceClient:recv_ReadUserTimeline(req_id, user_id, start, stop, carrier)
+function UserTimelineServiceClient:recv_ReadUserTimeline(req_id, user_id, start, stop, carrier, fields)
   local fname, mtype, rseqid = self.iprot:readMessageBegin()
   if mtype == TMessageType.EXCEPTION then
     local x = TApplicationException:new{}
@@ -435,7 +448,7 @@ function UserTimelineServiceProcessor:process_ReadUserTimeline(seqid, iprot, opr
   args:read(iprot)
   iprot:readMessageEnd()
   local result = ReadUserTimeline_result:new{}
-  local status, res = pcall(self.handler.ReadUserTimeline, self.handler, args.req_id, args.user_id, args.start, args.stop, args.carrier)
+  local status, res = pcall(self.handler.ReadUserTimeline, self.handler, args.req_id, args.user_id, args.start, args.stop, args.carrier, args.fields)
   if not status then
     reply_type = TMessageType.EXCEPTION
     result = TApplicationException:new{message = res}
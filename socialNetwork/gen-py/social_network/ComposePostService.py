@@ -19,16 +19,27 @@ all_structs = []
 
 
 class Iface(object):
-    def ComposePost(self, req_id, user_name, user_id, text, media_ids, media_types, post_type):
+    def ComposePost(self, req_id, username, user_id, text, media_ids, media_types, post_type, carrier):
         """
         Parameters:
          - req_id
-         - user_name
+         - username
          - user_id
          - text
          - media_ids
          - media_types
          - post_type
+         - carrier
+
+        """
+        pass
+
+    def ComposePosts(self, req_id, posts, carrier):
+        """
+        Parameters:
+         - req_id
+         - posts
+         - carrier
 
         """
         pass
@@ -41,31 +52,33 @@ class Client(Iface):
             self._oprot = oprot
         self._seqid = 0
 
-    def ComposePost(self, req_id, user_name, user_id, text, media_ids, media_types, post_type):
+    def ComposePost(self, req_id, username, user_id, text, media_ids, media_types, post_type, carrier):
         """
         Parameters:
          - req_id
-         - user_name
+         - username
          - user_id
          - text
          - media_ids
          - media_types
          - post_type
+         - carrier
 
         """
-        self.send_ComposePost(req_id, user_name, user_id, text, media_ids, media_types, post_type)
+        self.send_ComposePost(req_id, username, user_id, text, media_ids, media_types, post_type, carrier)
         self.recv_ComposePost()
 
-    def send_ComposePost(self, req_id, user_name, user_id, text, media_ids, media_types, post_type):
+    def send_ComposePost(self, req_id, username, user_id, text, media_ids, media_types, post_type, carrier):
         self._oprot.writeMessageBegin('ComposePost', TMessageType.CALL, self._seqid)
         args = ComposePost_args()
         args.req_id = req_id
-        args.user_name = user_name
+        args.username = username
         args.user_id = user_id
         args.text = text
         args.media_ids = media_ids
         args.media_types = media_types
         args.post_type = post_type
+        args.carrier = carrier
         args.write(self._oprot)
         self._oprot.writeMessageEnd()
         self._oprot.trans.flush()
@@ -85,12 +98,51 @@ class Client(Iface):
             raise result.se
         return
 
+    def ComposePosts(self, req_id, posts, carrier):
+        """
+        Parameters:
+         - req_id
+         - posts
+         - carrier
+
+        """
+        self.send_ComposePosts(req_id, posts, carrier)
+        return self.recv_ComposePosts()
+
+    def send_ComposePosts(self, req_id, posts, carrier):
+        self._oprot.writeMessageBegin('ComposePosts', TMessageType.CALL, self._seqid)
+        args = ComposePosts_args()
+        args.req_id = req_id
+        args.posts = posts
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_ComposePosts(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = ComposePosts_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.se is not None:
+            raise result.se
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "ComposePosts failed: unknown result")
+
 
 class Processor(Iface, TProcessor):
     def __init__(self, handler):
         self._handler = handler
         self._processMap = {}
         self._processMap["ComposePost"] = Processor.process_ComposePost
+        self._processMap["ComposePosts"] = Processor.process_ComposePosts
 
     def process(self, iprot, oprot):
         (name, type, seqid) = iprot.readMessageBegin()
@@ -113,7 +165,7 @@ class Processor(Iface, TProcessor):
         iprot.readMessageEnd()
         result = ComposePost_result()
         try:
-            self._handler.ComposePost(args.req_id, args.user_name, args.user_id, args.text, args.media_ids, args.media_types, args.post_type)
+            self._handler.ComposePost(args.req_id, args.username, args.user_id, args.text, args.media_ids, args.media_types, args.post_type, args.carrier)
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
@@ -133,6 +185,32 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_ComposePosts(self, seqid, iprot, oprot):
+        args = ComposePosts_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = ComposePosts_result()
+        try:
+            result.success = self._handler.ComposePosts(args.req_id, args.posts, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("ComposePosts", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
 # HELPER FUNCTIONS AND STRUCTURES
 
 
@@ -140,24 +218,26 @@ class ComposePost_args(object):
     """
     Attributes:
      - req_id
-     - user_name
+     - username
      - user_id
      - text
      - media_ids
      - media_types
      - post_type
+     - carrier
 
     """
 
 
-    def __init__(self, req_id=None, user_name=None, user_id=None, text=None, media_ids=None, media_types=None, post_type=None,):
+    def __init__(self, req_id=None, username=None, user_id=None, text=None, media_ids=None, media_types=None, post_type=None, carrier=None,):
         self.req_id = req_id
-        self.user_name = user_name
+        self.username = username
         self.user_id = user_id
         self.text = text
         self.media_ids = media_ids
         self.media_types = media_types
         self.post_type = post_type
+        self.carrier = carrier
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -175,7 +255,7 @@ class ComposePost_args(object):
                     iprot.skip(ftype)
             elif fid == 2:
                 if ftype == TType.STRING:
-                    self.user_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                    self.username = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
@@ -191,20 +271,20 @@ class ComposePost_args(object):
             elif fid == 5:
                 if ftype == TType.LIST:
                     self.media_ids = []
-                    (_etype96, _size93) = iprot.readListBegin()
-                    for _i97 in range(_size93):
-                        _elem98 = iprot.readI64()
-                        self.media_ids.append(_elem98)
+                    (_etype220, _size217) = iprot.readListBegin()
+                    for _i221 in range(_size217):
+                        _elem222 = iprot.readI64()
+                        self.media_ids.append(_elem222)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 6:
                 if ftype == TType.LIST:
                     self.media_types = []
-                    (_etype102, _size99) = iprot.readListBegin()
-                    for _i103 in range(_size99):
-                        _elem104 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.media_types.append(_elem104)
+                    (_etype226, _size223) = iprot.readListBegin()
+                    for _i227 in range(_size223):
+                        _elem228 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.media_types.append(_elem228)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -213,6 +293,17 @@ class ComposePost_args(object):
                     self.post_type = iprot.readI32()
                 else:
                     iprot.skip(ftype)
+            elif fid == 8:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype230, _vtype231, _size229) = iprot.readMapBegin()
+                    for _i233 in range(_size229):
+                        _key234 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val235 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key234] = _val235
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -227,9 +318,9 @@ class ComposePost_args(object):
             oprot.writeFieldBegin('req_id', TType.I64, 1)
             oprot.writeI64(self.req_id)
             oprot.writeFieldEnd()
-        if self.user_name is not None:
-            oprot.writeFieldBegin('user_name', TType.STRING, 2)
-            oprot.writeString(self.user_name.encode('utf-8') if sys.version_info[0] == 2 else self.user_name)
+        if self.username is not None:
+            oprot.writeFieldBegin('username', TType.STRING, 2)
+            oprot.writeString(self.username.encode('utf-8') if sys.version_info[0] == 2 else self.username)
             oprot.writeFieldEnd()
         if self.user_id is not None:
             oprot.writeFieldBegin('user_id', TType.I64, 3)
@@ -242,21 +333,29 @@ class ComposePost_args(object):
         if self.media_ids is not None:
             oprot.writeFieldBegin('media_ids', TType.LIST, 5)
             oprot.writeListBegin(TType.I64, len(self.media_ids))
-            for iter105 in self.media_ids:
-                oprot.writeI64(iter105)
+            for iter236 in self.media_ids:
+                oprot.writeI64(iter236)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.media_types is not None:
             oprot.writeFieldBegin('media_types', TType.LIST, 6)
             oprot.writeListBegin(TType.STRING, len(self.media_types))
-            for iter106 in self.media_types:
-                oprot.writeString(iter106.encode('utf-8') if sys.version_info[0] == 2 else iter106)
+            for iter237 in self.media_types:
+                oprot.writeString(iter237.encode('utf-8') if sys.version_info[0] == 2 else iter237)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.post_type is not None:
             oprot.writeFieldBegin('post_type', TType.I32, 7)
             oprot.writeI32(self.post_type)
             oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 8)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter238, viter239 in self.carrier.items():
+                oprot.writeString(kiter238.encode('utf-8') if sys.version_info[0] == 2 else kiter238)
+                oprot.writeString(viter239.encode('utf-8') if sys.version_info[0] == 2 else viter239)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -277,12 +376,13 @@ all_structs.append(ComposePost_args)
 ComposePost_args.thrift_spec = (
     None,  # 0
     (1, TType.I64, 'req_id', None, None, ),  # 1
-    (2, TType.STRING, 'user_name', 'UTF8', None, ),  # 2
+    (2, TType.STRING, 'username', 'UTF8', None, ),  # 2
     (3, TType.I64, 'user_id', None, None, ),  # 3
     (4, TType.STRING, 'text', 'UTF8', None, ),  # 4
     (5, TType.LIST, 'media_ids', (TType.I64, None, False), None, ),  # 5
     (6, TType.LIST, 'media_types', (TType.STRING, 'UTF8', False), None, ),  # 6
     (7, TType.I32, 'post_type', None, None, ),  # 7
+    (8, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 8
 )
 
 
@@ -347,6 +447,194 @@ ComposePost_result.thrift_spec = (
     None,  # 0
     (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
 )
+
+
+class ComposePosts_args(object):
+    """
+    Attributes:
+     - req_id
+     - posts
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, posts=None, carrier=None,):
+        self.req_id = req_id
+        self.posts = posts
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.LIST:
+                    self.posts = []
+                    (_etype243, _size240) = iprot.readListBegin()
+                    for _i244 in range(_size240):
+                        _elem245 = PostComposition()
+                        _elem245.read(iprot)
+                        self.posts.append(_elem245)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype247, _vtype248, _size246) = iprot.readMapBegin()
+                    for _i250 in range(_size246):
+                        _key251 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val252 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key251] = _val252
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('ComposePosts_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.posts is not None:
+            oprot.writeFieldBegin('posts', TType.LIST, 2)
+            oprot.writeListBegin(TType.STRUCT, len(self.posts))
+            for iter253 in self.posts:
+                iter253.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 3)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter254, viter255 in self.carrier.items():
+                oprot.writeString(kiter254.encode('utf-8') if sys.version_info[0] == 2 else kiter254)
+                oprot.writeString(viter255.encode('utf-8') if sys.version_info[0] == 2 else viter255)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(ComposePosts_args)
+ComposePosts_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.LIST, 'posts', (TType.STRUCT, [PostComposition, None], False), None, ),  # 2
+    (3, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 3
+)
+
+
+class ComposePosts_result(object):
+    """
+    Attributes:
+     - success
+     - se
+
+    """
+
+
+    def __init__(self, success=None, se=None,):
+        self.success = success
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype259, _size256) = iprot.readListBegin()
+                    for _i260 in range(_size256):
+                        _elem261 = PostCompositionResult()
+                        _elem261.read(iprot)
+                        self.success.append(_elem261)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException()
+                    self.se.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('ComposePosts_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.STRUCT, len(self.success))
+            for iter262 in self.success:
+                iter262.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(ComposePosts_result)
+ComposePosts_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.STRUCT, [PostCompositionResult, None], False), None, ),  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
 fix_spec(all_structs)
 del all_structs
 
@@ -19,7 +19,7 @@ all_structs = []
 
 
 class Iface(object):
-    def ReadHomeTimeline(self, req_id, user_id, start, stop, carrier):
+    def ReadHomeTimeline(self, req_id, user_id, start, stop, carrier, fields):
         """
         Parameters:
          - req_id
@@ -27,6 +27,33 @@ class Iface(object):
          - start
          - stop
          - carrier
+         - fields
+
+        """
+        pass
+
+    def WriteHomeTimeline(self, req_id, post_id, user_id, timestamp, user_mentions_id, carrier):
+        """
+        Parameters:
+         - req_id
+         - post_id
+         - user_id
+         - timestamp
+         - user_mentions_id
+         - carrier
+
+        """
+        pass
+
+    def WriteHomeTimelines(self, req_id, post_ids, user_ids, timestamps, user_mentions_ids, carrier):
+        """
+        Parameters:
+         - req_id
+         - post_ids
+         - user_ids
+         - timestamps
+         - user_mentions_ids
+         - carrier
 
         """
         pass
@@ -39,7 +66,7 @@ class Client(Iface):
             self._oprot = oprot
         self._seqid = 0
 
-    def ReadHomeTimeline(self, req_id, user_id, start, stop, carrier):
+    def ReadHomeTimeline(self, req_id, user_id, start, stop, carrier, fields):
         """
         Parameters:
          - req_id
@@ -47,12 +74,13 @@ class Client(Iface):
          - start
          - stop
          - carrier
+         - fields
 
         """
-        self.send_ReadHomeTimeline(req_id, user_id, start, stop, carrier)
+        self.send_ReadHomeTimeline(req_id, user_id, start, stop, carrier, fields)
         return self.recv_ReadHomeTimeline()
 
-    def send_ReadHomeTimeline(self, req_id, user_id, start, stop, carrier):
+    def send_ReadHomeTimeline(self, req_id, user_id, start, stop, carrier, fields):
         self._oprot.writeMessageBegin('ReadHomeTimeline', TMessageType.CALL, self._seqid)
         args = ReadHomeTimeline_args()
         args.req_id = req_id
@@ -60,6 +88,7 @@ class Client(Iface):
         args.start = start
         args.stop = stop
         args.carrier = carrier
+        args.fields = fields
         args.write(self._oprot)
         self._oprot.writeMessageEnd()
         self._oprot.trans.flush()
@@ -81,12 +110,98 @@ class Client(Iface):
             raise result.se
         raise TApplicationException(TApplicationException.MISSING_RESULT, "ReadHomeTimeline failed: unknown result")
 
+    def WriteHomeTimeline(self, req_id, post_id, user_id, timestamp, user_mentions_id, carrier):
+        """
+        Parameters:
+         - req_id
+         - post_id
+         - user_id
+         - timestamp
+         - user_mentions_id
+         - carrier
+
+        """
+        self.send_WriteHomeTimeline(req_id, post_id, user_id, timestamp, user_mentions_id, carrier)
+        self.recv_WriteHomeTimeline()
+
+    def send_WriteHomeTimeline(self, req_id, post_id, user_id, timestamp, user_mentions_id, carrier):
+        self._oprot.writeMessageBegin('WriteHomeTimeline', TMessageType.CALL, self._seqid)
+        args = WriteHomeTimeline_args()
+        args.req_id = req_id
+        args.post_id = post_id
+        args.user_id = user_id
+        args.timestamp = timestamp
+        args.user_mentions_id = user_mentions_id
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_WriteHomeTimeline(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = WriteHomeTimeline_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.se is not None:
+            raise result.se
+        return
+
+    def WriteHomeTimelines(self, req_id, post_ids, user_ids, timestamps, user_mentions_ids, carrier):
+        """
+        Parameters:
+         - req_id
+         - post_ids
+         - user_ids
+         - timestamps
+         - user_mentions_ids
+         - carrier
+
+        """
+        self.send_WriteHomeTimelines(req_id, post_ids, user_ids, timestamps, user_mentions_ids, carrier)
+        self.recv_WriteHomeTimelines()
+
+    def send_WriteHomeTimelines(self, req_id, post_ids, user_ids, timestamps, user_mentions_ids, carrier):
+        self._oprot.writeMessageBegin('WriteHomeTimelines', TMessageType.CALL, self._seqid)
+        args = WriteHomeTimelines_args()
+        args.req_id = req_id
+        args.post_ids = post_ids
+        args.user_ids = user_ids
+        args.timestamps = timestamps
+        args.user_mentions_ids = user_mentions_ids
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_WriteHomeTimelines(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = WriteHomeTimelines_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.se is not None:
+            raise result.se
+        return
+
 
 class Processor(Iface, TProcessor):
     def __init__(self, handler):
         self._handler = handler
         self._processMap = {}
         self._processMap["ReadHomeTimeline"] = Processor.process_ReadHomeTimeline
+        self._processMap["WriteHomeTimeline"] = Processor.process_WriteHomeTimeline
+        self._processMap["WriteHomeTimelines"] = Processor.process_WriteHomeTimelines
 
     def process(self, iprot, oprot):
         (name, type, seqid) = iprot.readMessageBegin()
@@ -109,7 +224,7 @@ class Processor(Iface, TProcessor):
         iprot.readMessageEnd()
         result = ReadHomeTimeline_result()
         try:
-            result.success = self._handler.ReadHomeTimeline(args.req_id, args.user_id, args.start, args.stop, args.carrier)
+            result.success = self._handler.ReadHomeTimeline(args.req_id, args.user_id, args.start, args.stop, args.carrier, args.fields)
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
@@ -129,6 +244,58 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_WriteHomeTimeline(self, seqid, iprot, oprot):
+        args = WriteHomeTimeline_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = WriteHomeTimeline_result()
+        try:
+            self._handler.WriteHomeTimeline(args.req_id, args.post_id, args.user_id, args.timestamp, args.user_mentions_id, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("WriteHomeTimeline", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_WriteHomeTimelines(self, seqid, iprot, oprot):
+        args = WriteHomeTimelines_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = WriteHomeTimelines_result()
+        try:
+            self._handler.WriteHomeTimelines(args.req_id, args.post_ids, args.user_ids, args.timestamps, args.user_mentions_ids, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("WriteHomeTimelines", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
 # HELPER FUNCTIONS AND STRUCTURES
 
 
@@ -140,16 +307,18 @@ class ReadHomeTimeline_args(object):
      - start
      - stop
      - carrier
+     - fields
 
     """
 
 
-    def __init__(self, req_id=None, user_id=None, start=None, stop=None, carrier=None,):
+    def __init__(self, req_id=None, user_id=None, start=None, stop=None, carrier=None, fields=511,):
         self.req_id = req_id
         self.user_id = user_id
         self.start = start
         self.stop = stop
         self.carrier = carrier
+        self.fields = fields
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -183,14 +352,19 @@ class ReadHomeTimeline_args(object):
             elif fid == 5:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype149, _vtype150, _size148) = iprot.readMapBegin()
-                    for _i152 in range(_size148):
-                        _key153 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val154 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key153] = _val154
+                    (_ktype328, _vtype329, _size327) = iprot.readMapBegin()
+                    for _i331 in range(_size327):
+                        _key332 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val333 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key332] = _val333
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.I32:
+                    self.fields = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -220,11 +394,15 @@ class ReadHomeTimeline_args(object):
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 5)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter155, viter156 in self.carrier.items():
-                oprot.writeString(kiter155.encode('utf-8') if sys.version_info[0] == 2 else kiter155)
-                oprot.writeString(viter156.encode('utf-8') if sys.version_info[0] == 2 else viter156)
+            for kiter334, viter335 in self.carrier.items():
+                oprot.writeString(kiter334.encode('utf-8') if sys.version_info[0] == 2 else kiter334)
+                oprot.writeString(viter335.encode('utf-8') if sys.version_info[0] == 2 else viter335)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
+        if self.fields is not None:
+            oprot.writeFieldBegin('fields', TType.I32, 6)
+            oprot.writeI32(self.fields)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -249,6 +427,7 @@ ReadHomeTimeline_args.thrift_spec = (
     (3, TType.I32, 'start', None, None, ),  # 3
     (4, TType.I32, 'stop', None, None, ),  # 4
     (5, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 5
+    (6, TType.I32, 'fields', None, 511, ),  # 6
 )
 
 
@@ -277,11 +456,11 @@ class ReadHomeTimeline_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype160, _size157) = iprot.readListBegin()
-                    for _i161 in range(_size157):
-                        _elem162 = Post()
-                        _elem162.read(iprot)
-                        self.success.append(_elem162)
+                    (_etype339, _size336) = iprot.readListBegin()
+                    for _i340 in range(_size336):
+                        _elem341 = Post()
+                        _elem341.read(iprot)
+                        self.success.append(_elem341)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -304,8 +483,8 @@ class ReadHomeTimeline_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter163 in self.success:
-                iter163.write(oprot)
+            for iter342 in self.success:
+                iter342.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.se is not None:
@@ -333,6 +512,444 @@ ReadHomeTimeline_result.thrift_spec = (
     (0, TType.LIST, 'success', (TType.STRUCT, [Post, None], False), None, ),  # 0
     (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
 )
+
+
+class WriteHomeTimeline_args(object):
+    """
+    Attributes:
+     - req_id
+     - post_id
+     - user_id
+     - timestamp
+     - user_mentions_id
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, post_id=None, user_id=None, timestamp=None, user_mentions_id=None, carrier=None,):
+        self.req_id = req_id
+        self.post_id = post_id
+        self.user_id = user_id
+        self.timestamp = timestamp
+        self.user_mentions_id = user_mentions_id
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.post_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I64:
+                    self.user_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I64:
+                    self.timestamp = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.LIST:
+                    self.user_mentions_id = []
+                    (_etype346, _size343) = iprot.readListBegin()
+                    for _i347 in range(_size343):
+                        _elem348 = iprot.readI64()
+                        self.user_mentions_id.append(_elem348)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype350, _vtype351, _size349) = iprot.readMapBegin()
+                    for _i353 in range(_size349):
+                        _key354 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val355 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key354] = _val355
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('WriteHomeTimeline_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.post_id is not None:
+            oprot.writeFieldBegin('post_id', TType.I64, 2)
+            oprot.writeI64(self.post_id)
+            oprot.writeFieldEnd()
+        if self.user_id is not None:
+            oprot.writeFieldBegin('user_id', TType.I64, 3)
+            oprot.writeI64(self.user_id)
+            oprot.writeFieldEnd()
+        if self.timestamp is not None:
+            oprot.writeFieldBegin('timestamp', TType.I64, 4)
+            oprot.writeI64(self.timestamp)
+            oprot.writeFieldEnd()
+        if self.user_mentions_id is not None:
+            oprot.writeFieldBegin('user_mentions_id', TType.LIST, 5)
+            oprot.writeListBegin(TType.I64, len(self.user_mentions_id))
+            for iter356 in self.user_mentions_id:
+                oprot.writeI64(iter356)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 6)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter357, viter358 in self.carrier.items():
+                oprot.writeString(kiter357.encode('utf-8') if sys.version_info[0] == 2 else kiter357)
+                oprot.writeString(viter358.encode('utf-8') if sys.version_info[0] == 2 else viter358)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(WriteHomeTimeline_args)
+WriteHomeTimeline_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.I64, 'post_id', None, None, ),  # 2
+    (3, TType.I64, 'user_id', None, None, ),  # 3
+    (4, TType.I64, 'timestamp', None, None, ),  # 4
+    (5, TType.LIST, 'user_mentions_id', (TType.I64, None, False), None, ),  # 5
+    (6, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 6
+)
+
+
+class WriteHomeTimeline_result(object):
+    """
+    Attributes:
+     - se
+
+    """
+
+
+    def __init__(self, se=None,):
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException()
+                    self.se.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('WriteHomeTimeline_result')
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(WriteHomeTimeline_result)
+WriteHomeTimeline_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
+
+
+class WriteHomeTimelines_args(object):
+    """
+    Attributes:
+     - req_id
+     - post_ids
+     - user_ids
+     - timestamps
+     - user_mentions_ids
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, post_ids=None, user_ids=None, timestamps=None, user_mentions_ids=None, carrier=None,):
+        self.req_id = req_id
+        self.post_ids = post_ids
+        self.user_ids = user_ids
+        self.timestamps = timestamps
+        self.user_mentions_ids = user_mentions_ids
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.LIST:
+                    self.post_ids = []
+                    (_etype362, _size359) = iprot.readListBegin()
+                    for _i363 in range(_size359):
+                        _elem364 = iprot.readI64()
+                        self.post_ids.append(_elem364)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.LIST:
+                    self.user_ids = []
+                    (_etype368, _size365) = iprot.readListBegin()
+                    for _i369 in range(_size365):
+                        _elem370 = iprot.readI64()
+                        self.user_ids.append(_elem370)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.LIST:
+                    self.timestamps = []
+                    (_etype374, _size371) = iprot.readListBegin()
+                    for _i375 in range(_size371):
+                        _elem376 = iprot.readI64()
+                        self.timestamps.append(_elem376)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.LIST:
+                    self.user_mentions_ids = []
+                    (_etype380, _size377) = iprot.readListBegin()
+                    for _i381 in range(_size377):
+                        _elem382 = []
+                        (_etype386, _size383) = iprot.readListBegin()
+                        for _i387 in range(_size383):
+                            _elem388 = iprot.readI64()
+                            _elem382.append(_elem388)
+                        iprot.readListEnd()
+                        self.user_mentions_ids.append(_elem382)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype390, _vtype391, _size389) = iprot.readMapBegin()
+                    for _i393 in range(_size389):
+                        _key394 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val395 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key394] = _val395
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('WriteHomeTimelines_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.post_ids is not None:
+            oprot.writeFieldBegin('post_ids', TType.LIST, 2)
+            oprot.writeListBegin(TType.I64, len(self.post_ids))
+            for iter396 in self.post_ids:
+                oprot.writeI64(iter396)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.user_ids is not None:
+            oprot.writeFieldBegin('user_ids', TType.LIST, 3)
+            oprot.writeListBegin(TType.I64, len(self.user_ids))
+            for iter397 in self.user_ids:
+                oprot.writeI64(iter397)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.timestamps is not None:
+            oprot.writeFieldBegin('timestamps', TType.LIST, 4)
+            oprot.writeListBegin(TType.I64, len(self.timestamps))
+            for iter398 in self.timestamps:
+                oprot.writeI64(iter398)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.user_mentions_ids is not None:
+            oprot.writeFieldBegin('user_mentions_ids', TType.LIST, 5)
+            oprot.writeListBegin(TType.LIST, len(self.user_mentions_ids))
+            for iter399 in self.user_mentions_ids:
+                oprot.writeListBegin(TType.I64, len(iter399))
+                for iter400 in iter399:
+                    oprot.writeI64(iter400)
+                oprot.writeListEnd()
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 6)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter401, viter402 in self.carrier.items():
+                oprot.writeString(kiter401.encode('utf-8') if sys.version_info[0] == 2 else kiter401)
+                oprot.writeString(viter402.encode('utf-8') if sys.version_info[0] == 2 else viter402)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(WriteHomeTimelines_args)
+WriteHomeTimelines_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.LIST, 'post_ids', (TType.I64, None, False), None, ),  # 2
+    (3, TType.LIST, 'user_ids', (TType.I64, None, False), None, ),  # 3
+    (4, TType.LIST, 'timestamps', (TType.I64, None, False), None, ),  # 4
+    (5, TType.LIST, 'user_mentions_ids', (TType.LIST, (TType.I64, None, False), False), None, ),  # 5
+    (6, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 6
+)
+
+
+class WriteHomeTimelines_result(object):
+    """
+    Attributes:
+     - se
+
+    """
+
+
+    def __init__(self, se=None,):
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException()
+                    self.se.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('WriteHomeTimelines_result')
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(WriteHomeTimelines_result)
+WriteHomeTimelines_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
 fix_spec(all_structs)
 del all_structs
 
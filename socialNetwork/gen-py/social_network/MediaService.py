@@ -163,31 +163,31 @@ class ComposeMedia_args(object):
             elif fid == 2:
                 if ftype == TType.LIST:
                     self.media_types = []
-                    (_etype338, _size335) = iprot.readListBegin()
-                    for _i339 in range(_size335):
-                        _elem340 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.media_types.append(_elem340)
+                    (_etype756, _size753) = iprot.readListBegin()
+                    for _i757 in range(_size753):
+                        _elem758 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.media_types.append(_elem758)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.media_ids = []
-                    (_etype344, _size341) = iprot.readListBegin()
-                    for _i345 in range(_size341):
-                        _elem346 = iprot.readI64()
-                        self.media_ids.append(_elem346)
+                    (_etype762, _size759) = iprot.readListBegin()
+                    for _i763 in range(_size759):
+                        _elem764 = iprot.readI64()
+                        self.media_ids.append(_elem764)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype348, _vtype349, _size347) = iprot.readMapBegin()
-                    for _i351 in range(_size347):
-                        _key352 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val353 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key352] = _val353
+                    (_ktype766, _vtype767, _size765) = iprot.readMapBegin()
+                    for _i769 in range(_size765):
+                        _key770 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val771 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key770] = _val771
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -208,23 +208,23 @@ class ComposeMedia_args(object):
         if self.media_types is not None:
             oprot.writeFieldBegin('media_types', TType.LIST, 2)
             oprot.writeListBegin(TType.STRING, len(self.media_types))
-            for iter354 in self.media_types:
-                oprot.writeString(iter354.encode('utf-8') if sys.version_info[0] == 2 else iter354)
+            for iter772 in self.media_types:
+                oprot.writeString(iter772.encode('utf-8') if sys.version_info[0] == 2 else iter772)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.media_ids is not None:
             oprot.writeFieldBegin('media_ids', TType.LIST, 3)
             oprot.writeListBegin(TType.I64, len(self.media_ids))
-            for iter355 in self.media_ids:
-                oprot.writeI64(iter355)
+            for iter773 in self.media_ids:
+                oprot.writeI64(iter773)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 4)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter356, viter357 in self.carrier.items():
-                oprot.writeString(kiter356.encode('utf-8') if sys.version_info[0] == 2 else kiter356)
-                oprot.writeString(viter357.encode('utf-8') if sys.version_info[0] == 2 else viter357)
+            for kiter774, viter775 in self.carrier.items():
+                oprot.writeString(kiter774.encode('utf-8') if sys.version_info[0] == 2 else kiter774)
+                oprot.writeString(viter775.encode('utf-8') if sys.version_info[0] == 2 else viter775)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -276,9 +276,14 @@ class ComposeMedia_result(object):
             if ftype == TType.STOP:
                 break
             if fid == 0:
-                if ftype == TType.STRUCT:
-                    self.success = Media()
-                    self.success.read(iprot)
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype779, _size776) = iprot.readListBegin()
+                    for _i780 in range(_size776):
+                        _elem781 = Media()
+                        _elem781.read(iprot)
+                        self.success.append(_elem781)
+                    iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 1:
@@ -298,8 +303,11 @@ class ComposeMedia_result(object):
             return
         oprot.writeStructBegin('ComposeMedia_result')
         if self.success is not None:
-            oprot.writeFieldBegin('success', TType.STRUCT, 0)
-            self.success.write(oprot)
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.STRUCT, len(self.success))
+            for iter782 in self.success:
+                iter782.write(oprot)
+            oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.se is not None:
             oprot.writeFieldBegin('se', TType.STRUCT, 1)
@@ -323,7 +331,7 @@ class ComposeMedia_result(object):
         return not (self == other)
 all_structs.append(ComposeMedia_result)
 ComposeMedia_result.thrift_spec = (
-    (0, TType.STRUCT, 'success', [Media, None], None, ),  # 0
+    (0, TType.LIST, 'success', (TType.STRUCT, [Media, None], False), None, ),  # 0
     (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
 )
 fix_spec(all_structs)
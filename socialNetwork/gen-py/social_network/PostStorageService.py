@@ -29,6 +29,16 @@ class Iface(object):
         """
         pass
 
+    def StorePosts(self, req_id, posts, carrier):
+        """
+        Parameters:
+         - req_id
+         - posts
+         - carrier
+
+        """
+        pass
+
     def ReadPost(self, req_id, post_id, carrier):
         """
         Parameters:
@@ -39,12 +49,13 @@ class Iface(object):
         """
         pass
 
-    def ReadPosts(self, req_id, post_ids, carrier):
+    def ReadPosts(self, req_id, post_ids, carrier, fields):
         """
         Parameters:
          - req_id
          - post_ids
          - carrier
+         - fields
 
         """
         pass
@@ -93,6 +104,44 @@ class Client(Iface):
             raise result.se
         return
 
+    def StorePosts(self, req_id, posts, carrier):
+        """
+        Parameters:
+         - req_id
+         - posts
+         - carrier
+
+        """
+        self.send_StorePosts(req_id, posts, carrier)
+        return self.recv_StorePosts()
+
+    def send_StorePosts(self, req_id, posts, carrier):
+        self._oprot.writeMessageBegin('StorePosts', TMessageType.CALL, self._seqid)
+        args = StorePosts_args()
+        args.req_id = req_id
+        args.posts = posts
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_StorePosts(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = StorePosts_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.se is not None:
+            raise result.se
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "StorePosts failed: unknown result")
+
     def ReadPost(self, req_id, post_id, carrier):
         """
         Parameters:
@@ -131,23 +180,25 @@ class Client(Iface):
             raise result.se
         raise TApplicationException(TApplicationException.MISSING_RESULT, "ReadPost failed: unknown result")
 
-    def ReadPosts(self, req_id, post_ids, carrier):
+    def ReadPosts(self, req_id, post_ids, carrier, fields):
         """
         Parameters:
          - req_id
          - post_ids
          - carrier
+         - fields
 
         """
-        self.send_ReadPosts(req_id, post_ids, carrier)
+        self.send_ReadPosts(req_id, post_ids, carrier, fields)
         return self.recv_ReadPosts()
 
-    def send_ReadPosts(self, req_id, post_ids, carrier):
+    def send_ReadPosts(self, req_id, post_ids, carrier, fields):
         self._oprot.writeMessageBegin('ReadPosts', TMessageType.CALL, self._seqid)
         args = ReadPosts_args()
         args.req_id = req_id
         args.post_ids = post_ids
         args.carrier = carrier
+        args.fields = fields
         args.write(self._oprot)
         self._oprot.writeMessageEnd()
         self._oprot.trans.flush()
@@ -175,6 +226,7 @@ class Processor(Iface, TProcessor):
         self._handler = handler
         self._processMap = {}
         self._processMap["StorePost"] = Processor.process_StorePost
+        self._processMap["StorePosts"] = Processor.process_StorePosts
         self._processMap["ReadPost"] = Processor.process_ReadPost
         self._processMap["ReadPosts"] = Processor.process_ReadPosts
 
@@ -219,6 +271,32 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_StorePosts(self, seqid, iprot, oprot):
+        args = StorePosts_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = StorePosts_result()
+        try:
+            result.success = self._handler.StorePosts(args.req_id, args.posts, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("StorePosts", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
     def process_ReadPost(self, seqid, iprot, oprot):
         args = ReadPost_args()
         args.read(iprot)
@@ -251,7 +329,7 @@ class Processor(Iface, TProcessor):
         iprot.readMessageEnd()
         result = ReadPosts_result()
         try:
-            result.success = self._handler.ReadPosts(args.req_id, args.post_ids, args.carrier)
+            result.success = self._handler.ReadPosts(args.req_id, args.post_ids, args.carrier, args.fields)
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
@@ -312,11 +390,11 @@ class StorePost_args(object):
             elif fid == 3:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype108, _vtype109, _size107) = iprot.readMapBegin()
-                    for _i111 in range(_size107):
-                        _key112 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val113 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key112] = _val113
+                    (_ktype264, _vtype265, _size263) = iprot.readMapBegin()
+                    for _i267 in range(_size263):
+                        _key268 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val269 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key268] = _val269
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -341,9 +419,9 @@ class StorePost_args(object):
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 3)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter114, viter115 in self.carrier.items():
-                oprot.writeString(kiter114.encode('utf-8') if sys.version_info[0] == 2 else kiter114)
-                oprot.writeString(viter115.encode('utf-8') if sys.version_info[0] == 2 else viter115)
+            for kiter270, viter271 in self.carrier.items():
+                oprot.writeString(kiter270.encode('utf-8') if sys.version_info[0] == 2 else kiter270)
+                oprot.writeString(viter271.encode('utf-8') if sys.version_info[0] == 2 else viter271)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -434,6 +512,193 @@ StorePost_result.thrift_spec = (
 )
 
 
+class StorePosts_args(object):
+    """
+    Attributes:
+     - req_id
+     - posts
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, posts=None, carrier=None,):
+        self.req_id = req_id
+        self.posts = posts
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.LIST:
+                    self.posts = []
+                    (_etype275, _size272) = iprot.readListBegin()
+                    for _i276 in range(_size272):
+                        _elem277 = Post()
+                        _elem277.read(iprot)
+                        self.posts.append(_elem277)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype279, _vtype280, _size278) = iprot.readMapBegin()
+                    for _i282 in range(_size278):
+                        _key283 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val284 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key283] = _val284
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('StorePosts_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.posts is not None:
+            oprot.writeFieldBegin('posts', TType.LIST, 2)
+            oprot.writeListBegin(TType.STRUCT, len(self.posts))
+            for iter285 in self.posts:
+                iter285.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 3)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter286, viter287 in self.carrier.items():
+                oprot.writeString(kiter286.encode('utf-8') if sys.version_info[0] == 2 else kiter286)
+                oprot.writeString(viter287.encode('utf-8') if sys.version_info[0] == 2 else viter287)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(StorePosts_args)
+StorePosts_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.LIST, 'posts', (TType.STRUCT, [Post, None], False), None, ),  # 2
+    (3, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 3
+)
+
+
+class StorePosts_result(object):
+    """
+    Attributes:
+     - success
+     - se
+
+    """
+
+
+    def __init__(self, success=None, se=None,):
+        self.success = success
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype291, _size288) = iprot.readListBegin()
+                    for _i292 in range(_size288):
+                        _elem293 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.success.append(_elem293)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException()
+                    self.se.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('StorePosts_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.STRING, len(self.success))
+            for iter294 in self.success:
+                oprot.writeString(iter294.encode('utf-8') if sys.version_info[0] == 2 else iter294)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(StorePosts_result)
+StorePosts_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.STRING, 'UTF8', False), None, ),  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
+
+
 class ReadPost_args(object):
     """
     Attributes:
@@ -471,11 +736,11 @@ class ReadPost_args(object):
             elif fid == 3:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype117, _vtype118, _size116) = iprot.readMapBegin()
-                    for _i120 in range(_size116):
-                        _key121 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val122 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key121] = _val122
+                    (_ktype296, _vtype297, _size295) = iprot.readMapBegin()
+                    for _i299 in range(_size295):
+                        _key300 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val301 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key300] = _val301
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -500,9 +765,9 @@ class ReadPost_args(object):
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 3)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter123, viter124 in self.carrier.items():
-                oprot.writeString(kiter123.encode('utf-8') if sys.version_info[0] == 2 else kiter123)
-                oprot.writeString(viter124.encode('utf-8') if sys.version_info[0] == 2 else viter124)
+            for kiter302, viter303 in self.carrier.items():
+                oprot.writeString(kiter302.encode('utf-8') if sys.version_info[0] == 2 else kiter302)
+                oprot.writeString(viter303.encode('utf-8') if sys.version_info[0] == 2 else viter303)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -611,14 +876,16 @@ class ReadPosts_args(object):
      - req_id
      - post_ids
      - carrier
+     - fields
 
     """
 
 
-    def __init__(self, req_id=None, post_ids=None, carrier=None,):
+    def __init__(self, req_id=None, post_ids=None, carrier=None, fields=511,):
         self.req_id = req_id
         self.post_ids = post_ids
         self.carrier = carrier
+        self.fields = fields
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -637,24 +904,29 @@ class ReadPosts_args(object):
             elif fid == 2:
                 if ftype == TType.LIST:
                     self.post_ids = []
-                    (_etype128, _size125) = iprot.readListBegin()
-                    for _i129 in range(_size125):
-                        _elem130 = iprot.readI64()
-                        self.post_ids.append(_elem130)
+                    (_etype307, _size304) = iprot.readListBegin()
+                    for _i308 in range(_size304):
+                        _elem309 = iprot.readI64()
+                        self.post_ids.append(_elem309)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype132, _vtype133, _size131) = iprot.readMapBegin()
-                    for _i135 in range(_size131):
-                        _key136 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val137 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key136] = _val137
+                    (_ktype311, _vtype312, _size310) = iprot.readMapBegin()
+                    for _i314 in range(_size310):
+                        _key315 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val316 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key315] = _val316
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I32:
+                    self.fields = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -672,18 +944,22 @@ class ReadPosts_args(object):
         if self.post_ids is not None:
             oprot.writeFieldBegin('post_ids', TType.LIST, 2)
             oprot.writeListBegin(TType.I64, len(self.post_ids))
-            for iter138 in self.post_ids:
-                oprot.writeI64(iter138)
+            for iter317 in self.post_ids:
+                oprot.writeI64(iter317)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 3)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter139, viter140 in self.carrier.items():
-                oprot.writeString(kiter139.encode('utf-8') if sys.version_info[0] == 2 else kiter139)
-                oprot.writeString(viter140.encode('utf-8') if sys.version_info[0] == 2 else viter140)
+            for kiter318, viter319 in self.carrier.items():
+                oprot.writeString(kiter318.encode('utf-8') if sys.version_info[0] == 2 else kiter318)
+                oprot.writeString(viter319.encode('utf-8') if sys.version_info[0] == 2 else viter319)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
+        if self.fields is not None:
+            oprot.writeFieldBegin('fields', TType.I32, 4)
+            oprot.writeI32(self.fields)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -706,6 +982,7 @@ ReadPosts_args.thrift_spec = (
     (1, TType.I64, 'req_id', None, None, ),  # 1
     (2, TType.LIST, 'post_ids', (TType.I64, None, False), None, ),  # 2
     (3, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 3
+    (4, TType.I32, 'fields', None, 511, ),  # 4
 )
 
 
@@ -734,11 +1011,11 @@ class ReadPosts_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype144, _size141) = iprot.readListBegin()
-                    for _i145 in range(_size141):
-                        _elem146 = Post()
-                        _elem146.read(iprot)
-                        self.success.append(_elem146)
+                    (_etype323, _size320) = iprot.readListBegin()
+                    for _i324 in range(_size320):
+                        _elem325 = Post()
+                        _elem325.read(iprot)
+                        self.success.append(_elem325)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -761,8 +1038,8 @@ class ReadPosts_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter147 in self.success:
-                iter147.write(oprot)
+            for iter326 in self.success:
+                iter326.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.se is not None:
@@ -93,6 +93,93 @@ class Iface(object):
         """
         pass
 
+    def InsertUsers(self, req_id, user_ids, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_ids
+         - carrier
+
+        """
+        pass
+
+    def FollowMany(self, req_id, user_ids, followee_ids, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_ids
+         - followee_ids
+         - carrier
+
+        """
+        pass
+
+    def UnfollowMany(self, req_id, user_ids, followee_ids, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_ids
+         - followee_ids
+         - carrier
+
+        """
+        pass
+
+    def GetMutualFollows(self, req_id, user_id, other_user_id, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_id
+         - other_user_id
+         - carrier
+
+        """
+        pass
+
+    def GetFollowersInCommon(self, req_id, user_ids, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_ids
+         - carrier
+
+        """
+        pass
+
+    def IsFollowing(self, req_id, user_ids, followee_ids, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_ids
+         - followee_ids
+         - carrier
+
+        """
+        pass
+
+    def GetFollowerCount(self, req_id, user_id, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_id
+         - carrier
+
+        """
+        pass
+
+    def GetFollowersPage(self, req_id, user_id, after_timestamp, after_user_id, limit, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_id
+         - after_timestamp
+         - after_user_id
+         - limit
+         - carrier
+
+        """
+        pass
+
 
 class Client(Iface):
     def __init__(self, iprot, oprot=None):
@@ -365,171 +452,361 @@ class Client(Iface):
             raise result.se
         return
 
+    def InsertUsers(self, req_id, user_ids, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_ids
+         - carrier
 
-class Processor(Iface, TProcessor):
-    def __init__(self, handler):
-        self._handler = handler
-        self._processMap = {}
-        self._processMap["GetFollowers"] = Processor.process_GetFollowers
-        self._processMap["GetFollowees"] = Processor.process_GetFollowees
-        self._processMap["Follow"] = Processor.process_Follow
-        self._processMap["Unfollow"] = Processor.process_Unfollow
-        self._processMap["FollowWithUsername"] = Processor.process_FollowWithUsername
-        self._processMap["UnfollowWithUsername"] = Processor.process_UnfollowWithUsername
-        self._processMap["InsertUser"] = Processor.process_InsertUser
+        """
+        self.send_InsertUsers(req_id, user_ids, carrier)
+        self.recv_InsertUsers()
 
-    def process(self, iprot, oprot):
-        (name, type, seqid) = iprot.readMessageBegin()
-        if name not in self._processMap:
-            iprot.skip(TType.STRUCT)
-            iprot.readMessageEnd()
-            x = TApplicationException(TApplicationException.UNKNOWN_METHOD, 'Unknown function %s' % (name))
-            oprot.writeMessageBegin(name, TMessageType.EXCEPTION, seqid)
-            x.write(oprot)
-            oprot.writeMessageEnd()
-            oprot.trans.flush()
-            return
-        else:
-            self._processMap[name](self, seqid, iprot, oprot)
-        return True
+    def send_InsertUsers(self, req_id, user_ids, carrier):
+        self._oprot.writeMessageBegin('InsertUsers', TMessageType.CALL, self._seqid)
+        args = InsertUsers_args()
+        args.req_id = req_id
+        args.user_ids = user_ids
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
 
-    def process_GetFollowers(self, seqid, iprot, oprot):
-        args = GetFollowers_args()
-        args.read(iprot)
+    def recv_InsertUsers(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = InsertUsers_result()
+        result.read(iprot)
         iprot.readMessageEnd()
-        result = GetFollowers_result()
-        try:
-            result.success = self._handler.GetFollowers(args.req_id, args.user_id, args.carrier)
-            msg_type = TMessageType.REPLY
-        except TTransport.TTransportException:
-            raise
-        except ServiceException as se:
-            msg_type = TMessageType.REPLY
-            result.se = se
-        except TApplicationException as ex:
-            logging.exception('TApplication exception in handler')
-            msg_type = TMessageType.EXCEPTION
-            result = ex
-        except Exception:
-            logging.exception('Unexpected exception in handler')
-            msg_type = TMessageType.EXCEPTION
-            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
-        oprot.writeMessageBegin("GetFollowers", msg_type, seqid)
-        result.write(oprot)
-        oprot.writeMessageEnd()
-        oprot.trans.flush()
+        if result.se is not None:
+            raise result.se
+        return
 
-    def process_GetFollowees(self, seqid, iprot, oprot):
-        args = GetFollowees_args()
-        args.read(iprot)
-        iprot.readMessageEnd()
-        result = GetFollowees_result()
-        try:
-            result.success = self._handler.GetFollowees(args.req_id, args.user_id, args.carrier)
-            msg_type = TMessageType.REPLY
-        except TTransport.TTransportException:
-            raise
-        except ServiceException as se:
-            msg_type = TMessageType.REPLY
-            result.se = se
-        except TApplicationException as ex:
-            logging.exception('TApplication exception in handler')
-            msg_type = TMessageType.EXCEPTION
-            result = ex
-        except Exception:
-            logging.exception('Unexpected exception in handler')
-            msg_type = TMessageType.EXCEPTION
-            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
-        oprot.writeMessageBegin("GetFollowees", msg_type, seqid)
-        result.write(oprot)
-        oprot.writeMessageEnd()
-        oprot.trans.flush()
+    def FollowMany(self, req_id, user_ids, followee_ids, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_ids
+         - followee_ids
+         - carrier
 
-    def process_Follow(self, seqid, iprot, oprot):
-        args = Follow_args()
-        args.read(iprot)
-        iprot.readMessageEnd()
-        result = Follow_result()
-        try:
-            self._handler.Follow(args.req_id, args.user_id, args.followee_id, args.carrier)
-            msg_type = TMessageType.REPLY
-        except TTransport.TTransportException:
-            raise
-        except ServiceException as se:
-            msg_type = TMessageType.REPLY
-            result.se = se
-        except TApplicationException as ex:
-            logging.exception('TApplication exception in handler')
-            msg_type = TMessageType.EXCEPTION
-            result = ex
-        except Exception:
-            logging.exception('Unexpected exception in handler')
-            msg_type = TMessageType.EXCEPTION
-            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
-        oprot.writeMessageBegin("Follow", msg_type, seqid)
-        result.write(oprot)
-        oprot.writeMessageEnd()
-        oprot.trans.flush()
+        """
+        self.send_FollowMany(req_id, user_ids, followee_ids, carrier)
+        self.recv_FollowMany()
 
-    def process_Unfollow(self, seqid, iprot, oprot):
-        args = Unfollow_args()
-        args.read(iprot)
-        iprot.readMessageEnd()
-        result = Unfollow_result()
-        try:
-            self._handler.Unfollow(args.req_id, args.user_id, args.followee_id, args.carrier)
-            msg_type = TMessageType.REPLY
-        except TTransport.TTransportException:
-            raise
-        except ServiceException as se:
-            msg_type = TMessageType.REPLY
-            result.se = se
-        except TApplicationException as ex:
-            logging.exception('TApplication exception in handler')
-            msg_type = TMessageType.EXCEPTION
-            result = ex
-        except Exception:
-            logging.exception('Unexpected exception in handler')
-            msg_type = TMessageType.EXCEPTION
-            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
-        oprot.writeMessageBegin("Unfollow", msg_type, seqid)
-        result.write(oprot)
-        oprot.writeMessageEnd()
-        oprot.trans.flush()
+    def send_FollowMany(self, req_id, user_ids, followee_ids, carrier):
+        self._oprot.writeMessageBegin('FollowMany', TMessageType.CALL, self._seqid)
+        args = FollowMany_args()
+        args.req_id = req_id
+        args.user_ids = user_ids
+        args.followee_ids = followee_ids
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
 
-    def process_FollowWithUsername(self, seqid, iprot, oprot):
-        args = FollowWithUsername_args()
-        args.read(iprot)
+    def recv_FollowMany(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = FollowMany_result()
+        result.read(iprot)
         iprot.readMessageEnd()
-        result = FollowWithUsername_result()
-        try:
-            self._handler.FollowWithUsername(args.req_id, args.user_usernmae, args.followee_username, args.carrier)
-            msg_type = TMessageType.REPLY
-        except TTransport.TTransportException:
-            raise
-        except ServiceException as se:
-            msg_type = TMessageType.REPLY
-            result.se = se
-        except TApplicationException as ex:
-            logging.exception('TApplication exception in handler')
-            msg_type = TMessageType.EXCEPTION
-            result = ex
-        except Exception:
-            logging.exception('Unexpected exception in handler')
-            msg_type = TMessageType.EXCEPTION
-            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
-        oprot.writeMessageBegin("FollowWithUsername", msg_type, seqid)
-        result.write(oprot)
-        oprot.writeMessageEnd()
-        oprot.trans.flush()
-
-    def process_UnfollowWithUsername(self, seqid, iprot, oprot):
-        args = UnfollowWithUsername_args()
+        if result.se is not None:
+            raise result.se
+        return
+
+    def UnfollowMany(self, req_id, user_ids, followee_ids, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_ids
+         - followee_ids
+         - carrier
+
+        """
+        self.send_UnfollowMany(req_id, user_ids, followee_ids, carrier)
+        self.recv_UnfollowMany()
+
+    def send_UnfollowMany(self, req_id, user_ids, followee_ids, carrier):
+        self._oprot.writeMessageBegin('UnfollowMany', TMessageType.CALL, self._seqid)
+        args = UnfollowMany_args()
+        args.req_id = req_id
+        args.user_ids = user_ids
+        args.followee_ids = followee_ids
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_UnfollowMany(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = UnfollowMany_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.se is not None:
+            raise result.se
+        return
+
+    def GetMutualFollows(self, req_id, user_id, other_user_id, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_id
+         - other_user_id
+         - carrier
+
+        """
+        self.send_GetMutualFollows(req_id, user_id, other_user_id, carrier)
+        return self.recv_GetMutualFollows()
+
+    def send_GetMutualFollows(self, req_id, user_id, other_user_id, carrier):
+        self._oprot.writeMessageBegin('GetMutualFollows', TMessageType.CALL, self._seqid)
+        args = GetMutualFollows_args()
+        args.req_id = req_id
+        args.user_id = user_id
+        args.other_user_id = other_user_id
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_GetMutualFollows(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = GetMutualFollows_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.se is not None:
+            raise result.se
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "GetMutualFollows failed: unknown result")
+
+    def GetFollowersInCommon(self, req_id, user_ids, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_ids
+         - carrier
+
+        """
+        self.send_GetFollowersInCommon(req_id, user_ids, carrier)
+        return self.recv_GetFollowersInCommon()
+
+    def send_GetFollowersInCommon(self, req_id, user_ids, carrier):
+        self._oprot.writeMessageBegin('GetFollowersInCommon', TMessageType.CALL, self._seqid)
+        args = GetFollowersInCommon_args()
+        args.req_id = req_id
+        args.user_ids = user_ids
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_GetFollowersInCommon(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = GetFollowersInCommon_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.se is not None:
+            raise result.se
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "GetFollowersInCommon failed: unknown result")
+
+    def IsFollowing(self, req_id, user_ids, followee_ids, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_ids
+         - followee_ids
+         - carrier
+
+        """
+        self.send_IsFollowing(req_id, user_ids, followee_ids, carrier)
+        return self.recv_IsFollowing()
+
+    def send_IsFollowing(self, req_id, user_ids, followee_ids, carrier):
+        self._oprot.writeMessageBegin('IsFollowing', TMessageType.CALL, self._seqid)
+        args = IsFollowing_args()
+        args.req_id = req_id
+        args.user_ids = user_ids
+        args.followee_ids = followee_ids
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_IsFollowing(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = IsFollowing_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.se is not None:
+            raise result.se
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "IsFollowing failed: unknown result")
+
+    def GetFollowerCount(self, req_id, user_id, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_id
+         - carrier
+
+        """
+        self.send_GetFollowerCount(req_id, user_id, carrier)
+        return self.recv_GetFollowerCount()
+
+    def send_GetFollowerCount(self, req_id, user_id, carrier):
+        self._oprot.writeMessageBegin('GetFollowerCount', TMessageType.CALL, self._seqid)
+        args = GetFollowerCount_args()
+        args.req_id = req_id
+        args.user_id = user_id
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_GetFollowerCount(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = GetFollowerCount_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.se is not None:
+            raise result.se
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "GetFollowerCount failed: unknown result")
+
+    def GetFollowersPage(self, req_id, user_id, after_timestamp, after_user_id, limit, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_id
+         - after_timestamp
+         - after_user_id
+         - limit
+         - carrier
+
+        """
+        self.send_GetFollowersPage(req_id, user_id, after_timestamp, after_user_id, limit, carrier)
+        return self.recv_GetFollowersPage()
+
+    def send_GetFollowersPage(self, req_id, user_id, after_timestamp, after_user_id, limit, carrier):
+        self._oprot.writeMessageBegin('GetFollowersPage', TMessageType.CALL, self._seqid)
+        args = GetFollowersPage_args()
+        args.req_id = req_id
+        args.user_id = user_id
+        args.after_timestamp = after_timestamp
+        args.after_user_id = after_user_id
+        args.limit = limit
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_GetFollowersPage(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = GetFollowersPage_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.se is not None:
+            raise result.se
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "GetFollowersPage failed: unknown result")
+
+
+class Processor(Iface, TProcessor):
+    def __init__(self, handler):
+        self._handler = handler
+        self._processMap = {}
+        self._processMap["GetFollowers"] = Processor.process_GetFollowers
+        self._processMap["GetFollowees"] = Processor.process_GetFollowees
+        self._processMap["Follow"] = Processor.process_Follow
+        self._processMap["Unfollow"] = Processor.process_Unfollow
+        self._processMap["FollowWithUsername"] = Processor.process_FollowWithUsername
+        self._processMap["UnfollowWithUsername"] = Processor.process_UnfollowWithUsername
+        self._processMap["InsertUser"] = Processor.process_InsertUser
+        self._processMap["InsertUsers"] = Processor.process_InsertUsers
+        self._processMap["FollowMany"] = Processor.process_FollowMany
+        self._processMap["UnfollowMany"] = Processor.process_UnfollowMany
+        self._processMap["GetMutualFollows"] = Processor.process_GetMutualFollows
+        self._processMap["GetFollowersInCommon"] = Processor.process_GetFollowersInCommon
+        self._processMap["IsFollowing"] = Processor.process_IsFollowing
+        self._processMap["GetFollowerCount"] = Processor.process_GetFollowerCount
+        self._processMap["GetFollowersPage"] = Processor.process_GetFollowersPage
+
+    def process(self, iprot, oprot):
+        (name, type, seqid) = iprot.readMessageBegin()
+        if name not in self._processMap:
+            iprot.skip(TType.STRUCT)
+            iprot.readMessageEnd()
+            x = TApplicationException(TApplicationException.UNKNOWN_METHOD, 'Unknown function %s' % (name))
+            oprot.writeMessageBegin(name, TMessageType.EXCEPTION, seqid)
+            x.write(oprot)
+            oprot.writeMessageEnd()
+            oprot.trans.flush()
+            return
+        else:
+            self._processMap[name](self, seqid, iprot, oprot)
+        return True
+
+    def process_GetFollowers(self, seqid, iprot, oprot):
+        args = GetFollowers_args()
         args.read(iprot)
         iprot.readMessageEnd()
-        result = UnfollowWithUsername_result()
+        result = GetFollowers_result()
         try:
-            self._handler.UnfollowWithUsername(args.req_id, args.user_usernmae, args.followee_username, args.carrier)
+            result.success = self._handler.GetFollowers(args.req_id, args.user_id, args.carrier)
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
@@ -544,53 +821,1590 @@ class Processor(Iface, TProcessor):
             logging.exception('Unexpected exception in handler')
             msg_type = TMessageType.EXCEPTION
             result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
-        oprot.writeMessageBegin("UnfollowWithUsername", msg_type, seqid)
+        oprot.writeMessageBegin("GetFollowers", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_GetFollowees(self, seqid, iprot, oprot):
+        args = GetFollowees_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = GetFollowees_result()
+        try:
+            result.success = self._handler.GetFollowees(args.req_id, args.user_id, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("GetFollowees", msg_type, seqid)
         result.write(oprot)
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
-    def process_InsertUser(self, seqid, iprot, oprot):
-        args = InsertUser_args()
-        args.read(iprot)
-        iprot.readMessageEnd()
-        result = InsertUser_result()
-        try:
-            self._handler.InsertUser(args.req_id, args.user_id, args.carrier)
-            msg_type = TMessageType.REPLY
-        except TTransport.TTransportException:
-            raise
-        except ServiceException as se:
-            msg_type = TMessageType.REPLY
-            result.se = se
-        except TApplicationException as ex:
-            logging.exception('TApplication exception in handler')
-            msg_type = TMessageType.EXCEPTION
-            result = ex
-        except Exception:
-            logging.exception('Unexpected exception in handler')
-            msg_type = TMessageType.EXCEPTION
-            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
-        oprot.writeMessageBegin("InsertUser", msg_type, seqid)
-        result.write(oprot)
-        oprot.writeMessageEnd()
-        oprot.trans.flush()
+    def process_Follow(self, seqid, iprot, oprot):
+        args = Follow_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = Follow_result()
+        try:
+            self._handler.Follow(args.req_id, args.user_id, args.followee_id, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("Follow", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_Unfollow(self, seqid, iprot, oprot):
+        args = Unfollow_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = Unfollow_result()
+        try:
+            self._handler.Unfollow(args.req_id, args.user_id, args.followee_id, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("Unfollow", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_FollowWithUsername(self, seqid, iprot, oprot):
+        args = FollowWithUsername_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = FollowWithUsername_result()
+        try:
+            self._handler.FollowWithUsername(args.req_id, args.user_usernmae, args.followee_username, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("FollowWithUsername", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_UnfollowWithUsername(self, seqid, iprot, oprot):
+        args = UnfollowWithUsername_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = UnfollowWithUsername_result()
+        try:
+            self._handler.UnfollowWithUsername(args.req_id, args.user_usernmae, args.followee_username, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("UnfollowWithUsername", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_InsertUser(self, seqid, iprot, oprot):
+        args = InsertUser_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = InsertUser_result()
+        try:
+            self._handler.InsertUser(args.req_id, args.user_id, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("InsertUser", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_InsertUsers(self, seqid, iprot, oprot):
+        args = InsertUsers_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = InsertUsers_result()
+        try:
+            self._handler.InsertUsers(args.req_id, args.user_ids, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("InsertUsers", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_FollowMany(self, seqid, iprot, oprot):
+        args = FollowMany_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = FollowMany_result()
+        try:
+            self._handler.FollowMany(args.req_id, args.user_ids, args.followee_ids, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("FollowMany", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_UnfollowMany(self, seqid, iprot, oprot):
+        args = UnfollowMany_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = UnfollowMany_result()
+        try:
+            self._handler.UnfollowMany(args.req_id, args.user_ids, args.followee_ids, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("UnfollowMany", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_GetMutualFollows(self, seqid, iprot, oprot):
+        args = GetMutualFollows_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = GetMutualFollows_result()
+        try:
+            result.success = self._handler.GetMutualFollows(args.req_id, args.user_id, args.other_user_id, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("GetMutualFollows", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_GetFollowersInCommon(self, seqid, iprot, oprot):
+        args = GetFollowersInCommon_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = GetFollowersInCommon_result()
+        try:
+            result.success = self._handler.GetFollowersInCommon(args.req_id, args.user_ids, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("GetFollowersInCommon", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_IsFollowing(self, seqid, iprot, oprot):
+        args = IsFollowing_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = IsFollowing_result()
+        try:
+            result.success = self._handler.IsFollowing(args.req_id, args.user_ids, args.followee_ids, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("IsFollowing", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_GetFollowerCount(self, seqid, iprot, oprot):
+        args = GetFollowerCount_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = GetFollowerCount_result()
+        try:
+            result.success = self._handler.GetFollowerCount(args.req_id, args.user_id, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("GetFollowerCount", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_GetFollowersPage(self, seqid, iprot, oprot):
+        args = GetFollowersPage_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = GetFollowersPage_result()
+        try:
+            result.success = self._handler.GetFollowersPage(args.req_id, args.user_id, args.after_timestamp, args.after_user_id, args.limit, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("GetFollowersPage", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+# HELPER FUNCTIONS AND STRUCTURES
+
+
+class GetFollowers_args(object):
+    """
+    Attributes:
+     - req_id
+     - user_id
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, user_id=None, carrier=None,):
+        self.req_id = req_id
+        self.user_id = user_id
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.user_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype459, _vtype460, _size458) = iprot.readMapBegin()
+                    for _i462 in range(_size458):
+                        _key463 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val464 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key463] = _val464
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('GetFollowers_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.user_id is not None:
+            oprot.writeFieldBegin('user_id', TType.I64, 2)
+            oprot.writeI64(self.user_id)
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 3)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter465, viter466 in self.carrier.items():
+                oprot.writeString(kiter465.encode('utf-8') if sys.version_info[0] == 2 else kiter465)
+                oprot.writeString(viter466.encode('utf-8') if sys.version_info[0] == 2 else viter466)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(GetFollowers_args)
+GetFollowers_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.I64, 'user_id', None, None, ),  # 2
+    (3, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 3
+)
+
+
+class GetFollowers_result(object):
+    """
+    Attributes:
+     - success
+     - se
+
+    """
+
+
+    def __init__(self, success=None, se=None,):
+        self.success = success
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype470, _size467) = iprot.readListBegin()
+                    for _i471 in range(_size467):
+                        _elem472 = iprot.readI64()
+                        self.success.append(_elem472)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException()
+                    self.se.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('GetFollowers_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.I64, len(self.success))
+            for iter473 in self.success:
+                oprot.writeI64(iter473)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(GetFollowers_result)
+GetFollowers_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.I64, None, False), None, ),  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
+
+
+class GetFollowees_args(object):
+    """
+    Attributes:
+     - req_id
+     - user_id
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, user_id=None, carrier=None,):
+        self.req_id = req_id
+        self.user_id = user_id
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.user_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype475, _vtype476, _size474) = iprot.readMapBegin()
+                    for _i478 in range(_size474):
+                        _key479 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val480 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key479] = _val480
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('GetFollowees_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.user_id is not None:
+            oprot.writeFieldBegin('user_id', TType.I64, 2)
+            oprot.writeI64(self.user_id)
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 3)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter481, viter482 in self.carrier.items():
+                oprot.writeString(kiter481.encode('utf-8') if sys.version_info[0] == 2 else kiter481)
+                oprot.writeString(viter482.encode('utf-8') if sys.version_info[0] == 2 else viter482)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(GetFollowees_args)
+GetFollowees_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.I64, 'user_id', None, None, ),  # 2
+    (3, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 3
+)
+
+
+class GetFollowees_result(object):
+    """
+    Attributes:
+     - success
+     - se
+
+    """
+
+
+    def __init__(self, success=None, se=None,):
+        self.success = success
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype486, _size483) = iprot.readListBegin()
+                    for _i487 in range(_size483):
+                        _elem488 = iprot.readI64()
+                        self.success.append(_elem488)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException()
+                    self.se.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('GetFollowees_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.I64, len(self.success))
+            for iter489 in self.success:
+                oprot.writeI64(iter489)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(GetFollowees_result)
+GetFollowees_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.I64, None, False), None, ),  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
+
+
+class Follow_args(object):
+    """
+    Attributes:
+     - req_id
+     - user_id
+     - followee_id
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, user_id=None, followee_id=None, carrier=None,):
+        self.req_id = req_id
+        self.user_id = user_id
+        self.followee_id = followee_id
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.user_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I64:
+                    self.followee_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype491, _vtype492, _size490) = iprot.readMapBegin()
+                    for _i494 in range(_size490):
+                        _key495 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val496 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key495] = _val496
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('Follow_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.user_id is not None:
+            oprot.writeFieldBegin('user_id', TType.I64, 2)
+            oprot.writeI64(self.user_id)
+            oprot.writeFieldEnd()
+        if self.followee_id is not None:
+            oprot.writeFieldBegin('followee_id', TType.I64, 3)
+            oprot.writeI64(self.followee_id)
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 4)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter497, viter498 in self.carrier.items():
+                oprot.writeString(kiter497.encode('utf-8') if sys.version_info[0] == 2 else kiter497)
+                oprot.writeString(viter498.encode('utf-8') if sys.version_info[0] == 2 else viter498)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(Follow_args)
+Follow_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.I64, 'user_id', None, None, ),  # 2
+    (3, TType.I64, 'followee_id', None, None, ),  # 3
+    (4, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 4
+)
+
+
+class Follow_result(object):
+    """
+    Attributes:
+     - se
+
+    """
+
+
+    def __init__(self, se=None,):
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException()
+                    self.se.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('Follow_result')
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(Follow_result)
+Follow_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
+
+
+class Unfollow_args(object):
+    """
+    Attributes:
+     - req_id
+     - user_id
+     - followee_id
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, user_id=None, followee_id=None, carrier=None,):
+        self.req_id = req_id
+        self.user_id = user_id
+        self.followee_id = followee_id
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.user_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I64:
+                    self.followee_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype500, _vtype501, _size499) = iprot.readMapBegin()
+                    for _i503 in range(_size499):
+                        _key504 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val505 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key504] = _val505
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('Unfollow_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.user_id is not None:
+            oprot.writeFieldBegin('user_id', TType.I64, 2)
+            oprot.writeI64(self.user_id)
+            oprot.writeFieldEnd()
+        if self.followee_id is not None:
+            oprot.writeFieldBegin('followee_id', TType.I64, 3)
+            oprot.writeI64(self.followee_id)
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 4)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter506, viter507 in self.carrier.items():
+                oprot.writeString(kiter506.encode('utf-8') if sys.version_info[0] == 2 else kiter506)
+                oprot.writeString(viter507.encode('utf-8') if sys.version_info[0] == 2 else viter507)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(Unfollow_args)
+Unfollow_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.I64, 'user_id', None, None, ),  # 2
+    (3, TType.I64, 'followee_id', None, None, ),  # 3
+    (4, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 4
+)
+
+
+class Unfollow_result(object):
+    """
+    Attributes:
+     - se
+
+    """
+
+
+    def __init__(self, se=None,):
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException()
+                    self.se.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('Unfollow_result')
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(Unfollow_result)
+Unfollow_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
+
+
+class FollowWithUsername_args(object):
+    """
+    Attributes:
+     - req_id
+     - user_usernmae
+     - followee_username
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, user_usernmae=None, followee_username=None, carrier=None,):
+        self.req_id = req_id
+        self.user_usernmae = user_usernmae
+        self.followee_username = followee_username
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.user_usernmae = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRING:
+                    self.followee_username = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype509, _vtype510, _size508) = iprot.readMapBegin()
+                    for _i512 in range(_size508):
+                        _key513 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val514 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key513] = _val514
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('FollowWithUsername_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.user_usernmae is not None:
+            oprot.writeFieldBegin('user_usernmae', TType.STRING, 2)
+            oprot.writeString(self.user_usernmae.encode('utf-8') if sys.version_info[0] == 2 else self.user_usernmae)
+            oprot.writeFieldEnd()
+        if self.followee_username is not None:
+            oprot.writeFieldBegin('followee_username', TType.STRING, 3)
+            oprot.writeString(self.followee_username.encode('utf-8') if sys.version_info[0] == 2 else self.followee_username)
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 4)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter515, viter516 in self.carrier.items():
+                oprot.writeString(kiter515.encode('utf-8') if sys.version_info[0] == 2 else kiter515)
+                oprot.writeString(viter516.encode('utf-8') if sys.version_info[0] == 2 else viter516)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(FollowWithUsername_args)
+FollowWithUsername_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.STRING, 'user_usernmae', 'UTF8', None, ),  # 2
+    (3, TType.STRING, 'followee_username', 'UTF8', None, ),  # 3
+    (4, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 4
+)
+
+
+class FollowWithUsername_result(object):
+    """
+    Attributes:
+     - se
+
+    """
+
+
+    def __init__(self, se=None,):
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException()
+                    self.se.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('FollowWithUsername_result')
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(FollowWithUsername_result)
+FollowWithUsername_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
+
+
+class UnfollowWithUsername_args(object):
+    """
+    Attributes:
+     - req_id
+     - user_usernmae
+     - followee_username
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, user_usernmae=None, followee_username=None, carrier=None,):
+        self.req_id = req_id
+        self.user_usernmae = user_usernmae
+        self.followee_username = followee_username
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.user_usernmae = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRING:
+                    self.followee_username = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype518, _vtype519, _size517) = iprot.readMapBegin()
+                    for _i521 in range(_size517):
+                        _key522 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val523 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key522] = _val523
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('UnfollowWithUsername_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.user_usernmae is not None:
+            oprot.writeFieldBegin('user_usernmae', TType.STRING, 2)
+            oprot.writeString(self.user_usernmae.encode('utf-8') if sys.version_info[0] == 2 else self.user_usernmae)
+            oprot.writeFieldEnd()
+        if self.followee_username is not None:
+            oprot.writeFieldBegin('followee_username', TType.STRING, 3)
+            oprot.writeString(self.followee_username.encode('utf-8') if sys.version_info[0] == 2 else self.followee_username)
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 4)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter524, viter525 in self.carrier.items():
+                oprot.writeString(kiter524.encode('utf-8') if sys.version_info[0] == 2 else kiter524)
+                oprot.writeString(viter525.encode('utf-8') if sys.version_info[0] == 2 else viter525)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(UnfollowWithUsername_args)
+UnfollowWithUsername_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.STRING, 'user_usernmae', 'UTF8', None, ),  # 2
+    (3, TType.STRING, 'followee_username', 'UTF8', None, ),  # 3
+    (4, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 4
+)
+
+
+class UnfollowWithUsername_result(object):
+    """
+    Attributes:
+     - se
+
+    """
+
+
+    def __init__(self, se=None,):
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException()
+                    self.se.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('UnfollowWithUsername_result')
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(UnfollowWithUsername_result)
+UnfollowWithUsername_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
+
+
+class InsertUser_args(object):
+    """
+    Attributes:
+     - req_id
+     - user_id
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, user_id=None, carrier=None,):
+        self.req_id = req_id
+        self.user_id = user_id
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.user_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype527, _vtype528, _size526) = iprot.readMapBegin()
+                    for _i530 in range(_size526):
+                        _key531 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val532 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key531] = _val532
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('InsertUser_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.user_id is not None:
+            oprot.writeFieldBegin('user_id', TType.I64, 2)
+            oprot.writeI64(self.user_id)
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 3)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter533, viter534 in self.carrier.items():
+                oprot.writeString(kiter533.encode('utf-8') if sys.version_info[0] == 2 else kiter533)
+                oprot.writeString(viter534.encode('utf-8') if sys.version_info[0] == 2 else viter534)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(InsertUser_args)
+InsertUser_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.I64, 'user_id', None, None, ),  # 2
+    (3, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 3
+)
+
+
+class InsertUser_result(object):
+    """
+    Attributes:
+     - se
+
+    """
+
+
+    def __init__(self, se=None,):
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException()
+                    self.se.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('InsertUser_result')
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
 
-# HELPER FUNCTIONS AND STRUCTURES
+    def validate(self):
+        return
 
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
 
-class GetFollowers_args(object):
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(InsertUser_result)
+InsertUser_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
+
+
+class InsertUsers_args(object):
     """
     Attributes:
      - req_id
-     - user_id
+     - user_ids
      - carrier
 
     """
 
 
-    def __init__(self, req_id=None, user_id=None, carrier=None,):
+    def __init__(self, req_id=None, user_ids=None, carrier=None,):
         self.req_id = req_id
-        self.user_id = user_id
+        self.user_ids = user_ids
         self.carrier = carrier
 
     def read(self, iprot):
@@ -608,18 +2422,23 @@ class GetFollowers_args(object):
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
-                if ftype == TType.I64:
-                    self.user_id = iprot.readI64()
+                if ftype == TType.LIST:
+                    self.user_ids = []
+                    (_etype538, _size535) = iprot.readListBegin()
+                    for _i539 in range(_size535):
+                        _elem540 = iprot.readI64()
+                        self.user_ids.append(_elem540)
+                    iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype190, _vtype191, _size189) = iprot.readMapBegin()
-                    for _i193 in range(_size189):
-                        _key194 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val195 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key194] = _val195
+                    (_ktype542, _vtype543, _size541) = iprot.readMapBegin()
+                    for _i545 in range(_size541):
+                        _key546 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val547 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key546] = _val547
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -632,21 +2451,24 @@ class GetFollowers_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('GetFollowers_args')
+        oprot.writeStructBegin('InsertUsers_args')
         if self.req_id is not None:
             oprot.writeFieldBegin('req_id', TType.I64, 1)
             oprot.writeI64(self.req_id)
             oprot.writeFieldEnd()
-        if self.user_id is not None:
-            oprot.writeFieldBegin('user_id', TType.I64, 2)
-            oprot.writeI64(self.user_id)
+        if self.user_ids is not None:
+            oprot.writeFieldBegin('user_ids', TType.LIST, 2)
+            oprot.writeListBegin(TType.I64, len(self.user_ids))
+            for iter548 in self.user_ids:
+                oprot.writeI64(iter548)
+            oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 3)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter196, viter197 in self.carrier.items():
-                oprot.writeString(kiter196.encode('utf-8') if sys.version_info[0] == 2 else kiter196)
-                oprot.writeString(viter197.encode('utf-8') if sys.version_info[0] == 2 else viter197)
+            for kiter549, viter550 in self.carrier.items():
+                oprot.writeString(kiter549.encode('utf-8') if sys.version_info[0] == 2 else kiter549)
+                oprot.writeString(viter550.encode('utf-8') if sys.version_info[0] == 2 else viter550)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -665,26 +2487,24 @@ class GetFollowers_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(GetFollowers_args)
-GetFollowers_args.thrift_spec = (
+all_structs.append(InsertUsers_args)
+InsertUsers_args.thrift_spec = (
     None,  # 0
     (1, TType.I64, 'req_id', None, None, ),  # 1
-    (2, TType.I64, 'user_id', None, None, ),  # 2
+    (2, TType.LIST, 'user_ids', (TType.I64, None, False), None, ),  # 2
     (3, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 3
 )
 
 
-class GetFollowers_result(object):
+class InsertUsers_result(object):
     """
     Attributes:
-     - success
      - se
 
     """
 
 
-    def __init__(self, success=None, se=None,):
-        self.success = success
+    def __init__(self, se=None,):
         self.se = se
 
     def read(self, iprot):
@@ -696,17 +2516,194 @@ class GetFollowers_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 0:
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException()
+                    self.se.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('InsertUsers_result')
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(InsertUsers_result)
+InsertUsers_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
+
+
+class FollowMany_args(object):
+    """
+    Attributes:
+     - req_id
+     - user_ids
+     - followee_ids
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, user_ids=None, followee_ids=None, carrier=None,):
+        self.req_id = req_id
+        self.user_ids = user_ids
+        self.followee_ids = followee_ids
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
                 if ftype == TType.LIST:
-                    self.success = []
-                    (_etype201, _size198) = iprot.readListBegin()
-                    for _i202 in range(_size198):
-                        _elem203 = iprot.readI64()
-                        self.success.append(_elem203)
+                    self.user_ids = []
+                    (_etype554, _size551) = iprot.readListBegin()
+                    for _i555 in range(_size551):
+                        _elem556 = iprot.readI64()
+                        self.user_ids.append(_elem556)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
-            elif fid == 1:
+            elif fid == 3:
+                if ftype == TType.LIST:
+                    self.followee_ids = []
+                    (_etype560, _size557) = iprot.readListBegin()
+                    for _i561 in range(_size557):
+                        _elem562 = iprot.readI64()
+                        self.followee_ids.append(_elem562)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype564, _vtype565, _size563) = iprot.readMapBegin()
+                    for _i567 in range(_size563):
+                        _key568 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val569 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key568] = _val569
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('FollowMany_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.user_ids is not None:
+            oprot.writeFieldBegin('user_ids', TType.LIST, 2)
+            oprot.writeListBegin(TType.I64, len(self.user_ids))
+            for iter570 in self.user_ids:
+                oprot.writeI64(iter570)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.followee_ids is not None:
+            oprot.writeFieldBegin('followee_ids', TType.LIST, 3)
+            oprot.writeListBegin(TType.I64, len(self.followee_ids))
+            for iter571 in self.followee_ids:
+                oprot.writeI64(iter571)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 4)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter572, viter573 in self.carrier.items():
+                oprot.writeString(kiter572.encode('utf-8') if sys.version_info[0] == 2 else kiter572)
+                oprot.writeString(viter573.encode('utf-8') if sys.version_info[0] == 2 else viter573)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(FollowMany_args)
+FollowMany_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.LIST, 'user_ids', (TType.I64, None, False), None, ),  # 2
+    (3, TType.LIST, 'followee_ids', (TType.I64, None, False), None, ),  # 3
+    (4, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 4
+)
+
+
+class FollowMany_result(object):
+    """
+    Attributes:
+     - se
+
+    """
+
+
+    def __init__(self, se=None,):
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
                 if ftype == TType.STRUCT:
                     self.se = ServiceException()
                     self.se.read(iprot)
@@ -721,14 +2718,7 @@ class GetFollowers_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('GetFollowers_result')
-        if self.success is not None:
-            oprot.writeFieldBegin('success', TType.LIST, 0)
-            oprot.writeListBegin(TType.I64, len(self.success))
-            for iter204 in self.success:
-                oprot.writeI64(iter204)
-            oprot.writeListEnd()
-            oprot.writeFieldEnd()
+        oprot.writeStructBegin('FollowMany_result')
         if self.se is not None:
             oprot.writeFieldBegin('se', TType.STRUCT, 1)
             self.se.write(oprot)
@@ -749,26 +2739,28 @@ class GetFollowers_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(GetFollowers_result)
-GetFollowers_result.thrift_spec = (
-    (0, TType.LIST, 'success', (TType.I64, None, False), None, ),  # 0
+all_structs.append(FollowMany_result)
+FollowMany_result.thrift_spec = (
+    None,  # 0
     (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
 )
 
 
-class GetFollowees_args(object):
+class UnfollowMany_args(object):
     """
     Attributes:
      - req_id
-     - user_id
+     - user_ids
+     - followee_ids
      - carrier
 
     """
 
 
-    def __init__(self, req_id=None, user_id=None, carrier=None,):
+    def __init__(self, req_id=None, user_ids=None, followee_ids=None, carrier=None,):
         self.req_id = req_id
-        self.user_id = user_id
+        self.user_ids = user_ids
+        self.followee_ids = followee_ids
         self.carrier = carrier
 
     def read(self, iprot):
@@ -786,18 +2778,33 @@ class GetFollowees_args(object):
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
-                if ftype == TType.I64:
-                    self.user_id = iprot.readI64()
+                if ftype == TType.LIST:
+                    self.user_ids = []
+                    (_etype577, _size574) = iprot.readListBegin()
+                    for _i578 in range(_size574):
+                        _elem579 = iprot.readI64()
+                        self.user_ids.append(_elem579)
+                    iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
+                if ftype == TType.LIST:
+                    self.followee_ids = []
+                    (_etype583, _size580) = iprot.readListBegin()
+                    for _i584 in range(_size580):
+                        _elem585 = iprot.readI64()
+                        self.followee_ids.append(_elem585)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype206, _vtype207, _size205) = iprot.readMapBegin()
-                    for _i209 in range(_size205):
-                        _key210 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val211 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key210] = _val211
+                    (_ktype587, _vtype588, _size586) = iprot.readMapBegin()
+                    for _i590 in range(_size586):
+                        _key591 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val592 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key591] = _val592
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -810,21 +2817,31 @@ class GetFollowees_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('GetFollowees_args')
+        oprot.writeStructBegin('UnfollowMany_args')
         if self.req_id is not None:
             oprot.writeFieldBegin('req_id', TType.I64, 1)
             oprot.writeI64(self.req_id)
             oprot.writeFieldEnd()
-        if self.user_id is not None:
-            oprot.writeFieldBegin('user_id', TType.I64, 2)
-            oprot.writeI64(self.user_id)
+        if self.user_ids is not None:
+            oprot.writeFieldBegin('user_ids', TType.LIST, 2)
+            oprot.writeListBegin(TType.I64, len(self.user_ids))
+            for iter593 in self.user_ids:
+                oprot.writeI64(iter593)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.followee_ids is not None:
+            oprot.writeFieldBegin('followee_ids', TType.LIST, 3)
+            oprot.writeListBegin(TType.I64, len(self.followee_ids))
+            for iter594 in self.followee_ids:
+                oprot.writeI64(iter594)
+            oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.carrier is not None:
-            oprot.writeFieldBegin('carrier', TType.MAP, 3)
+            oprot.writeFieldBegin('carrier', TType.MAP, 4)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter212, viter213 in self.carrier.items():
-                oprot.writeString(kiter212.encode('utf-8') if sys.version_info[0] == 2 else kiter212)
-                oprot.writeString(viter213.encode('utf-8') if sys.version_info[0] == 2 else viter213)
+            for kiter595, viter596 in self.carrier.items():
+                oprot.writeString(kiter595.encode('utf-8') if sys.version_info[0] == 2 else kiter595)
+                oprot.writeString(viter596.encode('utf-8') if sys.version_info[0] == 2 else viter596)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -842,27 +2859,26 @@ class GetFollowees_args(object):
         return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
 
     def __ne__(self, other):
-        return not (self == other)
-all_structs.append(GetFollowees_args)
-GetFollowees_args.thrift_spec = (
+        return not (self == other)
+all_structs.append(UnfollowMany_args)
+UnfollowMany_args.thrift_spec = (
     None,  # 0
     (1, TType.I64, 'req_id', None, None, ),  # 1
-    (2, TType.I64, 'user_id', None, None, ),  # 2
-    (3, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 3
+    (2, TType.LIST, 'user_ids', (TType.I64, None, False), None, ),  # 2
+    (3, TType.LIST, 'followee_ids', (TType.I64, None, False), None, ),  # 3
+    (4, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 4
 )
 
 
-class GetFollowees_result(object):
+class UnfollowMany_result(object):
     """
     Attributes:
-     - success
      - se
 
     """
 
 
-    def __init__(self, success=None, se=None,):
-        self.success = success
+    def __init__(self, se=None,):
         self.se = se
 
     def read(self, iprot):
@@ -874,17 +2890,7 @@ class GetFollowees_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 0:
-                if ftype == TType.LIST:
-                    self.success = []
-                    (_etype217, _size214) = iprot.readListBegin()
-                    for _i218 in range(_size214):
-                        _elem219 = iprot.readI64()
-                        self.success.append(_elem219)
-                    iprot.readListEnd()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 1:
+            if fid == 1:
                 if ftype == TType.STRUCT:
                     self.se = ServiceException()
                     self.se.read(iprot)
@@ -899,14 +2905,7 @@ class GetFollowees_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('GetFollowees_result')
-        if self.success is not None:
-            oprot.writeFieldBegin('success', TType.LIST, 0)
-            oprot.writeListBegin(TType.I64, len(self.success))
-            for iter220 in self.success:
-                oprot.writeI64(iter220)
-            oprot.writeListEnd()
-            oprot.writeFieldEnd()
+        oprot.writeStructBegin('UnfollowMany_result')
         if self.se is not None:
             oprot.writeFieldBegin('se', TType.STRUCT, 1)
             self.se.write(oprot)
@@ -927,28 +2926,28 @@ class GetFollowees_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(GetFollowees_result)
-GetFollowees_result.thrift_spec = (
-    (0, TType.LIST, 'success', (TType.I64, None, False), None, ),  # 0
+all_structs.append(UnfollowMany_result)
+UnfollowMany_result.thrift_spec = (
+    None,  # 0
     (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
 )
 
 
-class Follow_args(object):
+class GetMutualFollows_args(object):
     """
     Attributes:
      - req_id
      - user_id
-     - followee_id
+     - other_user_id
      - carrier
 
     """
 
 
-    def __init__(self, req_id=None, user_id=None, followee_id=None, carrier=None,):
+    def __init__(self, req_id=None, user_id=None, other_user_id=None, carrier=None,):
         self.req_id = req_id
         self.user_id = user_id
-        self.followee_id = followee_id
+        self.other_user_id = other_user_id
         self.carrier = carrier
 
     def read(self, iprot):
@@ -972,17 +2971,17 @@ class Follow_args(object):
                     iprot.skip(ftype)
             elif fid == 3:
                 if ftype == TType.I64:
-                    self.followee_id = iprot.readI64()
+                    self.other_user_id = iprot.readI64()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype222, _vtype223, _size221) = iprot.readMapBegin()
-                    for _i225 in range(_size221):
-                        _key226 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val227 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key226] = _val227
+                    (_ktype598, _vtype599, _size597) = iprot.readMapBegin()
+                    for _i601 in range(_size597):
+                        _key602 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val603 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key602] = _val603
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -995,7 +2994,7 @@ class Follow_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('Follow_args')
+        oprot.writeStructBegin('GetMutualFollows_args')
         if self.req_id is not None:
             oprot.writeFieldBegin('req_id', TType.I64, 1)
             oprot.writeI64(self.req_id)
@@ -1004,16 +3003,16 @@ class Follow_args(object):
             oprot.writeFieldBegin('user_id', TType.I64, 2)
             oprot.writeI64(self.user_id)
             oprot.writeFieldEnd()
-        if self.followee_id is not None:
-            oprot.writeFieldBegin('followee_id', TType.I64, 3)
-            oprot.writeI64(self.followee_id)
+        if self.other_user_id is not None:
+            oprot.writeFieldBegin('other_user_id', TType.I64, 3)
+            oprot.writeI64(self.other_user_id)
             oprot.writeFieldEnd()
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 4)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter228, viter229 in self.carrier.items():
-                oprot.writeString(kiter228.encode('utf-8') if sys.version_info[0] == 2 else kiter228)
-                oprot.writeString(viter229.encode('utf-8') if sys.version_info[0] == 2 else viter229)
+            for kiter604, viter605 in self.carrier.items():
+                oprot.writeString(kiter604.encode('utf-8') if sys.version_info[0] == 2 else kiter604)
+                oprot.writeString(viter605.encode('utf-8') if sys.version_info[0] == 2 else viter605)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -1032,25 +3031,27 @@ class Follow_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(Follow_args)
-Follow_args.thrift_spec = (
+all_structs.append(GetMutualFollows_args)
+GetMutualFollows_args.thrift_spec = (
     None,  # 0
     (1, TType.I64, 'req_id', None, None, ),  # 1
     (2, TType.I64, 'user_id', None, None, ),  # 2
-    (3, TType.I64, 'followee_id', None, None, ),  # 3
+    (3, TType.I64, 'other_user_id', None, None, ),  # 3
     (4, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 4
 )
 
 
-class Follow_result(object):
+class GetMutualFollows_result(object):
     """
     Attributes:
+     - success
      - se
 
     """
 
 
-    def __init__(self, se=None,):
+    def __init__(self, success=None, se=None,):
+        self.success = success
         self.se = se
 
     def read(self, iprot):
@@ -1062,7 +3063,17 @@ class Follow_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 1:
+            if fid == 0:
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype609, _size606) = iprot.readListBegin()
+                    for _i610 in range(_size606):
+                        _elem611 = iprot.readI64()
+                        self.success.append(_elem611)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
                 if ftype == TType.STRUCT:
                     self.se = ServiceException()
                     self.se.read(iprot)
@@ -1077,7 +3088,14 @@ class Follow_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('Follow_result')
+        oprot.writeStructBegin('GetMutualFollows_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.I64, len(self.success))
+            for iter612 in self.success:
+                oprot.writeI64(iter612)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
         if self.se is not None:
             oprot.writeFieldBegin('se', TType.STRUCT, 1)
             self.se.write(oprot)
@@ -1098,28 +3116,26 @@ class Follow_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(Follow_result)
-Follow_result.thrift_spec = (
-    None,  # 0
+all_structs.append(GetMutualFollows_result)
+GetMutualFollows_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.I64, None, False), None, ),  # 0
     (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
 )
 
 
-class Unfollow_args(object):
+class GetFollowersInCommon_args(object):
     """
     Attributes:
      - req_id
-     - user_id
-     - followee_id
+     - user_ids
      - carrier
 
     """
 
 
-    def __init__(self, req_id=None, user_id=None, followee_id=None, carrier=None,):
+    def __init__(self, req_id=None, user_ids=None, carrier=None,):
         self.req_id = req_id
-        self.user_id = user_id
-        self.followee_id = followee_id
+        self.user_ids = user_ids
         self.carrier = carrier
 
     def read(self, iprot):
@@ -1137,23 +3153,23 @@ class Unfollow_args(object):
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
-                if ftype == TType.I64:
-                    self.user_id = iprot.readI64()
+                if ftype == TType.LIST:
+                    self.user_ids = []
+                    (_etype616, _size613) = iprot.readListBegin()
+                    for _i617 in range(_size613):
+                        _elem618 = iprot.readI64()
+                        self.user_ids.append(_elem618)
+                    iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
-                if ftype == TType.I64:
-                    self.followee_id = iprot.readI64()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 4:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype231, _vtype232, _size230) = iprot.readMapBegin()
-                    for _i234 in range(_size230):
-                        _key235 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val236 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key235] = _val236
+                    (_ktype620, _vtype621, _size619) = iprot.readMapBegin()
+                    for _i623 in range(_size619):
+                        _key624 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val625 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key624] = _val625
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -1166,25 +3182,24 @@ class Unfollow_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('Unfollow_args')
+        oprot.writeStructBegin('GetFollowersInCommon_args')
         if self.req_id is not None:
             oprot.writeFieldBegin('req_id', TType.I64, 1)
             oprot.writeI64(self.req_id)
             oprot.writeFieldEnd()
-        if self.user_id is not None:
-            oprot.writeFieldBegin('user_id', TType.I64, 2)
-            oprot.writeI64(self.user_id)
-            oprot.writeFieldEnd()
-        if self.followee_id is not None:
-            oprot.writeFieldBegin('followee_id', TType.I64, 3)
-            oprot.writeI64(self.followee_id)
+        if self.user_ids is not None:
+            oprot.writeFieldBegin('user_ids', TType.LIST, 2)
+            oprot.writeListBegin(TType.I64, len(self.user_ids))
+            for iter626 in self.user_ids:
+                oprot.writeI64(iter626)
+            oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.carrier is not None:
-            oprot.writeFieldBegin('carrier', TType.MAP, 4)
+            oprot.writeFieldBegin('carrier', TType.MAP, 3)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter237, viter238 in self.carrier.items():
-                oprot.writeString(kiter237.encode('utf-8') if sys.version_info[0] == 2 else kiter237)
-                oprot.writeString(viter238.encode('utf-8') if sys.version_info[0] == 2 else viter238)
+            for kiter627, viter628 in self.carrier.items():
+                oprot.writeString(kiter627.encode('utf-8') if sys.version_info[0] == 2 else kiter627)
+                oprot.writeString(viter628.encode('utf-8') if sys.version_info[0] == 2 else viter628)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -1203,25 +3218,26 @@ class Unfollow_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(Unfollow_args)
-Unfollow_args.thrift_spec = (
+all_structs.append(GetFollowersInCommon_args)
+GetFollowersInCommon_args.thrift_spec = (
     None,  # 0
     (1, TType.I64, 'req_id', None, None, ),  # 1
-    (2, TType.I64, 'user_id', None, None, ),  # 2
-    (3, TType.I64, 'followee_id', None, None, ),  # 3
-    (4, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 4
+    (2, TType.LIST, 'user_ids', (TType.I64, None, False), None, ),  # 2
+    (3, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 3
 )
 
 
-class Unfollow_result(object):
+class GetFollowersInCommon_result(object):
     """
     Attributes:
+     - success
      - se
 
     """
 
 
-    def __init__(self, se=None,):
+    def __init__(self, success=None, se=None,):
+        self.success = success
         self.se = se
 
     def read(self, iprot):
@@ -1233,7 +3249,17 @@ class Unfollow_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 1:
+            if fid == 0:
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype632, _size629) = iprot.readListBegin()
+                    for _i633 in range(_size629):
+                        _elem634 = iprot.readI64()
+                        self.success.append(_elem634)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
                 if ftype == TType.STRUCT:
                     self.se = ServiceException()
                     self.se.read(iprot)
@@ -1248,7 +3274,14 @@ class Unfollow_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('Unfollow_result')
+        oprot.writeStructBegin('GetFollowersInCommon_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.I64, len(self.success))
+            for iter635 in self.success:
+                oprot.writeI64(iter635)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
         if self.se is not None:
             oprot.writeFieldBegin('se', TType.STRUCT, 1)
             self.se.write(oprot)
@@ -1269,28 +3302,28 @@ class Unfollow_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(Unfollow_result)
-Unfollow_result.thrift_spec = (
-    None,  # 0
+all_structs.append(GetFollowersInCommon_result)
+GetFollowersInCommon_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.I64, None, False), None, ),  # 0
     (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
 )
 
 
-class FollowWithUsername_args(object):
+class IsFollowing_args(object):
     """
     Attributes:
      - req_id
-     - user_usernmae
-     - followee_username
+     - user_ids
+     - followee_ids
      - carrier
 
     """
 
 
-    def __init__(self, req_id=None, user_usernmae=None, followee_username=None, carrier=None,):
+    def __init__(self, req_id=None, user_ids=None, followee_ids=None, carrier=None,):
         self.req_id = req_id
-        self.user_usernmae = user_usernmae
-        self.followee_username = followee_username
+        self.user_ids = user_ids
+        self.followee_ids = followee_ids
         self.carrier = carrier
 
     def read(self, iprot):
@@ -1308,23 +3341,33 @@ class FollowWithUsername_args(object):
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
-                if ftype == TType.STRING:
-                    self.user_usernmae = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                if ftype == TType.LIST:
+                    self.user_ids = []
+                    (_etype639, _size636) = iprot.readListBegin()
+                    for _i640 in range(_size636):
+                        _elem641 = iprot.readI64()
+                        self.user_ids.append(_elem641)
+                    iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
-                if ftype == TType.STRING:
-                    self.followee_username = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                if ftype == TType.LIST:
+                    self.followee_ids = []
+                    (_etype645, _size642) = iprot.readListBegin()
+                    for _i646 in range(_size642):
+                        _elem647 = iprot.readI64()
+                        self.followee_ids.append(_elem647)
+                    iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype240, _vtype241, _size239) = iprot.readMapBegin()
-                    for _i243 in range(_size239):
-                        _key244 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val245 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key244] = _val245
+                    (_ktype649, _vtype650, _size648) = iprot.readMapBegin()
+                    for _i652 in range(_size648):
+                        _key653 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val654 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key653] = _val654
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -1337,25 +3380,31 @@ class FollowWithUsername_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('FollowWithUsername_args')
+        oprot.writeStructBegin('IsFollowing_args')
         if self.req_id is not None:
             oprot.writeFieldBegin('req_id', TType.I64, 1)
             oprot.writeI64(self.req_id)
             oprot.writeFieldEnd()
-        if self.user_usernmae is not None:
-            oprot.writeFieldBegin('user_usernmae', TType.STRING, 2)
-            oprot.writeString(self.user_usernmae.encode('utf-8') if sys.version_info[0] == 2 else self.user_usernmae)
+        if self.user_ids is not None:
+            oprot.writeFieldBegin('user_ids', TType.LIST, 2)
+            oprot.writeListBegin(TType.I64, len(self.user_ids))
+            for iter655 in self.user_ids:
+                oprot.writeI64(iter655)
+            oprot.writeListEnd()
             oprot.writeFieldEnd()
-        if self.followee_username is not None:
-            oprot.writeFieldBegin('followee_username', TType.STRING, 3)
-            oprot.writeString(self.followee_username.encode('utf-8') if sys.version_info[0] == 2 else self.followee_username)
+        if self.followee_ids is not None:
+            oprot.writeFieldBegin('followee_ids', TType.LIST, 3)
+            oprot.writeListBegin(TType.I64, len(self.followee_ids))
+            for iter656 in self.followee_ids:
+                oprot.writeI64(iter656)
+            oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 4)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter246, viter247 in self.carrier.items():
-                oprot.writeString(kiter246.encode('utf-8') if sys.version_info[0] == 2 else kiter246)
-                oprot.writeString(viter247.encode('utf-8') if sys.version_info[0] == 2 else viter247)
+            for kiter657, viter658 in self.carrier.items():
+                oprot.writeString(kiter657.encode('utf-8') if sys.version_info[0] == 2 else kiter657)
+                oprot.writeString(viter658.encode('utf-8') if sys.version_info[0] == 2 else viter658)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -1374,25 +3423,27 @@ class FollowWithUsername_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(FollowWithUsername_args)
-FollowWithUsername_args.thrift_spec = (
+all_structs.append(IsFollowing_args)
+IsFollowing_args.thrift_spec = (
     None,  # 0
     (1, TType.I64, 'req_id', None, None, ),  # 1
-    (2, TType.STRING, 'user_usernmae', 'UTF8', None, ),  # 2
-    (3, TType.STRING, 'followee_username', 'UTF8', None, ),  # 3
+    (2, TType.LIST, 'user_ids', (TType.I64, None, False), None, ),  # 2
+    (3, TType.LIST, 'followee_ids', (TType.I64, None, False), None, ),  # 3
     (4, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 4
 )
 
 
-class FollowWithUsername_result(object):
+class IsFollowing_result(object):
     """
     Attributes:
+     - success
      - se
 
     """
 
 
-    def __init__(self, se=None,):
+    def __init__(self, success=None, se=None,):
+        self.success = success
         self.se = se
 
     def read(self, iprot):
@@ -1404,7 +3455,17 @@ class FollowWithUsername_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 1:
+            if fid == 0:
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype662, _size659) = iprot.readListBegin()
+                    for _i663 in range(_size659):
+                        _elem664 = iprot.readBool()
+                        self.success.append(_elem664)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
                 if ftype == TType.STRUCT:
                     self.se = ServiceException()
                     self.se.read(iprot)
@@ -1419,7 +3480,14 @@ class FollowWithUsername_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('FollowWithUsername_result')
+        oprot.writeStructBegin('IsFollowing_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.BOOL, len(self.success))
+            for iter665 in self.success:
+                oprot.writeBool(iter665)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
         if self.se is not None:
             oprot.writeFieldBegin('se', TType.STRUCT, 1)
             self.se.write(oprot)
@@ -1440,28 +3508,26 @@ class FollowWithUsername_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(FollowWithUsername_result)
-FollowWithUsername_result.thrift_spec = (
-    None,  # 0
+all_structs.append(IsFollowing_result)
+IsFollowing_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.BOOL, None, False), None, ),  # 0
     (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
 )
 
 
-class UnfollowWithUsername_args(object):
+class GetFollowerCount_args(object):
     """
     Attributes:
      - req_id
-     - user_usernmae
-     - followee_username
+     - user_id
      - carrier
 
     """
 
 
-    def __init__(self, req_id=None, user_usernmae=None, followee_username=None, carrier=None,):
+    def __init__(self, req_id=None, user_id=None, carrier=None,):
         self.req_id = req_id
-        self.user_usernmae = user_usernmae
-        self.followee_username = followee_username
+        self.user_id = user_id
         self.carrier = carrier
 
     def read(self, iprot):
@@ -1479,23 +3545,18 @@ class UnfollowWithUsername_args(object):
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
-                if ftype == TType.STRING:
-                    self.user_usernmae = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                if ftype == TType.I64:
+                    self.user_id = iprot.readI64()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
-                if ftype == TType.STRING:
-                    self.followee_username = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 4:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype249, _vtype250, _size248) = iprot.readMapBegin()
-                    for _i252 in range(_size248):
-                        _key253 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val254 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key253] = _val254
+                    (_ktype667, _vtype668, _size666) = iprot.readMapBegin()
+                    for _i670 in range(_size666):
+                        _key671 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val672 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key671] = _val672
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -1508,25 +3569,21 @@ class UnfollowWithUsername_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('UnfollowWithUsername_args')
+        oprot.writeStructBegin('GetFollowerCount_args')
         if self.req_id is not None:
             oprot.writeFieldBegin('req_id', TType.I64, 1)
             oprot.writeI64(self.req_id)
             oprot.writeFieldEnd()
-        if self.user_usernmae is not None:
-            oprot.writeFieldBegin('user_usernmae', TType.STRING, 2)
-            oprot.writeString(self.user_usernmae.encode('utf-8') if sys.version_info[0] == 2 else self.user_usernmae)
-            oprot.writeFieldEnd()
-        if self.followee_username is not None:
-            oprot.writeFieldBegin('followee_username', TType.STRING, 3)
-            oprot.writeString(self.followee_username.encode('utf-8') if sys.version_info[0] == 2 else self.followee_username)
+        if self.user_id is not None:
+            oprot.writeFieldBegin('user_id', TType.I64, 2)
+            oprot.writeI64(self.user_id)
             oprot.writeFieldEnd()
         if self.carrier is not None:
-            oprot.writeFieldBegin('carrier', TType.MAP, 4)
+            oprot.writeFieldBegin('carrier', TType.MAP, 3)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter255, viter256 in self.carrier.items():
-                oprot.writeString(kiter255.encode('utf-8') if sys.version_info[0] == 2 else kiter255)
-                oprot.writeString(viter256.encode('utf-8') if sys.version_info[0] == 2 else viter256)
+            for kiter673, viter674 in self.carrier.items():
+                oprot.writeString(kiter673.encode('utf-8') if sys.version_info[0] == 2 else kiter673)
+                oprot.writeString(viter674.encode('utf-8') if sys.version_info[0] == 2 else viter674)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -1545,25 +3602,26 @@ class UnfollowWithUsername_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(UnfollowWithUsername_args)
-UnfollowWithUsername_args.thrift_spec = (
+all_structs.append(GetFollowerCount_args)
+GetFollowerCount_args.thrift_spec = (
     None,  # 0
     (1, TType.I64, 'req_id', None, None, ),  # 1
-    (2, TType.STRING, 'user_usernmae', 'UTF8', None, ),  # 2
-    (3, TType.STRING, 'followee_username', 'UTF8', None, ),  # 3
-    (4, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 4
+    (2, TType.I64, 'user_id', None, None, ),  # 2
+    (3, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 3
 )
 
 
-class UnfollowWithUsername_result(object):
+class GetFollowerCount_result(object):
     """
     Attributes:
+     - success
      - se
 
     """
 
 
-    def __init__(self, se=None,):
+    def __init__(self, success=None, se=None,):
+        self.success = success
         self.se = se
 
     def read(self, iprot):
@@ -1575,7 +3633,12 @@ class UnfollowWithUsername_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 1:
+            if fid == 0:
+                if ftype == TType.I64:
+                    self.success = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
                 if ftype == TType.STRUCT:
                     self.se = ServiceException()
                     self.se.read(iprot)
@@ -1590,7 +3653,11 @@ class UnfollowWithUsername_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('UnfollowWithUsername_result')
+        oprot.writeStructBegin('GetFollowerCount_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.I64, 0)
+            oprot.writeI64(self.success)
+            oprot.writeFieldEnd()
         if self.se is not None:
             oprot.writeFieldBegin('se', TType.STRUCT, 1)
             self.se.write(oprot)
@@ -1611,26 +3678,32 @@ class UnfollowWithUsername_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(UnfollowWithUsername_result)
-UnfollowWithUsername_result.thrift_spec = (
-    None,  # 0
+all_structs.append(GetFollowerCount_result)
+GetFollowerCount_result.thrift_spec = (
+    (0, TType.I64, 'success', None, None, ),  # 0
     (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
 )
 
 
-class InsertUser_args(object):
+class GetFollowersPage_args(object):
     """
     Attributes:
      - req_id
      - user_id
+     - after_timestamp
+     - after_user_id
+     - limit
      - carrier
 
     """
 
 
-    def __init__(self, req_id=None, user_id=None, carrier=None,):
+    def __init__(self, req_id=None, user_id=None, after_timestamp=None, after_user_id=None, limit=None, carrier=None,):
         self.req_id = req_id
         self.user_id = user_id
+        self.after_timestamp = after_timestamp
+        self.after_user_id = after_user_id
+        self.limit = limit
         self.carrier = carrier
 
     def read(self, iprot):
@@ -1653,13 +3726,28 @@ class InsertUser_args(object):
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
+                if ftype == TType.I64:
+                    self.after_timestamp = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I64:
+                    self.after_user_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.I32:
+                    self.limit = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype258, _vtype259, _size257) = iprot.readMapBegin()
-                    for _i261 in range(_size257):
-                        _key262 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val263 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key262] = _val263
+                    (_ktype676, _vtype677, _size675) = iprot.readMapBegin()
+                    for _i679 in range(_size675):
+                        _key680 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val681 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key680] = _val681
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -1672,7 +3760,7 @@ class InsertUser_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('InsertUser_args')
+        oprot.writeStructBegin('GetFollowersPage_args')
         if self.req_id is not None:
             oprot.writeFieldBegin('req_id', TType.I64, 1)
             oprot.writeI64(self.req_id)
@@ -1681,12 +3769,24 @@ class InsertUser_args(object):
             oprot.writeFieldBegin('user_id', TType.I64, 2)
             oprot.writeI64(self.user_id)
             oprot.writeFieldEnd()
+        if self.after_timestamp is not None:
+            oprot.writeFieldBegin('after_timestamp', TType.I64, 3)
+            oprot.writeI64(self.after_timestamp)
+            oprot.writeFieldEnd()
+        if self.after_user_id is not None:
+            oprot.writeFieldBegin('after_user_id', TType.I64, 4)
+            oprot.writeI64(self.after_user_id)
+            oprot.writeFieldEnd()
+        if self.limit is not None:
+            oprot.writeFieldBegin('limit', TType.I32, 5)
+            oprot.writeI32(self.limit)
+            oprot.writeFieldEnd()
         if self.carrier is not None:
-            oprot.writeFieldBegin('carrier', TType.MAP, 3)
+            oprot.writeFieldBegin('carrier', TType.MAP, 6)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter264, viter265 in self.carrier.items():
-                oprot.writeString(kiter264.encode('utf-8') if sys.version_info[0] == 2 else kiter264)
-                oprot.writeString(viter265.encode('utf-8') if sys.version_info[0] == 2 else viter265)
+            for kiter682, viter683 in self.carrier.items():
+                oprot.writeString(kiter682.encode('utf-8') if sys.version_info[0] == 2 else kiter682)
+                oprot.writeString(viter683.encode('utf-8') if sys.version_info[0] == 2 else viter683)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -1705,24 +3805,29 @@ class InsertUser_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(InsertUser_args)
-InsertUser_args.thrift_spec = (
+all_structs.append(GetFollowersPage_args)
+GetFollowersPage_args.thrift_spec = (
     None,  # 0
     (1, TType.I64, 'req_id', None, None, ),  # 1
     (2, TType.I64, 'user_id', None, None, ),  # 2
-    (3, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 3
+    (3, TType.I64, 'after_timestamp', None, None, ),  # 3
+    (4, TType.I64, 'after_user_id', None, None, ),  # 4
+    (5, TType.I32, 'limit', None, None, ),  # 5
+    (6, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 6
 )
 
 
-class InsertUser_result(object):
+class GetFollowersPage_result(object):
     """
     Attributes:
+     - success
      - se
 
     """
 
 
-    def __init__(self, se=None,):
+    def __init__(self, success=None, se=None,):
+        self.success = success
         self.se = se
 
     def read(self, iprot):
@@ -1734,7 +3839,13 @@ class InsertUser_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 1:
+            if fid == 0:
+                if ftype == TType.STRUCT:
+                    self.success = FollowersPage()
+                    self.success.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
                 if ftype == TType.STRUCT:
                     self.se = ServiceException()
                     self.se.read(iprot)
@@ -1749,7 +3860,11 @@ class InsertUser_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('InsertUser_result')
+        oprot.writeStructBegin('GetFollowersPage_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.STRUCT, 0)
+            self.success.write(oprot)
+            oprot.writeFieldEnd()
         if self.se is not None:
             oprot.writeFieldBegin('se', TType.STRUCT, 1)
             self.se.write(oprot)
@@ -1770,9 +3885,9 @@ class InsertUser_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(InsertUser_result)
-InsertUser_result.thrift_spec = (
-    None,  # 0
+all_structs.append(GetFollowersPage_result)
+GetFollowersPage_result.thrift_spec = (
+    (0, TType.STRUCT, 'success', [FollowersPage, None], None, ),  # 0
     (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
 )
 fix_spec(all_structs)
@@ -233,21 +233,21 @@ class ComposeUrls_args(object):
             elif fid == 2:
                 if ftype == TType.LIST:
                     self.urls = []
-                    (_etype292, _size289) = iprot.readListBegin()
-                    for _i293 in range(_size289):
-                        _elem294 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.urls.append(_elem294)
+                    (_etype710, _size707) = iprot.readListBegin()
+                    for _i711 in range(_size707):
+                        _elem712 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.urls.append(_elem712)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype296, _vtype297, _size295) = iprot.readMapBegin()
-                    for _i299 in range(_size295):
-                        _key300 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val301 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key300] = _val301
+                    (_ktype714, _vtype715, _size713) = iprot.readMapBegin()
+                    for _i717 in range(_size713):
+                        _key718 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val719 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key718] = _val719
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -268,16 +268,16 @@ class ComposeUrls_args(object):
         if self.urls is not None:
             oprot.writeFieldBegin('urls', TType.LIST, 2)
             oprot.writeListBegin(TType.STRING, len(self.urls))
-            for iter302 in self.urls:
-                oprot.writeString(iter302.encode('utf-8') if sys.version_info[0] == 2 else iter302)
+            for iter720 in self.urls:
+                oprot.writeString(iter720.encode('utf-8') if sys.version_info[0] == 2 else iter720)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 3)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter303, viter304 in self.carrier.items():
-                oprot.writeString(kiter303.encode('utf-8') if sys.version_info[0] == 2 else kiter303)
-                oprot.writeString(viter304.encode('utf-8') if sys.version_info[0] == 2 else viter304)
+            for kiter721, viter722 in self.carrier.items():
+                oprot.writeString(kiter721.encode('utf-8') if sys.version_info[0] == 2 else kiter721)
+                oprot.writeString(viter722.encode('utf-8') if sys.version_info[0] == 2 else viter722)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -330,10 +330,11 @@ class ComposeUrls_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype308, _size305) = iprot.readListBegin()
-                    for _i309 in range(_size305):
-                        _elem310 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.success.append(_elem310)
+                    (_etype726, _size723) = iprot.readListBegin()
+                    for _i727 in range(_size723):
+                        _elem728 = Url()
+                        _elem728.read(iprot)
+                        self.success.append(_elem728)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -355,9 +356,9 @@ class ComposeUrls_result(object):
         oprot.writeStructBegin('ComposeUrls_result')
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
-            oprot.writeListBegin(TType.STRING, len(self.success))
-            for iter311 in self.success:
-                oprot.writeString(iter311.encode('utf-8') if sys.version_info[0] == 2 else iter311)
+            oprot.writeListBegin(TType.STRUCT, len(self.success))
+            for iter729 in self.success:
+                iter729.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.se is not None:
@@ -382,7 +383,7 @@ class ComposeUrls_result(object):
         return not (self == other)
 all_structs.append(ComposeUrls_result)
 ComposeUrls_result.thrift_spec = (
-    (0, TType.LIST, 'success', (TType.STRING, 'UTF8', False), None, ),  # 0
+    (0, TType.LIST, 'success', (TType.STRUCT, [Url, None], False), None, ),  # 0
     (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
 )
 
@@ -419,21 +420,21 @@ class GetExtendedUrls_args(object):
             elif fid == 2:
                 if ftype == TType.LIST:
                     self.shortened_urls = []
-                    (_etype315, _size312) = iprot.readListBegin()
-                    for _i316 in range(_size312):
-                        _elem317 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.shortened_urls.append(_elem317)
+                    (_etype733, _size730) = iprot.readListBegin()
+                    for _i734 in range(_size730):
+                        _elem735 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.shortened_urls.append(_elem735)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype319, _vtype320, _size318) = iprot.readMapBegin()
-                    for _i322 in range(_size318):
-                        _key323 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val324 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key323] = _val324
+                    (_ktype737, _vtype738, _size736) = iprot.readMapBegin()
+                    for _i740 in range(_size736):
+                        _key741 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val742 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key741] = _val742
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -454,16 +455,16 @@ class GetExtendedUrls_args(object):
         if self.shortened_urls is not None:
             oprot.writeFieldBegin('shortened_urls', TType.LIST, 2)
             oprot.writeListBegin(TType.STRING, len(self.shortened_urls))
-            for iter325 in self.shortened_urls:
-                oprot.writeString(iter325.encode('utf-8') if sys.version_info[0] == 2 else iter325)
+            for iter743 in self.shortened_urls:
+                oprot.writeString(iter743.encode('utf-8') if sys.version_info[0] == 2 else iter743)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 3)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter326, viter327 in self.carrier.items():
-                oprot.writeString(kiter326.encode('utf-8') if sys.version_info[0] == 2 else kiter326)
-                oprot.writeString(viter327.encode('utf-8') if sys.version_info[0] == 2 else viter327)
+            for kiter744, viter745 in self.carrier.items():
+                oprot.writeString(kiter744.encode('utf-8') if sys.version_info[0] == 2 else kiter744)
+                oprot.writeString(viter745.encode('utf-8') if sys.version_info[0] == 2 else viter745)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -516,10 +517,10 @@ class GetExtendedUrls_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype331, _size328) = iprot.readListBegin()
-                    for _i332 in range(_size328):
-                        _elem333 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.success.append(_elem333)
+                    (_etype749, _size746) = iprot.readListBegin()
+                    for _i750 in range(_size746):
+                        _elem751 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.success.append(_elem751)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -542,8 +543,8 @@ class GetExtendedUrls_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRING, len(self.success))
-            for iter334 in self.success:
-                oprot.writeString(iter334.encode('utf-8') if sys.version_info[0] == 2 else iter334)
+            for iter752 in self.success:
+                oprot.writeString(iter752.encode('utf-8') if sys.version_info[0] == 2 else iter752)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.se is not None:
@@ -31,7 +31,19 @@ class Iface(object):
         """
         pass
 
-    def ReadUserTimeline(self, req_id, user_id, start, stop, carrier):
+    def WriteUserTimelines(self, req_id, post_ids, user_ids, timestamps, carrier):
+        """
+        Parameters:
+         - req_id
+         - post_ids
+         - user_ids
+         - timestamps
+         - carrier
+
+        """
+        pass
+
+    def ReadUserTimeline(self, req_id, user_id, start, stop, carrier, fields):
         """
         Parameters:
          - req_id
@@ -39,6 +51,7 @@ class Iface(object):
          - start
          - stop
          - carrier
+         - fields
 
         """
         pass
@@ -91,7 +104,47 @@ class Client(Iface):
             raise result.se
         return
 
-    def ReadUserTimeline(self, req_id, user_id, start, stop, carrier):
+    def WriteUserTimelines(self, req_id, post_ids, user_ids, timestamps, carrier):
+        """
+        Parameters:
+         - req_id
+         - post_ids
+         - user_ids
+         - timestamps
+         - carrier
+
+        """
+        self.send_WriteUserTimelines(req_id, post_ids, user_ids, timestamps, carrier)
+        self.recv_WriteUserTimelines()
+
+    def send_WriteUserTimelines(self, req_id, post_ids, user_ids, timestamps, carrier):
+        self._oprot.writeMessageBegin('WriteUserTimelines', TMessageType.CALL, self._seqid)
+        args = WriteUserTimelines_args()
+        args.req_id = req_id
+        args.post_ids = post_ids
+        args.user_ids = user_ids
+        args.timestamps = timestamps
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_WriteUserTimelines(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = WriteUserTimelines_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.se is not None:
+            raise result.se
+        return
+
+    def ReadUserTimeline(self, req_id, user_id, start, stop, carrier, fields):
         """
         Parameters:
          - req_id
@@ -99,12 +152,13 @@ class Client(Iface):
          - start
          - stop
          - carrier
+         - fields
 
         """
-        self.send_ReadUserTimeline(req_id, user_id, start, stop, carrier)
+        self.send_ReadUserTimeline(req_id, user_id, start, stop, carrier, fields)
         return self.recv_ReadUserTimeline()
 
-    def send_ReadUserTimeline(self, req_id, user_id, start, stop, carrier):
+    def send_ReadUserTimeline(self, req_id, user_id, start, stop, carrier, fields):
         self._oprot.writeMessageBegin('ReadUserTimeline', TMessageType.CALL, self._seqid)
         args = ReadUserTimeline_args()
         args.req_id = req_id
@@ -112,6 +166,7 @@ class Client(Iface):
         args.start = start
         args.stop = stop
         args.carrier = carrier
+        args.fields = fields
         args.write(self._oprot)
         self._oprot.writeMessageEnd()
         self._oprot.trans.flush()
@@ -139,6 +194,7 @@ class Processor(Iface, TProcessor):
         self._handler = handler
         self._processMap = {}
         self._processMap["WriteUserTimeline"] = Processor.process_WriteUserTimeline
+        self._processMap["WriteUserTimelines"] = Processor.process_WriteUserTimelines
         self._processMap["ReadUserTimeline"] = Processor.process_ReadUserTimeline
 
     def process(self, iprot, oprot):
@@ -182,13 +238,39 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_WriteUserTimelines(self, seqid, iprot, oprot):
+        args = WriteUserTimelines_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = WriteUserTimelines_result()
+        try:
+            self._handler.WriteUserTimelines(args.req_id, args.post_ids, args.user_ids, args.timestamps, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("WriteUserTimelines", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
     def process_ReadUserTimeline(self, seqid, iprot, oprot):
         args = ReadUserTimeline_args()
         args.read(iprot)
         iprot.readMessageEnd()
         result = ReadUserTimeline_result()
         try:
-            result.success = self._handler.ReadUserTimeline(args.req_id, args.user_id, args.start, args.stop, args.carrier)
+            result.success = self._handler.ReadUserTimeline(args.req_id, args.user_id, args.start, args.stop, args.carrier, args.fields)
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
@@ -262,11 +344,11 @@ class WriteUserTimeline_args(object):
             elif fid == 5:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype165, _vtype166, _size164) = iprot.readMapBegin()
-                    for _i168 in range(_size164):
-                        _key169 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val170 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key169] = _val170
+                    (_ktype404, _vtype405, _size403) = iprot.readMapBegin()
+                    for _i407 in range(_size403):
+                        _key408 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val409 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key408] = _val409
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -299,9 +381,9 @@ class WriteUserTimeline_args(object):
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 5)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter171, viter172 in self.carrier.items():
-                oprot.writeString(kiter171.encode('utf-8') if sys.version_info[0] == 2 else kiter171)
-                oprot.writeString(viter172.encode('utf-8') if sys.version_info[0] == 2 else viter172)
+            for kiter410, viter411 in self.carrier.items():
+                oprot.writeString(kiter410.encode('utf-8') if sys.version_info[0] == 2 else kiter410)
+                oprot.writeString(viter411.encode('utf-8') if sys.version_info[0] == 2 else viter411)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -394,6 +476,213 @@ WriteUserTimeline_result.thrift_spec = (
 )
 
 
+class WriteUserTimelines_args(object):
+    """
+    Attributes:
+     - req_id
+     - post_ids
+     - user_ids
+     - timestamps
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, post_ids=None, user_ids=None, timestamps=None, carrier=None,):
+        self.req_id = req_id
+        self.post_ids = post_ids
+        self.user_ids = user_ids
+        self.timestamps = timestamps
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.LIST:
+                    self.post_ids = []
+                    (_etype415, _size412) = iprot.readListBegin()
+                    for _i416 in range(_size412):
+                        _elem417 = iprot.readI64()
+                        self.post_ids.append(_elem417)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.LIST:
+                    self.user_ids = []
+                    (_etype421, _size418) = iprot.readListBegin()
+                    for _i422 in range(_size418):
+                        _elem423 = iprot.readI64()
+                        self.user_ids.append(_elem423)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.LIST:
+                    self.timestamps = []
+                    (_etype427, _size424) = iprot.readListBegin()
+                    for _i428 in range(_size424):
+                        _elem429 = iprot.readI64()
+                        self.timestamps.append(_elem429)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype431, _vtype432, _size430) = iprot.readMapBegin()
+                    for _i434 in range(_size430):
+                        _key435 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val436 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key435] = _val436
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('WriteUserTimelines_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.post_ids is not None:
+            oprot.writeFieldBegin('post_ids', TType.LIST, 2)
+            oprot.writeListBegin(TType.I64, len(self.post_ids))
+            for iter437 in self.post_ids:
+                oprot.writeI64(iter437)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.user_ids is not None:
+            oprot.writeFieldBegin('user_ids', TType.LIST, 3)
+            oprot.writeListBegin(TType.I64, len(self.user_ids))
+            for iter438 in self.user_ids:
+                oprot.writeI64(iter438)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.timestamps is not None:
+            oprot.writeFieldBegin('timestamps', TType.LIST, 4)
+            oprot.writeListBegin(TType.I64, len(self.timestamps))
+            for iter439 in self.timestamps:
+                oprot.writeI64(iter439)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 5)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter440, viter441 in self.carrier.items():
+                oprot.writeString(kiter440.encode('utf-8') if sys.version_info[0] == 2 else kiter440)
+                oprot.writeString(viter441.encode('utf-8') if sys.version_info[0] == 2 else viter441)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(WriteUserTimelines_args)
+WriteUserTimelines_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.LIST, 'post_ids', (TType.I64, None, False), None, ),  # 2
+    (3, TType.LIST, 'user_ids', (TType.I64, None, False), None, ),  # 3
+    (4, TType.LIST, 'timestamps', (TType.I64, None, False), None, ),  # 4
+    (5, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 5
+)
+
+
+class WriteUserTimelines_result(object):
+    """
+    Attributes:
+     - se
+
+    """
+
+
+    def __init__(self, se=None,):
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException()
+                    self.se.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('WriteUserTimelines_result')
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(WriteUserTimelines_result)
+WriteUserTimelines_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
+
+
 class ReadUserTimeline_args(object):
     """
     Attributes:
@@ -402,16 +691,18 @@ class ReadUserTimeline_args(object):
      - start
      - stop
      - carrier
+     - fields
 
     """
 
 
-    def __init__(self, req_id=None, user_id=None, start=None, stop=None, carrier=None,):
+    def __init__(self, req_id=None, user_id=None, start=None, stop=None, carrier=None, fields=511,):
         self.req_id = req_id
         self.user_id = user_id
         self.start = start
         self.stop = stop
         self.carrier = carrier
+        self.fields = fields
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -445,14 +736,19 @@ class ReadUserTimeline_args(object):
             elif fid == 5:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype174, _vtype175, _size173) = iprot.readMapBegin()
-                    for _i177 in range(_size173):
-                        _key178 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val179 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key178] = _val179
+                    (_ktype443, _vtype444, _size442) = iprot.readMapBegin()
+                    for _i446 in range(_size442):
+                        _key447 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val448 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key447] = _val448
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.I32:
+                    self.fields = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -482,11 +778,15 @@ class ReadUserTimeline_args(object):
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 5)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter180, viter181 in self.carrier.items():
-                oprot.writeString(kiter180.encode('utf-8') if sys.version_info[0] == 2 else kiter180)
-                oprot.writeString(viter181.encode('utf-8') if sys.version_info[0] == 2 else viter181)
+            for kiter449, viter450 in self.carrier.items():
+                oprot.writeString(kiter449.encode('utf-8') if sys.version_info[0] == 2 else kiter449)
+                oprot.writeString(viter450.encode('utf-8') if sys.version_info[0] == 2 else viter450)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
+        if self.fields is not None:
+            oprot.writeFieldBegin('fields', TType.I32, 6)
+            oprot.writeI32(self.fields)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -511,6 +811,7 @@ ReadUserTimeline_args.thrift_spec = (
     (3, TType.I32, 'start', None, None, ),  # 3
     (4, TType.I32, 'stop', None, None, ),  # 4
     (5, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 5
+    (6, TType.I32, 'fields', None, 511, ),  # 6
 )
 
 
@@ -539,11 +840,11 @@ class ReadUserTimeline_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype185, _size182) = iprot.readListBegin()
-                    for _i186 in range(_size182):
-                        _elem187 = Post()
-                        _elem187.read(iprot)
-                        self.success.append(_elem187)
+                    (_etype454, _size451) = iprot.readListBegin()
+                    for _i455 in range(_size451):
+                        _elem456 = Post()
+                        _elem456.read(iprot)
+                        self.success.append(_elem456)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -566,8 +867,8 @@ class ReadUserTimeline_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter188 in self.success:
-                iter188.write(oprot)
+            for iter457 in self.success:
+                iter457.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.se is not None:
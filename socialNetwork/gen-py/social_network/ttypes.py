@@ -525,6 +525,103 @@ class Creator(object):
         return not (self == other)
 
 
+class TextServiceReturn(object):
+    """
+    Attributes:
+     - text
+     - user_mentions
+     - urls
+
+    """
+
+
+    def __init__(self, text=None, user_mentions=None, urls=None,):
+        self.text = text
+        self.user_mentions = user_mentions
+        self.urls = urls
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.text = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.LIST:
+                    self.user_mentions = []
+                    (_etype3, _size0) = iprot.readListBegin()
+                    for _i4 in range(_size0):
+                        _elem5 = UserMention()
+                        _elem5.read(iprot)
+                        self.user_mentions.append(_elem5)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.LIST:
+                    self.urls = []
+                    (_etype9, _size6) = iprot.readListBegin()
+                    for _i10 in range(_size6):
+                        _elem11 = Url()
+                        _elem11.read(iprot)
+                        self.urls.append(_elem11)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('TextServiceReturn')
+        if self.text is not None:
+            oprot.writeFieldBegin('text', TType.STRING, 1)
+            oprot.writeString(self.text.encode('utf-8') if sys.version_info[0] == 2 else self.text)
+            oprot.writeFieldEnd()
+        if self.user_mentions is not None:
+            oprot.writeFieldBegin('user_mentions', TType.LIST, 2)
+            oprot.writeListBegin(TType.STRUCT, len(self.user_mentions))
+            for iter12 in self.user_mentions:
+                iter12.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.urls is not None:
+            oprot.writeFieldBegin('urls', TType.LIST, 3)
+            oprot.writeListBegin(TType.STRUCT, len(self.urls))
+            for iter13 in self.urls:
+                iter13.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
 class Post(object):
     """
     Attributes:
@@ -585,33 +682,33 @@ class Post(object):
             elif fid == 5:
                 if ftype == TType.LIST:
                     self.user_mentions = []
-                    (_etype3, _size0) = iprot.readListBegin()
-                    for _i4 in range(_size0):
-                        _elem5 = UserMention()
-                        _elem5.read(iprot)
-                        self.user_mentions.append(_elem5)
+                    (_etype17, _size14) = iprot.readListBegin()
+                    for _i18 in range(_size14):
+                        _elem19 = UserMention()
+                        _elem19.read(iprot)
+                        self.user_mentions.append(_elem19)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 6:
                 if ftype == TType.LIST:
                     self.media = []
-                    (_etype9, _size6) = iprot.readListBegin()
-                    for _i10 in range(_size6):
-                        _elem11 = Media()
-                        _elem11.read(iprot)
-                        self.media.append(_elem11)
+                    (_etype23, _size20) = iprot.readListBegin()
+                    for _i24 in range(_size20):
+                        _elem25 = Media()
+                        _elem25.read(iprot)
+                        self.media.append(_elem25)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 7:
                 if ftype == TType.LIST:
                     self.urls = []
-                    (_etype15, _size12) = iprot.readListBegin()
-                    for _i16 in range(_size12):
-                        _elem17 = Url()
-                        _elem17.read(iprot)
-                        self.urls.append(_elem17)
+                    (_etype29, _size26) = iprot.readListBegin()
+                    for _i30 in range(_size26):
+                        _elem31 = Url()
+                        _elem31.read(iprot)
+                        self.urls.append(_elem31)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -654,22 +751,22 @@ class Post(object):
         if self.user_mentions is not None:
             oprot.writeFieldBegin('user_mentions', TType.LIST, 5)
             oprot.writeListBegin(TType.STRUCT, len(self.user_mentions))
-            for iter18 in self.user_mentions:
-                iter18.write(oprot)
+            for iter32 in self.user_mentions:
+                iter32.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.media is not None:
             oprot.writeFieldBegin('media', TType.LIST, 6)
             oprot.writeListBegin(TType.STRUCT, len(self.media))
-            for iter19 in self.media:
-                iter19.write(oprot)
+            for iter33 in self.media:
+                iter33.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.urls is not None:
             oprot.writeFieldBegin('urls', TType.LIST, 7)
             oprot.writeListBegin(TType.STRUCT, len(self.urls))
-            for iter20 in self.urls:
-                iter20.write(oprot)
+            for iter34 in self.urls:
+                iter34.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.timestamp is not None:
@@ -696,6 +793,469 @@ class Post(object):
 
     def __ne__(self, other):
         return not (self == other)
+
+
+class UserRegistration(object):
+    """
+    Attributes:
+     - user_id
+     - first_name
+     - last_name
+     - username
+     - password
+
+    """
+
+
+    def __init__(self, user_id=None, first_name=None, last_name=None, username=None, password=None,):
+        self.user_id = user_id
+        self.first_name = first_name
+        self.last_name = last_name
+        self.username = username
+        self.password = password
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.user_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.first_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRING:
+                    self.last_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.STRING:
+                    self.username = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.STRING:
+                    self.password = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('UserRegistration')
+        if self.user_id is not None:
+            oprot.writeFieldBegin('user_id', TType.I64, 1)
+            oprot.writeI64(self.user_id)
+            oprot.writeFieldEnd()
+        if self.first_name is not None:
+            oprot.writeFieldBegin('first_name', TType.STRING, 2)
+            oprot.writeString(self.first_name.encode('utf-8') if sys.version_info[0] == 2 else self.first_name)
+            oprot.writeFieldEnd()
+        if self.last_name is not None:
+            oprot.writeFieldBegin('last_name', TType.STRING, 3)
+            oprot.writeString(self.last_name.encode('utf-8') if sys.version_info[0] == 2 else self.last_name)
+            oprot.writeFieldEnd()
+        if self.username is not None:
+            oprot.writeFieldBegin('username', TType.STRING, 4)
+            oprot.writeString(self.username.encode('utf-8') if sys.version_info[0] == 2 else self.username)
+            oprot.writeFieldEnd()
+        if self.password is not None:
+            oprot.writeFieldBegin('password', TType.STRING, 5)
+            oprot.writeString(self.password.encode('utf-8') if sys.version_info[0] == 2 else self.password)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class UserRegistrationResult(object):
+    """
+    Attributes:
+     - user_id
+     - message
+
+    """
+
+
+    def __init__(self, user_id=None, message=None,):
+        self.user_id = user_id
+        self.message = message
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.user_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.message = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('UserRegistrationResult')
+        if self.user_id is not None:
+            oprot.writeFieldBegin('user_id', TType.I64, 1)
+            oprot.writeI64(self.user_id)
+            oprot.writeFieldEnd()
+        if self.message is not None:
+            oprot.writeFieldBegin('message', TType.STRING, 2)
+            oprot.writeString(self.message.encode('utf-8') if sys.version_info[0] == 2 else self.message)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class PostComposition(object):
+    """
+    Attributes:
+     - username
+     - user_id
+     - text
+     - media_ids
+     - media_types
+     - post_type
+     - timestamp
+
+    """
+
+
+    def __init__(self, username=None, user_id=None, text=None, media_ids=None, media_types=None, post_type=None, timestamp=None,):
+        self.username = username
+        self.user_id = user_id
+        self.text = text
+        self.media_ids = media_ids
+        self.media_types = media_types
+        self.post_type = post_type
+        self.timestamp = timestamp
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.username = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.user_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRING:
+                    self.text = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.LIST:
+                    self.media_ids = []
+                    (_etype38, _size35) = iprot.readListBegin()
+                    for _i39 in range(_size35):
+                        _elem40 = iprot.readI64()
+                        self.media_ids.append(_elem40)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.LIST:
+                    self.media_types = []
+                    (_etype44, _size41) = iprot.readListBegin()
+                    for _i45 in range(_size41):
+                        _elem46 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.media_types.append(_elem46)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.I32:
+                    self.post_type = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 7:
+                if ftype == TType.I64:
+                    self.timestamp = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('PostComposition')
+        if self.username is not None:
+            oprot.writeFieldBegin('username', TType.STRING, 1)
+            oprot.writeString(self.username.encode('utf-8') if sys.version_info[0] == 2 else self.username)
+            oprot.writeFieldEnd()
+        if self.user_id is not None:
+            oprot.writeFieldBegin('user_id', TType.I64, 2)
+            oprot.writeI64(self.user_id)
+            oprot.writeFieldEnd()
+        if self.text is not None:
+            oprot.writeFieldBegin('text', TType.STRING, 3)
+            oprot.writeString(self.text.encode('utf-8') if sys.version_info[0] == 2 else self.text)
+            oprot.writeFieldEnd()
+        if self.media_ids is not None:
+            oprot.writeFieldBegin('media_ids', TType.LIST, 4)
+            oprot.writeListBegin(TType.I64, len(self.media_ids))
+            for iter47 in self.media_ids:
+                oprot.writeI64(iter47)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.media_types is not None:
+            oprot.writeFieldBegin('media_types', TType.LIST, 5)
+            oprot.writeListBegin(TType.STRING, len(self.media_types))
+            for iter48 in self.media_types:
+                oprot.writeString(iter48.encode('utf-8') if sys.version_info[0] == 2 else iter48)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.post_type is not None:
+            oprot.writeFieldBegin('post_type', TType.I32, 6)
+            oprot.writeI32(self.post_type)
+            oprot.writeFieldEnd()
+        if self.timestamp is not None:
+            oprot.writeFieldBegin('timestamp', TType.I64, 7)
+            oprot.writeI64(self.timestamp)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class PostCompositionResult(object):
+    """
+    Attributes:
+     - post_id
+     - message
+
+    """
+
+
+    def __init__(self, post_id=None, message=None,):
+        self.post_id = post_id
+        self.message = message
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.post_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.message = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('PostCompositionResult')
+        if self.post_id is not None:
+            oprot.writeFieldBegin('post_id', TType.I64, 1)
+            oprot.writeI64(self.post_id)
+            oprot.writeFieldEnd()
+        if self.message is not None:
+            oprot.writeFieldBegin('message', TType.STRING, 2)
+            oprot.writeString(self.message.encode('utf-8') if sys.version_info[0] == 2 else self.message)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class FollowersPage(object):
+    """
+    Attributes:
+     - followers
+     - next_timestamp
+     - next_user_id
+
+    """
+
+
+    def __init__(self, followers=None, next_timestamp=None, next_user_id=None,):
+        self.followers = followers
+        self.next_timestamp = next_timestamp
+        self.next_user_id = next_user_id
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.LIST:
+                    self.followers = []
+                    (_etype52, _size49) = iprot.readListBegin()
+                    for _i53 in range(_size49):
+                        _elem54 = iprot.readI64()
+                        self.followers.append(_elem54)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.next_timestamp = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I64:
+                    self.next_user_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('FollowersPage')
+        if self.followers is not None:
+            oprot.writeFieldBegin('followers', TType.LIST, 1)
+            oprot.writeListBegin(TType.I64, len(self.followers))
+            for iter55 in self.followers:
+                oprot.writeI64(iter55)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.next_timestamp is not None:
+            oprot.writeFieldBegin('next_timestamp', TType.I64, 2)
+            oprot.writeI64(self.next_timestamp)
+            oprot.writeFieldEnd()
+        if self.next_user_id is not None:
+            oprot.writeFieldBegin('next_user_id', TType.I64, 3)
+            oprot.writeI64(self.next_user_id)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
 all_structs.append(User)
 User.thrift_spec = (
     None,  # 0
@@ -736,6 +1296,13 @@ Creator.thrift_spec = (
     (1, TType.I64, 'user_id', None, None, ),  # 1
     (2, TType.STRING, 'username', 'UTF8', None, ),  # 2
 )
+all_structs.append(TextServiceReturn)
+TextServiceReturn.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'text', 'UTF8', None, ),  # 1
+    (2, TType.LIST, 'user_mentions', (TType.STRUCT, [UserMention, None], False), None, ),  # 2
+    (3, TType.LIST, 'urls', (TType.STRUCT, [Url, None], False), None, ),  # 3
+)
 all_structs.append(Post)
 Post.thrift_spec = (
     None,  # 0
@@ -749,5 +1316,44 @@ Post.thrift_spec = (
     (8, TType.I64, 'timestamp', None, None, ),  # 8
     (9, TType.I32, 'post_type', None, None, ),  # 9
 )
+all_structs.append(UserRegistration)
+UserRegistration.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'user_id', None, None, ),  # 1
+    (2, TType.STRING, 'first_name', 'UTF8', None, ),  # 2
+    (3, TType.STRING, 'last_name', 'UTF8', None, ),  # 3
+    (4, TType.STRING, 'username', 'UTF8', None, ),  # 4
+    (5, TType.STRING, 'password', 'UTF8', None, ),  # 5
+)
+all_structs.append(UserRegistrationResult)
+UserRegistrationResult.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'user_id', None, None, ),  # 1
+    (2, TType.STRING, 'message', 'UTF8', None, ),  # 2
+)
+all_structs.append(PostComposition)
+PostComposition.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'username', 'UTF8', None, ),  # 1
+    (2, TType.I64, 'user_id', None, None, ),  # 2
+    (3, TType.STRING, 'text', 'UTF8', None, ),  # 3
+    (4, TType.LIST, 'media_ids', (TType.I64, None, False), None, ),  # 4
+    (5, TType.LIST, 'media_types', (TType.STRING, 'UTF8', False), None, ),  # 5
+    (6, TType.I32, 'post_type', None, None, ),  # 6
+    (7, TType.I64, 'timestamp', None, None, ),  # 7
+)
+all_structs.append(PostCompositionResult)
+PostCompositionResult.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'post_id', None, None, ),  # 1
+    (2, TType.STRING, 'message', 'UTF8', None, ),  # 2
+)
+all_structs.append(FollowersPage)
+FollowersPage.thrift_spec = (
+    None,  # 0
+    (1, TType.LIST, 'followers', (TType.I64, None, False), None, ),  # 1
+    (2, TType.I64, 'next_timestamp', None, None, ),  # 2
+    (3, TType.I64, 'next_user_id', None, None, ),  # 3
+)
 fix_spec(all_structs)
 del all_structs
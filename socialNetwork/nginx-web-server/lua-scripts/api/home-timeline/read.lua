@@ -8,41 +8,79 @@ local function _StrIsEmpty(s)
   return s == nil or s == ''
 end
 
+-- Bits of the fields argument of ReadHomeTimeline, one per Post field
+-- (src/PostFields.h)
+local _POST_FIELDS = {
+  post_id = 1, creator = 2, req_id = 4, text = 8, user_mentions = 16,
+  media = 32, urls = 64, timestamp = 128, post_type = 256
+}
+
+-- The mask of a comma-separated list of field names, or nil and the first
+-- name that is not a field
+local function _FieldsMask(names)
+  local requested = {}
+  for name in string.gmatch(names, "[^,]+") do
+    if _POST_FIELDS[name] == nil then
+      return nil, name
+    end
+    requested[name] = true
+  end
+  local mask = 0
+  for name, bit in pairs(_POST_FIELDS) do
+    if requested[name] then
+      mask = mask + bit
+    end
+  end
+  return mask
+end
+
 local function _LoadTimeline(data)
   local timeline = {}
   for _, timeline_post in ipairs(data) do
     local new_post = {}
     new_post["post_id"] = tostring(timeline_post.post_id)
-    new_post["creator"] = {}
-    new_post["creator"]["user_id"] = tostring(timeline_post.creator.user_id)
-    new_post["creator"]["username"] = timeline_post.creator.username
-    new_post["req_id"] = tostring(timeline_post.req_id)
+    if timeline_post.creator ~= nil then
+      new_post["creator"] = {}
+      new_post["creator"]["user_id"] = tostring(timeline_post.creator.user_id)
+      new_post["creator"]["username"] = timeline_post.creator.username
+    end
+    if timeline_post.req_id ~= nil then
+      new_post["req_id"] = tostring(timeline_post.req_id)
+    end
     new_post["text"] = timeline_post.text
-    new_post["user_mentions"] = {}
-    for _, user_mention in ipairs(timeline_post.user_mentions) do
-      local new_user_mention = {}
-      new_user_mention["user_id"] = tostring(user_mention.user_id)
-      new_user_mention["username"] = user_mention.username
-      table.insert(new_post["user_mentions"], new_user_mention)
+    if timeline_post.user_mentions ~= nil then
+      new_post["user_mentions"] = {}
+      for _, user_mention in ipairs(timeline_post.user_mentions) do
+        local new_user_mention = {}
+        new_user_mention["user_id"] = tostring(user_mention.user_id)
+        new_user_mention["username"] = user_mention.username
+        table.insert(new_post["user_mentions"], new_user_mention)
+      end
     end
-    new_post["media"] = {}
-    for _, media in ipairs(timeline_post.media) do
-      local new_media = {}
-      new_media["media_id"] = tostring(media.media_id)
-      new_media["media_type"] = media.media_type
-      table.insert(new_post["media"], new_media)
+    if timeline_post.media ~= nil then
+      new_post["media"] = {}
+      for _, media in ipairs(timeline_post.media) do
+        local new_media = {}
+        new_media["media_id"] = tostring(media.media_id)
+        new_media["media_type"] = media.media_type
+        table.insert(new_post["media"], new_media)
+      end
     end
-    new_post["urls"] = {}
-    for _, url in ipairs(timeline_post.urls) do
-      local new_url = {}
-      new_url["shortened_url"] = url.shortened_url
-      new_url["expanded_url"] = url.expanded_url
-      table.insert(new_post["urls"], new_url)
+    if timeline_post.urls ~= nil then
+      new_post["urls"] = {}
+      for _, url in ipairs(timeline_post.urls) do
+        local new_url = {}
+        new_url["shortened_url"] = url.shortened_url
+        new_url["expanded_url"] = url.expanded_url
+        table.insert(new_post["urls"], new_url)
+      end
     end
     --add os.date("*t", timestamp)
     --new_post["time"] = os.date("*t", timestamp)
     --print(new_post["text"])
-    new_post["timestamp"] = tostring(timeline_post.timestamp)
+    if timeline_post.timestamp ~= nil then
+      new_post["timestamp"] = tostring(timeline_post.timestamp)
+    end
     new_post["post_type"] = timeline_post.post_type
     table.insert(timeline, new_post)
   end
@@ -97,6 +135,18 @@ function _M.ReadHomeTimeline()
     ngx.exit(ngx.HTTP_BAD_REQUEST)
   end
 
+  local fields = nil
+  if not _StrIsEmpty(args.fields) then
+    local unknown
+    fields, unknown = _FieldsMask(args.fields)
+    if fields == nil then
+      ngx.status = ngx.HTTP_BAD_REQUEST
+      ngx.say("Unknown field " .. unknown)
+      ngx.log(ngx.ERR, "Unknown field " .. unknown)
+      ngx.exit(ngx.HTTP_BAD_REQUEST)
+    end
+  end
+
   local timestamp = tonumber(login_obj["payload"]["timestamp"])
   local ttl = tonumber(login_obj["payload"]["ttl"])
   local user_id = tonumber(login_obj["payload"]["user_id"])
@@ -112,7 +162,8 @@ function _M.ReadHomeTimeline()
     local client = GenericObjectPool:connection(
         HomeTimelineServiceClient, "home-timeline-service" .. k8s_suffix, 9090)
     local status, ret = pcall(client.ReadHomeTimeline, client, req_id,
-        user_id, tonumber(args.start), tonumber(args.stop), carrier)
+        user_id, tonumber(args.start), tonumber(args.stop), carrier,
+        fields)
     GenericObjectPool:returnConnection(client)
     if not status then
       ngx.status = ngx.HTTP_INTERNAL_SERVER_ERROR
@@ -8,6 +8,14 @@ local function _StrIsEmpty(s)
   return s == nil or s == ''
 end
 
+local function _SplitIds(s)
+  local ids = {}
+  for id in string.gmatch(s, "[^,]+") do
+    table.insert(ids, tonumber(id))
+  end
+  return ids
+end
+
 function _M.Unfollow()
   local bridge_tracer = require "opentracing_bridge_tracer"
   local ngx = ngx
@@ -31,7 +39,19 @@ function _M.Unfollow()
 
   local status
   local err
-  if (not _StrIsEmpty(post.user_id) and not _StrIsEmpty(post.followee_id)) then
+  if (not _StrIsEmpty(post.user_ids) and not _StrIsEmpty(post.followee_ids)) then
+    -- Comma-separated, pairwise edges user_ids[i] -> followee_ids[i]
+    local user_ids = _SplitIds(post.user_ids)
+    local followee_ids = _SplitIds(post.followee_ids)
+    if (#user_ids ~= #followee_ids) then
+      ngx.status = ngx.HTTP_BAD_REQUEST
+      ngx.say("user_ids and followee_ids differ in length")
+      ngx.log(ngx.ERR, "user_ids and followee_ids differ in length")
+      ngx.exit(ngx.HTTP_BAD_REQUEST)
+    end
+    status, err = pcall(client.UnfollowMany, client,req_id,
+        user_ids, followee_ids, carrier )
+  elseif (not _StrIsEmpty(post.user_id) and not _StrIsEmpty(post.followee_id)) then
     status, err = pcall(client.Unfollow, client,req_id,
         tonumber(post.user_id), tonumber(post.followee_id), carrier )
   elseif (not _StrIsEmpty(post.user_name) and not _StrIsEmpty(post.followee_name)) then
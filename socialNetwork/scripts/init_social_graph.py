@@ -13,6 +13,13 @@ async def upload_follow(session, addr, user_0, user_1):
     return await resp.text()
 
 
+async def upload_follow_many(session, addr, edges):
+  payload = {'user_ids': ','.join(edge[0] for edge in edges),
+             'followee_ids': ','.join(edge[1] for edge in edges)}
+  async with session.post(addr + '/wrk2-api/user/follow', data=payload) as resp:
+    return await resp.text()
+
+
 async def upload_register(session, addr, user):
   payload = {'first_name': 'first_name_' + user, 'last_name': 'last_name_' + user,
              'username': 'username_' + user, 'password': 'password_' + user, 'user_id': user}
@@ -109,6 +116,28 @@ async def follow(addr, edges, limit=200):
     printResults(results)
 
 
+async def follow_batched(addr, edges, batch_size, limit=200):
+  idx = 0
+  tasks = []
+  conn = aiohttp.TCPConnector(limit=limit)
+  async with aiohttp.ClientSession(connector=conn) as session:
+    print('Adding follows in batches of', batch_size, 'edges...')
+    directed_edges = []
+    for edge in edges:
+      directed_edges.append((edge[0], edge[1]))
+      directed_edges.append((edge[1], edge[0]))
+    for i in range(0, len(directed_edges), batch_size):
+      task = asyncio.ensure_future(
+          upload_follow_many(session, addr, directed_edges[i:i + batch_size]))
+      tasks.append(task)
+      idx += 1
+      if idx % limit == 0:
+        _ = await asyncio.gather(*tasks)
+        print(idx * batch_size)
+    results = await asyncio.gather(*tasks)
+    printResults(results)
+
+
 async def compose(addr, nodes, limit=200):
   idx = 0
   tasks = []
@@ -139,6 +168,8 @@ if __name__ == '__main__':
   parser.add_argument('--compose', action='store_true',
                       help='intialize with up to 20 posts per user', default=False)
   parser.add_argument('--limit', type=int, help='total number simultaneous connections', default=200)
+  parser.add_argument('--follow-batch', type=int,
+                      help='number of follow edges sent per request, 0 to send one edge per request', default=0)
   args = parser.parse_args()
 
   with open(os.path.join('datasets/social-graph', args.graph, f'{args.graph}.nodes'), 'r') as f:
@@ -153,7 +184,11 @@ if __name__ == '__main__':
   loop = asyncio.get_event_loop()
   future = asyncio.ensure_future(register(addr, nodes, limit))
   loop.run_until_complete(future)
-  future = asyncio.ensure_future(follow(addr, edges, limit))
+  if args.follow_batch > 0:
+    future = asyncio.ensure_future(
+        follow_batched(addr, edges, args.follow_batch, limit))
+  else:
+    future = asyncio.ensure_future(follow(addr, edges, limit))
   loop.run_until_complete(future)
   if args.compose:
     future = asyncio.ensure_future(compose(addr, nodes, limit))
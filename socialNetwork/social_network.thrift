@@ -62,14 +62,53 @@ struct TextServiceReturn {
 
 struct Post {
   1: i64 post_id;
-  2: Creator creator;
-  3: i64 req_id;
-  4: string text;
-  5: list<UserMention> user_mentions;
-  6: list<Media> media;
-  7: list<Url> urls;
-  8: i64 timestamp;
-  9: PostType post_type;
+  2: optional Creator creator;
+  3: optional i64 req_id;
+  4: optional string text;
+  5: optional list<UserMention> user_mentions;
+  6: optional list<Media> media;
+  7: optional list<Url> urls;
+  8: optional i64 timestamp;
+  9: optional PostType post_type;
+}
+
+struct UserRegistration {
+  1: i64 user_id;
+  2: string first_name;
+  3: string last_name;
+  4: string username;
+  5: string password;
+}
+
+struct UserRegistrationResult {
+  1: i64 user_id;
+  2: string message;
+}
+
+// A post of ComposePostService::ComposePosts. user_id -1 looks the creator
+// up by username; timestamp 0 stamps the post when it is composed.
+struct PostComposition {
+  1: string username;
+  2: i64 user_id;
+  3: string text;
+  4: list<i64> media_ids;
+  5: list<string> media_types;
+  6: PostType post_type;
+  7: i64 timestamp;
+}
+
+struct PostCompositionResult {
+  1: i64 post_id;
+  2: string message;
+}
+
+// A page of SocialGraphService::GetFollowersPage, in (follow timestamp,
+// user_id) order. The next page starts after (next_timestamp,
+// next_user_id); a page shorter than the limit is the last one.
+struct FollowersPage {
+  1: list<i64> followers;
+  2: i64 next_timestamp;
+  3: i64 next_user_id;
 }
 
 service UniqueIdService {
@@ -78,6 +117,13 @@ service UniqueIdService {
       2: PostType post_type,
       3: map<string, string> carrier
   ) throws (1: ServiceException se)
+
+  i64 ComposeUniqueIds (
+      1: i64 req_id,
+      2: PostType post_type,
+      3: i32 num_ids,
+      4: map<string, string> carrier
+  ) throws (1: ServiceException se)
 }
 
 service TextService {
@@ -86,6 +132,12 @@ service TextService {
       2: string text,
       3: map<string, string> carrier
   ) throws (1: ServiceException se)
+
+  list<TextServiceReturn> ComposeTexts (
+      1: i64 req_id,
+      2: list<string> texts,
+      3: map<string, string> carrier
+  ) throws (1: ServiceException se)
 }
 
 service UserService {
@@ -133,6 +185,24 @@ service UserService {
       2: string username,
       3: map<string, string> carrier
   ) throws (1: ServiceException se)
+
+  i64 VerifyToken(
+      1: i64 req_id,
+      2: string token,
+      3: map<string, string> carrier
+  ) throws (1: ServiceException se)
+
+  map<string, i64> GetUserIds(
+      1: i64 req_id,
+      2: list<string> usernames,
+      3: map<string, string> carrier
+  ) throws (1: ServiceException se)
+
+  list<UserRegistrationResult> RegisterUsers(
+      1: i64 req_id,
+      2: list<UserRegistration> users,
+      3: map<string, string> carrier
+  ) throws (1: ServiceException se)
 }
 
 service ComposePostService {
@@ -146,6 +216,12 @@ service ComposePostService {
     7: PostType post_type,
     8: map<string, string> carrier
   ) throws (1: ServiceException se)
+
+  list<PostCompositionResult> ComposePosts(
+    1: i64 req_id,
+    2: list<PostComposition> posts,
+    3: map<string, string> carrier
+  ) throws (1: ServiceException se)
 }
 
 service PostStorageService {
@@ -155,26 +231,38 @@ service PostStorageService {
     3: map<string, string> carrier
   ) throws (1: ServiceException se)
 
+  // The error of each post, empty if it was stored
+  list<string> StorePosts(
+    1: i64 req_id,
+    2: list<Post> posts,
+    3: map<string, string> carrier
+  ) throws (1: ServiceException se)
+
   Post ReadPost(
     1: i64 req_id,
     2: i64 post_id,
     3: map<string, string> carrier
   ) throws (1: ServiceException se)
 
+  // fields: bit n - 1 set for each Post field id n to return, the others are
+  // left unset (src/PostFields.h). Callers that omit it get every field.
   list<Post> ReadPosts(
     1: i64 req_id,
     2: list<i64> post_ids,
-    3: map<string, string> carrier
+    3: map<string, string> carrier,
+    4: i32 fields = 511
   ) throws (1: ServiceException se)
 }
 
 service HomeTimelineService {
+  // fields: as in ReadPosts
   list<Post> ReadHomeTimeline(
     1: i64 req_id,
     2: i64 user_id,
     3: i32 start,
     4: i32 stop,
-    5: map<string, string> carrier
+    5: map<string, string> carrier,
+    6: i32 fields = 511
   ) throws (1: ServiceException se)
 
   void WriteHomeTimeline(
@@ -185,6 +273,17 @@ service HomeTimelineService {
     5: list<i64> user_mentions_id,
     6: map<string, string> carrier
   ) throws (1: ServiceException se)
+
+  // WriteHomeTimeline of post_ids[i], user_ids[i], timestamps[i] and
+  // user_mentions_ids[i] for each i
+  void WriteHomeTimelines(
+    1: i64 req_id,
+    2: list<i64> post_ids,
+    3: list<i64> user_ids,
+    4: list<i64> timestamps,
+    5: list<list<i64>> user_mentions_ids,
+    6: map<string, string> carrier
+  ) throws (1: ServiceException se)
 }
 
 service UserTimelineService {
@@ -196,12 +295,23 @@ service UserTimelineService {
     5: map<string, string> carrier
   ) throws (1: ServiceException se)
 
+  // WriteUserTimeline of post_ids[i], user_ids[i] and timestamps[i] for each i
+  void WriteUserTimelines(
+    1: i64 req_id,
+    2: list<i64> post_ids,
+    3: list<i64> user_ids,
+    4: list<i64> timestamps,
+    5: map<string, string> carrier
+  ) throws (1: ServiceException se)
+
+  // fields: as in ReadPosts
   list<Post> ReadUserTimeline(
     1: i64 req_id,
     2: i64 user_id,
     3: i32 start,
     4: i32 stop,
-    5: map<string, string> carrier
+    5: map<string, string> carrier,
+    6: i32 fields = 511
   ) throws (1: ServiceException se)
 }
 
@@ -251,6 +361,61 @@ service SocialGraphService{
       2: i64 user_id,
       3: map<string, string> carrier
   ) throws (1: ServiceException se)
+
+  void InsertUsers(
+      1: i64 req_id,
+      2: list<i64> user_ids,
+      3: map<string, string> carrier
+  ) throws (1: ServiceException se)
+
+  void FollowMany(
+      1: i64 req_id,
+      2: list<i64> user_ids,
+      3: list<i64> followee_ids,
+      4: map<string, string> carrier
+  ) throws (1: ServiceException se)
+
+  void UnfollowMany(
+      1: i64 req_id,
+      2: list<i64> user_ids,
+      3: list<i64> followee_ids,
+      4: map<string, string> carrier
+  ) throws (1: ServiceException se)
+
+  list<i64> GetMutualFollows(
+      1: i64 req_id,
+      2: i64 user_id,
+      3: i64 other_user_id,
+      4: map<string, string> carrier
+  ) throws (1: ServiceException se)
+
+  list<i64> GetFollowersInCommon(
+      1: i64 req_id,
+      2: list<i64> user_ids,
+      3: map<string, string> carrier
+  ) throws (1: ServiceException se)
+
+  list<bool> IsFollowing(
+      1: i64 req_id,
+      2: list<i64> user_ids,
+      3: list<i64> followee_ids,
+      4: map<string, string> carrier
+  ) throws (1: ServiceException se)
+
+  i64 GetFollowerCount(
+      1: i64 req_id,
+      2: i64 user_id,
+      3: map<string, string> carrier
+  ) throws (1: ServiceException se)
+
+  FollowersPage GetFollowersPage(
+      1: i64 req_id,
+      2: i64 user_id,
+      3: i64 after_timestamp,
+      4: i64 after_user_id,
+      5: i32 limit,
+      6: map<string, string> carrier
+  ) throws (1: ServiceException se)
 }
 
 service UserMentionService {
@@ -0,0 +1,621 @@
+// Seeds a socialNetwork deployment directly from a datasets/social-graph edge
+// list, bypassing nginx and the Thrift services:
+//   user.user                           one document per node
+//   social-graph.social-graph           followers/followees of every node
+//   post.post                           (--posts-per-user) synthetic posts
+//   user-timeline.user-timeline-bucket  the bucketed timelines of those posts
+// It also primes the "<user_id>:followers"/"<user_id>:followees" ZSETs in
+// social-graph-redis, the "<username>:user_id"/"<username>:login" entries in
+// user-memcached and the posts in post-storage-memcached.
+//
+// Users, usernames and passwords follow scripts/init_social_graph.py
+// (user_id i, "username_i", "password_i"), and every edge is followed in both
+// directions, so wrk2 workloads written against that script keep working.
+// The loader expects empty databases; it does not create home timelines.
+
+#include <signal.h>
+
+#include <libmemcached/memcached.h>
+#include <libmemcached/util.h>
+
+#include <algorithm>
+#include <atomic>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../../third_party/PicoSHA2/picosha2.h"
+#include "../MongoIndexes.h"
+#include "../PostStorageSerivce/PostStorageHandler.h"
+#include "../SocialGraphService/SocialGraphHandler.h"
+#include "../UserService/LoginRecord.h"
+#include "../UserService/UserHandler.h"
+#include "../UserTimelineService/UserTimelineBucket.h"
+#include "../UserTimelineService/UserTimelineHandler.h"
+#include "../logger.h"
+#include "../utils.h"
+#include "../utils_memcached.h"
+#include "../utils_mongodb.h"
+#include "../utils_redis.h"
+
+#define BULK_LOADER_POST_TEXT_LENGTH 64
+#define BULK_LOADER_MAX_MENTIONS 3
+
+using namespace social_network;
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+using std::chrono::system_clock;
+
+void sigintHandler(int sig) { exit(EXIT_SUCCESS); }
+
+struct SocialGraph {
+  int64_t num_users = 0;
+  std::vector<std::vector<int64_t>> followers;
+  std::vector<std::vector<int64_t>> followees;
+};
+
+struct PhaseStats {
+  std::atomic<int64_t> rows{0};
+  std::atomic<bool> ok{true};
+};
+
+// Queues documents into unordered bulk inserts of at most batch_size
+// documents, flushing each batch as it fills up.
+class BulkInserter {
+ public:
+  BulkInserter(mongoc_collection_t *collection, int batch_size,
+               PhaseStats *stats)
+      : _collection(collection), _batch_size(batch_size), _stats(stats) {
+    _opts = BCON_NEW("ordered", BCON_BOOL(false));
+  }
+  ~BulkInserter() {
+    Flush();
+    bson_destroy(_opts);
+  }
+
+  void Insert(const bson_t *doc) {
+    if (!_bulk) {
+      _bulk =
+          mongoc_collection_create_bulk_operation_with_opts(_collection, _opts);
+    }
+    bson_error_t error;
+    if (!mongoc_bulk_operation_insert_with_opts(_bulk, doc, nullptr,
+                                                &error)) {
+      LOG(error) << "Failed to queue document: " << error.message;
+      _stats->ok = false;
+    }
+    if (++_pending >= _batch_size) {
+      Flush();
+    }
+  }
+
+  void Flush() {
+    if (!_bulk) {
+      return;
+    }
+    bson_t reply;
+    bson_error_t error;
+    if (!mongoc_bulk_operation_execute(_bulk, &reply, &error)) {
+      LOG(error) << "Failed to write " << _pending
+                 << " documents: " << error.message;
+      _stats->ok = false;
+    } else {
+      _stats->rows += _pending;
+    }
+    bson_destroy(&reply);
+    mongoc_bulk_operation_destroy(_bulk);
+    _bulk = nullptr;
+    _pending = 0;
+  }
+
+ private:
+  mongoc_collection_t *_collection;
+  mongoc_bulk_operation_t *_bulk = nullptr;
+  bson_t *_opts;
+  int _batch_size;
+  int _pending = 0;
+  PhaseStats *_stats;
+};
+
+static bool LoadSocialGraph(const std::string &nodes_file,
+                            const std::string &edges_file,
+                            SocialGraph *graph) {
+  std::ifstream nodes(nodes_file);
+  if (!nodes.is_open() || !(nodes >> graph->num_users)) {
+    LOG(error) << "Cannot read the number of nodes from " << nodes_file;
+    return false;
+  }
+  std::ifstream edges(edges_file);
+  if (!edges.is_open()) {
+    LOG(error) << "Cannot open " << edges_file;
+    return false;
+  }
+  graph->followers.resize(graph->num_users);
+  graph->followees.resize(graph->num_users);
+  int64_t u, v;
+  int64_t skipped = 0;
+  while (edges >> u >> v) {
+    if (u < 0 || v < 0 || u >= graph->num_users || v >= graph->num_users ||
+        u == v) {
+      skipped++;
+      continue;
+    }
+    graph->followees[u].emplace_back(v);
+    graph->followers[v].emplace_back(u);
+    graph->followees[v].emplace_back(u);
+    graph->followers[u].emplace_back(v);
+  }
+  for (int64_t i = 0; i < graph->num_users; ++i) {
+    for (auto *list : {&graph->followers[i], &graph->followees[i]}) {
+      std::sort(list->begin(), list->end());
+      list->erase(std::unique(list->begin(), list->end()), list->end());
+    }
+  }
+  if (skipped) {
+    LOG(warning) << "Skipped " << skipped << " invalid or self edges";
+  }
+  return true;
+}
+
+static std::string GenRandomString(std::mt19937 *gen, int len) {
+  static const std::string alphanum =
+      "0123456789"
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+      "abcdefghijklmnopqrstuvwxyz";
+  std::uniform_int_distribution<int> dist(0, alphanum.length() - 1);
+  std::string s;
+  s.reserve(len);
+  for (int i = 0; i < len; ++i) {
+    s += alphanum[dist(*gen)];
+  }
+  return s;
+}
+
+static void MemcachedSet(memcached_st *client, const std::string &key,
+                         const std::string &value) {
+  memcached_return_t rc =
+      memcached_set(client, key.c_str(), key.length(), value.c_str(),
+                    value.length(), static_cast<time_t>(0),
+                    static_cast<uint32_t>(0));
+  if (rc != MEMCACHED_SUCCESS) {
+    LOG(warning) << "Failed to set " << key
+                 << " to Memcached: " << memcached_strerror(client, rc);
+  }
+}
+
+// Splits [0, num_users) into one contiguous range per thread and runs fn on
+// each, then logs the throughput of the phase.
+static bool RunPhase(const std::string &name, int64_t num_users, int threads,
+                     PhaseStats *stats,
+                     const std::function<void(int64_t, int64_t, int)> &fn) {
+  LOG(info) << "Loading " << name << "...";
+  auto start = system_clock::now();
+  std::vector<std::thread> workers;
+  int64_t chunk = (num_users + threads - 1) / threads;
+  for (int t = 0; t < threads; ++t) {
+    int64_t begin = t * chunk;
+    int64_t end = std::min(num_users, begin + chunk);
+    if (begin >= end) {
+      break;
+    }
+    workers.emplace_back(fn, begin, end, t);
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  double seconds =
+      duration_cast<milliseconds>(system_clock::now() - start).count() /
+      1000.0;
+  int64_t rows = stats->rows;
+  LOG(info) << name << ": " << rows << " rows in " << seconds << " s ("
+            << static_cast<int64_t>(rows / std::max(seconds, 0.001))
+            << " rows/s)";
+  return stats->ok;
+}
+
+int main(int argc, char *argv[]) {
+  signal(SIGINT, sigintHandler);
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "config",
+      po::value<std::string>()->default_value("config/service-config.json"),
+      "Path to service-config.json")(
+      "graph", po::value<std::string>()->default_value("socfb-Reed98"),
+      "Graph name (socfb-Reed98, ego-twitter or soc-twitter-follows-mun)")(
+      "dataset-dir",
+      po::value<std::string>()->default_value("datasets/social-graph"),
+      "Directory holding <graph>/<graph>.nodes and <graph>/<graph>.edges")(
+      "threads",
+      po::value<int>()->default_value(std::thread::hardware_concurrency()),
+      "Number of loader threads")(
+      "batch-size", po::value<int>()->default_value(1000),
+      "Number of documents per MongoDB bulk write")(
+      "posts-per-user", po::value<int>()->default_value(0),
+      "Compose up to this many posts per user (uniformly, 0 to skip posts)")(
+      "redis-cluster",
+      po::value<bool>()->default_value(false)->implicit_value(true),
+      "social-graph-redis runs in cluster mode")(
+      "skip-cache",
+      po::value<bool>()->default_value(false)->implicit_value(true),
+      "Only write MongoDB, leave Redis and Memcached cold");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  json config_json;
+  if (load_config_file(vm["config"].as<std::string>(), &config_json) != 0) {
+    exit(EXIT_FAILURE);
+  }
+  std::string graph_name = vm["graph"].as<std::string>();
+  std::string graph_dir =
+      vm["dataset-dir"].as<std::string>() + "/" + graph_name + "/" + graph_name;
+  int threads = std::max(1, vm["threads"].as<int>());
+  int batch_size = std::max(1, vm["batch-size"].as<int>());
+  int posts_per_user = std::max(0, vm["posts-per-user"].as<int>());
+  bool redis_cluster_flag = vm["redis-cluster"].as<bool>();
+  bool prime_cache = !vm["skip-cache"].as<bool>();
+  int64_t bucket_window_ms = config_json["user-timeline-service"].value(
+      "bucket_window_ms", (int64_t)USER_TIMELINE_DEFAULT_BUCKET_WINDOW_MS);
+  int bucket_max_posts = config_json["user-timeline-service"].value(
+      "bucket_max_posts", USER_TIMELINE_DEFAULT_BUCKET_MAX_POSTS);
+
+  SocialGraph graph;
+  if (!LoadSocialGraph(graph_dir + ".nodes", graph_dir + ".edges", &graph)) {
+    return EXIT_FAILURE;
+  }
+  LOG(info) << "Read " << graph_name << ": " << graph.num_users << " users";
+
+  auto user_mongodb_pool = init_mongodb_client_pool(config_json, "user", threads);
+  auto social_graph_mongodb_pool =
+      init_mongodb_client_pool(config_json, "social-graph", threads);
+  auto post_mongodb_pool =
+      init_mongodb_client_pool(config_json, "post-storage", threads);
+  auto user_timeline_mongodb_pool =
+      init_mongodb_client_pool(config_json, "user-timeline", threads);
+  if (!user_mongodb_pool || !social_graph_mongodb_pool || !post_mongodb_pool ||
+      !user_timeline_mongodb_pool) {
+    return EXIT_FAILURE;
+  }
+
+  memcached_pool_st *user_memcached_pool = nullptr;
+  memcached_pool_st *post_memcached_pool = nullptr;
+  std::unique_ptr<Redis> redis_client;
+  std::unique_ptr<RedisCluster> redis_cluster_client;
+  if (prime_cache) {
+    user_memcached_pool =
+        init_memcached_client_pool(config_json, "user", threads, threads);
+    post_memcached_pool = init_memcached_client_pool(
+        config_json, "post-storage", threads, threads);
+    if (redis_cluster_flag) {
+      redis_cluster_client.reset(new RedisCluster(
+          init_redis_cluster_client_pool(config_json, "social-graph")));
+    } else {
+      redis_client.reset(
+          new Redis(init_redis_client_pool(config_json, "social-graph")));
+    }
+  }
+
+  // The indexes the services declare, so that the unique ones reject any
+  // duplicate the loader would write
+  for (auto &pool_specs :
+       std::vector<std::pair<mongoc_client_pool_t *,
+                             std::vector<MongoIndexSpec>>>{
+           {user_mongodb_pool, UserHandler::IndexSpecs()},
+           {social_graph_mongodb_pool, SocialGraphHandler::IndexSpecs()},
+           {post_mongodb_pool, PostStorageHandler::IndexSpecs()},
+           {user_timeline_mongodb_pool, UserTimelineHandler::IndexSpecs()}}) {
+    mongoc_client_t *client = mongoc_client_pool_pop(pool_specs.first);
+    bool created = CreateIndexes(client, pool_specs.second);
+    mongoc_client_pool_push(pool_specs.first, client);
+    if (!created) {
+      LOG(fatal) << "Failed to create MongoDB indexes";
+      return EXIT_FAILURE;
+    }
+  }
+
+  int64_t timestamp =
+      duration_cast<milliseconds>(system_clock::now().time_since_epoch())
+          .count();
+  bool ok = true;
+
+  PhaseStats user_stats;
+  ok &= RunPhase(
+      "user", graph.num_users, threads, &user_stats,
+      [&](int64_t begin, int64_t end, int worker) {
+        std::mt19937 gen(timestamp + worker);
+        mongoc_client_t *client = mongoc_client_pool_pop(user_mongodb_pool);
+        auto collection = mongoc_client_get_collection(client, "user", "user");
+        memcached_st *memcached_client = nullptr;
+        memcached_return_t memcached_rc;
+        if (user_memcached_pool) {
+          memcached_client =
+              memcached_pool_pop(user_memcached_pool, true, &memcached_rc);
+        }
+        {
+          BulkInserter inserter(collection, batch_size, &user_stats);
+          for (int64_t user_id = begin; user_id < end; ++user_id) {
+            std::string id_str = std::to_string(user_id);
+            std::string username = "username_" + id_str;
+            std::string salt = GenRandomString(&gen, 32);
+            std::string password_hashed =
+                picosha2::hash256_hex_string("password_" + id_str + salt);
+            bson_t *doc = bson_new();
+            BSON_APPEND_INT64(doc, "user_id", user_id);
+            BSON_APPEND_UTF8(doc, "first_name", ("first_name_" + id_str).c_str());
+            BSON_APPEND_UTF8(doc, "last_name", ("last_name_" + id_str).c_str());
+            BSON_APPEND_UTF8(doc, "username", username.c_str());
+            BSON_APPEND_UTF8(doc, "salt", salt.c_str());
+            BSON_APPEND_UTF8(doc, "password", password_hashed.c_str());
+            inserter.Insert(doc);
+            bson_destroy(doc);
+
+            if (memcached_client) {
+              LoginRecord login_record;
+              login_record.user_id = user_id;
+              login_record.salt = salt;
+              HexToHash(password_hashed, &login_record.password_hash);
+              MemcachedSet(memcached_client, username + ":user_id", id_str);
+              MemcachedSet(memcached_client, username + ":login",
+                           EncodeLoginRecord(login_record));
+            }
+          }
+        }
+        if (memcached_client) {
+          memcached_pool_push(user_memcached_pool, memcached_client);
+        }
+        mongoc_collection_destroy(collection);
+        mongoc_client_pool_push(user_mongodb_pool, client);
+      });
+
+  PhaseStats social_graph_stats;
+  ok &= RunPhase(
+      "social-graph", graph.num_users, threads, &social_graph_stats,
+      [&](int64_t begin, int64_t end, int worker) {
+        mongoc_client_t *client =
+            mongoc_client_pool_pop(social_graph_mongodb_pool);
+        auto collection =
+            mongoc_client_get_collection(client, "social-graph", "social-graph");
+        std::unique_ptr<Pipeline> pipe;
+        if (redis_client) {
+          pipe.reset(new Pipeline(redis_client->pipeline(false)));
+        }
+        int pipe_size = 0;
+        auto exec_pipe = [&]() {
+          try {
+            pipe->exec();
+          } catch (const Error &err) {
+            LOG(error) << "Failed to prime social-graph-redis: " << err.what();
+            social_graph_stats.ok = false;
+          }
+          pipe_size = 0;
+        };
+        {
+          BulkInserter inserter(collection, batch_size, &social_graph_stats);
+          for (int64_t user_id = begin; user_id < end; ++user_id) {
+            bson_t *doc = bson_new();
+            BSON_APPEND_INT64(doc, "user_id", user_id);
+            const std::pair<const char *, const std::vector<int64_t> *>
+                fields[] = {{"followers", &graph.followers[user_id]},
+                            {"followees", &graph.followees[user_id]}};
+            for (auto &field : fields) {
+              bson_t list;
+              BSON_APPEND_ARRAY_BEGIN(doc, field.first, &list);
+              int idx = 0;
+              std::vector<std::pair<std::string, double>> zset;
+              for (auto other_id : *field.second) {
+                bson_t edge_doc;
+                std::string idx_str = std::to_string(idx++);
+                BSON_APPEND_DOCUMENT_BEGIN(&list, idx_str.c_str(), &edge_doc);
+                BSON_APPEND_INT64(&edge_doc, "user_id", other_id);
+                BSON_APPEND_INT64(&edge_doc, "timestamp", timestamp);
+                bson_append_document_end(&list, &edge_doc);
+                zset.emplace_back(std::to_string(other_id),
+                                  static_cast<double>(timestamp));
+              }
+              bson_append_array_end(doc, &list);
+
+              if (zset.empty()) {
+                continue;
+              }
+              std::string key =
+                  std::to_string(user_id) + ":" + std::string(field.first);
+              if (pipe) {
+                pipe->zadd(key, zset.begin(), zset.end());
+                if (++pipe_size >= batch_size) {
+                  exec_pipe();
+                }
+              } else if (redis_cluster_client) {
+                try {
+                  redis_cluster_client->zadd(key, zset.begin(), zset.end());
+                } catch (const Error &err) {
+                  LOG(error) << "Failed to prime social-graph-redis: "
+                             << err.what();
+                  social_graph_stats.ok = false;
+                }
+              }
+            }
+            inserter.Insert(doc);
+            bson_destroy(doc);
+          }
+        }
+        if (pipe && pipe_size > 0) {
+          exec_pipe();
+        }
+        mongoc_collection_destroy(collection);
+        mongoc_client_pool_push(social_graph_mongodb_pool, client);
+      });
+
+  if (posts_per_user > 0) {
+    // Post ids only need to be unique; they are drawn from a counter seeded
+    // with the load time so that repeated loads do not collide.
+    std::atomic<int64_t> next_post_id{timestamp << 20};
+    PhaseStats post_stats;
+    PhaseStats user_timeline_stats;
+    ok &= RunPhase(
+        "post", graph.num_users, threads, &post_stats,
+        [&](int64_t begin, int64_t end, int worker) {
+          std::mt19937 gen(timestamp + threads + worker);
+          std::uniform_int_distribution<int> num_posts_dist(0, posts_per_user);
+          std::uniform_int_distribution<int> num_mentions_dist(
+              0, BULK_LOADER_MAX_MENTIONS);
+          std::uniform_int_distribution<int64_t> user_dist(
+              0, graph.num_users - 1);
+
+          mongoc_client_t *post_client =
+              mongoc_client_pool_pop(post_mongodb_pool);
+          auto post_collection =
+              mongoc_client_get_collection(post_client, "post", "post");
+          mongoc_client_t *timeline_client =
+              mongoc_client_pool_pop(user_timeline_mongodb_pool);
+          auto timeline_collection = mongoc_client_get_collection(
+              timeline_client, USER_TIMELINE_DB,
+              USER_TIMELINE_BUCKET_COLLECTION);
+          memcached_st *memcached_client = nullptr;
+          memcached_return_t memcached_rc;
+          if (post_memcached_pool) {
+            memcached_client =
+                memcached_pool_pop(post_memcached_pool, true, &memcached_rc);
+          }
+          {
+            BulkInserter post_inserter(post_collection, batch_size,
+                                       &post_stats);
+            BulkInserter timeline_inserter(timeline_collection, batch_size,
+                                           &user_timeline_stats);
+            for (int64_t user_id = begin; user_id < end; ++user_id) {
+              std::string username = "username_" + std::to_string(user_id);
+              // bucket -> (post_id, timestamp), newest first
+              std::map<int64_t, std::vector<std::pair<int64_t, int64_t>>>
+                  buckets;
+              int num_posts = num_posts_dist(gen);
+              for (int i = 0; i < num_posts; ++i) {
+                int64_t post_id = next_post_id++;
+                int64_t post_timestamp = timestamp - i * 1000;
+                std::string text =
+                    GenRandomString(&gen, BULK_LOADER_POST_TEXT_LENGTH);
+                std::vector<int64_t> mentions;
+                for (int m = num_mentions_dist(gen); m > 0; --m) {
+                  mentions.emplace_back(user_dist(gen));
+                  text += " @username_" + std::to_string(mentions.back());
+                }
+
+                bson_t *doc = bson_new();
+                BSON_APPEND_INT64(doc, "post_id", post_id);
+                BSON_APPEND_INT64(doc, "timestamp", post_timestamp);
+                BSON_APPEND_UTF8(doc, "text", text.c_str());
+                BSON_APPEND_INT64(doc, "req_id", 0);
+                BSON_APPEND_INT32(doc, "post_type", 0);
+                bson_t creator_doc;
+                BSON_APPEND_DOCUMENT_BEGIN(doc, "creator", &creator_doc);
+                BSON_APPEND_INT64(&creator_doc, "user_id", user_id);
+                BSON_APPEND_UTF8(&creator_doc, "username", username.c_str());
+                bson_append_document_end(doc, &creator_doc);
+                bson_t list;
+                BSON_APPEND_ARRAY_BEGIN(doc, "urls", &list);
+                bson_append_array_end(doc, &list);
+                BSON_APPEND_ARRAY_BEGIN(doc, "user_mentions", &list);
+                int idx = 0;
+                for (auto mention_id : mentions) {
+                  bson_t mention_doc;
+                  std::string idx_str = std::to_string(idx++);
+                  BSON_APPEND_DOCUMENT_BEGIN(&list, idx_str.c_str(),
+                                             &mention_doc);
+                  BSON_APPEND_INT64(&mention_doc, "user_id", mention_id);
+                  BSON_APPEND_UTF8(
+                      &mention_doc, "username",
+                      ("username_" + std::to_string(mention_id)).c_str());
+                  bson_append_document_end(&list, &mention_doc);
+                }
+                bson_append_array_end(doc, &list);
+                BSON_APPEND_ARRAY_BEGIN(doc, "media", &list);
+                bson_append_array_end(doc, &list);
+                post_inserter.Insert(doc);
+
+                if (memcached_client) {
+                  // Same encoding PostStorageHandler caches on a read miss
+                  char *post_json_char = bson_as_json(doc, nullptr);
+                  MemcachedSet(memcached_client, std::to_string(post_id),
+                               post_json_char);
+                  bson_free(post_json_char);
+                }
+                bson_destroy(doc);
+
+                buckets[GetUserTimelineBucket(post_timestamp,
+                                              bucket_window_ms)]
+                    .emplace_back(post_id, post_timestamp);
+              }
+
+              // Split as GetUserTimelineSeqRange splits them, the way the
+              // service would have
+              for (auto &bucket : buckets) {
+                auto &entries = bucket.second;
+                int64_t seqs =
+                    GetUserTimelineBucketSeqs(entries.size(), bucket_max_posts);
+                for (int64_t seq = 0; seq < seqs; seq++) {
+                  auto range = GetUserTimelineSeqRange(entries.size(), seq,
+                                                       bucket_max_posts);
+                  bson_t *doc = bson_new();
+                  bson_t posts_array;
+                  BSON_APPEND_INT64(doc, "user_id", user_id);
+                  BSON_APPEND_INT64(doc, "bucket", bucket.first);
+                  BSON_APPEND_INT64(doc, "seq", seq);
+                  BSON_APPEND_INT32(doc, "count", range.second - range.first);
+                  BSON_APPEND_ARRAY_BEGIN(doc, "posts", &posts_array);
+                  int idx = 0;
+                  for (size_t i = range.first; i < range.second; i++) {
+                    bson_t post_doc;
+                    std::string idx_str = std::to_string(idx++);
+                    BSON_APPEND_DOCUMENT_BEGIN(&posts_array, idx_str.c_str(),
+                                               &post_doc);
+                    BSON_APPEND_INT64(&post_doc, "post_id", entries[i].first);
+                    BSON_APPEND_INT64(&post_doc, "timestamp",
+                                      entries[i].second);
+                    bson_append_document_end(&posts_array, &post_doc);
+                  }
+                  bson_append_array_end(doc, &posts_array);
+                  timeline_inserter.Insert(doc);
+                  bson_destroy(doc);
+                }
+              }
+            }
+          }
+          if (memcached_client) {
+            memcached_pool_push(post_memcached_pool, memcached_client);
+          }
+          mongoc_collection_destroy(timeline_collection);
+          mongoc_client_pool_push(user_timeline_mongodb_pool, timeline_client);
+          mongoc_collection_destroy(post_collection);
+          mongoc_client_pool_push(post_mongodb_pool, post_client);
+        });
+    LOG(info) << "user-timeline: " << user_timeline_stats.rows
+              << " bucket documents";
+    ok &= user_timeline_stats.ok;
+  }
+
+  if (user_memcached_pool) {
+    memcached_pool_destroy(user_memcached_pool);
+  }
+  if (post_memcached_pool) {
+    memcached_pool_destroy(post_memcached_pool);
+  }
+  mongoc_client_pool_destroy(user_timeline_mongodb_pool);
+  mongoc_client_pool_destroy(post_mongodb_pool);
+  mongoc_client_pool_destroy(social_graph_mongodb_pool);
+  mongoc_client_pool_destroy(user_mongodb_pool);
+  mongoc_cleanup();
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
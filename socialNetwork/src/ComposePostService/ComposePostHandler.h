@@ -1,10 +1,13 @@
 #ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_COMPOSEPOSTSERVICE_COMPOSEPOSTHANDLER_H_
 #define SOCIAL_NETWORK_MICROSERVICES_SRC_COMPOSEPOSTSERVICE_COMPOSEPOSTHANDLER_H_
 
+#include <algorithm>
 #include <chrono>
 #include <future>
 #include <iostream>
+#include <map>
 #include <nlohmann/json.hpp>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -18,7 +21,9 @@
 #include "../../gen-cpp/UserTimelineService.h"
 #include "../../gen-cpp/social_network_types.h"
 #include "../ClientPool.h"
+#include "../PostFields.h"
 #include "../ThriftClient.h"
+#include "../UniqueIdGenerator.h"
 #include "../logger.h"
 #include "../tracing.h"
 
@@ -36,7 +41,8 @@ class ComposePostHandler : public ComposePostServiceIf {
                      ClientPool<ThriftClient<UniqueIdServiceClient>> *,
                      ClientPool<ThriftClient<MediaServiceClient>> *,
                      ClientPool<ThriftClient<TextServiceClient>> *,
-                     ClientPool<ThriftClient<HomeTimelineServiceClient>> *);
+                     ClientPool<ThriftClient<HomeTimelineServiceClient>> *,
+                     UniqueIdGenerator *id_generator = nullptr);
   ~ComposePostHandler() override = default;
 
   void ComposePost(int64_t req_id, const std::string &username, int64_t user_id,
@@ -46,6 +52,10 @@ class ComposePostHandler : public ComposePostServiceIf {
                    PostType::type post_type,
                    const std::map<std::string, std::string> &carrier) override;
 
+  void ComposePosts(std::vector<PostCompositionResult> &_return,
+                    int64_t req_id, const std::vector<PostComposition> &posts,
+                    const std::map<std::string, std::string> &carrier) override;
+
  private:
   ClientPool<ThriftClient<PostStorageServiceClient>> *_post_storage_client_pool;
   ClientPool<ThriftClient<UserTimelineServiceClient>>
@@ -58,6 +68,8 @@ class ComposePostHandler : public ComposePostServiceIf {
   ClientPool<ThriftClient<TextServiceClient>> *_text_service_client_pool;
   ClientPool<ThriftClient<HomeTimelineServiceClient>>
       *_home_timeline_client_pool;
+  // Mints post ids in-process when set, instead of calling unique-id-service
+  UniqueIdGenerator *_id_generator;
 
   void _UploadUserTimelineHelper(
       int64_t req_id, int64_t post_id, int64_t user_id, int64_t timestamp,
@@ -84,6 +96,34 @@ class ComposePostHandler : public ComposePostServiceIf {
   int64_t _ComposeUniqueIdHelper(
       int64_t req_id, PostType::type post_type,
       const std::map<std::string, std::string> &carrier);
+  int64_t _ComposeLocalUniqueIdHelper(int64_t req_id);
+
+  std::vector<TextServiceReturn> _ComposeTextsHelper(
+      int64_t req_id, const std::vector<std::string> &texts,
+      const std::map<std::string, std::string> &carrier);
+  std::map<std::string, int64_t> _GetUserIdsHelper(
+      int64_t req_id, const std::vector<std::string> &usernames,
+      const std::map<std::string, std::string> &carrier);
+  int64_t _ComposeUniqueIdsHelper(
+      int64_t req_id, int32_t num_ids,
+      const std::map<std::string, std::string> &carrier);
+  std::vector<int64_t> _ComposePostIdsHelper(
+      int64_t req_id, size_t num_ids,
+      const std::map<std::string, std::string> &carrier);
+  std::vector<std::string> _UploadPostsHelper(
+      int64_t req_id, const std::vector<Post> &posts,
+      const std::map<std::string, std::string> &carrier);
+  void _UploadUserTimelinesHelper(
+      int64_t req_id, const std::vector<int64_t> &post_ids,
+      const std::vector<int64_t> &user_ids,
+      const std::vector<int64_t> &timestamps,
+      const std::map<std::string, std::string> &carrier);
+  void _UploadHomeTimelinesHelper(
+      int64_t req_id, const std::vector<int64_t> &post_ids,
+      const std::vector<int64_t> &user_ids,
+      const std::vector<int64_t> &timestamps,
+      const std::vector<std::vector<int64_t>> &user_mentions_ids,
+      const std::map<std::string, std::string> &carrier);
 };
 
 ComposePostHandler::ComposePostHandler(
@@ -97,7 +137,8 @@ ComposePostHandler::ComposePostHandler(
     ClientPool<ThriftClient<MediaServiceClient>> *media_service_client_pool,
     ClientPool<ThriftClient<TextServiceClient>> *text_service_client_pool,
     ClientPool<ThriftClient<HomeTimelineServiceClient>>
-        *home_timeline_client_pool) {
+        *home_timeline_client_pool,
+    UniqueIdGenerator *id_generator) {
   _post_storage_client_pool = post_storage_client_pool;
   _user_timeline_client_pool = user_timeline_client_pool;
   _user_service_client_pool = user_service_client_pool;
@@ -105,6 +146,7 @@ ComposePostHandler::ComposePostHandler(
   _media_service_client_pool = media_service_client_pool;
   _text_service_client_pool = text_service_client_pool;
   _home_timeline_client_pool = home_timeline_client_pool;
+  _id_generator = id_generator;
 }
 
 Creator ComposePostHandler::_ComposeCreaterHelper(
@@ -257,6 +299,19 @@ int64_t ComposePostHandler::_ComposeUniqueIdHelper(
   return _return_unique_id;
 }
 
+int64_t ComposePostHandler::_ComposeLocalUniqueIdHelper(int64_t req_id) {
+  int64_t post_id;
+  if (!_id_generator->NextId(&post_id)) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "Clock moved backwards, cannot compose a post_id";
+    LOG(error) << se.message;
+    throw se;
+  }
+  LOG(debug) << "The post_id of the request " << req_id << " is " << post_id;
+  return post_id;
+}
+
 void ComposePostHandler::_UploadPostHelper(
     int64_t req_id, const Post &post,
     const std::map<std::string, std::string> &carrier) {
@@ -380,9 +435,12 @@ void ComposePostHandler::ComposePost(
   auto media_future =
       std::async(std::launch::async, &ComposePostHandler::_ComposeMediaHelper,
                  this, req_id, media_types, media_ids, writer_text_map);
-  auto unique_id_future = std::async(
-      std::launch::async, &ComposePostHandler::_ComposeUniqueIdHelper, this,
-      req_id, post_type, writer_text_map);
+  std::future<int64_t> unique_id_future;
+  if (!_id_generator) {
+    unique_id_future = std::async(
+        std::launch::async, &ComposePostHandler::_ComposeUniqueIdHelper, this,
+        req_id, post_type, writer_text_map);
+  }
 
   Post post;
   auto timestamp =
@@ -392,7 +450,8 @@ void ComposePostHandler::ComposePost(
 
   // try
   // {
-  post.post_id = unique_id_future.get();
+  post.post_id = _id_generator ? _ComposeLocalUniqueIdHelper(req_id)
+                               : unique_id_future.get();
   post.creator = creator_future.get();
   post.media = media_future.get();
   auto text_return = text_future.get();
@@ -401,6 +460,7 @@ void ComposePostHandler::ComposePost(
   post.user_mentions = text_return.user_mentions;
   post.req_id = req_id;
   post.post_type = post_type;
+  SetPostFieldsIsset(POST_FIELDS_ALL, &post);
   // }
   // catch (...)
   // {
@@ -412,31 +472,451 @@ void ComposePostHandler::ComposePost(
     user_mention_ids.emplace_back(item.user_id);
   }
 
-  //In mixed workloed condition, need to make sure _UploadPostHelper execute
-  //Before _UploadUserTimelineHelper and _UploadHomeTimelineHelper.
-  //Change _UploadUserTimelineHelper and _UploadHomeTimelineHelper to deferred.
-  //To let them start execute after post_future.get() return.
-  auto post_future =
-      std::async(std::launch::async, &ComposePostHandler::_UploadPostHelper,
-                 this, req_id, post, writer_text_map);
+  // The timelines must not reference a post before it is stored, or a
+  // concurrent timeline read fails on the missing post. Once it is stored,
+  // the two timeline writes are independent, so they overlap: the user
+  // timeline on its own thread and the home timeline on this one.
+  _UploadPostHelper(req_id, post, writer_text_map);
   auto user_timeline_future = std::async(
-      std::launch::deferred, &ComposePostHandler::_UploadUserTimelineHelper, this,
+      std::launch::async, &ComposePostHandler::_UploadUserTimelineHelper, this,
       req_id, post.post_id, user_id, timestamp, writer_text_map);
-  auto home_timeline_future = std::async(
-      std::launch::deferred, &ComposePostHandler::_UploadHomeTimelineHelper, this,
-      req_id, post.post_id, user_id, timestamp, user_mention_ids,
-      writer_text_map);
-
-  // try
-  // {
-  post_future.get();
+  _UploadHomeTimelineHelper(req_id, post.post_id, user_id, timestamp,
+                            user_mention_ids, writer_text_map);
   user_timeline_future.get();
-  home_timeline_future.get();
-  // }
-  // catch (...)
-  // {
-  //   throw;
-  // }
+  span->Finish();
+}
+
+std::vector<TextServiceReturn> ComposePostHandler::_ComposeTextsHelper(
+    int64_t req_id, const std::vector<std::string> &texts,
+    const std::map<std::string, std::string> &carrier) {
+  TextMapReader reader(carrier);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "compose_texts_client", {opentracing::ChildOf(parent_span->get())});
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  auto text_client_wrapper = _text_service_client_pool->Pop();
+  if (!text_client_wrapper) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
+    se.message = "Failed to connect to text-service";
+    LOG(error) << se.message;
+    span->Finish();
+    throw se;
+  }
+
+  auto text_client = text_client_wrapper->GetClient();
+  std::vector<TextServiceReturn> _return_texts;
+  try {
+    text_client->ComposeTexts(_return_texts, req_id, texts, writer_text_map);
+  } catch (...) {
+    LOG(error) << "Failed to send compose-texts to text-service";
+    _text_service_client_pool->Remove(text_client_wrapper);
+    span->Finish();
+    throw;
+  }
+  _text_service_client_pool->Keepalive(text_client_wrapper);
+  span->Finish();
+  return _return_texts;
+}
+
+std::map<std::string, int64_t> ComposePostHandler::_GetUserIdsHelper(
+    int64_t req_id, const std::vector<std::string> &usernames,
+    const std::map<std::string, std::string> &carrier) {
+  TextMapReader reader(carrier);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "get_user_ids_client", {opentracing::ChildOf(parent_span->get())});
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  auto user_client_wrapper = _user_service_client_pool->Pop();
+  if (!user_client_wrapper) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
+    se.message = "Failed to connect to user-service";
+    LOG(error) << se.message;
+    span->Finish();
+    throw se;
+  }
+
+  auto user_client = user_client_wrapper->GetClient();
+  std::map<std::string, int64_t> _return_user_ids;
+  try {
+    user_client->GetUserIds(_return_user_ids, req_id, usernames,
+                            writer_text_map);
+  } catch (...) {
+    LOG(error) << "Failed to send get-user-ids to user-service";
+    _user_service_client_pool->Remove(user_client_wrapper);
+    span->Finish();
+    throw;
+  }
+  _user_service_client_pool->Keepalive(user_client_wrapper);
+  span->Finish();
+  return _return_user_ids;
+}
+
+int64_t ComposePostHandler::_ComposeUniqueIdsHelper(
+    int64_t req_id, int32_t num_ids,
+    const std::map<std::string, std::string> &carrier) {
+  TextMapReader reader(carrier);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "compose_unique_ids_client", {opentracing::ChildOf(parent_span->get())});
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  auto unique_id_client_wrapper = _unique_id_service_client_pool->Pop();
+  if (!unique_id_client_wrapper) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
+    se.message = "Failed to connect to unique_id-service";
+    LOG(error) << se.message;
+    span->Finish();
+    throw se;
+  }
+
+  auto unique_id_client = unique_id_client_wrapper->GetClient();
+  int64_t _return_first_id;
+  try {
+    // The ids do not depend on the post type, so one block serves posts of
+    // any type
+    _return_first_id = unique_id_client->ComposeUniqueIds(
+        req_id, PostType::POST, num_ids, writer_text_map);
+  } catch (...) {
+    LOG(error) << "Failed to send compose-unique_ids to unique_id-service";
+    _unique_id_service_client_pool->Remove(unique_id_client_wrapper);
+    span->Finish();
+    throw;
+  }
+  _unique_id_service_client_pool->Keepalive(unique_id_client_wrapper);
+  span->Finish();
+  return _return_first_id;
+}
+
+// num_ids post_ids, reserved a block of up to UNIQUE_ID_MAX_BLOCK
+// consecutive ids at a time rather than one by one
+std::vector<int64_t> ComposePostHandler::_ComposePostIdsHelper(
+    int64_t req_id, size_t num_ids,
+    const std::map<std::string, std::string> &carrier) {
+  std::vector<int64_t> post_ids;
+  post_ids.reserve(num_ids);
+  while (post_ids.size() < num_ids) {
+    int32_t block = (int32_t)std::min<size_t>(num_ids - post_ids.size(),
+                                              UNIQUE_ID_MAX_BLOCK);
+    int64_t first_id;
+    if (!_id_generator) {
+      first_id = _ComposeUniqueIdsHelper(req_id, block, carrier);
+    } else if (!_id_generator->NextIds(block, &first_id)) {
+      ServiceException se;
+      se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+      se.message = "Clock moved backwards, cannot compose post_ids";
+      LOG(error) << se.message;
+      throw se;
+    }
+    for (int32_t i = 0; i < block; i++) {
+      post_ids.emplace_back(first_id + i);
+    }
+  }
+  return post_ids;
+}
+
+std::vector<std::string> ComposePostHandler::_UploadPostsHelper(
+    int64_t req_id, const std::vector<Post> &posts,
+    const std::map<std::string, std::string> &carrier) {
+  TextMapReader reader(carrier);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "store_posts_client", {opentracing::ChildOf(parent_span->get())});
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  auto post_storage_client_wrapper = _post_storage_client_pool->Pop();
+  if (!post_storage_client_wrapper) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
+    se.message = "Failed to connect to post-storage-service";
+    LOG(error) << se.message;
+    throw se;
+  }
+  auto post_storage_client = post_storage_client_wrapper->GetClient();
+  std::vector<std::string> _return_errors;
+  try {
+    post_storage_client->StorePosts(_return_errors, req_id, posts,
+                                    writer_text_map);
+  } catch (...) {
+    _post_storage_client_pool->Remove(post_storage_client_wrapper);
+    LOG(error) << "Failed to store posts to post-storage-service";
+    throw;
+  }
+  _post_storage_client_pool->Keepalive(post_storage_client_wrapper);
+
+  span->Finish();
+  return _return_errors;
+}
+
+void ComposePostHandler::_UploadUserTimelinesHelper(
+    int64_t req_id, const std::vector<int64_t> &post_ids,
+    const std::vector<int64_t> &user_ids,
+    const std::vector<int64_t> &timestamps,
+    const std::map<std::string, std::string> &carrier) {
+  TextMapReader reader(carrier);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "write_user_timelines_client",
+      {opentracing::ChildOf(parent_span->get())});
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  auto user_timeline_client_wrapper = _user_timeline_client_pool->Pop();
+  if (!user_timeline_client_wrapper) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
+    se.message = "Failed to connect to user-timeline-service";
+    LOG(error) << se.message;
+    throw se;
+  }
+  auto user_timeline_client = user_timeline_client_wrapper->GetClient();
+  try {
+    user_timeline_client->WriteUserTimelines(req_id, post_ids, user_ids,
+                                             timestamps, writer_text_map);
+  } catch (...) {
+    _user_timeline_client_pool->Remove(user_timeline_client_wrapper);
+    LOG(error) << "Failed to write user timelines to user-timeline-service";
+    throw;
+  }
+  _user_timeline_client_pool->Keepalive(user_timeline_client_wrapper);
+
+  span->Finish();
+}
+
+void ComposePostHandler::_UploadHomeTimelinesHelper(
+    int64_t req_id, const std::vector<int64_t> &post_ids,
+    const std::vector<int64_t> &user_ids,
+    const std::vector<int64_t> &timestamps,
+    const std::vector<std::vector<int64_t>> &user_mentions_ids,
+    const std::map<std::string, std::string> &carrier) {
+  TextMapReader reader(carrier);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "write_home_timelines_client",
+      {opentracing::ChildOf(parent_span->get())});
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  auto home_timeline_client_wrapper = _home_timeline_client_pool->Pop();
+  if (!home_timeline_client_wrapper) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
+    se.message = "Failed to connect to home-timeline-service";
+    LOG(error) << se.message;
+    throw se;
+  }
+  auto home_timeline_client = home_timeline_client_wrapper->GetClient();
+  try {
+    home_timeline_client->WriteHomeTimelines(req_id, post_ids, user_ids,
+                                             timestamps, user_mentions_ids,
+                                             writer_text_map);
+  } catch (...) {
+    _home_timeline_client_pool->Remove(home_timeline_client_wrapper);
+    LOG(error) << "Failed to write home timelines to home-timeline-service";
+    throw;
+  }
+  _home_timeline_client_pool->Keepalive(home_timeline_client_wrapper);
+
+  span->Finish();
+}
+
+// ComposePost of many posts, with a constant number of calls to each
+// service rather than a number per post: one ComposeTexts, one GetUserIds
+// for the creators given by username only, one block of post_ids per
+// UNIQUE_ID_MAX_BLOCK posts, one StorePosts and one write of each timeline.
+// The creator and media of a post are composed here, as user-service and
+// media-service would, since that takes no lookup.
+//
+// Each post gets its own result: its post_id, -1 if it was not stored, and
+// why it was not, or why its timelines were not written. Failures that stop
+// every post before any is stored, e.g. text-service being unreachable,
+// throw instead.
+void ComposePostHandler::ComposePosts(
+    std::vector<PostCompositionResult> &_return, int64_t req_id,
+    const std::vector<PostComposition> &posts,
+    const std::map<std::string, std::string> &carrier) {
+  TextMapReader reader(carrier);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "compose_posts_server", {opentracing::ChildOf(parent_span->get())});
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  std::vector<PostCompositionResult> results(posts.size());
+  for (auto &result : results) {
+    result.post_id = -1;
+  }
+
+  // Items to compose, and the texts and creator usernames they need
+  std::vector<size_t> valid;
+  std::vector<std::string> texts;
+  std::vector<std::string> usernames;
+  std::set<std::string> usernames_seen;
+  for (size_t i = 0; i < posts.size(); i++) {
+    auto &post = posts[i];
+    if (post.media_ids.size() != post.media_types.size()) {
+      results[i].message = "The numbers of media_ids and media_types differ";
+      continue;
+    }
+    valid.emplace_back(i);
+    texts.emplace_back(post.text);
+    if (post.user_id < 0 && usernames_seen.insert(post.username).second) {
+      usernames.emplace_back(post.username);
+    }
+  }
+  if (valid.empty()) {
+    _return = std::move(results);
+    span->Finish();
+    return;
+  }
+
+  auto texts_future =
+      std::async(std::launch::async, &ComposePostHandler::_ComposeTextsHelper,
+                 this, req_id, texts, writer_text_map);
+  std::future<std::map<std::string, int64_t>> user_ids_future;
+  if (!usernames.empty()) {
+    user_ids_future =
+        std::async(std::launch::async, &ComposePostHandler::_GetUserIdsHelper,
+                   this, req_id, usernames, writer_text_map);
+  }
+  auto post_ids = _ComposePostIdsHelper(req_id, valid.size(), writer_text_map);
+  auto text_returns = texts_future.get();
+  std::map<std::string, int64_t> user_ids;
+  if (user_ids_future.valid()) {
+    user_ids = user_ids_future.get();
+  }
+  if (text_returns.size() != valid.size()) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "text-service returned " +
+                 std::to_string(text_returns.size()) + " texts for " +
+                 std::to_string(valid.size());
+    throw se;
+  }
+
+  auto now = duration_cast<milliseconds>(system_clock::now().time_since_epoch())
+                 .count();
+  // Items composed, in the order of new_posts
+  std::vector<size_t> composed;
+  std::vector<Post> new_posts;
+  for (size_t j = 0; j < valid.size(); j++) {
+    auto &item = posts[valid[j]];
+    Post post;
+    post.creator.username = item.username;
+    post.creator.user_id = item.user_id;
+    if (item.user_id < 0) {
+      auto it = user_ids.find(item.username);
+      if (it == user_ids.end() || it->second < 0) {
+        results[valid[j]].message = "User " + item.username + " does not exist";
+        continue;
+      }
+      post.creator.user_id = it->second;
+    }
+    post.post_id = post_ids[j];
+    post.req_id = req_id;
+    post.text = std::move(text_returns[j].text);
+    post.urls = std::move(text_returns[j].urls);
+    post.user_mentions = std::move(text_returns[j].user_mentions);
+    post.media.resize(item.media_ids.size());
+    for (size_t k = 0; k < item.media_ids.size(); k++) {
+      post.media[k].media_id = item.media_ids[k];
+      post.media[k].media_type = item.media_types[k];
+    }
+    post.post_type = item.post_type;
+    post.timestamp = item.timestamp > 0 ? item.timestamp : now;
+    SetPostFieldsIsset(POST_FIELDS_ALL, &post);
+    composed.emplace_back(valid[j]);
+    new_posts.emplace_back(std::move(post));
+  }
+  if (new_posts.empty()) {
+    _return = std::move(results);
+    span->Finish();
+    return;
+  }
+
+  // As in ComposePost, the timelines are written only once the posts they
+  // reference are stored
+  auto errors = _UploadPostsHelper(req_id, new_posts, writer_text_map);
+  if (errors.size() != new_posts.size()) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "post-storage-service returned " +
+                 std::to_string(errors.size()) + " results for " +
+                 std::to_string(new_posts.size()) + " posts";
+    throw se;
+  }
+  std::vector<size_t> stored;
+  std::vector<int64_t> post_ids_stored;
+  std::vector<int64_t> user_ids_stored;
+  std::vector<int64_t> timestamps_stored;
+  std::vector<std::vector<int64_t>> user_mentions_ids_stored;
+  for (size_t k = 0; k < new_posts.size(); k++) {
+    auto &post = new_posts[k];
+    if (!errors[k].empty()) {
+      results[composed[k]].message = "Failed to store post: " + errors[k];
+      continue;
+    }
+    results[composed[k]].post_id = post.post_id;
+    stored.emplace_back(composed[k]);
+    post_ids_stored.emplace_back(post.post_id);
+    user_ids_stored.emplace_back(post.creator.user_id);
+    timestamps_stored.emplace_back(post.timestamp);
+    std::vector<int64_t> user_mention_ids;
+    for (auto &item : post.user_mentions) {
+      user_mention_ids.emplace_back(item.user_id);
+    }
+    user_mentions_ids_stored.emplace_back(std::move(user_mention_ids));
+  }
+
+  if (!stored.empty()) {
+    auto user_timelines_future = std::async(
+        std::launch::async, &ComposePostHandler::_UploadUserTimelinesHelper,
+        this, req_id, post_ids_stored, user_ids_stored, timestamps_stored,
+        writer_text_map);
+    std::string message;
+    try {
+      _UploadHomeTimelinesHelper(req_id, post_ids_stored, user_ids_stored,
+                                 timestamps_stored, user_mentions_ids_stored,
+                                 writer_text_map);
+    } catch (const ServiceException &e) {
+      message = e.message;
+    } catch (const std::exception &e) {
+      message = e.what();
+    }
+    try {
+      user_timelines_future.get();
+    } catch (const ServiceException &e) {
+      message = message.empty() ? e.message : message;
+    } catch (const std::exception &e) {
+      message = message.empty() ? e.what() : message;
+    }
+    if (!message.empty()) {
+      LOG(error) << "Failed to write the timelines of " << stored.size()
+                 << " posts: " << message;
+      for (auto i : stored) {
+        results[i].message = "Stored, but failed to write timelines: " +
+                             message;
+      }
+    }
+  }
+
+  LOG(debug) << stored.size() << " of " << posts.size() << " posts composed";
+  _return = std::move(results);
   span->Finish();
 }
 
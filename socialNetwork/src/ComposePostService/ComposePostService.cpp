@@ -97,13 +97,37 @@ int main(int argc, char *argv[]) {
       "unique-id-service-client", unique_id_addr, unique_id_port, 0,
       unique_id_conns, unique_id_timeout, unique_id_keepalive, config_json);
 
+  // "rpc" asks unique-id-service for each post. "local" mints post ids in
+  // this process under the configured machine_id, which must differ from
+  // that of every other instance minting post ids. It is not hashed from
+  // the MAC address and pid as unique-id-service's is: 11 bits of such a
+  // hash collide often enough across replicas to hand out duplicate ids.
+  std::unique_ptr<UniqueIdGenerator> id_generator;
+  std::string unique_id_mode =
+      config_json["compose-post-service"].value("unique_id_mode", "rpc");
+  if (unique_id_mode == "local") {
+    int machine_id =
+        config_json["compose-post-service"].value("machine_id", -1);
+    if (machine_id < 0 || machine_id > UNIQUE_ID_MAX_MACHINE_ID) {
+      LOG(fatal) << "unique_id_mode \"local\" needs a machine_id from 0 to "
+                 << UNIQUE_ID_MAX_MACHINE_ID;
+      exit(EXIT_FAILURE);
+    }
+    LOG(info) << "machine_id = " << machine_id;
+    id_generator.reset(new UniqueIdGenerator(machine_id));
+  } else if (unique_id_mode != "rpc") {
+    LOG(fatal) << "Unknown unique_id_mode " << unique_id_mode;
+    exit(EXIT_FAILURE);
+  }
+
   std::shared_ptr<TServerSocket> server_socket = get_server_socket(config_json, "0.0.0.0", port);
   TThreadedServer server(
       std::make_shared<ComposePostServiceProcessor>(
           std::make_shared<ComposePostHandler>(
               &post_storage_client_pool, &user_timeline_client_pool,
               &user_client_pool, &unique_id_client_pool, &media_client_pool,
-              &text_client_pool, &home_timeline_client_pool)),
+              &text_client_pool, &home_timeline_client_pool,
+              id_generator.get())),
       server_socket,
       std::make_shared<TFramedTransportFactory>(),
       std::make_shared<TBinaryProtocolFactory>());
@@ -0,0 +1,187 @@
+// Ingestion throughput of compose-post-service, one post per RPC against
+// ComposePosts batches.
+//
+// Against the compose-post-service in --config, from --threads connections:
+//   single   ComposePost, --single posts
+//   bulk     ComposePosts, --posts posts in --batch sized calls; every item
+//            must be stored and have its timelines written
+// Every post is by --username and --user-id, username_<i> and i as
+// scripts/init_social_graph.py registers them; with --lookup-user the
+// ComposePosts items leave the user_id to be looked up by username. Rates
+// are posts per second.
+
+#include <algorithm>
+#include <atomic>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../gen-cpp/ComposePostService.h"
+#include "../ThriftClient.h"
+#include "../logger.h"
+#include "../utils.h"
+
+using namespace social_network;
+
+template <typename Run>
+static double OpsPerSecond(size_t num_ops, const Run &run) {
+  auto start = std::chrono::steady_clock::now();
+  run();
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+  return (double)num_ops * 1e9 / (double)elapsed;
+}
+
+// Runs call(client, i) for i in [0, num_ops) spread over num_threads
+// connections, false if any call failed
+template <typename Call>
+static bool RunOnThreads(const std::string &addr, int port,
+                         const json &config_json, int num_threads,
+                         size_t num_ops, const Call &call) {
+  std::atomic<bool> ok{true};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; t++) {
+    threads.emplace_back([&, t]() {
+      ThriftClient<ComposePostServiceClient> client(addr, port, 0,
+                                                    config_json);
+      try {
+        client.Connect();
+        for (size_t i = t; i < num_ops && ok; i += num_threads) {
+          if (!call(client.GetClient(), i)) {
+            ok = false;
+          }
+        }
+      } catch (const ServiceException &e) {
+        LOG(error) << "compose-post-service error: " << e.message;
+        ok = false;
+      } catch (const std::exception &e) {
+        LOG(error) << "Failed to call compose-post-service at " << addr
+                   << ":" << port << ": " << e.what();
+        ok = false;
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  return ok;
+}
+
+static std::string Text(size_t i) {
+  return "Bulk post " + std::to_string(i) + " http://example.com/" +
+         std::to_string(i);
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "config",
+      po::value<std::string>()->default_value("config/service-config.json"),
+      "Service config holding the compose-post-service address")(
+      "username", po::value<std::string>()->default_value("username_1"),
+      "Creator of the posts, which must be registered")(
+      "user-id", po::value<int64_t>()->default_value(1),
+      "user_id of --username")(
+      "lookup-user", po::bool_switch()->default_value(false),
+      "Have ComposePosts look the creator up by username")(
+      "posts", po::value<int>()->default_value(100000),
+      "Number of posts composed with ComposePosts")(
+      "batch", po::value<int>()->default_value(100),
+      "Posts per ComposePosts call")(
+      "single", po::value<int>()->default_value(10000),
+      "Number of posts composed with ComposePost")(
+      "threads", po::value<int>()->default_value(8),
+      "Concurrent connections to compose-post-service");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  std::string username = vm["username"].as<std::string>();
+  int64_t user_id = vm["user-id"].as<int64_t>();
+  bool lookup_user = vm["lookup-user"].as<bool>();
+  int num_posts = vm["posts"].as<int>();
+  int batch_size = vm["batch"].as<int>();
+  int num_single = vm["single"].as<int>();
+  int num_threads = vm["threads"].as<int>();
+  if (num_posts < 1 || batch_size < 1 || num_single < 0 || num_threads < 1 ||
+      user_id < 0) {
+    LOG(error) << "--posts, --batch and --threads must be positive and "
+                  "--single and --user-id not negative";
+    return EXIT_FAILURE;
+  }
+
+  json config_json;
+  if (load_config_file(vm["config"].as<std::string>(), &config_json) != 0) {
+    return EXIT_FAILURE;
+  }
+  std::string addr = config_json["compose-post-service"]["addr"];
+  int port = config_json["compose-post-service"]["port"];
+  std::map<std::string, std::string> carrier;
+
+  bool ok = true;
+  double single_rate = 0;
+  if (num_single > 0) {
+    single_rate = OpsPerSecond(num_single, [&]() {
+      ok = RunOnThreads(addr, port, config_json, num_threads, num_single,
+                        [&](ComposePostServiceClient *client, size_t i) {
+                          client->ComposePost(i, username, user_id, Text(i),
+                                              {}, {}, PostType::POST,
+                                              carrier);
+                          return true;
+                        });
+    });
+    if (!ok) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  size_t num_batches = (num_posts + batch_size - 1) / batch_size;
+  auto compose_batch = [&](ComposePostServiceClient *client, size_t b) {
+    size_t begin = b * batch_size;
+    size_t end = std::min((size_t)num_posts, begin + batch_size);
+    std::vector<PostComposition> posts(end - begin);
+    for (size_t i = begin; i < end; i++) {
+      auto &post = posts[i - begin];
+      post.username = username;
+      post.user_id = lookup_user ? -1 : user_id;
+      post.text = Text(i);
+      post.post_type = PostType::POST;
+      post.timestamp = 0;
+    }
+    std::vector<PostCompositionResult> results;
+    client->ComposePosts(results, b, posts, carrier);
+    for (size_t j = 0; j < results.size(); j++) {
+      if (!results[j].message.empty() || results[j].post_id < 0) {
+        LOG(error) << "ComposePosts of post " << begin + j << ": "
+                   << results[j].message;
+        return false;
+      }
+    }
+    return results.size() == end - begin;
+  };
+  double bulk_rate = OpsPerSecond(num_posts, [&]() {
+    ok = RunOnThreads(addr, port, config_json, num_threads, num_batches,
+                      compose_batch);
+  });
+  if (!ok) {
+    return EXIT_FAILURE;
+  }
+  LOG(info) << "single: " << single_rate << " /s, bulk: " << bulk_rate
+            << " /s (" << num_posts << " posts, " << batch_size
+            << " per call)";
+  return 0;
+}
@@ -0,0 +1,115 @@
+// Latency of the two ways ComposePost can obtain a post_id, see
+// "unique_id_mode" in config/service-config.json:
+//   rpc    ComposeUniqueId on a running unique-id-service, one call at a time
+//          over one connection, as each ComposePost does
+//   local  UniqueIdGenerator::NextId in this process
+// Reports mean and percentiles in microseconds for each mode. Run it next to
+// the deployment, e.g. inside the compose-post-service container.
+
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../../gen-cpp/UniqueIdService.h"
+#include "../ThriftClient.h"
+#include "../UniqueIdGenerator.h"
+#include "../logger.h"
+#include "../utils.h"
+
+using namespace social_network;
+
+static void ReportLatencies(const std::string &mode,
+                            std::vector<double> *latencies_us) {
+  std::sort(latencies_us->begin(), latencies_us->end());
+  double sum = 0;
+  for (double latency : *latencies_us) {
+    sum += latency;
+  }
+  auto percentile = [&](double p) {
+    size_t idx = std::min(latencies_us->size() - 1,
+                          (size_t)(p * latencies_us->size()));
+    return (*latencies_us)[idx];
+  };
+  LOG(info) << mode << ": " << latencies_us->size() << " ids, mean "
+            << sum / latencies_us->size() << " us, p50 " << percentile(0.5)
+            << " us, p99 " << percentile(0.99) << " us, p99.9 "
+            << percentile(0.999) << " us";
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "config",
+      po::value<std::string>()->default_value("config/service-config.json"),
+      "Service config holding the unique-id-service address")(
+      "requests", po::value<int>()->default_value(10000),
+      "Number of ids composed in each mode")(
+      "skip-rpc", po::bool_switch()->default_value(false),
+      "Only time the local mode");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  int num_requests = vm["requests"].as<int>();
+  if (num_requests < 1) {
+    LOG(error) << "--requests must be positive";
+    return EXIT_FAILURE;
+  }
+  std::vector<double> latencies_us;
+  latencies_us.reserve(num_requests);
+  std::map<std::string, std::string> carrier;
+
+  if (!vm["skip-rpc"].as<bool>()) {
+    json config_json;
+    if (load_config_file(vm["config"].as<std::string>(), &config_json) != 0) {
+      return EXIT_FAILURE;
+    }
+    std::string addr = config_json["unique-id-service"]["addr"];
+    int port = config_json["unique-id-service"]["port"];
+    ThriftClient<UniqueIdServiceClient> client(addr, port, 0, config_json);
+    try {
+      client.Connect();
+      for (int i = 0; i < num_requests; i++) {
+        auto start = std::chrono::steady_clock::now();
+        client.GetClient()->ComposeUniqueId(i, PostType::POST, carrier);
+        latencies_us.emplace_back(
+            std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - start)
+                .count());
+      }
+    } catch (const std::exception &e) {
+      LOG(error) << "Failed to call unique-id-service at " << addr << ":"
+                 << port << ": " << e.what();
+      return EXIT_FAILURE;
+    }
+    ReportLatencies("rpc", &latencies_us);
+  }
+
+  latencies_us.clear();
+  UniqueIdGenerator id_generator(0);
+  int64_t post_id;
+  for (int i = 0; i < num_requests; i++) {
+    auto start = std::chrono::steady_clock::now();
+    if (!id_generator.NextId(&post_id)) {
+      return EXIT_FAILURE;
+    }
+    latencies_us.emplace_back(std::chrono::duration<double, std::micro>(
+                                  std::chrono::steady_clock::now() - start)
+                                  .count());
+  }
+  ReportLatencies("local", &latencies_us);
+  return 0;
+}
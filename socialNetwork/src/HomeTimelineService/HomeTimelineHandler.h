@@ -2,80 +2,138 @@
 #define SOCIAL_NETWORK_MICROSERVICES_SRC_HOMETIMELINESERVICE_HOMETIMELINEHANDLER_H_
 
 #include <sw/redis++/redis++.h>
+#include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/transport/TBufferTransports.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
 #include <future>
 #include <iostream>
+#include <map>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "../../gen-cpp/HomeTimelineService.h"
 #include "../../gen-cpp/PostStorageService.h"
 #include "../../gen-cpp/SocialGraphService.h"
 #include "../ClientPool.h"
+#include "../PackedTimeline.h"
+#include "../PostFields.h"
 #include "../ThriftClient.h"
 #include "../logger.h"
 #include "../tracing.h"
 
+#define FIRST_PAGE_CACHE_DEFAULT_SIZE 10
+#define FIRST_PAGE_CACHE_TTL_SECONDS 600
+#define FIRST_PAGE_CACHE_LOG_INTERVAL 10000
+
 using namespace sw::redis;
 namespace social_network {
 class HomeTimelineHandler : public HomeTimelineServiceIf {
  public:
   HomeTimelineHandler(Redis *,
                       ClientPool<ThriftClient<PostStorageServiceClient>> *,
-                      ClientPool<ThriftClient<SocialGraphServiceClient>> *);
+                      ClientPool<ThriftClient<SocialGraphServiceClient>> *,
+                      bool packed_timeline = false,
+                      int packed_timeline_max_records =
+                          PACKED_TIMELINE_DEFAULT_MAX_RECORDS,
+                      bool first_page_cache = false,
+                      int first_page_size = FIRST_PAGE_CACHE_DEFAULT_SIZE);
   HomeTimelineHandler(RedisCluster *,
                       ClientPool<ThriftClient<PostStorageServiceClient>> *,
-                      ClientPool<ThriftClient<SocialGraphServiceClient>> *);
+                      ClientPool<ThriftClient<SocialGraphServiceClient>> *,
+                      bool packed_timeline = false,
+                      int packed_timeline_max_records =
+                          PACKED_TIMELINE_DEFAULT_MAX_RECORDS,
+                      bool first_page_cache = false,
+                      int first_page_size = FIRST_PAGE_CACHE_DEFAULT_SIZE);
   ~HomeTimelineHandler() override = default;
 
   void ReadHomeTimeline(std::vector<Post> &, int64_t, int64_t, int, int,
-                        const std::map<std::string, std::string> &) override;
+                        const std::map<std::string, std::string> &,
+                        int32_t) override;
 
   void WriteHomeTimeline(int64_t, int64_t, int64_t, int64_t,
                          const std::vector<int64_t> &,
                          const std::map<std::string, std::string> &) override;
 
+  void WriteHomeTimelines(
+      int64_t, const std::vector<int64_t> &, const std::vector<int64_t> &,
+      const std::vector<int64_t> &, const std::vector<std::vector<int64_t>> &,
+      const std::map<std::string, std::string> &) override;
+
  private:
   Redis *_redis_client_pool;
   RedisCluster *_redis_cluster_client_pool;
   ClientPool<ThriftClient<PostStorageServiceClient>> *_post_client_pool;
   ClientPool<ThriftClient<SocialGraphServiceClient>> *_social_graph_client_pool;
+  bool _packed_timeline;
+  int _packed_timeline_max_records;
+  bool _first_page_cache;
+  int _first_page_size;
+  std::atomic<int64_t> _first_page_lookups{0};
+  std::atomic<int64_t> _first_page_hits{0};
+
+  std::vector<int64_t> _GetFollowers(
+      int64_t req_id, int64_t user_id,
+      const opentracing::SpanContext &parent_context);
+  // Runs the commands add_to_pipe queues for each follower in one pipeline,
+  // or in one per shard with Redis Cluster
+  void _PipelineToFollowers(
+      const std::vector<int64_t> &follower_ids,
+      const std::function<void(Pipeline *, int64_t)> &add_to_pipe);
+
+  void _CountFirstPageLookup(bool hit);
+  static std::string _FirstPageVersionKey(int64_t user_id);
+  static std::string _FirstPageKey(int64_t user_id);
+  static std::string _SerializeFirstPage(int64_t version,
+                                         const std::vector<Post> &posts);
+  static bool _DeserializeFirstPage(const std::string &value, int64_t version,
+                                    std::vector<Post> *posts);
 };
 
 HomeTimelineHandler::HomeTimelineHandler(
     Redis *redis_pool,
     ClientPool<ThriftClient<PostStorageServiceClient>> *post_client_pool,
     ClientPool<ThriftClient<SocialGraphServiceClient>>
-        *social_graph_client_pool) {
+        *social_graph_client_pool,
+    bool packed_timeline, int packed_timeline_max_records,
+    bool first_page_cache, int first_page_size) {
   _redis_client_pool = redis_pool;
   _redis_cluster_client_pool = nullptr;
   _post_client_pool = post_client_pool;
   _social_graph_client_pool = social_graph_client_pool;
+  _packed_timeline = packed_timeline;
+  _packed_timeline_max_records = packed_timeline_max_records;
+  _first_page_cache = first_page_cache;
+  _first_page_size = first_page_size;
 }
 
 HomeTimelineHandler::HomeTimelineHandler(
     RedisCluster *redis_pool,
     ClientPool<ThriftClient<PostStorageServiceClient>> *post_client_pool,
     ClientPool<ThriftClient<SocialGraphServiceClient>>
-        *social_graph_client_pool) {
+        *social_graph_client_pool,
+    bool packed_timeline, int packed_timeline_max_records,
+    bool first_page_cache, int first_page_size) {
   _redis_client_pool = nullptr;
   _redis_cluster_client_pool = redis_pool;
   _post_client_pool = post_client_pool;
   _social_graph_client_pool = social_graph_client_pool;
+  _packed_timeline = packed_timeline;
+  _packed_timeline_max_records = packed_timeline_max_records;
+  _first_page_cache = first_page_cache;
+  _first_page_size = first_page_size;
 }
 
-void HomeTimelineHandler::WriteHomeTimeline(
-    int64_t req_id, int64_t post_id, int64_t user_id, int64_t timestamp,
-    const std::vector<int64_t> &user_mentions_id,
-    const std::map<std::string, std::string> &carrier) {
-  // Initialize a span
-  TextMapReader reader(carrier);
-  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
-  auto span = opentracing::Tracer::Global()->StartSpan(
-      "write_home_timeline_server", {opentracing::ChildOf(parent_span->get())});
-
-  // Find followers of the user
+std::vector<int64_t> HomeTimelineHandler::_GetFollowers(
+    int64_t req_id, int64_t user_id,
+    const opentracing::SpanContext &parent_context) {
   auto followers_span = opentracing::Tracer::Global()->StartSpan(
-      "get_followers_client", {opentracing::ChildOf(&span->context())});
+      "get_followers_client", {opentracing::ChildOf(&parent_context)});
   std::map<std::string, std::string> writer_text_map;
   TextMapWriter writer(writer_text_map);
   opentracing::Tracer::Global()->Inject(followers_span->context(), writer);
@@ -99,70 +157,207 @@ void HomeTimelineHandler::WriteHomeTimeline(
   }
   _social_graph_client_pool->Keepalive(social_graph_client_wrapper);
   followers_span->Finish();
+  return followers_id;
+}
+
+void HomeTimelineHandler::_PipelineToFollowers(
+    const std::vector<int64_t> &follower_ids,
+    const std::function<void(Pipeline *, int64_t)> &add_to_pipe) {
+  if (_redis_client_pool) {
+    auto pipe = _redis_client_pool->pipeline(false);
+    for (auto &follower_id : follower_ids) {
+      add_to_pipe(&pipe, follower_id);
+    }
+    try {
+      auto replies = pipe.exec();
+    } catch (const Error &err) {
+      LOG(error) << err.what();
+      throw err;
+    }
+  } else {
+    // Create multi-pipeline that match with shards pool
+    std::map<std::shared_ptr<ConnectionPool>, std::shared_ptr<Pipeline>> pipe_map;
+    auto *shards_pool = _redis_cluster_client_pool->get_shards_pool();
+
+    for (auto &follower_id : follower_ids) {
+      std::string key = _packed_timeline ? PackedTimelineKey(follower_id)
+                                         : std::to_string(follower_id);
+      auto conn = shards_pool->fetch(key);
+      auto pipe = pipe_map.find(conn);
+      if(pipe == pipe_map.end()) {//Not found, create new pipeline and insert
+        auto new_pipe = std::make_shared<Pipeline>(_redis_cluster_client_pool->pipeline(key, false));
+        pipe_map.insert(make_pair(conn, new_pipe));
+        auto *_pipe = new_pipe.get();
+        add_to_pipe(_pipe, follower_id);
+      }else{//Found, use exist pipeline
+        std::pair<std::shared_ptr<ConnectionPool>, std::shared_ptr<Pipeline>> found = *pipe;
+        auto *_pipe = found.second.get();
+        add_to_pipe(_pipe, follower_id);
+      }
+    }
+    // LOG(info) <<"followers_id_set items:" << followers_id_set.size()<<"; pipeline items:" << pipe_map.size();
+    try {
+      for(auto const &it : pipe_map) {
+        auto _pipe = it.second.get();
+        _pipe->exec();
+      }
+
+    } catch (const Error &err) {
+      LOG(error) << err.what();
+      throw err;
+    }
+  }
+}
+
+void HomeTimelineHandler::WriteHomeTimeline(
+    int64_t req_id, int64_t post_id, int64_t user_id, int64_t timestamp,
+    const std::vector<int64_t> &user_mentions_id,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "write_home_timeline_server", {opentracing::ChildOf(parent_span->get())});
+
+  // Find followers of the user
+  std::vector<int64_t> followers_id =
+      _GetFollowers(req_id, user_id, span->context());
 
   std::set<int64_t> followers_id_set(followers_id.begin(), followers_id.end());
   followers_id_set.insert(user_mentions_id.begin(), user_mentions_id.end());
 
   // Update Redis ZSet
   // Zset key: follower_id, Zset value: post_id_str, Zset score: timestamp_str
+  // or, with the packed layout, append one (timestamp, post_id) record to
+  // the string at follower_id:packed
   auto redis_span = opentracing::Tracer::Global()->StartSpan(
       "write_home_timeline_redis_update_client",
       {opentracing::ChildOf(&span->context())});
   std::string post_id_str = std::to_string(post_id);
-
-  {
-    if (_redis_client_pool) {
-      auto pipe = _redis_client_pool->pipeline(false);
-      for (auto &follower_id : followers_id_set) {
-        pipe.zadd(std::to_string(follower_id), post_id_str, timestamp,
-                  UpdateType::NOT_EXIST);
-      }
-      try {
-        auto replies = pipe.exec();
-      } catch (const Error &err) {
-        LOG(error) << err.what();
-        throw err;
-      }
+  std::string packed_record = EncodePackedTimelineRecord(timestamp, post_id);
+  std::string packed_cap = std::to_string(_packed_timeline_max_records *
+                                          sizeof(PackedTimelineRecord));
+  auto add_to_pipe = [&](Pipeline *pipe, int64_t follower_id) {
+    if (_packed_timeline) {
+      pipe->eval(PACKED_TIMELINE_APPEND_SCRIPT,
+                 {PackedTimelineKey(follower_id)},
+                 {packed_record, packed_cap});
     } else {
-      // Create multi-pipeline that match with shards pool
-      std::map<std::shared_ptr<ConnectionPool>, std::shared_ptr<Pipeline>> pipe_map;
-      auto *shards_pool = _redis_cluster_client_pool->get_shards_pool();
-
-      for (auto &follower_id : followers_id_set) {
-        auto conn = shards_pool->fetch(std::to_string(follower_id));
-        auto pipe = pipe_map.find(conn);
-        if(pipe == pipe_map.end()) {//Not found, create new pipeline and insert
-          auto new_pipe = std::make_shared<Pipeline>(_redis_cluster_client_pool->pipeline(std::to_string(follower_id), false));
-          pipe_map.insert(make_pair(conn, new_pipe));
-          auto *_pipe = new_pipe.get();
-          _pipe->zadd(std::to_string(follower_id), post_id_str, timestamp,
-                  UpdateType::NOT_EXIST);
-        }else{//Found, use exist pipeline
-          std::pair<std::shared_ptr<ConnectionPool>, std::shared_ptr<Pipeline>> found = *pipe;
-          auto *_pipe = found.second.get();
-          _pipe->zadd(std::to_string(follower_id), post_id_str, timestamp,
-                  UpdateType::NOT_EXIST);
-        }
-      }
-      // LOG(info) <<"followers_id_set items:" << followers_id_set.size()<<"; pipeline items:" << pipe_map.size();
-      try {
-        for(auto const &it : pipe_map) {
-          auto _pipe = it.second.get();
-          _pipe->exec();
-        }
+      pipe->zadd(std::to_string(follower_id), post_id_str, timestamp,
+                 UpdateType::NOT_EXIST);
+    }
+    if (_first_page_cache) {
+      // Invalidates the follower's cached first page. The page is deleted
+      // as well, since the version alone can repeat once its key has been
+      // evicted or has expired.
+      pipe->incr(_FirstPageVersionKey(follower_id));
+      pipe->del(_FirstPageKey(follower_id));
+    }
+  };
+  _PipelineToFollowers(
+      std::vector<int64_t>(followers_id_set.begin(), followers_id_set.end()),
+      add_to_pipe);
+  redis_span->Finish();
+}
 
-      } catch (const Error &err) {
-        LOG(error) << err.what();
-        throw err;
-      }
+// WriteHomeTimeline of many posts at once. The followers of each author are
+// fetched once, however many of the posts are theirs, and each follower
+// gets all of its new posts with one command, and one first-page
+// invalidation, rather than one per post.
+void HomeTimelineHandler::WriteHomeTimelines(
+    int64_t req_id, const std::vector<int64_t> &post_ids,
+    const std::vector<int64_t> &user_ids,
+    const std::vector<int64_t> &timestamps,
+    const std::vector<std::vector<int64_t>> &user_mentions_ids,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "write_home_timelines_server",
+      {opentracing::ChildOf(parent_span->get())});
+
+  if (user_ids.size() != post_ids.size() ||
+      timestamps.size() != post_ids.size() ||
+      user_mentions_ids.size() != post_ids.size()) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "The lengths of post_ids, user_ids, timestamps and "
+                 "user_mentions_ids are not equal";
+    throw se;
+  }
+
+  std::map<int64_t, std::vector<int64_t>> followers_of;
+  for (auto user_id : user_ids) {
+    if (!followers_of.count(user_id)) {
+      followers_of[user_id] = _GetFollowers(req_id, user_id, span->context());
+    }
+  }
+
+  // The new posts of each follower, or mentioned user, newest first
+  std::map<int64_t, std::vector<PackedTimelineRecord>> follower_posts;
+  for (size_t i = 0; i < post_ids.size(); i++) {
+    auto &followers_id = followers_of[user_ids[i]];
+    std::set<int64_t> followers_id_set(followers_id.begin(),
+                                       followers_id.end());
+    followers_id_set.insert(user_mentions_ids[i].begin(),
+                            user_mentions_ids[i].end());
+    for (auto follower_id : followers_id_set) {
+      follower_posts[follower_id].push_back({timestamps[i], post_ids[i]});
     }
   }
+  std::vector<int64_t> follower_ids;
+  follower_ids.reserve(follower_posts.size());
+  for (auto &follower : follower_posts) {
+    std::stable_sort(follower.second.begin(), follower.second.end(),
+                     [](const PackedTimelineRecord &a,
+                        const PackedTimelineRecord &b) {
+                       return a.timestamp > b.timestamp;
+                     });
+    follower_ids.emplace_back(follower.first);
+  }
+
+  auto redis_span = opentracing::Tracer::Global()->StartSpan(
+      "write_home_timelines_redis_update_client",
+      {opentracing::ChildOf(&span->context())});
+  std::string packed_cap = std::to_string(_packed_timeline_max_records *
+                                          sizeof(PackedTimelineRecord));
+  auto add_to_pipe = [&](Pipeline *pipe, int64_t follower_id) {
+    auto &records = follower_posts[follower_id];
+    if (_packed_timeline) {
+      pipe->eval(PACKED_TIMELINE_APPEND_SCRIPT,
+                 {PackedTimelineKey(follower_id)},
+                 {EncodePackedTimeline(records), packed_cap});
+    } else {
+      std::vector<std::pair<std::string, double>> members;
+      members.reserve(records.size());
+      for (auto &record : records) {
+        members.emplace_back(std::to_string(record.post_id),
+                             record.timestamp);
+      }
+      pipe->zadd(std::to_string(follower_id), members.begin(), members.end(),
+                 UpdateType::NOT_EXIST);
+    }
+    if (_first_page_cache) {
+      // Invalidates the follower's cached first page. The page is deleted
+      // as well, since the version alone can repeat once its key has been
+      // evicted or has expired.
+      pipe->incr(_FirstPageVersionKey(follower_id));
+      pipe->del(_FirstPageKey(follower_id));
+    }
+  };
+  _PipelineToFollowers(follower_ids, add_to_pipe);
   redis_span->Finish();
+  span->Finish();
 }
 
+// The first-page cache holds full posts, so a cached page is masked after it
+// is read, and a page about to be cached is read whole and masked after.
 void HomeTimelineHandler::ReadHomeTimeline(
     std::vector<Post> &_return, int64_t req_id, int64_t user_id, int start_idx,
-    int stop_idx, const std::map<std::string, std::string> &carrier) {
+    int stop_idx, const std::map<std::string, std::string> &carrier,
+    int32_t fields) {
+  fields &= POST_FIELDS_ALL;
   // Initialize a span
   TextMapReader reader(carrier);
   std::map<std::string, std::string> writer_text_map;
@@ -176,19 +371,87 @@ void HomeTimelineHandler::ReadHomeTimeline(
     return;
   }
 
+  // First-page requests are served from the hydrated page cache when the
+  // cached page was built at the current timeline version. On a miss the
+  // whole first page is read so that it can be cached for later requests.
+  // A missing version key is a miss: once it has been evicted, the version
+  // a cached page was built at can no longer be told from the current one.
+  bool use_first_page_cache =
+      _first_page_cache && start_idx == 0 && stop_idx <= _first_page_size;
+  int fetch_stop_idx = stop_idx;
+  int64_t first_page_version = 0;
+  bool first_page_version_found = false;
+  if (use_first_page_cache) {
+    auto cache_span = opentracing::Tracer::Global()->StartSpan(
+        "read_home_timeline_first_page_cache_client",
+        {opentracing::ChildOf(&span->context())});
+    std::vector<OptionalString> cached;
+    try {
+      if (_redis_client_pool) {
+        _redis_client_pool->mget(
+            {_FirstPageVersionKey(user_id), _FirstPageKey(user_id)},
+            std::back_inserter(cached));
+      } else {
+        _redis_cluster_client_pool->mget(
+            {_FirstPageVersionKey(user_id), _FirstPageKey(user_id)},
+            std::back_inserter(cached));
+      }
+    } catch (const Error &err) {
+      LOG(error) << err.what();
+      throw err;
+    }
+    cache_span->Finish();
+
+    if (cached[0]) {
+      first_page_version = std::stoll(*cached[0]);
+      first_page_version_found = true;
+    }
+    if (first_page_version_found && cached[1] &&
+        _DeserializeFirstPage(*cached[1], first_page_version, &_return)) {
+      if (_return.size() > static_cast<size_t>(stop_idx)) {
+        _return.resize(stop_idx);
+      }
+      if (fields != POST_FIELDS_ALL) {
+        for (auto &post : _return) {
+          ApplyPostFields(fields, &post);
+        }
+      }
+      span->SetTag("first_page_cache_hit", true);
+      _CountFirstPageLookup(true);
+      span->Finish();
+      return;
+    }
+    _return.clear();
+    span->SetTag("first_page_cache_hit", false);
+    _CountFirstPageLookup(false);
+    fetch_stop_idx = _first_page_size;
+  }
+
   auto redis_span = opentracing::Tracer::Global()->StartSpan(
       "read_home_timeline_redis_find_client",
       {opentracing::ChildOf(&span->context())});
 
   std::vector<std::string> post_ids_str;
+  std::string packed_timeline;
   try {
-    if (_redis_client_pool) {
+    if (_packed_timeline) {
+      if (_redis_client_pool) {
+        packed_timeline =
+            ReadPackedTimelineRange(_redis_client_pool,
+                                    PackedTimelineKey(user_id), start_idx,
+                                    fetch_stop_idx);
+      } else {
+        packed_timeline = ReadPackedTimelineRange(_redis_cluster_client_pool,
+                                                  PackedTimelineKey(user_id),
+                                                  start_idx, fetch_stop_idx);
+      }
+    } else if (_redis_client_pool) {
       _redis_client_pool->zrevrange(std::to_string(user_id), start_idx,
-                                    stop_idx - 1,
+                                    fetch_stop_idx - 1,
                                     std::back_inserter(post_ids_str));
     } else {
       _redis_cluster_client_pool->zrevrange(std::to_string(user_id), start_idx,
-                                            stop_idx - 1,
+                                            fetch_stop_idx - 1,
                                             std::back_inserter(post_ids_str));
     }
   } catch (const Error &err) {
@@ -198,8 +461,12 @@ void HomeTimelineHandler::ReadHomeTimeline(
   redis_span->Finish();
 
   std::vector<int64_t> post_ids;
-  for (auto &post_id_str : post_ids_str) {
-    post_ids.emplace_back(std::stoul(post_id_str));
+  if (_packed_timeline) {
+    DecodePackedTimeline(packed_timeline, &post_ids);
+  } else {
+    for (auto &post_id_str : post_ids_str) {
+      post_ids.emplace_back(std::stoul(post_id_str));
+    }
   }
 
   auto post_client_wrapper = _post_client_pool->Pop();
@@ -210,17 +477,140 @@ void HomeTimelineHandler::ReadHomeTimeline(
     throw se;
   }
   auto post_client = post_client_wrapper->GetClient();
+  int32_t read_fields = use_first_page_cache ? POST_FIELDS_ALL : fields;
   try {
-    post_client->ReadPosts(_return, req_id, post_ids, writer_text_map);
+    post_client->ReadPosts(_return, req_id, post_ids, writer_text_map,
+                           read_fields);
   } catch (...) {
     _post_client_pool->Remove(post_client_wrapper);
     LOG(error) << "Failed to read posts from post-storage-service";
     throw;
   }
   _post_client_pool->Keepalive(post_client_wrapper);
+
+  if (use_first_page_cache) {
+    // A fan-out that raced with this read has already bumped the version, so
+    // the page cached here will simply never be served. Without a version
+    // key, one is created at 0 with the page's TTL first; if a fan-out
+    // created it meanwhile, the page may already be stale and is not cached.
+    try {
+      auto ttl = std::chrono::seconds(FIRST_PAGE_CACHE_TTL_SECONDS);
+      bool cacheable = first_page_version_found;
+      if (!cacheable) {
+        if (_redis_client_pool) {
+          cacheable = _redis_client_pool->set(_FirstPageVersionKey(user_id),
+                                              "0", ttl,
+                                              UpdateType::NOT_EXIST);
+        } else {
+          cacheable = _redis_cluster_client_pool->set(
+              _FirstPageVersionKey(user_id), "0", ttl, UpdateType::NOT_EXIST);
+        }
+      }
+      if (cacheable) {
+        std::string first_page =
+            _SerializeFirstPage(first_page_version, _return);
+        if (_redis_client_pool) {
+          _redis_client_pool->set(_FirstPageKey(user_id), first_page, ttl);
+        } else {
+          _redis_cluster_client_pool->set(_FirstPageKey(user_id), first_page,
+                                          ttl);
+        }
+      }
+    } catch (const Error &err) {
+      LOG(warning) << "Failed to cache first page of home timeline "
+                   << user_id << ": " << err.what();
+    }
+    if (_return.size() > static_cast<size_t>(stop_idx)) {
+      _return.resize(stop_idx);
+    }
+    if (fields != POST_FIELDS_ALL) {
+      for (auto &post : _return) {
+        ApplyPostFields(fields, &post);
+      }
+    }
+  }
   span->Finish();
 }
 
+void HomeTimelineHandler::_CountFirstPageLookup(bool hit) {
+  if (hit) {
+    _first_page_hits++;
+  }
+  int64_t lookups = ++_first_page_lookups;
+  if (lookups % FIRST_PAGE_CACHE_LOG_INTERVAL == 0) {
+    LOG(info) << "First page cache: " << lookups << " lookups, "
+              << 100.0 * _first_page_hits.load() / lookups << "% hits";
+  }
+}
+
+// Both keys carry the user_id as a hash tag so that they live in the same
+// cluster slot as the timeline itself and can be fetched with one MGET.
+std::string HomeTimelineHandler::_FirstPageVersionKey(int64_t user_id) {
+  return "{" + std::to_string(user_id) + "}:version";
+}
+
+std::string HomeTimelineHandler::_FirstPageKey(int64_t user_id) {
+  return "{" + std::to_string(user_id) + "}:first-page";
+}
+
+// Cached value layout: the 8-byte timeline version the page was built at,
+// followed by the posts as a Thrift binary-encoded list<Post>.
+std::string HomeTimelineHandler::_SerializeFirstPage(
+    int64_t version, const std::vector<Post> &posts) {
+  using apache::thrift::protocol::TBinaryProtocol;
+  using apache::thrift::transport::TMemoryBuffer;
+  auto buffer = std::make_shared<TMemoryBuffer>();
+  TBinaryProtocol protocol(buffer);
+  protocol.writeListBegin(apache::thrift::protocol::T_STRUCT,
+                          static_cast<uint32_t>(posts.size()));
+  for (auto &post : posts) {
+    post.write(&protocol);
+  }
+  protocol.writeListEnd();
+
+  std::string value(sizeof(version), '\0');
+  std::memcpy(&value[0], &version, sizeof(version));
+  value += buffer->getBufferAsString();
+  return value;
+}
+
+bool HomeTimelineHandler::_DeserializeFirstPage(const std::string &value,
+                                                int64_t version,
+                                                std::vector<Post> *posts) {
+  using apache::thrift::protocol::TBinaryProtocol;
+  using apache::thrift::transport::TMemoryBuffer;
+  int64_t cached_version;
+  if (value.size() < sizeof(cached_version)) {
+    return false;
+  }
+  std::memcpy(&cached_version, value.data(), sizeof(cached_version));
+  if (cached_version != version) {
+    return false;
+  }
+
+  auto buffer = std::make_shared<TMemoryBuffer>(
+      reinterpret_cast<uint8_t *>(
+          const_cast<char *>(value.data() + sizeof(cached_version))),
+      static_cast<uint32_t>(value.size() - sizeof(cached_version)));
+  TBinaryProtocol protocol(buffer);
+  try {
+    apache::thrift::protocol::TType elem_type;
+    uint32_t size;
+    protocol.readListBegin(elem_type, size);
+    posts->resize(size);
+    for (auto &post : *posts) {
+      post.read(&protocol);
+    }
+    protocol.readListEnd();
+  } catch (const apache::thrift::TException &e) {
+    LOG(warning) << "Discarding malformed first page cache entry: "
+                 << e.what();
+    posts->clear();
+    return false;
+  }
+  return true;
+}
+
 }  // namespace social_network
 
 #endif  // SOCIAL_NETWORK_MICROSERVICES_SRC_HOMETIMELINESERVICE_HOMETIMELINEHANDLER_H_
@@ -58,6 +58,16 @@ int main(int argc, char *argv[]) {
   }
 
   int port = config_json["home-timeline-service"]["port"];
+  std::string timeline_layout = config_json["home-timeline-service"].value(
+      "timeline_layout", std::string("zset"));
+  bool packed_timeline = (timeline_layout == "packed");
+  int packed_timeline_max_records =
+      config_json["home-timeline-service"].value(
+          "timeline_max_records", PACKED_TIMELINE_DEFAULT_MAX_RECORDS);
+  bool first_page_cache =
+      config_json["home-timeline-service"].value("first_page_cache", false);
+  int first_page_size = config_json["home-timeline-service"].value(
+      "first_page_size", FIRST_PAGE_CACHE_DEFAULT_SIZE);
 
   int post_storage_port = config_json["post-storage-service"]["port"];
   std::string post_storage_addr = config_json["post-storage-service"]["addr"];
@@ -93,11 +103,16 @@ int main(int argc, char *argv[]) {
         std::make_shared<HomeTimelineServiceProcessor>(
             std::make_shared<HomeTimelineHandler>(&redis_cluster_client_pool,
                                                   &post_storage_client_pool,
-                                                  &social_graph_client_pool)),
+                                                  &social_graph_client_pool,
+                                                  packed_timeline,
+                                                  packed_timeline_max_records,
+                                                  first_page_cache,
+                                                  first_page_size)),
         server_socket, std::make_shared<TFramedTransportFactory>(),
         std::make_shared<TBinaryProtocolFactory>());
 
-    LOG(info) << "Starting the home-timeline-service server...";
+    LOG(info) << "Starting the home-timeline-service server ("
+              << timeline_layout << " timeline layout)...";
     server.serve();
   } else {
     Redis redis_client_pool =
@@ -106,11 +121,16 @@ int main(int argc, char *argv[]) {
         std::make_shared<HomeTimelineServiceProcessor>(
             std::make_shared<HomeTimelineHandler>(&redis_client_pool,
                                                   &post_storage_client_pool,
-                                                  &social_graph_client_pool)),
+                                                  &social_graph_client_pool,
+                                                  packed_timeline,
+                                                  packed_timeline_max_records,
+                                                  first_page_cache,
+                                                  first_page_size)),
         server_socket, std::make_shared<TFramedTransportFactory>(),
         std::make_shared<TBinaryProtocolFactory>());
 
-    LOG(info) << "Starting the home-timeline-service server...";
+    LOG(info) << "Starting the home-timeline-service server ("
+              << timeline_layout << " timeline layout)...";
     server.serve();
   }
 }
\ No newline at end of file
@@ -0,0 +1,288 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_MONGOINDEXES_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_MONGOINDEXES_H_
+
+#include <bson/bson.h>
+#include <mongoc.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "logger.h"
+
+namespace social_network {
+
+// An index a service needs, declared next to the handler whose queries use
+// it (see the IndexSpecs() of the handlers)
+struct MongoIndexSpec {
+  std::string db;
+  std::string collection;
+  // (field, direction) pairs in index order
+  std::vector<std::pair<std::string, int>> keys;
+  bool unique;
+  // Extended JSON partialFilterExpression, empty for a full index
+  std::string partial_filter;
+};
+
+// A query a handler issues, with sample values, for the self-check (see the
+// QueryShapes() of the handlers)
+struct MongoQueryShape {
+  std::string db;
+  std::string collection;
+  // Extended JSON filter and sort, sort empty for none
+  std::string filter;
+  std::string sort;
+};
+
+// The shape of a filter, and sort, built by the same function the handler
+// builds its query with, so that the shape cannot drift from the query.
+// Destroys filter and sort.
+inline MongoQueryShape MongoQueryShapeOf(const std::string &db,
+                                         const std::string &collection,
+                                         bson_t *filter,
+                                         bson_t *sort = nullptr) {
+  MongoQueryShape shape{db, collection, "", ""};
+  char *json = bson_as_canonical_extended_json(filter, nullptr);
+  shape.filter = json;
+  bson_free(json);
+  bson_destroy(filter);
+  if (sort) {
+    json = bson_as_canonical_extended_json(sort, nullptr);
+    shape.sort = json;
+    bson_free(json);
+    bson_destroy(sort);
+  }
+  return shape;
+}
+
+// Creates the indexes of specs that do not exist yet. A failure that
+// retrying cannot fix, i.e. anything but a connection error, such as an
+// E11000 duplicate key building a unique index, is also appended to
+// *permanent_errors when given.
+inline bool CreateIndexes(mongoc_client_t *client,
+                          const std::vector<MongoIndexSpec> &specs,
+                          std::string *permanent_errors = nullptr) {
+  bool all_created = true;
+  for (auto &spec : specs) {
+    bson_t keys;
+    bson_init(&keys);
+    for (auto &key : spec.keys) {
+      BSON_APPEND_INT32(&keys, key.first.c_str(), key.second);
+    }
+    char *index_name = mongoc_collection_keys_to_index_string(&keys);
+    auto add_permanent_error = [&](const char *message) {
+      if (permanent_errors) {
+        if (!permanent_errors->empty()) {
+          *permanent_errors += "; ";
+        }
+        *permanent_errors += std::string(index_name) + " on " + spec.db +
+                             "." + spec.collection + ": " + message;
+      }
+    };
+
+    bson_t index;
+    bson_init(&index);
+    BSON_APPEND_DOCUMENT(&index, "key", &keys);
+    BSON_APPEND_UTF8(&index, "name", index_name);
+    BSON_APPEND_BOOL(&index, "unique", spec.unique);
+    bson_error_t error;
+    bool ok = true;
+    if (!spec.partial_filter.empty()) {
+      bson_t *partial_filter = bson_new_from_json(
+          (const uint8_t *)spec.partial_filter.c_str(), -1, &error);
+      if (partial_filter) {
+        BSON_APPEND_DOCUMENT(&index, "partialFilterExpression",
+                             partial_filter);
+        bson_destroy(partial_filter);
+      } else {
+        LOG(error) << "Invalid partial filter of index " << index_name
+                   << " on " << spec.db << "." << spec.collection << ": "
+                   << error.message;
+        ok = false;
+        add_permanent_error(error.message);
+      }
+    }
+
+    if (ok) {
+      bson_t *create_indexes =
+          BCON_NEW("createIndexes", BCON_UTF8(spec.collection.c_str()),
+                   "indexes", "[", BCON_DOCUMENT(&index), "]");
+      mongoc_database_t *db =
+          mongoc_client_get_database(client, spec.db.c_str());
+      bson_t reply;
+      ok = mongoc_database_write_command_with_opts(db, create_indexes,
+                                                   nullptr, &reply, &error);
+      if (!ok) {
+        LOG(error) << "Error in createIndexes of " << index_name << " on "
+                   << spec.db << "." << spec.collection << ": "
+                   << error.message;
+        bool connection_error = error.domain == MONGOC_ERROR_STREAM ||
+                                error.domain == MONGOC_ERROR_SERVER_SELECTION;
+        if (!connection_error) {
+          add_permanent_error(error.message);
+        }
+      }
+      bson_destroy(&reply);
+      bson_destroy(create_indexes);
+      mongoc_database_destroy(db);
+    }
+    bson_free(index_name);
+    bson_destroy(&index);
+    bson_destroy(&keys);
+    all_created = all_created && ok;
+  }
+  return all_created;
+}
+
+// Builds the indexes on a detached thread, retrying connection errors until
+// they all exist, so that a long index build does not hold up serving
+inline void CreateIndexesInBackground(mongoc_client_pool_t *mongodb_client_pool,
+                                      std::vector<MongoIndexSpec> specs) {
+  std::thread([mongodb_client_pool, specs]() {
+    while (true) {
+      mongoc_client_t *mongodb_client =
+          mongoc_client_pool_pop(mongodb_client_pool);
+      std::string permanent_errors;
+      bool created = CreateIndexes(mongodb_client, specs, &permanent_errors);
+      mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+      if (created) {
+        LOG(info) << "Created " << specs.size() << " MongoDB indexes";
+        return;
+      }
+      if (!permanent_errors.empty()) {
+        LOG(error) << "Giving up on MongoDB indexes: " << permanent_errors;
+        return;
+      }
+      LOG(error) << "Failed to create mongodb indexes, try again";
+      sleep(1);
+    }
+  }).detach();
+}
+
+// True if a stage of the plan document at iter, or of its input stages, is a
+// collection scan
+inline bool PlanHasCollectionScan(bson_iter_t *iter) {
+  while (bson_iter_next(iter)) {
+    if (strcmp(bson_iter_key(iter), "stage") == 0 &&
+        BSON_ITER_HOLDS_UTF8(iter) &&
+        strcmp(bson_iter_utf8(iter, nullptr), "COLLSCAN") == 0) {
+      return true;
+    }
+    bson_iter_t child;
+    if ((BSON_ITER_HOLDS_DOCUMENT(iter) || BSON_ITER_HOLDS_ARRAY(iter)) &&
+        bson_iter_recurse(iter, &child) && PlanHasCollectionScan(&child)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Runs explain on every shape and returns false if any of them would scan
+// its collection. On a collection that does not exist yet every shape
+// passes, as there is nothing to scan.
+inline bool VerifyQueryShapes(mongoc_client_t *client,
+                              const std::vector<MongoQueryShape> &shapes) {
+  bool all_indexed = true;
+  for (auto &shape : shapes) {
+    bson_error_t error;
+    bson_t *filter = bson_new_from_json((const uint8_t *)shape.filter.c_str(),
+                                        -1, &error);
+    if (!filter) {
+      LOG(error) << "Invalid query shape " << shape.filter << ": "
+                 << error.message;
+      all_indexed = false;
+      continue;
+    }
+    bson_t find;
+    bson_init(&find);
+    BSON_APPEND_UTF8(&find, "find", shape.collection.c_str());
+    BSON_APPEND_DOCUMENT(&find, "filter", filter);
+    if (!shape.sort.empty()) {
+      bson_t *sort = bson_new_from_json((const uint8_t *)shape.sort.c_str(),
+                                        -1, &error);
+      if (sort) {
+        BSON_APPEND_DOCUMENT(&find, "sort", sort);
+        bson_destroy(sort);
+      }
+    }
+    bson_t *explain = BCON_NEW("explain", BCON_DOCUMENT(&find), "verbosity",
+                               BCON_UTF8("queryPlanner"));
+
+    bson_t reply;
+    bool ok = mongoc_client_read_command_with_opts(
+        client, shape.db.c_str(), explain, nullptr, nullptr, &reply, &error);
+    bson_iter_t iter;
+    bson_iter_t plan;
+    if (!ok) {
+      LOG(error) << "Failed to explain " << shape.db << "."
+                 << shape.collection << " " << shape.filter << ": "
+                 << error.message;
+      all_indexed = false;
+    } else if (bson_iter_init(&iter, &reply) &&
+               bson_iter_find_descendant(&iter, "queryPlanner.winningPlan",
+                                         &plan) &&
+               bson_iter_recurse(&plan, &iter) &&
+               PlanHasCollectionScan(&iter)) {
+      LOG(error) << "Query " << shape.filter << " on " << shape.db << "."
+                 << shape.collection << " scans the collection";
+      all_indexed = false;
+    } else {
+      LOG(info) << "Query " << shape.filter << " on " << shape.db << "."
+                << shape.collection << " uses an index";
+    }
+    bson_destroy(&reply);
+    bson_destroy(explain);
+    bson_destroy(&find);
+    bson_destroy(filter);
+  }
+  return all_indexed;
+}
+
+// Applies specs. Unique indexes are waited for, since until they exist
+// nothing stops two writers from inserting the same key; the others are
+// built in the background. In check mode ("mongodb_index_check" in
+// service-config.json) all of them are waited for, then every shape is
+// verified to be served by an index. Only connection errors are retried;
+// false is returned if an index cannot be created, e.g. a unique one over
+// duplicate keys, or if a shape is not served by an index.
+inline bool SetUpMongoIndexes(mongoc_client_pool_t *mongodb_client_pool,
+                              const std::vector<MongoIndexSpec> &specs,
+                              const std::vector<MongoQueryShape> &shapes,
+                              bool check) {
+  std::vector<MongoIndexSpec> now_specs;
+  std::vector<MongoIndexSpec> background_specs;
+  for (auto &spec : specs) {
+    if (spec.unique || check) {
+      now_specs.emplace_back(spec);
+    } else {
+      background_specs.emplace_back(spec);
+    }
+  }
+  if (!background_specs.empty()) {
+    CreateIndexesInBackground(mongodb_client_pool, background_specs);
+  }
+  if (now_specs.empty() && !check) {
+    return true;
+  }
+  mongoc_client_t *mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
+  std::string permanent_errors;
+  while (!CreateIndexes(mongodb_client, now_specs, &permanent_errors)) {
+    if (!permanent_errors.empty()) {
+      LOG(fatal) << "Cannot create MongoDB indexes: " << permanent_errors;
+      mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+      return false;
+    }
+    LOG(error) << "Failed to create mongodb indexes, try again";
+    sleep(1);
+  }
+  bool indexed = !check || VerifyQueryShapes(mongodb_client, shapes);
+  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+  return indexed;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SRC_MONGOINDEXES_H_
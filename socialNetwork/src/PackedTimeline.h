@@ -0,0 +1,126 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_PACKEDTIMELINE_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_PACKEDTIMELINE_H_
+
+#include <sw/redis++/redis++.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace social_network {
+
+// Packed timeline layout
+//
+// Instead of a ZSET of decimal post_id strings scored by timestamp, a packed
+// timeline is a single Redis string holding fixed-width records appended in
+// arrival order (oldest first). A page is one GETRANGE counted from the tail
+// of the string and is decoded with a single memcpy, without per-entry
+// parsing and without the skiplist/dict overhead of a ZSET member.
+//
+// Records are stored in host byte order; all timeline services are expected
+// to run on the same architecture.
+struct PackedTimelineRecord {
+  int64_t timestamp;
+  int64_t post_id;
+};
+static_assert(sizeof(PackedTimelineRecord) == 16,
+              "PackedTimelineRecord must be 16 bytes");
+
+#define PACKED_TIMELINE_DEFAULT_MAX_RECORDS 1024
+
+// KEYS[1]: timeline key, ARGV[1]: encoded record(s), ARGV[2]: cap in bytes.
+// The string is allowed to grow to twice the cap before the oldest records
+// are dropped, so truncation is amortized over many appends.
+static const char *PACKED_TIMELINE_APPEND_SCRIPT =
+    "local len = redis.call('APPEND', KEYS[1], ARGV[1]) "
+    "local cap = tonumber(ARGV[2]) "
+    "if len > 2 * cap then "
+    "  redis.call('SET', KEYS[1], redis.call('GETRANGE', KEYS[1], -cap, -1)) "
+    "  len = cap "
+    "end "
+    "return len";
+
+// KEYS[1]: timeline key, ARGV[1]: encoded records read from MongoDB, ARGV[2]:
+// cap in bytes. Replaces the timeline with ARGV[1] followed by the records
+// the key holds that ARGV[1] lacks, i.e. those appended while MongoDB was
+// read, keeping the newest cap bytes. Records are compared as 16-byte
+// strings, so post_ids above 2^53 are never rounded by Lua.
+static const char *PACKED_TIMELINE_MERGE_SCRIPT =
+    "local merged = {ARGV[1]} "
+    "local seen = {} "
+    "for i = 1, #ARGV[1] - 15, 16 do "
+    "  seen[string.sub(ARGV[1], i, i + 15)] = true "
+    "end "
+    "local cur = redis.call('GET', KEYS[1]) "
+    "if cur then "
+    "  for i = 1, #cur - 15, 16 do "
+    "    local record = string.sub(cur, i, i + 15) "
+    "    if not seen[record] then "
+    "      merged[#merged + 1] = record "
+    "      seen[record] = true "
+    "    end "
+    "  end "
+    "end "
+    "local packed = table.concat(merged) "
+    "local cap = tonumber(ARGV[2]) "
+    "if #packed > cap then "
+    "  packed = string.sub(packed, -cap) "
+    "end "
+    "redis.call('SET', KEYS[1], packed) "
+    "return #packed";
+
+// Kept apart from the ZSET key so that switching layouts never hits WRONGTYPE.
+// The user_id hash tag keeps it in the same cluster slot as the ZSET key and
+// any other per-user keys tagged the same way.
+inline std::string PackedTimelineKey(int64_t user_id) {
+  return "{" + std::to_string(user_id) + "}:packed";
+}
+
+inline std::string EncodePackedTimelineRecord(int64_t timestamp,
+                                              int64_t post_id) {
+  PackedTimelineRecord record{timestamp, post_id};
+  return std::string(reinterpret_cast<const char *>(&record), sizeof(record));
+}
+
+// Encodes records given newest first (the order timelines are read in) into
+// the oldest-first layout stored in Redis.
+inline std::string EncodePackedTimeline(
+    const std::vector<PackedTimelineRecord> &newest_first) {
+  std::string packed(newest_first.size() * sizeof(PackedTimelineRecord), '\0');
+  auto *out = &packed[0];
+  for (auto it = newest_first.rbegin(); it != newest_first.rend(); ++it) {
+    std::memcpy(out, &*it, sizeof(PackedTimelineRecord));
+    out += sizeof(PackedTimelineRecord);
+  }
+  return packed;
+}
+
+// Appends the post_ids in packed to post_ids, newest first. A trailing
+// partial record (which can only come from a corrupted value) is ignored.
+inline void DecodePackedTimeline(const std::string &packed,
+                                 std::vector<int64_t> *post_ids) {
+  size_t n = packed.size() / sizeof(PackedTimelineRecord);
+  if (n == 0) {
+    return;
+  }
+  std::vector<PackedTimelineRecord> records(n);
+  std::memcpy(records.data(), packed.data(), n * sizeof(PackedTimelineRecord));
+  post_ids->reserve(post_ids->size() + n);
+  for (auto it = records.rbegin(); it != records.rend(); ++it) {
+    post_ids->emplace_back(it->post_id);
+  }
+}
+
+// Reads entries [start, stop) of the timeline counted from the newest entry.
+// Works with both Redis and RedisCluster.
+template <typename RedisClient>
+std::string ReadPackedTimelineRange(RedisClient *redis, const std::string &key,
+                                    int start, int stop) {
+  long long record_size = sizeof(PackedTimelineRecord);
+  return redis->getrange(key, -static_cast<long long>(stop) * record_size,
+                         -static_cast<long long>(start) * record_size - 1);
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SRC_PACKEDTIMELINE_H_
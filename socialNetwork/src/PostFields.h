@@ -0,0 +1,91 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_POSTFIELDS_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_POSTFIELDS_H_
+
+#include <cstdint>
+#include <cstring>
+
+#include "../gen-cpp/social_network_types.h"
+
+// Field masks of the fields argument of ReadPosts, ReadHomeTimeline and
+// ReadUserTimeline: bit n - 1 stands for the Post field with Thrift id n. A
+// field outside the mask is left unset, so it is neither decoded nor read
+// from MongoDB nor written on the wire. post_id is always written.
+#define POST_FIELD_POST_ID (1 << 0)
+#define POST_FIELD_CREATOR (1 << 1)
+#define POST_FIELD_REQ_ID (1 << 2)
+#define POST_FIELD_TEXT (1 << 3)
+#define POST_FIELD_USER_MENTIONS (1 << 4)
+#define POST_FIELD_MEDIA (1 << 5)
+#define POST_FIELD_URLS (1 << 6)
+#define POST_FIELD_TIMESTAMP (1 << 7)
+#define POST_FIELD_POST_TYPE (1 << 8)
+#define POST_FIELDS_ALL ((1 << 9) - 1)
+// What a timeline preview shows
+#define POST_FIELDS_PREVIEW                                    \
+  (POST_FIELD_POST_ID | POST_FIELD_CREATOR | POST_FIELD_TEXT | \
+   POST_FIELD_TIMESTAMP)
+
+namespace social_network {
+
+// The post fields, by the name of the field in MongoDB and in the cached
+// JSON
+struct PostFieldName {
+  int32_t field;
+  const char *name;
+};
+
+static const PostFieldName POST_FIELD_NAMES[] = {
+    {POST_FIELD_POST_ID, "post_id"},
+    {POST_FIELD_CREATOR, "creator"},
+    {POST_FIELD_REQ_ID, "req_id"},
+    {POST_FIELD_TEXT, "text"},
+    {POST_FIELD_USER_MENTIONS, "user_mentions"},
+    {POST_FIELD_MEDIA, "media"},
+    {POST_FIELD_URLS, "urls"},
+    {POST_FIELD_TIMESTAMP, "timestamp"},
+    {POST_FIELD_POST_TYPE, "post_type"},
+};
+
+// The bit of the field called name, 0 for anything else, e.g. "_id"
+inline int32_t PostFieldOfName(const char *name, size_t length) {
+  for (auto &field_name : POST_FIELD_NAMES) {
+    if (std::strlen(field_name.name) == length &&
+        std::memcmp(field_name.name, name, length) == 0) {
+      return field_name.field;
+    }
+  }
+  return 0;
+}
+
+// Marks the optional fields of post in fields as set and the others as
+// unset, which decides the fields written on the wire
+inline void SetPostFieldsIsset(int32_t fields, Post *post) {
+  post->__isset.post_id = true;
+  post->__isset.creator = (fields & POST_FIELD_CREATOR) != 0;
+  post->__isset.req_id = (fields & POST_FIELD_REQ_ID) != 0;
+  post->__isset.text = (fields & POST_FIELD_TEXT) != 0;
+  post->__isset.user_mentions = (fields & POST_FIELD_USER_MENTIONS) != 0;
+  post->__isset.media = (fields & POST_FIELD_MEDIA) != 0;
+  post->__isset.urls = (fields & POST_FIELD_URLS) != 0;
+  post->__isset.timestamp = (fields & POST_FIELD_TIMESTAMP) != 0;
+  post->__isset.post_type = (fields & POST_FIELD_POST_TYPE) != 0;
+}
+
+// Resets the fields of post outside fields, for posts read whole, e.g. from
+// a cache of full posts
+inline void ApplyPostFields(int32_t fields, Post *post) {
+  if (!(fields & POST_FIELD_POST_ID)) post->post_id = 0;
+  if (!(fields & POST_FIELD_CREATOR)) post->creator = Creator();
+  if (!(fields & POST_FIELD_REQ_ID)) post->req_id = 0;
+  if (!(fields & POST_FIELD_TEXT)) post->text.clear();
+  if (!(fields & POST_FIELD_USER_MENTIONS)) post->user_mentions.clear();
+  if (!(fields & POST_FIELD_MEDIA)) post->media.clear();
+  if (!(fields & POST_FIELD_URLS)) post->urls.clear();
+  if (!(fields & POST_FIELD_TIMESTAMP)) post->timestamp = 0;
+  if (!(fields & POST_FIELD_POST_TYPE)) post->post_type = (PostType::type)0;
+  SetPostFieldsIsset(fields, post);
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SRC_POSTFIELDS_H_
@@ -0,0 +1,114 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_POSTCODEC_H
+#define SOCIAL_NETWORK_MICROSERVICES_POSTCODEC_H
+
+#include <cinttypes>
+#include <cstdio>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <utility>
+
+#include "../../gen-cpp/social_network_types.h"
+#include "../PostFields.h"
+
+// Longest decimal int64, sign included
+#define POST_KEY_MAX_LENGTH 20
+
+namespace social_network {
+
+// The memcached key of a post, its post_id in decimal, written to buf of at
+// least POST_KEY_MAX_LENGTH + 1 bytes. Returns the length.
+inline size_t FormatPostKey(int64_t post_id, char *buf) {
+  return (size_t)snprintf(buf, POST_KEY_MAX_LENGTH + 1, "%" PRId64, post_id);
+}
+
+// Fills the fields of post in fields from its MongoDB document as
+// bson_as_json renders it, the value cached in memcached, and marks just
+// those as set. Strings are moved out of post_json.
+inline void PostFromJson(nlohmann::json &post_json, Post *post,
+                         int32_t fields = POST_FIELDS_ALL) {
+  if (fields & POST_FIELD_POST_ID) {
+    post->post_id = post_json.at("post_id").get<int64_t>();
+  }
+  if (fields & POST_FIELD_CREATOR) {
+    auto &creator = post_json.at("creator");
+    post->creator.user_id = creator.at("user_id").get<int64_t>();
+    post->creator.username =
+        std::move(creator.at("username").get_ref<std::string &>());
+  }
+  if (fields & POST_FIELD_REQ_ID) {
+    post->req_id = post_json.at("req_id").get<int64_t>();
+  }
+  if (fields & POST_FIELD_TEXT) {
+    post->text = std::move(post_json.at("text").get_ref<std::string &>());
+  }
+  if (fields & POST_FIELD_USER_MENTIONS) {
+    auto &user_mentions = post_json.at("user_mentions");
+    post->user_mentions.resize(user_mentions.size());
+    for (size_t i = 0; i < user_mentions.size(); i++) {
+      post->user_mentions[i].user_id =
+          user_mentions[i].at("user_id").get<int64_t>();
+      post->user_mentions[i].username =
+          std::move(user_mentions[i].at("username").get_ref<std::string &>());
+    }
+  }
+  if (fields & POST_FIELD_MEDIA) {
+    auto &media = post_json.at("media");
+    post->media.resize(media.size());
+    for (size_t i = 0; i < media.size(); i++) {
+      post->media[i].media_id = media[i].at("media_id").get<int64_t>();
+      post->media[i].media_type =
+          std::move(media[i].at("media_type").get_ref<std::string &>());
+    }
+  }
+  if (fields & POST_FIELD_URLS) {
+    auto &urls = post_json.at("urls");
+    post->urls.resize(urls.size());
+    for (size_t i = 0; i < urls.size(); i++) {
+      post->urls[i].shortened_url =
+          std::move(urls[i].at("shortened_url").get_ref<std::string &>());
+      post->urls[i].expanded_url =
+          std::move(urls[i].at("expanded_url").get_ref<std::string &>());
+    }
+  }
+  if (fields & POST_FIELD_TIMESTAMP) {
+    post->timestamp = post_json.at("timestamp").get<int64_t>();
+  }
+  if (fields & POST_FIELD_POST_TYPE) {
+    post->post_type = (PostType::type)post_json.at("post_type").get<int>();
+  }
+  SetPostFieldsIsset(fields, post);
+}
+
+// Parses the size bytes at value in place, e.g. in libmemcached's result
+// buffer, without copying them into a std::string first. The values of
+// top-level keys outside fields are skipped by the parser rather than built
+// and dropped. Returns false if the bytes are not a post, which callers
+// treat as a cache miss.
+inline bool DecodePost(const char *value, size_t size, Post *post,
+                       int32_t fields = POST_FIELDS_ALL) {
+  try {
+    nlohmann::json post_json;
+    if (fields == POST_FIELDS_ALL) {
+      post_json = nlohmann::json::parse(value, value + size);
+    } else {
+      post_json = nlohmann::json::parse(
+          value, value + size,
+          [fields](int depth, nlohmann::json::parse_event_t event,
+                   nlohmann::json &parsed) {
+            if (depth != 1 || event != nlohmann::json::parse_event_t::key) {
+              return true;
+            }
+            auto &key = parsed.get_ref<const std::string &>();
+            return (PostFieldOfName(key.data(), key.size()) & fields) != 0;
+          });
+    }
+    PostFromJson(post_json, post, fields);
+  } catch (const nlohmann::json::exception &) {
+    return false;
+  }
+  return true;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_POSTCODEC_H
@@ -0,0 +1,183 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_POSTCOMPRESSOR_H
+#define SOCIAL_NETWORK_MICROSERVICES_POSTCOMPRESSOR_H
+
+#include <zstd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include "../logger.h"
+
+// memcached item flag of post values compressed with the dictionary
+#define POST_VALUE_FLAG_ZSTD 1
+#define POST_COMPRESSION_DEFAULT_LEVEL 3
+// Values shorter than this are cached as they are: a frame header and a
+// compression call cost more than the few bytes it could save
+#define POST_COMPRESSION_DEFAULT_MIN_BYTES 128
+// Larger frames are not posts, so are not decompressed
+#define POST_COMPRESSION_MAX_VALUE_BYTES (1 << 24)
+#define POST_COMPRESSION_LOG_INTERVAL 10000
+
+namespace social_network {
+
+// Compresses the post values cached in memcached with a zstd dictionary
+// trained by TrainPostDictionary. The dictionary ID, which zstd writes into
+// every frame, is the dictionary's version: a frame of another dictionary
+// does not decompress and reads as a cache miss, so a new dictionary
+// replaces the old one entry by entry as posts are read again.
+class PostCompressor {
+ public:
+  ~PostCompressor();
+
+  // The dictionary in the file at path, nullptr if it cannot be read or is
+  // not a zstd dictionary with an ID
+  static std::unique_ptr<PostCompressor> Load(const std::string &path,
+                                              int level, size_t min_bytes);
+
+  unsigned DictionaryId() const;
+
+  // Returns true with value compressed into *compressed, or false if value
+  // is shorter than min_bytes or does not shrink, to be cached as it is
+  bool Compress(const char *value, size_t size, std::string *compressed);
+
+  // Returns true with the frame at compressed decompressed into *value, or
+  // false if it is not a frame of this dictionary
+  bool Decompress(const char *compressed, size_t size, std::string *value);
+
+ private:
+  PostCompressor(ZSTD_CDict *cdict, ZSTD_DDict *ddict, unsigned dictionary_id,
+                 size_t min_bytes);
+  void _Count(size_t raw_bytes, size_t cached_bytes, bool compressed);
+
+  ZSTD_CDict *_cdict;
+  ZSTD_DDict *_ddict;
+  unsigned _dictionary_id;
+  size_t _min_bytes;
+
+  std::atomic<int64_t> _values{0};
+  std::atomic<int64_t> _compressed{0};
+  std::atomic<int64_t> _raw_bytes{0};
+  std::atomic<int64_t> _cached_bytes{0};
+};
+
+// This thread's zstd contexts. Unlike the digested dictionaries, contexts
+// cannot be shared between threads.
+struct ZstdContexts {
+  ZSTD_CCtx *cctx = ZSTD_createCCtx();
+  ZSTD_DCtx *dctx = ZSTD_createDCtx();
+  ~ZstdContexts() {
+    ZSTD_freeCCtx(cctx);
+    ZSTD_freeDCtx(dctx);
+  }
+};
+
+inline ZstdContexts &ThreadZstdContexts() {
+  thread_local ZstdContexts contexts;
+  return contexts;
+}
+
+PostCompressor::PostCompressor(ZSTD_CDict *cdict, ZSTD_DDict *ddict,
+                               unsigned dictionary_id, size_t min_bytes) {
+  _cdict = cdict;
+  _ddict = ddict;
+  _dictionary_id = dictionary_id;
+  _min_bytes = min_bytes;
+}
+
+PostCompressor::~PostCompressor() {
+  ZSTD_freeCDict(_cdict);
+  ZSTD_freeDDict(_ddict);
+}
+
+std::unique_ptr<PostCompressor> PostCompressor::Load(const std::string &path,
+                                                     int level,
+                                                     size_t min_bytes) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    LOG(error) << "Cannot open post dictionary " << path;
+    return nullptr;
+  }
+  std::string dictionary((std::istreambuf_iterator<char>(file)),
+                         std::istreambuf_iterator<char>());
+  unsigned dictionary_id =
+      ZSTD_getDictID_fromDict(dictionary.data(), dictionary.size());
+  if (dictionary_id == 0) {
+    LOG(error) << path << " is not a zstd dictionary with an ID";
+    return nullptr;
+  }
+  ZSTD_CDict *cdict =
+      ZSTD_createCDict(dictionary.data(), dictionary.size(), level);
+  ZSTD_DDict *ddict = ZSTD_createDDict(dictionary.data(), dictionary.size());
+  if (!cdict || !ddict) {
+    LOG(error) << "Cannot load post dictionary " << path;
+    ZSTD_freeCDict(cdict);
+    ZSTD_freeDDict(ddict);
+    return nullptr;
+  }
+  LOG(info) << "Compressing cached posts with dictionary " << dictionary_id
+            << " (" << dictionary.size() << " bytes) at level " << level
+            << ", from " << min_bytes << " bytes";
+  return std::unique_ptr<PostCompressor>(
+      new PostCompressor(cdict, ddict, dictionary_id, min_bytes));
+}
+
+unsigned PostCompressor::DictionaryId() const { return _dictionary_id; }
+
+bool PostCompressor::Compress(const char *value, size_t size,
+                              std::string *compressed) {
+  if (size < _min_bytes) {
+    _Count(size, size, false);
+    return false;
+  }
+  size_t bound = ZSTD_compressBound(size);
+  compressed->resize(bound);
+  size_t compressed_size =
+      ZSTD_compress_usingCDict(ThreadZstdContexts().cctx, &(*compressed)[0],
+                               bound, value, size, _cdict);
+  if (ZSTD_isError(compressed_size) || compressed_size >= size) {
+    _Count(size, size, false);
+    return false;
+  }
+  compressed->resize(compressed_size);
+  _Count(size, compressed_size, true);
+  return true;
+}
+
+bool PostCompressor::Decompress(const char *compressed, size_t size,
+                                std::string *value) {
+  if (ZSTD_getDictID_fromFrame(compressed, size) != _dictionary_id) {
+    return false;
+  }
+  unsigned long long value_size = ZSTD_getFrameContentSize(compressed, size);
+  if (value_size == ZSTD_CONTENTSIZE_UNKNOWN ||
+      value_size == ZSTD_CONTENTSIZE_ERROR ||
+      value_size > POST_COMPRESSION_MAX_VALUE_BYTES) {
+    return false;
+  }
+  value->resize(value_size);
+  size_t decompressed_size =
+      ZSTD_decompress_usingDDict(ThreadZstdContexts().dctx, &(*value)[0],
+                                 value_size, compressed, size, _ddict);
+  return !ZSTD_isError(decompressed_size) && decompressed_size == value_size;
+}
+
+void PostCompressor::_Count(size_t raw_bytes, size_t cached_bytes,
+                            bool compressed) {
+  int64_t raw_total = _raw_bytes += raw_bytes;
+  int64_t cached_total = _cached_bytes += cached_bytes;
+  int64_t compressed_total = compressed ? ++_compressed : _compressed.load();
+  int64_t values = ++_values;
+  if (values % POST_COMPRESSION_LOG_INTERVAL == 0) {
+    LOG(info) << "Post compression: " << values << " values cached, "
+              << 100.0 * compressed_total / values << "% compressed, ratio "
+              << (double)raw_total / cached_total;
+  }
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_POSTCOMPRESSOR_H
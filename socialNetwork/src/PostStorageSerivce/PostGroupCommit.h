@@ -0,0 +1,254 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_POSTGROUPCOMMIT_H
+#define SOCIAL_NETWORK_MICROSERVICES_POSTGROUPCOMMIT_H
+
+#include <bson/bson.h>
+#include <mongoc.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../../gen-cpp/social_network_types.h"
+#include "../logger.h"
+
+#define POST_GROUP_COMMIT_DEFAULT_MAX_BATCH 64
+#define POST_GROUP_COMMIT_DEFAULT_MAX_DELAY_US 1000
+#define POST_GROUP_COMMIT_DEFAULT_FLUSHERS 2
+#define POST_GROUP_COMMIT_LOG_INTERVAL 10000
+
+namespace social_network {
+
+// Writes docs to post.post with one unordered insert_many, so that a
+// rejected document, e.g. a duplicate post_id, does not hold back the
+// others. (*errors)[i] is why docs[i] was not written, empty if it was.
+// Returns false if the write failed as a whole, which is logged here and
+// reported for every document.
+inline bool InsertPostDocs(mongoc_client_pool_t *mongodb_client_pool,
+                           std::vector<const bson_t *> docs,
+                           std::vector<std::string> *errors) {
+  errors->assign(docs.size(), std::string());
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(mongodb_client_pool);
+  if (!mongodb_client) {
+    errors->assign(docs.size(), "Failed to pop a client from MongoDB pool");
+    return false;
+  }
+  auto collection =
+      mongoc_client_get_collection(mongodb_client, "post", "post");
+  if (!collection) {
+    mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+    errors->assign(docs.size(),
+                   "Failed to create collection post from DB post");
+    return false;
+  }
+
+  bson_t *opts = BCON_NEW("ordered", BCON_BOOL(false));
+  bson_t reply;
+  bson_error_t error;
+  bool ok = mongoc_collection_insert_many(collection, docs.data(), docs.size(),
+                                          opts, &reply, &error);
+
+  // An unordered insert_many reports the documents it rejected in
+  // "writeErrors", by their index in docs
+  bool item_errors = false;
+  bson_iter_t iter;
+  bson_iter_t iter_errors;
+  if (!ok && bson_iter_init_find(&iter, &reply, "writeErrors") &&
+      BSON_ITER_HOLDS_ARRAY(&iter) && bson_iter_recurse(&iter, &iter_errors)) {
+    while (bson_iter_next(&iter_errors)) {
+      bson_iter_t iter_error;
+      if (!BSON_ITER_HOLDS_DOCUMENT(&iter_errors) ||
+          !bson_iter_recurse(&iter_errors, &iter_error)) {
+        continue;
+      }
+      int64_t index = -1;
+      std::string errmsg = error.message;
+      while (bson_iter_next(&iter_error)) {
+        const char *field = bson_iter_key(&iter_error);
+        if (std::strcmp(field, "index") == 0) {
+          index = bson_iter_as_int64(&iter_error);
+        } else if (std::strcmp(field, "errmsg") == 0 &&
+                   BSON_ITER_HOLDS_UTF8(&iter_error)) {
+          errmsg = bson_iter_utf8(&iter_error, nullptr);
+        }
+      }
+      if (index >= 0 && (size_t)index < docs.size()) {
+        (*errors)[index] = errmsg.empty() ? "Insert rejected" : errmsg;
+        item_errors = true;
+      }
+    }
+  }
+  bson_destroy(&reply);
+  bson_destroy(opts);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+
+  if (!ok && !item_errors) {
+    LOG(error) << "Failed to insert " << docs.size()
+               << " posts to MongoDB: " << error.message;
+    errors->assign(docs.size(), error.message);
+    return false;
+  }
+  return true;
+}
+
+// Group commit of post inserts. Insert queues a document and blocks until a
+// flusher thread has written it with the documents queued alongside: each
+// flusher takes up to max_batch documents once that many are queued, or
+// once the oldest has waited max_delay_us, and writes them with one
+// unordered insert_many. Every caller is completed on its own, so one
+// rejected document, e.g. a duplicate post_id, fails only its own Insert.
+//
+// A larger max_batch or max_delay_us trades insert latency for fewer MongoDB
+// round trips and pooled clients per post; more flushers keep batches of
+// several clients in flight at once.
+class PostGroupCommit {
+ public:
+  PostGroupCommit(mongoc_client_pool_t *mongodb_client_pool, int max_batch,
+                  int max_delay_us, int num_flushers);
+
+  // Starts the flusher threads, which run for the life of the process
+  void Start();
+
+  // Writes doc to post.post. Throws ServiceException if it was not written.
+  // doc stays owned by the caller, who is blocked until it has been written.
+  void Insert(const bson_t *doc);
+
+ private:
+  struct Pending {
+    const bson_t *doc;
+    std::chrono::steady_clock::time_point queued_at;
+    std::promise<void> written;
+  };
+
+  void _Flush();
+  void _Write(std::vector<Pending *> *batch);
+
+  mongoc_client_pool_t *_mongodb_client_pool;
+  size_t _max_batch;
+  std::chrono::microseconds _max_delay;
+  int _num_flushers;
+
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque<Pending *> _queue;
+
+  std::atomic<int64_t> _batches{0};
+  std::atomic<int64_t> _docs{0};
+};
+
+PostGroupCommit::PostGroupCommit(mongoc_client_pool_t *mongodb_client_pool,
+                                 int max_batch, int max_delay_us,
+                                 int num_flushers) {
+  _mongodb_client_pool = mongodb_client_pool;
+  _max_batch = std::max(max_batch, 1);
+  _max_delay = std::chrono::microseconds(std::max(max_delay_us, 0));
+  _num_flushers = std::max(num_flushers, 1);
+}
+
+void PostGroupCommit::Start() {
+  for (int i = 0; i < _num_flushers; i++) {
+    std::thread([this]() {
+      while (true) {
+        _Flush();
+      }
+    }).detach();
+  }
+  LOG(info) << "Group-committing post inserts: up to " << _max_batch
+            << " per batch, after at most " << _max_delay.count()
+            << " us, with " << _num_flushers << " flushers";
+}
+
+void PostGroupCommit::Insert(const bson_t *doc) {
+  Pending pending;
+  pending.doc = doc;
+  pending.queued_at = std::chrono::steady_clock::now();
+  auto written = pending.written.get_future();
+  size_t queued;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _queue.emplace_back(&pending);
+    queued = _queue.size();
+  }
+  // A flusher waits for the first document, then for a full batch
+  if (queued == 1 || queued == _max_batch) {
+    _cv.notify_one();
+  }
+  written.get();
+}
+
+void PostGroupCommit::_Flush() {
+  std::vector<Pending *> batch;
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [this]() { return !_queue.empty(); });
+    auto deadline = _queue.front()->queued_at + _max_delay;
+    _cv.wait_until(lock, deadline, [this]() {
+      return _queue.empty() || _queue.size() >= _max_batch;
+    });
+    size_t size = std::min(_queue.size(), _max_batch);
+    batch.assign(_queue.begin(), _queue.begin() + size);
+    _queue.erase(_queue.begin(), _queue.begin() + size);
+    // Wakes another flusher for what is left over
+    if (!_queue.empty()) {
+      _cv.notify_one();
+    }
+  }
+  if (!batch.empty()) {
+    _Write(&batch);
+  }
+}
+
+void PostGroupCommit::_Write(std::vector<Pending *> *batch) {
+  std::vector<const bson_t *> docs(batch->size());
+  for (size_t i = 0; i < batch->size(); i++) {
+    docs[i] = (*batch)[i]->doc;
+  }
+  // A write that failed as a whole is logged by InsertPostDocs, a document
+  // it rejected is logged here. Every caller is completed even if the write
+  // throws, or it would wait forever.
+  std::vector<std::string> errors;
+  bool write_ok;
+  try {
+    write_ok = InsertPostDocs(_mongodb_client_pool, std::move(docs), &errors);
+  } catch (const std::exception &e) {
+    LOG(error) << "Failed to insert " << batch->size()
+               << " posts to MongoDB: " << e.what();
+    errors.assign(batch->size(), e.what());
+    write_ok = false;
+  }
+  for (size_t i = 0; i < batch->size(); i++) {
+    if (errors[i].empty()) {
+      (*batch)[i]->written.set_value();
+      continue;
+    }
+    if (write_ok) {
+      LOG(error) << "Failed to insert post to MongoDB: " << errors[i];
+    }
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = errors[i];
+    (*batch)[i]->written.set_exception(std::make_exception_ptr(se));
+  }
+
+  int64_t docs_total = _docs += batch->size();
+  int64_t batches = ++_batches;
+  if (batches % POST_GROUP_COMMIT_LOG_INTERVAL == 0) {
+    LOG(info) << "Post group commit: " << batches << " batches, "
+              << (double)docs_total / batches << " posts per batch";
+  }
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_POSTGROUPCOMMIT_H
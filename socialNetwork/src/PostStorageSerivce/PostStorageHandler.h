@@ -6,76 +6,106 @@
 #include <libmemcached/util.h>
 #include <mongoc.h>
 
+#include <algorithm>
+#include <cstring>
 #include <future>
 #include <iostream>
 #include <nlohmann/json.hpp>
 #include <string>
 
 #include "../../gen-cpp/PostStorageService.h"
+#include "../MongoIndexes.h"
 #include "../logger.h"
 #include "../tracing.h"
+#include "PostCodec.h"
+#include "PostCompressor.h"
+#include "PostGroupCommit.h"
 
 namespace social_network {
 using json = nlohmann::json;
 
 class PostStorageHandler : public PostStorageServiceIf {
  public:
-  PostStorageHandler(memcached_pool_st *, mongoc_client_pool_t *);
+  PostStorageHandler(memcached_pool_st *, mongoc_client_pool_t *,
+                     PostCompressor *compressor = nullptr,
+                     PostGroupCommit *group_commit = nullptr);
   ~PostStorageHandler() override = default;
 
   void StorePost(int64_t req_id, const Post &post,
                  const std::map<std::string, std::string> &carrier) override;
 
+  void StorePosts(std::vector<std::string> &_return, int64_t req_id,
+                  const std::vector<Post> &posts,
+                  const std::map<std::string, std::string> &carrier) override;
+
   void ReadPost(Post &_return, int64_t req_id, int64_t post_id,
                 const std::map<std::string, std::string> &carrier) override;
 
   void ReadPosts(std::vector<Post> &_return, int64_t req_id,
                  const std::vector<int64_t> &post_ids,
-                 const std::map<std::string, std::string> &carrier) override;
+                 const std::map<std::string, std::string> &carrier,
+                 int32_t fields) override;
+
+  // MongoDB indexes this handler's queries rely on, and sample queries of
+  // each shape it issues, for SetUpMongoIndexes
+  static std::vector<MongoIndexSpec> IndexSpecs();
+  static std::vector<MongoQueryShape> QueryShapes();
 
  private:
   memcached_pool_st *_memcached_client_pool;
   mongoc_client_pool_t *_mongodb_client_pool;
+  PostCompressor *_compressor;
+  PostGroupCommit *_group_commit;
+
+  // Decodes a value read from memcached with its item flags
+  bool _DecodeCached(const char *value, size_t size, uint32_t flags,
+                     Post *post, int32_t fields);
+  // Compresses *value in place when compression is on and pays, and returns
+  // the memcached item flags to store it with
+  uint32_t _EncodeForCache(std::string *value);
+  // The MongoDB document of post, to be destroyed by the caller
+  static bson_t *_NewPostDoc(const Post &post);
+  // The MongoDB filters of ReadPost and ReadPosts, also used by QueryShapes,
+  // to be destroyed by the caller
+  static bson_t *_NewPostIdQuery(int64_t post_id);
+  static bson_t *_NewPostIdsQuery(const std::vector<int64_t> &post_ids);
 };
 
 PostStorageHandler::PostStorageHandler(
     memcached_pool_st *memcached_client_pool,
-    mongoc_client_pool_t *mongodb_client_pool) {
+    mongoc_client_pool_t *mongodb_client_pool, PostCompressor *compressor,
+    PostGroupCommit *group_commit) {
   _memcached_client_pool = memcached_client_pool;
   _mongodb_client_pool = mongodb_client_pool;
+  _compressor = compressor;
+  _group_commit = group_commit;
 }
 
-void PostStorageHandler::StorePost(
-    int64_t req_id, const social_network::Post &post,
-    const std::map<std::string, std::string> &carrier) {
-  // Initialize a span
-  TextMapReader reader(carrier);
-  std::map<std::string, std::string> writer_text_map;
-  TextMapWriter writer(writer_text_map);
-  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
-  auto span = opentracing::Tracer::Global()->StartSpan(
-      "store_post_server", {opentracing::ChildOf(parent_span->get())});
-  opentracing::Tracer::Global()->Inject(span->context(), writer);
-
-  mongoc_client_t *mongodb_client =
-      mongoc_client_pool_pop(_mongodb_client_pool);
-  if (!mongodb_client) {
-    ServiceException se;
-    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-    se.message = "Failed to pop a client from MongoDB pool";
-    throw se;
+bool PostStorageHandler::_DecodeCached(const char *value, size_t size,
+                                       uint32_t flags, Post *post,
+                                       int32_t fields) {
+  if (!(flags & POST_VALUE_FLAG_ZSTD)) {
+    return DecodePost(value, size, post, fields);
   }
+  // DecodePost moves strings out of its parse, not out of this buffer, so
+  // the buffer is reused across values
+  thread_local std::string decompressed;
+  return _compressor &&
+         _compressor->Decompress(value, size, &decompressed) &&
+         DecodePost(decompressed.data(), decompressed.size(), post, fields);
+}
 
-  auto collection =
-      mongoc_client_get_collection(mongodb_client, "post", "post");
-  if (!collection) {
-    ServiceException se;
-    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-    se.message = "Failed to create collection user from DB user";
-    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-    throw se;
+uint32_t PostStorageHandler::_EncodeForCache(std::string *value) {
+  std::string compressed;
+  if (!_compressor ||
+      !_compressor->Compress(value->data(), value->size(), &compressed)) {
+    return 0;
   }
+  *value = std::move(compressed);
+  return POST_VALUE_FLAG_ZSTD;
+}
 
+bson_t *PostStorageHandler::_NewPostDoc(const Post &post) {
   bson_t *new_doc = bson_new();
   BSON_APPEND_INT64(new_doc, "post_id", post.post_id);
   BSON_APPEND_INT64(new_doc, "timestamp", post.timestamp);
@@ -134,6 +164,60 @@ void PostStorageHandler::StorePost(
     idx++;
   }
   bson_append_array_end(new_doc, &media_list);
+  return new_doc;
+}
+
+void PostStorageHandler::StorePost(
+    int64_t req_id, const social_network::Post &post,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "store_post_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  bson_t *new_doc = _NewPostDoc(post);
+
+  if (_group_commit) {
+    auto insert_span = opentracing::Tracer::Global()->StartSpan(
+        "post_storage_mongo_group_insert_client",
+        {opentracing::ChildOf(&span->context())});
+    try {
+      _group_commit->Insert(new_doc);
+    } catch (...) {
+      insert_span->Finish();
+      bson_destroy(new_doc);
+      throw;
+    }
+    insert_span->Finish();
+    bson_destroy(new_doc);
+    span->Finish();
+    return;
+  }
+
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(_mongodb_client_pool);
+  if (!mongodb_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    bson_destroy(new_doc);
+    throw se;
+  }
+
+  auto collection =
+      mongoc_client_get_collection(mongodb_client, "post", "post");
+  if (!collection) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to create collection user from DB user";
+    bson_destroy(new_doc);
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
 
   bson_error_t error;
   auto insert_span = opentracing::Tracer::Global()->StartSpan(
@@ -161,6 +245,54 @@ void PostStorageHandler::StorePost(
   span->Finish();
 }
 
+// One unordered insert_many of all the posts, so that a rejected post, e.g.
+// one whose post_id is already stored, fails alone. Group commit is not
+// used: the posts are already batched.
+void PostStorageHandler::StorePosts(
+    std::vector<std::string> &_return, int64_t req_id,
+    const std::vector<Post> &posts,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "store_posts_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  if (posts.empty()) {
+    _return.clear();
+    span->Finish();
+    return;
+  }
+
+  std::vector<bson_t *> docs;
+  docs.reserve(posts.size());
+  for (auto &post : posts) {
+    docs.emplace_back(_NewPostDoc(post));
+  }
+  auto insert_span = opentracing::Tracer::Global()->StartSpan(
+      "post_storage_mongo_insert_many_client",
+      {opentracing::ChildOf(&span->context())});
+  try {
+    InsertPostDocs(_mongodb_client_pool,
+                   std::vector<const bson_t *>(docs.begin(), docs.end()),
+                   &_return);
+  } catch (...) {
+    insert_span->Finish();
+    for (auto *doc : docs) {
+      bson_destroy(doc);
+    }
+    throw;
+  }
+  insert_span->Finish();
+  for (auto *doc : docs) {
+    bson_destroy(doc);
+  }
+  span->Finish();
+}
+
 void PostStorageHandler::ReadPost(
     Post &_return, int64_t req_id, int64_t post_id,
     const std::map<std::string, std::string> &carrier) {
@@ -202,37 +334,19 @@ void PostStorageHandler::ReadPost(
   memcached_pool_push(_memcached_client_pool, memcached_client);
   get_span->Finish();
 
+  bool cached = false;
   if (post_mmc) {
-    LOG(debug) << "Get post " << post_id << " cache hit from Memcached";
-    json post_json =
-        json::parse(std::string(post_mmc, post_mmc + post_mmc_size));
-    _return.req_id = post_json["req_id"];
-    _return.timestamp = post_json["timestamp"];
-    _return.post_id = post_json["post_id"];
-    _return.creator.user_id = post_json["creator"]["user_id"];
-    _return.creator.username = post_json["creator"]["username"];
-    _return.post_type = post_json["post_type"];
-    _return.text = post_json["text"];
-    for (auto &item : post_json["media"]) {
-      Media media;
-      media.media_id = item["media_id"];
-      media.media_type = item["media_type"];
-      _return.media.emplace_back(media);
-    }
-    for (auto &item : post_json["user_mentions"]) {
-      UserMention user_mention;
-      user_mention.username = item["username"];
-      user_mention.user_id = item["user_id"];
-      _return.user_mentions.emplace_back(user_mention);
-    }
-    for (auto &item : post_json["urls"]) {
-      Url url;
-      url.shortened_url = item["shortened_url"];
-      url.expanded_url = item["expanded_url"];
-      _return.urls.emplace_back(url);
+    cached = _DecodeCached(post_mmc, post_mmc_size, memcached_flags, &_return,
+                           POST_FIELDS_ALL);
+    if (cached) {
+      LOG(debug) << "Get post " << post_id << " cache hit from Memcached";
+    } else {
+      LOG(warning) << "Post " << post_id
+                   << " in Memcached cannot be decoded";
     }
     free(post_mmc);
-  } else {
+  }
+  if (!cached) {
     // If not cached in memcached
     mongoc_client_t *mongodb_client =
         mongoc_client_pool_pop(_mongodb_client_pool);
@@ -253,8 +367,7 @@ void PostStorageHandler::ReadPost(
       throw se;
     }
 
-    bson_t *query = bson_new();
-    BSON_APPEND_INT64(query, "post_id", post_id);
+    bson_t *query = _NewPostIdQuery(post_id);
     auto find_span = opentracing::Tracer::Global()->StartSpan(
         "post_storage_mongo_find_client",
         {opentracing::ChildOf(&span->context())});
@@ -291,31 +404,7 @@ void PostStorageHandler::ReadPost(
       LOG(debug) << "Post_id: " << post_id << " found in MongoDB";
       auto post_json_char = bson_as_json(doc, nullptr);
       json post_json = json::parse(post_json_char);
-      _return.req_id = post_json["req_id"];
-      _return.timestamp = post_json["timestamp"];
-      _return.post_id = post_json["post_id"];
-      _return.creator.user_id = post_json["creator"]["user_id"];
-      _return.creator.username = post_json["creator"]["username"];
-      _return.post_type = post_json["post_type"];
-      _return.text = post_json["text"];
-      for (auto &item : post_json["media"]) {
-        Media media;
-        media.media_id = item["media_id"];
-        media.media_type = item["media_type"];
-        _return.media.emplace_back(media);
-      }
-      for (auto &item : post_json["user_mentions"]) {
-        UserMention user_mention;
-        user_mention.username = item["username"];
-        user_mention.user_id = item["user_id"];
-        _return.user_mentions.emplace_back(user_mention);
-      }
-      for (auto &item : post_json["urls"]) {
-        Url url;
-        url.shortened_url = item["shortened_url"];
-        url.expanded_url = item["expanded_url"];
-        _return.urls.emplace_back(url);
-      }
+      PostFromJson(post_json, &_return);
       bson_destroy(query);
       mongoc_cursor_destroy(cursor);
       mongoc_collection_destroy(collection);
@@ -334,10 +423,12 @@ void PostStorageHandler::ReadPost(
           "post_storage_mmc_set_client",
           {opentracing::ChildOf(&span->context())});
 
-      memcached_rc = memcached_set(
-          memcached_client, post_id_str.c_str(), post_id_str.length(),
-          post_json_char, std::strlen(post_json_char), static_cast<time_t>(0),
-          static_cast<uint32_t>(0));
+      std::string value(post_json_char);
+      uint32_t flags = _EncodeForCache(&value);
+      memcached_rc = memcached_set(memcached_client, post_id_str.c_str(),
+                                   post_id_str.length(), value.data(),
+                                   value.size(), static_cast<time_t>(0),
+                                   flags);
       if (memcached_rc != MEMCACHED_SUCCESS) {
         LOG(warning) << "Failed to set post to Memcached: "
                      << memcached_strerror(memcached_client, memcached_rc);
@@ -350,10 +441,18 @@ void PostStorageHandler::ReadPost(
 
   span->Finish();
 }
+
+// Cache hits are decoded in place from one reused memcached_result_st and
+// placed by index into a pre-sized vector, and the keys share one buffer, so
+// the allocations of a call are those of the posts themselves.
+// Only the fields in fields are decoded from memcached and read from
+// MongoDB. Posts read whole from MongoDB are cached; those read through a
+// projection are not, as the cache holds full posts only.
 void PostStorageHandler::ReadPosts(
     std::vector<Post> &_return, int64_t req_id,
     const std::vector<int64_t> &post_ids,
-    const std::map<std::string, std::string> &carrier) {
+    const std::map<std::string, std::string> &carrier, int32_t fields) {
+  fields &= POST_FIELDS_ALL;
   // Initialize a span
   TextMapReader reader(carrier);
   std::map<std::string, std::string> writer_text_map;
@@ -368,15 +467,45 @@ void PostStorageHandler::ReadPosts(
     return;
   }
 
-  std::set<int64_t> post_ids_not_cached(post_ids.begin(), post_ids.end());
-  if (post_ids_not_cached.size() != post_ids.size()) {
-    LOG(error)<< "Post_ids are duplicated";
+  // (post_id, index in post_ids), sorted, to place each post found
+  std::vector<std::pair<int64_t, size_t>> positions(post_ids.size());
+  for (size_t i = 0; i < post_ids.size(); ++i) {
+    positions[i] = {post_ids[i], i};
+  }
+  std::sort(positions.begin(), positions.end());
+  auto duplicate = std::adjacent_find(
+      positions.begin(), positions.end(),
+      [](const std::pair<int64_t, size_t> &a,
+         const std::pair<int64_t, size_t> &b) { return a.first == b.first; });
+  if (duplicate != positions.end()) {
+    LOG(error) << "Post_ids are duplicated";
     ServiceException se;
     se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
     se.message = "Post_ids are duplicated";
     throw se;
   }
-  std::map<int64_t, Post> return_map;
+  auto position_of = [&](int64_t post_id) -> size_t {
+    auto it = std::lower_bound(positions.begin(), positions.end(),
+                               std::make_pair(post_id, (size_t)0));
+    if (it == positions.end() || it->first != post_id) {
+      return post_ids.size();
+    }
+    return it->second;
+  };
+
+  std::vector<Post> posts(post_ids.size());
+  std::vector<bool> found(post_ids.size(), false);
+  size_t num_found = 0;
+
+  std::vector<char> key_buffer(post_ids.size() * (POST_KEY_MAX_LENGTH + 1));
+  std::vector<const char *> keys(post_ids.size());
+  std::vector<size_t> key_sizes(post_ids.size());
+  for (size_t i = 0; i < post_ids.size(); ++i) {
+    char *key = key_buffer.data() + i * (POST_KEY_MAX_LENGTH + 1);
+    key_sizes[i] = FormatPostKey(post_ids[i], key);
+    keys[i] = key;
+  }
+
   memcached_return_t memcached_rc;
   auto memcached_client =
       memcached_pool_pop(_memcached_client_pool, true, &memcached_rc);
@@ -386,21 +515,10 @@ void PostStorageHandler::ReadPosts(
     se.message = "Failed to pop a client from memcached pool";
     throw se;
   }
-
-  char **keys;
-  size_t *key_sizes;
-  keys = new char *[post_ids.size()];
-  key_sizes = new size_t[post_ids.size()];
-  int idx = 0;
-  for (auto &post_id : post_ids) {
-    std::string key_str = std::to_string(post_id);
-    keys[idx] = new char[key_str.length() + 1];
-    strcpy(keys[idx], key_str.c_str());
-    key_sizes[idx] = key_str.length();
-    idx++;
-  }
-  memcached_rc =
-      memcached_mget(memcached_client, keys, key_sizes, post_ids.size());
+  auto get_span = opentracing::Tracer::Global()->StartSpan(
+      "post_storage_mmc_mget_client", {opentracing::ChildOf(&span->context())});
+  memcached_rc = memcached_mget(memcached_client, keys.data(),
+                                key_sizes.data(), post_ids.size());
   if (memcached_rc != MEMCACHED_SUCCESS) {
     LOG(error) << "Cannot get post_ids of request " << req_id << ": "
                << memcached_strerror(memcached_client, memcached_rc);
@@ -411,24 +529,11 @@ void PostStorageHandler::ReadPosts(
     throw se;
   }
 
-  char return_key[MEMCACHED_MAX_KEY];
-  size_t return_key_length;
-  char *return_value;
-  size_t return_value_length;
-  uint32_t flags;
-  auto get_span = opentracing::Tracer::Global()->StartSpan(
-      "post_storage_mmc_mget_client", {opentracing::ChildOf(&span->context())});
-
-  while (true) {
-    return_value =
-        memcached_fetch(memcached_client, return_key, &return_key_length,
-                        &return_value_length, &flags, &memcached_rc);
-    if (return_value == nullptr) {
-      LOG(debug) << "Memcached mget finished";
-      break;
-    }
+  memcached_result_st result;
+  memcached_result_create(memcached_client, &result);
+  while (memcached_fetch_result(memcached_client, &result, &memcached_rc)) {
     if (memcached_rc != MEMCACHED_SUCCESS) {
-      free(return_value);
+      memcached_result_free(&result);
       memcached_quit(memcached_client);
       memcached_pool_push(_memcached_client_pool, memcached_client);
       LOG(error) << "Cannot get posts of request " << req_id;
@@ -437,52 +542,37 @@ void PostStorageHandler::ReadPosts(
       se.message = "Cannot get posts of request " + std::to_string(req_id);
       throw se;
     }
-    Post new_post;
-    json post_json = json::parse(
-        std::string(return_value, return_value + return_value_length));
-    new_post.req_id = post_json["req_id"];
-    new_post.timestamp = post_json["timestamp"];
-    new_post.post_id = post_json["post_id"];
-    new_post.creator.user_id = post_json["creator"]["user_id"];
-    new_post.creator.username = post_json["creator"]["username"];
-    new_post.post_type = post_json["post_type"];
-    new_post.text = post_json["text"];
-    for (auto &item : post_json["media"]) {
-      Media media;
-      media.media_id = item["media_id"];
-      media.media_type = item["media_type"];
-      new_post.media.emplace_back(media);
+    char key[POST_KEY_MAX_LENGTH + 1];
+    size_t key_length = std::min(memcached_result_key_length(&result),
+                                 (size_t)POST_KEY_MAX_LENGTH);
+    memcpy(key, memcached_result_key_value(&result), key_length);
+    key[key_length] = '\0';
+    size_t i = position_of(std::strtoll(key, nullptr, 10));
+    if (i == post_ids.size() || found[i]) {
+      continue;
     }
-    for (auto &item : post_json["user_mentions"]) {
-      UserMention user_mention;
-      user_mention.username = item["username"];
-      user_mention.user_id = item["user_id"];
-      new_post.user_mentions.emplace_back(user_mention);
-    }
-    for (auto &item : post_json["urls"]) {
-      Url url;
-      url.shortened_url = item["shortened_url"];
-      url.expanded_url = item["expanded_url"];
-      new_post.urls.emplace_back(url);
+    if (_DecodeCached(memcached_result_value(&result),
+                      memcached_result_length(&result),
+                      memcached_result_flags(&result), &posts[i], fields)) {
+      found[i] = true;
+      num_found++;
+    } else {
+      LOG(warning) << "Post " << post_ids[i]
+                   << " in Memcached cannot be decoded";
     }
-    return_map.insert(std::make_pair(new_post.post_id, new_post));
-    post_ids_not_cached.erase(new_post.post_id);
-    free(return_value);
   }
+  LOG(debug) << "Memcached mget finished";
+  memcached_result_free(&result);
   get_span->Finish();
   memcached_quit(memcached_client);
   memcached_pool_push(_memcached_client_pool, memcached_client);
-  for (int i = 0; i < post_ids.size(); ++i) {
-    delete keys[i];
-  }
-  delete[] keys;
-  delete[] key_sizes;
 
   std::vector<std::future<void>> set_futures;
-  std::map<int64_t, std::string> post_json_map;
+  // (key, JSON) of the posts read from MongoDB, to cache
+  std::vector<std::pair<std::string, std::string>> posts_to_cache;
 
   // Find the rest in MongoDB
-  if (!post_ids_not_cached.empty()) {
+  if (num_found < post_ids.size()) {
     mongoc_client_t *mongodb_client =
         mongoc_client_pool_pop(_mongodb_client_pool);
     if (!mongodb_client) {
@@ -500,63 +590,54 @@ void PostStorageHandler::ReadPosts(
       mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
       throw se;
     }
-    bson_t *query = bson_new();
-    bson_t query_child;
-    bson_t query_post_id_list;
-    const char *key;
-    idx = 0;
-    char buf[16];
-
-    BSON_APPEND_DOCUMENT_BEGIN(query, "post_id", &query_child);
-    BSON_APPEND_ARRAY_BEGIN(&query_child, "$in", &query_post_id_list);
-    for (auto &item : post_ids_not_cached) {
-      bson_uint32_to_string(idx, &key, buf, sizeof buf);
-      BSON_APPEND_INT64(&query_post_id_list, key, item);
-      idx++;
+    std::vector<int64_t> missed_post_ids;
+    for (size_t i = 0; i < post_ids.size(); ++i) {
+      if (!found[i]) {
+        missed_post_ids.emplace_back(post_ids[i]);
+      }
+    }
+    bson_t *query = _NewPostIdsQuery(missed_post_ids);
+
+    // post_id places each post, so it is projected whatever fields holds
+    bson_t *opts = nullptr;
+    if (fields != POST_FIELDS_ALL) {
+      opts = bson_new();
+      bson_t projection;
+      BSON_APPEND_DOCUMENT_BEGIN(opts, "projection", &projection);
+      BSON_APPEND_BOOL(&projection, "_id", false);
+      for (auto &field_name : POST_FIELD_NAMES) {
+        if ((fields & field_name.field) ||
+            field_name.field == POST_FIELD_POST_ID) {
+          BSON_APPEND_BOOL(&projection, field_name.name, true);
+        }
+      }
+      bson_append_document_end(opts, &projection);
     }
-    bson_append_array_end(&query_child, &query_post_id_list);
-    bson_append_document_end(query, &query_child);
     mongoc_cursor_t *cursor =
-        mongoc_collection_find_with_opts(collection, query, nullptr, nullptr);
+        mongoc_collection_find_with_opts(collection, query, opts, nullptr);
     const bson_t *doc;
 
     auto find_span = opentracing::Tracer::Global()->StartSpan(
         "mongo_find_client", {opentracing::ChildOf(&span->context())});
-    while (true) {
-      bool found = mongoc_cursor_next(cursor, &doc);
-      if (!found) {
-        break;
+    while (mongoc_cursor_next(cursor, &doc)) {
+      bson_iter_t iter_post_id;
+      if (!bson_iter_init_find(&iter_post_id, doc, "post_id")) {
+        continue;
+      }
+      int64_t post_id = bson_iter_as_int64(&iter_post_id);
+      size_t i = position_of(post_id);
+      if (i == post_ids.size() || found[i]) {
+        continue;
       }
-      Post new_post;
       char *post_json_char = bson_as_json(doc, nullptr);
       json post_json = json::parse(post_json_char);
-      new_post.req_id = post_json["req_id"];
-      new_post.timestamp = post_json["timestamp"];
-      new_post.post_id = post_json["post_id"];
-      new_post.creator.user_id = post_json["creator"]["user_id"];
-      new_post.creator.username = post_json["creator"]["username"];
-      new_post.post_type = post_json["post_type"];
-      new_post.text = post_json["text"];
-      for (auto &item : post_json["media"]) {
-        Media media;
-        media.media_id = item["media_id"];
-        media.media_type = item["media_type"];
-        new_post.media.emplace_back(media);
-      }
-      for (auto &item : post_json["user_mentions"]) {
-        UserMention user_mention;
-        user_mention.username = item["username"];
-        user_mention.user_id = item["user_id"];
-        new_post.user_mentions.emplace_back(user_mention);
-      }
-      for (auto &item : post_json["urls"]) {
-        Url url;
-        url.shortened_url = item["shortened_url"];
-        url.expanded_url = item["expanded_url"];
-        new_post.urls.emplace_back(url);
+      PostFromJson(post_json, &posts[i], fields);
+      found[i] = true;
+      num_found++;
+      if (fields == POST_FIELDS_ALL) {
+        posts_to_cache.emplace_back(std::to_string(post_id),
+                                    std::string(post_json_char));
       }
-      post_json_map.insert({new_post.post_id, std::string(post_json_char)});
-      return_map.insert({new_post.post_id, new_post});
       bson_free(post_json_char);
     }
     find_span->Finish();
@@ -564,6 +645,9 @@ void PostStorageHandler::ReadPosts(
     if (mongoc_cursor_error(cursor, &error)) {
       LOG(warning) << error.message;
       bson_destroy(query);
+      if (opts) {
+        bson_destroy(opts);
+      }
       mongoc_cursor_destroy(cursor);
       mongoc_collection_destroy(collection);
       mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
@@ -573,36 +657,42 @@ void PostStorageHandler::ReadPosts(
       throw se;
     }
     bson_destroy(query);
+    if (opts) {
+      bson_destroy(opts);
+    }
     mongoc_cursor_destroy(cursor);
     mongoc_collection_destroy(collection);
     mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
 
     // upload posts to memcached
-    set_futures.emplace_back(std::async(std::launch::async, [&]() {
-      memcached_return_t _rc;
-      auto _memcached_client =
-          memcached_pool_pop(_memcached_client_pool, true, &_rc);
-      if (!_memcached_client) {
-        LOG(error) << "Failed to pop a client from memcached pool";
-        ServiceException se;
-        se.errorCode = ErrorCode::SE_MEMCACHED_ERROR;
-        se.message = "Failed to pop a client from memcached pool";
-        throw se;
-      }
-      auto set_span = opentracing::Tracer::Global()->StartSpan(
-          "mmc_set_client", {opentracing::ChildOf(&span->context())});
-      for (auto &it : post_json_map) {
-        std::string id_str = std::to_string(it.first);
-        _rc = memcached_set(_memcached_client, id_str.c_str(), id_str.length(),
-                            it.second.c_str(), it.second.length(),
-                            static_cast<time_t>(0), static_cast<uint32_t>(0));
-      }
-      memcached_pool_push(_memcached_client_pool, _memcached_client);
-      set_span->Finish();
-    }));
+    if (!posts_to_cache.empty()) {
+      set_futures.emplace_back(std::async(std::launch::async, [&]() {
+        memcached_return_t _rc;
+        auto _memcached_client =
+            memcached_pool_pop(_memcached_client_pool, true, &_rc);
+        if (!_memcached_client) {
+          LOG(error) << "Failed to pop a client from memcached pool";
+          ServiceException se;
+          se.errorCode = ErrorCode::SE_MEMCACHED_ERROR;
+          se.message = "Failed to pop a client from memcached pool";
+          throw se;
+        }
+        auto set_span = opentracing::Tracer::Global()->StartSpan(
+            "mmc_set_client", {opentracing::ChildOf(&span->context())});
+        for (auto &it : posts_to_cache) {
+          uint32_t flags = _EncodeForCache(&it.second);
+          _rc = memcached_set(_memcached_client, it.first.c_str(),
+                              it.first.length(), it.second.c_str(),
+                              it.second.length(), static_cast<time_t>(0),
+                              flags);
+        }
+        memcached_pool_push(_memcached_client_pool, _memcached_client);
+        set_span->Finish();
+      }));
+    }
   }
 
-  if (return_map.size() != post_ids.size()) {
+  if (num_found != post_ids.size()) {
     try {
       for (auto &it : set_futures) {
         it.get();
@@ -617,9 +707,7 @@ void PostStorageHandler::ReadPosts(
     throw se;
   }
 
-  for (auto &post_id : post_ids) {
-    _return.emplace_back(return_map[post_id]);
-  }
+  _return = std::move(posts);
 
   try {
     for (auto &it : set_futures) {
@@ -630,6 +718,44 @@ void PostStorageHandler::ReadPosts(
   }
 }
 
+std::vector<MongoIndexSpec> PostStorageHandler::IndexSpecs() {
+  return {
+      {"post", "post", {{"post_id", 1}}, true, ""},
+  };
+}
+
+bson_t *PostStorageHandler::_NewPostIdQuery(int64_t post_id) {
+  bson_t *query = bson_new();
+  BSON_APPEND_INT64(query, "post_id", post_id);
+  return query;
+}
+
+bson_t *PostStorageHandler::_NewPostIdsQuery(
+    const std::vector<int64_t> &post_ids) {
+  bson_t *query = bson_new();
+  bson_t query_child;
+  bson_t query_post_id_list;
+  const char *key;
+  char buf[16];
+
+  BSON_APPEND_DOCUMENT_BEGIN(query, "post_id", &query_child);
+  BSON_APPEND_ARRAY_BEGIN(&query_child, "$in", &query_post_id_list);
+  for (uint32_t i = 0; i < post_ids.size(); ++i) {
+    bson_uint32_to_string(i, &key, buf, sizeof buf);
+    BSON_APPEND_INT64(&query_post_id_list, key, post_ids[i]);
+  }
+  bson_append_array_end(&query_child, &query_post_id_list);
+  bson_append_document_end(query, &query_child);
+  return query;
+}
+
+std::vector<MongoQueryShape> PostStorageHandler::QueryShapes() {
+  return {
+      MongoQueryShapeOf("post", "post", _NewPostIdQuery(0)),
+      MongoQueryShapeOf("post", "post", _NewPostIdsQuery({0, 1})),
+  };
+}
+
 }  // namespace social_network
 
 #endif  // SOCIAL_NETWORK_MICROSERVICES_POSTSTORAGEHANDLER_H
@@ -40,6 +40,27 @@ int main(int argc, char* argv[]) {
   }
 
   int port = config_json["post-storage-service"]["port"];
+  std::string value_compression = config_json["post-storage-service"].value(
+      "value_compression", std::string("none"));
+  std::unique_ptr<PostCompressor> compressor;
+  if (value_compression == "zstd") {
+    compressor = PostCompressor::Load(
+        config_json["post-storage-service"].value(
+            "compression_dictionary",
+            std::string("config/post-storage-zstd.dict")),
+        config_json["post-storage-service"].value(
+            "compression_level", POST_COMPRESSION_DEFAULT_LEVEL),
+        config_json["post-storage-service"].value(
+            "compression_min_bytes", POST_COMPRESSION_DEFAULT_MIN_BYTES));
+    if (!compressor) {
+      return EXIT_FAILURE;
+    }
+  } else if (value_compression != "none") {
+    LOG(fatal) << "Unknown value_compression " << value_compression;
+    return EXIT_FAILURE;
+  }
+  bool group_commit =
+      config_json["post-storage-service"].value("group_commit", false);
 
   int mongodb_conns = config_json["post-storage-mongodb"]["connections"];
   int mongodb_timeout = config_json["post-storage-mongodb"]["timeout_ms"];
@@ -55,25 +76,32 @@ int main(int argc, char* argv[]) {
     return EXIT_FAILURE;
   }
 
-  mongoc_client_t* mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
-  if (!mongodb_client) {
-    LOG(fatal) << "Failed to pop mongoc client";
-    return EXIT_FAILURE;
+  std::unique_ptr<PostGroupCommit> post_group_commit;
+  if (group_commit) {
+    post_group_commit.reset(new PostGroupCommit(
+        mongodb_client_pool,
+        config_json["post-storage-service"].value(
+            "group_commit_max_batch", POST_GROUP_COMMIT_DEFAULT_MAX_BATCH),
+        config_json["post-storage-service"].value(
+            "group_commit_max_delay_us",
+            POST_GROUP_COMMIT_DEFAULT_MAX_DELAY_US),
+        config_json["post-storage-service"].value(
+            "group_commit_flushers", POST_GROUP_COMMIT_DEFAULT_FLUSHERS)));
+    post_group_commit->Start();
   }
-  bool r = false;
-  while (!r) {
-    r = CreateIndex(mongodb_client, "post", "post_id", true);
-    if (!r) {
-      LOG(error) << "Failed to create mongodb index, try again";
-      sleep(1);
-    }
+
+  if (!SetUpMongoIndexes(mongodb_client_pool, PostStorageHandler::IndexSpecs(),
+                         PostStorageHandler::QueryShapes(),
+                         config_json.value("mongodb_index_check", false))) {
+    LOG(fatal) << "Failed to set up the MongoDB indexes of PostStorageHandler";
+    return EXIT_FAILURE;
   }
-  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
   std::shared_ptr<TServerSocket> server_socket = get_server_socket(config_json, "0.0.0.0", port);
 
   TThreadedServer server(std::make_shared<PostStorageServiceProcessor>(
                              std::make_shared<PostStorageHandler>(
-                                 memcached_client_pool, mongodb_client_pool)),
+                                 memcached_client_pool, mongodb_client_pool,
+                                 compressor.get(), post_group_commit.get())),
                          server_socket,
                          std::make_shared<TFramedTransportFactory>(),
                          std::make_shared<TBinaryProtocolFactory>());
@@ -0,0 +1,264 @@
+// Heap allocations and decode rate of the cache-hit path of
+// PostStorageHandler::ReadPosts, in this process, on pages of --page-size
+// cached posts:
+//   former   a new char[] per key, each value copied into a std::string and
+//            parsed, the posts collected in a std::map and copied out in
+//            request order
+//   current  keys in one buffer, DecodePost on the value in place, the
+//            posts decoded into their slot of a pre-sized vector and moved
+//            out
+// Allocations are counted by the global operator new of this program, so
+// libmemcached's own buffers are not included.
+//
+// Then, per field mask, the current path with the mask applied by
+// DecodePost, and the decoded page written as the list<Post> of a reply in
+// TBinaryProtocol: bytes on the wire and CPU time per request, decode and
+// encode together.
+//   all       POST_FIELDS_ALL, what ReadPosts returns
+//   preview   POST_FIELDS_PREVIEW
+
+#include <atomic>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/transport/TBufferTransports.h>
+#include <vector>
+
+#include "../PostFields.h"
+#include "../logger.h"
+#include "PostCodec.h"
+
+using apache::thrift::protocol::TBinaryProtocol;
+using apache::thrift::transport::TMemoryBuffer;
+using namespace social_network;
+using json = nlohmann::json;
+
+static std::atomic<size_t> num_allocations{0};
+
+void *operator new(size_t size) {
+  num_allocations++;
+  void *p = std::malloc(size ? size : 1);
+  if (!p) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+
+// A post as bson_as_json renders its MongoDB document, with mentions, media
+// and urls like those of the ComposePost workload
+static std::string CachedPost(int64_t post_id) {
+  json post_json;
+  post_json["_id"] = {{"$oid", "5f2b6c1e8e1b2a3c4d5e6f70"}};
+  post_json["post_id"] = post_id;
+  post_json["timestamp"] = 1596681246000 + post_id;
+  post_json["text"] =
+      "@username_12 @username_34 Lorem ipsum dolor sit amet, consectetur "
+      "adipiscing elit, sed do eiusmod tempor incididunt http://short-url/"
+      "Ab3dE5gH9k";
+  post_json["req_id"] = post_id * 7;
+  post_json["post_type"] = 0;
+  std::string username = "username_" + std::to_string(post_id % 962);
+  post_json["creator"] = {{"user_id", post_id % 962}, {"username", username}};
+  post_json["urls"] = {{{"shortened_url", "http://short-url/Ab3dE5gH9k"},
+                        {"expanded_url", "http://example.com/some/long/path"}}};
+  post_json["user_mentions"] = {{{"user_id", 12}, {"username", "username_12"}},
+                                {{"user_id", 34}, {"username", "username_34"}}};
+  post_json["media"] = {{{"media_id", post_id * 3}, {"media_type", "png"}}};
+  return post_json.dump();
+}
+
+// The decode of the former ReadPosts, per cached value
+static void FormerPostFromValue(const char *value, size_t size, Post *post) {
+  json post_json = json::parse(std::string(value, value + size));
+  post->req_id = post_json["req_id"];
+  post->timestamp = post_json["timestamp"];
+  post->post_id = post_json["post_id"];
+  post->creator.user_id = post_json["creator"]["user_id"];
+  post->creator.username = post_json["creator"]["username"];
+  post->post_type = post_json["post_type"];
+  post->text = post_json["text"];
+  for (auto &item : post_json["media"]) {
+    Media media;
+    media.media_id = item["media_id"];
+    media.media_type = item["media_type"];
+    post->media.emplace_back(media);
+  }
+  for (auto &item : post_json["user_mentions"]) {
+    UserMention user_mention;
+    user_mention.username = item["username"];
+    user_mention.user_id = item["user_id"];
+    post->user_mentions.emplace_back(user_mention);
+  }
+  for (auto &item : post_json["urls"]) {
+    Url url;
+    url.shortened_url = item["shortened_url"];
+    url.expanded_url = item["expanded_url"];
+    post->urls.emplace_back(url);
+  }
+  SetPostFieldsIsset(POST_FIELDS_ALL, post);
+}
+
+static std::vector<Post> ReadFormer(const std::vector<int64_t> &post_ids,
+                                    const std::vector<std::string> &values) {
+  char **keys = new char *[post_ids.size()];
+  size_t *key_sizes = new size_t[post_ids.size()];
+  for (size_t i = 0; i < post_ids.size(); i++) {
+    std::string key_str = std::to_string(post_ids[i]);
+    keys[i] = new char[key_str.length() + 1];
+    strcpy(keys[i], key_str.c_str());
+    key_sizes[i] = key_str.length();
+  }
+  std::map<int64_t, Post> return_map;
+  for (auto &value : values) {
+    Post new_post;
+    FormerPostFromValue(value.data(), value.size(), &new_post);
+    return_map.insert(std::make_pair(new_post.post_id, new_post));
+  }
+  std::vector<Post> posts;
+  for (auto &post_id : post_ids) {
+    posts.emplace_back(return_map[post_id]);
+  }
+  for (size_t i = 0; i < post_ids.size(); i++) {
+    delete[] keys[i];
+  }
+  delete[] keys;
+  delete[] key_sizes;
+  return posts;
+}
+
+static std::vector<Post> ReadCurrent(const std::vector<int64_t> &post_ids,
+                                     const std::vector<std::string> &values,
+                                     int32_t fields = POST_FIELDS_ALL) {
+  std::vector<char> key_buffer(post_ids.size() * (POST_KEY_MAX_LENGTH + 1));
+  std::vector<const char *> keys(post_ids.size());
+  std::vector<size_t> key_sizes(post_ids.size());
+  for (size_t i = 0; i < post_ids.size(); i++) {
+    char *key = key_buffer.data() + i * (POST_KEY_MAX_LENGTH + 1);
+    key_sizes[i] = FormatPostKey(post_ids[i], key);
+    keys[i] = key;
+  }
+  // Values arrive in request order here, so the index is the position
+  std::vector<Post> posts(post_ids.size());
+  for (size_t i = 0; i < values.size(); i++) {
+    DecodePost(values[i].data(), values[i].size(), &posts[i], fields);
+  }
+  return posts;
+}
+
+// Bytes of posts as the list<Post> of a ReadPosts reply
+static uint32_t WireSize(const std::vector<Post> &posts) {
+  auto buffer = std::make_shared<TMemoryBuffer>();
+  TBinaryProtocol protocol(buffer);
+  uint32_t size = protocol.writeListBegin(apache::thrift::protocol::T_STRUCT,
+                                          (uint32_t)posts.size());
+  for (auto &post : posts) {
+    size += post.write(&protocol);
+  }
+  size += protocol.writeListEnd();
+  return size;
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "page-size", po::value<std::vector<int>>()->multitoken()->default_value(
+                       std::vector<int>{10, 50, 100}, "10 50 100"),
+      "Posts per ReadPosts call")(
+      "iterations", po::value<int>()->default_value(10000),
+      "Calls per page size and path");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  int iterations = vm["iterations"].as<int>();
+  if (iterations < 1) {
+    LOG(error) << "--iterations must be positive";
+    return EXIT_FAILURE;
+  }
+
+  for (int page_size : vm["page-size"].as<std::vector<int>>()) {
+    if (page_size < 1) {
+      LOG(error) << "--page-size must be positive";
+      return EXIT_FAILURE;
+    }
+    std::vector<int64_t> post_ids;
+    std::vector<std::string> values;
+    for (int i = 0; i < page_size; i++) {
+      post_ids.emplace_back(1000000 + i);
+      values.emplace_back(CachedPost(post_ids.back()));
+    }
+
+    if (ReadFormer(post_ids, values) != ReadCurrent(post_ids, values)) {
+      LOG(error) << "The two paths decode page size " << page_size
+                 << " differently";
+      return EXIT_FAILURE;
+    }
+
+    for (int current = 0; current < 2; current++) {
+      size_t allocations_before = num_allocations.load();
+      size_t checksum = 0;
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < iterations; i++) {
+        auto posts = current ? ReadCurrent(post_ids, values)
+                             : ReadFormer(post_ids, values);
+        checksum += posts.back().creator.user_id;
+      }
+      auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+      double num_posts = (double)iterations * page_size;
+      LOG(info) << "page size " << page_size << ", "
+                << (current ? "current" : "former") << ": "
+                << (num_allocations.load() - allocations_before) / num_posts
+                << " allocations/post, " << num_posts * 1e9 / elapsed
+                << " posts/s (checksum " << checksum << ")";
+    }
+
+    auto preview = ReadCurrent(post_ids, values);
+    for (auto &post : preview) {
+      ApplyPostFields(POST_FIELDS_PREVIEW, &post);
+    }
+    if (ReadCurrent(post_ids, values, POST_FIELDS_PREVIEW) != preview) {
+      LOG(error) << "The preview mask decodes page size " << page_size
+                 << " differently from masking full posts";
+      return EXIT_FAILURE;
+    }
+
+    for (int32_t fields : {POST_FIELDS_ALL, POST_FIELDS_PREVIEW}) {
+      size_t wire_bytes = 0;
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < iterations; i++) {
+        wire_bytes += WireSize(ReadCurrent(post_ids, values, fields));
+      }
+      auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+      LOG(info) << "page size " << page_size << ", "
+                << (fields == POST_FIELDS_ALL ? "all" : "preview") << ": "
+                << wire_bytes / iterations << " bytes/request, "
+                << elapsed / 1e3 / iterations << " us/request";
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,275 @@
+// Trains the zstd dictionary PostCompressor compresses cached posts with, on
+// a random sample of the posts in MongoDB, rendered by bson_as_json exactly
+// as PostStorageHandler caches them.
+//
+// Each dictionary is a version: its zstd dictionary ID is one more than that
+// of the dictionary already at --output, which is kept as
+// <output>.<dictionary ID> to roll back to. post-storage-service reads
+// frames of an older dictionary as cache misses, so a new one can be
+// deployed without flushing memcached.
+//
+// Every tenth sampled post is held out of training, and compressed with the
+// new dictionary and without one, with the compression_min_bytes bypass of
+// the service, to report the compression ratio and time each would give.
+
+#include <bson/bson.h>
+#include <mongoc.h>
+#include <signal.h>
+#include <zdict.h>
+#include <zstd.h>
+
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../logger.h"
+#include "../utils.h"
+#include "../utils_mongodb.h"
+#include "PostCompressor.h"
+
+// The first dictionary ID of the range zstd leaves to private use
+#define POST_DICTIONARY_FIRST_ID 32768
+// A zstd dictionary starts with its 4-byte magic number and then its ID,
+// both little-endian
+#define POST_DICTIONARY_ID_OFFSET 4
+
+using namespace social_network;
+
+void sigintHandler(int sig) { exit(EXIT_SUCCESS); }
+
+static bool ReadFile(const std::string &path, std::string *contents) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  contents->assign((std::istreambuf_iterator<char>(file)),
+                   std::istreambuf_iterator<char>());
+  return true;
+}
+
+static bool WriteFile(const std::string &path, const std::string &contents) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(contents.data(), contents.size());
+  return (bool)file;
+}
+
+// size posts drawn with $sample, as the JSON that is cached
+static bool SamplePosts(mongoc_client_t *mongodb_client, int size,
+                        std::vector<std::string> *posts) {
+  auto collection =
+      mongoc_client_get_collection(mongodb_client, "post", "post");
+  bson_t *pipeline = BCON_NEW("pipeline", "[", "{", "$sample", "{", "size",
+                              BCON_INT32(size), "}", "}", "]");
+  mongoc_cursor_t *cursor = mongoc_collection_aggregate(
+      collection, MONGOC_QUERY_NONE, pipeline, nullptr, nullptr);
+  const bson_t *doc;
+  while (mongoc_cursor_next(cursor, &doc)) {
+    char *post_json_char = bson_as_json(doc, nullptr);
+    posts->emplace_back(post_json_char);
+    bson_free(post_json_char);
+  }
+  bson_error_t error;
+  bool ok = !mongoc_cursor_error(cursor, &error);
+  if (!ok) {
+    LOG(error) << "Failed to sample posts: " << error.message;
+  }
+  mongoc_cursor_destroy(cursor);
+  bson_destroy(pipeline);
+  mongoc_collection_destroy(collection);
+  return ok;
+}
+
+int main(int argc, char *argv[]) {
+  signal(SIGINT, sigintHandler);
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "config",
+      po::value<std::string>()->default_value("config/service-config.json"),
+      "Path to service-config.json")(
+      "output", po::value<std::string>(),
+      "Dictionary file, by default the compression_dictionary of "
+      "post-storage-service")(
+      "samples", po::value<int>()->default_value(20000),
+      "Number of posts sampled")(
+      "dictionary-bytes", po::value<int>()->default_value(64 * 1024),
+      "Largest dictionary to train")(
+      "dictionary-id", po::value<unsigned>(),
+      "ID of the new dictionary, by default one more than that at --output");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  json config_json;
+  if (load_config_file(vm["config"].as<std::string>(), &config_json) != 0) {
+    exit(EXIT_FAILURE);
+  }
+  std::string output =
+      vm.count("output")
+          ? vm["output"].as<std::string>()
+          : config_json["post-storage-service"].value(
+                "compression_dictionary",
+                std::string("config/post-storage-zstd.dict"));
+  int level = config_json["post-storage-service"].value(
+      "compression_level", POST_COMPRESSION_DEFAULT_LEVEL);
+  size_t min_bytes = config_json["post-storage-service"].value(
+      "compression_min_bytes", POST_COMPRESSION_DEFAULT_MIN_BYTES);
+  int num_samples = vm["samples"].as<int>();
+  int dictionary_bytes = vm["dictionary-bytes"].as<int>();
+  if (num_samples < 10 || dictionary_bytes < 1024) {
+    LOG(error) << "--samples must be at least 10 and --dictionary-bytes at "
+                  "least 1024";
+    return EXIT_FAILURE;
+  }
+
+  std::string previous;
+  unsigned previous_id = 0;
+  if (ReadFile(output, &previous)) {
+    previous_id = ZSTD_getDictID_fromDict(previous.data(), previous.size());
+  }
+  unsigned dictionary_id = vm.count("dictionary-id")
+                               ? vm["dictionary-id"].as<unsigned>()
+                               : std::max<unsigned>(previous_id + 1,
+                                                    POST_DICTIONARY_FIRST_ID);
+  if (dictionary_id == 0 || dictionary_id == previous_id) {
+    LOG(error) << "Dictionary ID " << dictionary_id
+               << " is 0 or that of the dictionary at " << output;
+    return EXIT_FAILURE;
+  }
+
+  auto mongodb_client_pool =
+      init_mongodb_client_pool(config_json, "post-storage", 1);
+  if (mongodb_client_pool == nullptr) {
+    return EXIT_FAILURE;
+  }
+  mongoc_client_t *mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
+  if (!mongodb_client) {
+    LOG(fatal) << "Failed to pop mongoc client";
+    return EXIT_FAILURE;
+  }
+  std::vector<std::string> posts;
+  bool sampled = SamplePosts(mongodb_client, num_samples, &posts);
+  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+  mongoc_client_pool_destroy(mongodb_client_pool);
+  if (!sampled) {
+    return EXIT_FAILURE;
+  }
+  if (posts.size() < 10) {
+    LOG(error) << "Only " << posts.size() << " posts to sample";
+    return EXIT_FAILURE;
+  }
+
+  std::string training;
+  std::vector<size_t> training_sizes;
+  std::vector<const std::string *> held_out;
+  for (size_t i = 0; i < posts.size(); i++) {
+    if (i % 10 == 9) {
+      held_out.emplace_back(&posts[i]);
+    } else {
+      training += posts[i];
+      training_sizes.emplace_back(posts[i].size());
+    }
+  }
+
+  std::string dictionary(dictionary_bytes, '\0');
+  size_t trained_bytes = ZDICT_trainFromBuffer(
+      &dictionary[0], dictionary.size(), training.data(),
+      training_sizes.data(), (unsigned)training_sizes.size());
+  if (ZDICT_isError(trained_bytes)) {
+    LOG(error) << "Failed to train a dictionary on " << training_sizes.size()
+               << " posts: " << ZDICT_getErrorName(trained_bytes);
+    return EXIT_FAILURE;
+  }
+  dictionary.resize(trained_bytes);
+  for (int i = 0; i < 4; i++) {
+    dictionary[POST_DICTIONARY_ID_OFFSET + i] =
+        (char)((dictionary_id >> (8 * i)) & 0xff);
+  }
+
+  if (previous_id != 0 &&
+      !WriteFile(output + "." + std::to_string(previous_id), previous)) {
+    LOG(error) << "Failed to keep dictionary " << previous_id;
+    return EXIT_FAILURE;
+  }
+  if (!WriteFile(output, dictionary)) {
+    LOG(error) << "Failed to write " << output;
+    return EXIT_FAILURE;
+  }
+  LOG(info) << "Wrote dictionary " << dictionary_id << " (" << trained_bytes
+            << " bytes, from " << training_sizes.size() << " posts) to "
+            << output;
+
+  // Round trip the held-out posts through the written dictionary, as the
+  // service would load it
+  auto compressor = PostCompressor::Load(output, level, min_bytes);
+  if (!compressor) {
+    return EXIT_FAILURE;
+  }
+  size_t raw_bytes = 0;
+  size_t dictionary_cached_bytes = 0;
+  size_t plain_cached_bytes = 0;
+  size_t bypassed = 0;
+  int64_t compress_ns = 0;
+  int64_t decompress_ns = 0;
+  std::string compressed;
+  std::string decompressed;
+  for (auto *post : held_out) {
+    raw_bytes += post->size();
+    auto start = std::chrono::steady_clock::now();
+    bool was_compressed =
+        compressor->Compress(post->data(), post->size(), &compressed);
+    auto compressed_at = std::chrono::steady_clock::now();
+    compress_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       compressed_at - start)
+                       .count();
+    if (!was_compressed) {
+      bypassed++;
+      dictionary_cached_bytes += post->size();
+      plain_cached_bytes += post->size();
+      continue;
+    }
+    dictionary_cached_bytes += compressed.size();
+    if (!compressor->Decompress(compressed.data(), compressed.size(),
+                                &decompressed) ||
+        decompressed != *post) {
+      LOG(error) << "A held-out post does not round trip";
+      return EXIT_FAILURE;
+    }
+    decompress_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now() - compressed_at)
+                         .count();
+
+    std::string plain(ZSTD_compressBound(post->size()), '\0');
+    size_t plain_size = ZSTD_compress(&plain[0], plain.size(), post->data(),
+                                      post->size(), level);
+    plain_cached_bytes += ZSTD_isError(plain_size)
+                              ? post->size()
+                              : std::min(plain_size, post->size());
+  }
+  size_t num_compressed = held_out.size() - bypassed;
+  LOG(info) << held_out.size() << " held-out posts, " << bypassed
+            << " under " << min_bytes << " bytes: ratio "
+            << (double)raw_bytes / dictionary_cached_bytes
+            << " with the dictionary, "
+            << (double)raw_bytes / plain_cached_bytes << " without";
+  if (num_compressed > 0) {
+    LOG(info) << "Per compressed post: " << compress_ns / 1e3 / num_compressed
+              << " us to compress, "
+              << decompress_ns / 1e3 / num_compressed << " us to decompress";
+  }
+  return 0;
+}
@@ -0,0 +1,178 @@
+// Microbenchmark of the adjacency-list intersections behind GetMutualFollows
+// and GetFollowersInCommon, run on a datasets/social-graph edge list.
+//
+// Every edge is followed in both directions, as scripts/init_social_graph.py
+// and BulkLoader do. Two workloads are timed:
+//   uniform  both users drawn uniformly, lists of similar (small) length
+//   skewed   one of the 1% highest-degree users against a uniform user, the
+//            case galloping is meant for
+// For each, the dispatched IntersectSorted is compared against the plain
+// merge and against std::set_intersection, and the result sizes are checked
+// to agree.
+
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../logger.h"
+#include "SortedIntersection.h"
+
+using namespace social_network;
+
+static bool LoadAdjacency(const std::string &nodes_file,
+                          const std::string &edges_file,
+                          std::vector<std::vector<int64_t>> *adjacency) {
+  std::ifstream nodes(nodes_file);
+  int64_t num_users;
+  if (!nodes.is_open() || !(nodes >> num_users)) {
+    LOG(error) << "Cannot read the number of nodes from " << nodes_file;
+    return false;
+  }
+  std::ifstream edges(edges_file);
+  if (!edges.is_open()) {
+    LOG(error) << "Cannot open " << edges_file;
+    return false;
+  }
+  adjacency->assign(num_users, std::vector<int64_t>());
+  int64_t u, v;
+  while (edges >> u >> v) {
+    if (u < 0 || v < 0 || u >= num_users || v >= num_users || u == v) {
+      continue;
+    }
+    (*adjacency)[u].emplace_back(v);
+    (*adjacency)[v].emplace_back(u);
+  }
+  for (auto &list : *adjacency) {
+    std::sort(list.begin(), list.end());
+    list.erase(std::unique(list.begin(), list.end()), list.end());
+  }
+  return true;
+}
+
+using IntersectFn = std::function<void(
+    const std::vector<int64_t> &, const std::vector<int64_t> &,
+    std::vector<int64_t> *)>;
+
+static double TimeIntersections(
+    const std::vector<std::vector<int64_t>> &adjacency,
+    const std::vector<std::pair<int64_t, int64_t>> &pairs, int rounds,
+    const IntersectFn &intersect, size_t *total) {
+  std::vector<int64_t> out;
+  *total = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; round++) {
+    for (auto const &pair : pairs) {
+      out.clear();
+      intersect(adjacency[pair.first], adjacency[pair.second], &out);
+      *total += out.size();
+    }
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+  return (double)elapsed / ((double)rounds * pairs.size());
+}
+
+static void RunWorkload(const std::string &name,
+                        const std::vector<std::vector<int64_t>> &adjacency,
+                        const std::vector<std::pair<int64_t, int64_t>> &pairs,
+                        int rounds) {
+  size_t naive_total, merge_total, dispatched_total;
+  double naive_ns = TimeIntersections(
+      adjacency, pairs, rounds, IntersectSortedNaive, &naive_total);
+  double merge_ns = TimeIntersections(
+      adjacency, pairs, rounds,
+      [](const std::vector<int64_t> &a, const std::vector<int64_t> &b,
+         std::vector<int64_t> *out) {
+        IntersectMergeScalar(a.data(), a.size(), b.data(), b.size(), out);
+      },
+      &merge_total);
+  double dispatched_ns = TimeIntersections(
+      adjacency, pairs, rounds,
+      [](const std::vector<int64_t> &a, const std::vector<int64_t> &b,
+         std::vector<int64_t> *out) { IntersectSorted(a, b, out); },
+      &dispatched_total);
+
+  if (naive_total != merge_total || naive_total != dispatched_total) {
+    LOG(error) << name << ": result mismatch (std::set_intersection "
+               << naive_total << ", merge " << merge_total
+               << ", IntersectSorted " << dispatched_total << ")";
+    exit(EXIT_FAILURE);
+  }
+  LOG(info) << name << ": " << pairs.size() << " pairs x " << rounds
+            << " rounds, std::set_intersection " << naive_ns
+            << " ns/op, scalar merge " << merge_ns
+            << " ns/op, IntersectSorted " << dispatched_ns << " ns/op ("
+            << naive_ns / dispatched_ns << "x)";
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "graph", po::value<std::string>()->default_value("socfb-Reed98"),
+      "Graph name (socfb-Reed98, ego-twitter or soc-twitter-follows-mun)")(
+      "dataset-dir",
+      po::value<std::string>()->default_value("datasets/social-graph"),
+      "Directory holding <graph>/<graph>.nodes and <graph>/<graph>.edges")(
+      "pairs", po::value<int>()->default_value(100000),
+      "Number of random user pairs per workload")(
+      "rounds", po::value<int>()->default_value(10),
+      "Number of passes over the pairs")(
+      "seed", po::value<int>()->default_value(1), "Random seed");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  std::string graph_name = vm["graph"].as<std::string>();
+  std::string graph_dir =
+      vm["dataset-dir"].as<std::string>() + "/" + graph_name + "/" + graph_name;
+  std::vector<std::vector<int64_t>> adjacency;
+  if (!LoadAdjacency(graph_dir + ".nodes", graph_dir + ".edges", &adjacency) ||
+      adjacency.empty()) {
+    return EXIT_FAILURE;
+  }
+
+  std::vector<int64_t> by_degree(adjacency.size());
+  for (size_t i = 0; i < by_degree.size(); i++) {
+    by_degree[i] = i;
+  }
+  std::sort(by_degree.begin(), by_degree.end(), [&](int64_t a, int64_t b) {
+    return adjacency[a].size() > adjacency[b].size();
+  });
+  LOG(info) << "Read " << graph_name << ": " << adjacency.size()
+            << " users, max degree " << adjacency[by_degree[0]].size();
+
+  int num_pairs = vm["pairs"].as<int>();
+  int rounds = vm["rounds"].as<int>();
+  std::mt19937 gen(vm["seed"].as<int>());
+  std::uniform_int_distribution<int64_t> any_user(0, adjacency.size() - 1);
+  std::uniform_int_distribution<int64_t> hub(
+      0, std::max<int64_t>(by_degree.size() / 100, 1) - 1);
+
+  std::vector<std::pair<int64_t, int64_t>> uniform_pairs;
+  std::vector<std::pair<int64_t, int64_t>> skewed_pairs;
+  for (int i = 0; i < num_pairs; i++) {
+    uniform_pairs.emplace_back(any_user(gen), any_user(gen));
+    skewed_pairs.emplace_back(by_degree[hub(gen)], any_user(gen));
+  }
+
+  RunWorkload("uniform", adjacency, uniform_pairs, rounds);
+  RunWorkload("skewed", adjacency, skewed_pairs, rounds);
+  return 0;
+}
@@ -0,0 +1,207 @@
+// Benchmark of SocialGraphSnapshot on a datasets/social-graph edge list.
+//
+// Every edge is followed in both directions, as scripts/init_social_graph.py
+// and BulkLoader do. Reports
+//   build    time to build the CSR arrays and the bytes they take
+//   lookup   GetFollowers latency of uniformly drawn users, no writers
+//   churn    --ops random Follow/Unfollow calls on one thread, compacting
+//            every --compact-threshold of them, while --readers threads call
+//            GetFollowers back to back; reader latency percentiles show how
+//            long compactions hold readers up
+// Each compaction also logs how long it held the exclusive lock. Readers never
+// sleep, so keep --readers below the core count: on an oversubscribed machine
+// the reader-preferring lock starves the writer.
+
+#include <algorithm>
+#include <atomic>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../logger.h"
+#include "SocialGraphSnapshot.h"
+
+using namespace social_network;
+
+static bool LoadEdges(const std::string &nodes_file,
+                      const std::string &edges_file, int64_t *num_users,
+                      std::vector<std::pair<int64_t, int64_t>> *edges) {
+  std::ifstream nodes(nodes_file);
+  if (!nodes.is_open() || !(nodes >> *num_users)) {
+    LOG(error) << "Cannot read the number of nodes from " << nodes_file;
+    return false;
+  }
+  std::ifstream edges_in(edges_file);
+  if (!edges_in.is_open()) {
+    LOG(error) << "Cannot open " << edges_file;
+    return false;
+  }
+  int64_t u, v;
+  while (edges_in >> u >> v) {
+    if (u < 0 || v < 0 || u >= *num_users || v >= *num_users || u == v) {
+      continue;
+    }
+    edges->emplace_back(u, v);
+    edges->emplace_back(v, u);
+  }
+  std::sort(edges->begin(), edges->end());
+  edges->erase(std::unique(edges->begin(), edges->end()), edges->end());
+  return true;
+}
+
+static int64_t ElapsedNs(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+static int64_t Percentile(std::vector<int64_t> *latencies, double p) {
+  if (latencies->empty()) {
+    return 0;
+  }
+  size_t idx = std::min(latencies->size() - 1,
+                        (size_t)(p / 100.0 * latencies->size()));
+  std::nth_element(latencies->begin(), latencies->begin() + idx,
+                   latencies->end());
+  return (*latencies)[idx];
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "graph", po::value<std::string>()->default_value("socfb-Reed98"),
+      "Graph name (socfb-Reed98, ego-twitter or soc-twitter-follows-mun)")(
+      "dataset-dir",
+      po::value<std::string>()->default_value("datasets/social-graph"),
+      "Directory holding <graph>/<graph>.nodes and <graph>/<graph>.edges")(
+      "lookups", po::value<int>()->default_value(1000000),
+      "Number of GetFollowers calls of the lookup workload")(
+      "ops", po::value<int>()->default_value(200000),
+      "Number of Follow/Unfollow calls of the churn workload")(
+      "compact-threshold", po::value<int>()->default_value(10000),
+      "csr_compact_threshold of the churn workload")(
+      "readers", po::value<int>()->default_value(1),
+      "Reader threads of the churn workload")(
+      "seed", po::value<int>()->default_value(1), "Random seed");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  std::string graph_name = vm["graph"].as<std::string>();
+  std::string graph_dir =
+      vm["dataset-dir"].as<std::string>() + "/" + graph_name + "/" + graph_name;
+  int64_t num_users;
+  std::vector<std::pair<int64_t, int64_t>> edges;
+  if (!LoadEdges(graph_dir + ".nodes", graph_dir + ".edges", &num_users,
+                 &edges) ||
+      num_users < 1 || edges.empty()) {
+    return EXIT_FAILURE;
+  }
+
+  int num_lookups = vm["lookups"].as<int>();
+  int num_ops = vm["ops"].as<int>();
+  int num_readers = vm["readers"].as<int>();
+  int compact_threshold = vm["compact-threshold"].as<int>();
+  if (num_lookups < 1 || num_ops < 1 || num_readers < 0 ||
+      compact_threshold < 1) {
+    LOG(error) << "--lookups, --ops and --compact-threshold must be positive "
+                  "and --readers not negative";
+    return EXIT_FAILURE;
+  }
+  SocialGraphSnapshot snapshot(compact_threshold);
+
+  auto start = std::chrono::steady_clock::now();
+  snapshot.Load(num_users, edges);
+  double build_ms = ElapsedNs(start) / 1e6;
+  size_t bytes = snapshot.MemoryUsage();
+  LOG(info) << "build: " << graph_name << ", " << num_users << " users, "
+            << edges.size() << " edges in " << build_ms << " ms, " << bytes
+            << " bytes (" << (double)bytes / edges.size() << " per edge)";
+
+  std::mt19937_64 gen(vm["seed"].as<int>());
+  std::uniform_int_distribution<int64_t> any_user(0, num_users - 1);
+  std::vector<int64_t> followers;
+  std::vector<int64_t> latencies;
+  latencies.reserve(num_lookups);
+  size_t total = 0;
+  for (int i = 0; i < num_lookups; i++) {
+    int64_t user_id = any_user(gen);
+    followers.clear();
+    auto call_start = std::chrono::steady_clock::now();
+    snapshot.GetFollowers(user_id, &followers);
+    latencies.emplace_back(ElapsedNs(call_start));
+    total += followers.size();
+  }
+  LOG(info) << "lookup: " << num_lookups << " calls, " << total / num_lookups
+            << " followers on average, p50 " << Percentile(&latencies, 50)
+            << " ns, p99 " << Percentile(&latencies, 99) << " ns";
+
+  std::atomic<bool> done{false};
+  std::vector<std::vector<int64_t>> reader_latencies(num_readers);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < num_readers; t++) {
+    readers.emplace_back([&, t]() {
+      std::mt19937_64 reader_gen(t + 1);
+      std::vector<int64_t> out;
+      while (!done) {
+        out.clear();
+        int64_t user_id = any_user(reader_gen);
+        auto call_start = std::chrono::steady_clock::now();
+        snapshot.GetFollowers(user_id, &out);
+        reader_latencies[t].emplace_back(ElapsedNs(call_start));
+      }
+    });
+  }
+  std::vector<int64_t> write_latencies;
+  write_latencies.reserve(num_ops);
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < num_ops; i++) {
+    int64_t user_id = any_user(gen);
+    int64_t followee_id = any_user(gen);
+    auto call_start = std::chrono::steady_clock::now();
+    if (i % 4 == 3) {
+      snapshot.Unfollow(user_id, followee_id);
+    } else {
+      snapshot.Follow(user_id, followee_id);
+    }
+    write_latencies.emplace_back(ElapsedNs(call_start));
+  }
+  double churn_s = ElapsedNs(start) / 1e9;
+  done = true;
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  std::vector<int64_t> all_reads;
+  for (auto const &reader : reader_latencies) {
+    all_reads.insert(all_reads.end(), reader.begin(), reader.end());
+  }
+  int64_t write_max =
+      *std::max_element(write_latencies.begin(), write_latencies.end());
+  int64_t read_max =
+      all_reads.empty() ? 0 : *std::max_element(all_reads.begin(),
+                                                all_reads.end());
+  LOG(info) << "churn: " << num_ops / churn_s << " writes/s, write p50 "
+            << Percentile(&write_latencies, 50) << " ns, max "
+            << write_max / 1000 << " us; " << all_reads.size()
+            << " reads on " << num_readers << " threads, p50 "
+            << Percentile(&all_reads, 50) << " ns, p99 "
+            << Percentile(&all_reads, 99) << " ns, p99.99 "
+            << Percentile(&all_reads, 99.99) / 1000 << " us, max "
+            << read_max / 1000 << " us";
+  return 0;
+}
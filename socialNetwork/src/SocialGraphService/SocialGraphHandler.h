@@ -5,19 +5,33 @@
 #include <mongoc.h>
 #include <sw/redis++/redis++.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstring>
+#include <functional>
 #include <future>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
 #include <string>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "../../gen-cpp/SocialGraphService.h"
 #include "../../gen-cpp/UserService.h"
 #include "../ClientPool.h"
+#include "../MongoIndexes.h"
 #include "../ThriftClient.h"
 #include "../logger.h"
 #include "../tracing.h"
+#include "SocialGraphSnapshot.h"
+#include "SortedIntersection.h"
 
 using namespace sw::redis;
 
@@ -27,12 +41,111 @@ using std::chrono::duration_cast;
 using std::chrono::milliseconds;
 using std::chrono::system_clock;
 
+// "{<key>}" + EMPTY_MARKER_SUFFIX set to "1" marks a user whose <key>
+// ("<user_id>:followers" or "<user_id>:followees") list is known to be empty
+// in MongoDB. An empty ZSET is otherwise indistinguishable from an uncached
+// one, which would send every GetFollowers call for such a user to MongoDB.
+//
+// A reader that misses first claims the marker with a random token, for
+// EMPTY_MARKER_CLAIM_TTL seconds, and after finding the list empty in MongoDB
+// turns only its own claim into "1". Follow deletes the marker once its edge
+// is in MongoDB, so a read that may have missed the edge can no longer mark
+// the list empty. The hash tag keeps the marker in the slot of <key>.
+#define EMPTY_MARKER_SUFFIX ":empty"
+#define EMPTY_MARKER_CLAIM_TTL 60
+#define EMPTY_MARKER_LOG_INTERVAL 10000
+
+// KEYS[1]: marker, ARGV[1]: claim token, ARGV[2]: claim TTL in seconds.
+// Returns 1 if the marker is set, otherwise claims it and returns 0.
+static const char *EMPTY_MARKER_CLAIM_SCRIPT =
+    "if redis.call('GET', KEYS[1]) == '1' then return 1 end "
+    "redis.call('SET', KEYS[1], ARGV[1], 'EX', ARGV[2]) "
+    "return 0";
+
+// KEYS[1]: marker, KEYS[2]: list key, ARGV[1]: claim token. Sets the marker
+// if the claim still holds and the list has not been cached meanwhile.
+static const char *EMPTY_MARKER_SET_SCRIPT =
+    "if redis.call('GET', KEYS[1]) == ARGV[1] and "
+    "   redis.call('EXISTS', KEYS[2]) == 0 then "
+    "  redis.call('SET', KEYS[1], '1') "
+    "  return 1 "
+    "end "
+    "return 0";
+
+// A cold follower/followee list is copied to Redis by a background thread,
+// SOCIAL_GRAPH_WARM_CHUNK members per ZADD, into
+// "{<key>}" + WARMING_KEY_SUFFIX. The hash tag keeps that key in the slot of
+// <key> on a cluster, so it can be merged into <key> with one ZUNIONSTORE
+// once complete and readers never see a partial ZSET.
+#define SOCIAL_GRAPH_WARM_CHUNK 1000
+#define WARMING_KEY_SUFFIX ":warming"
+
+// MongoDB's code for a write rejected by a unique index
+#define MONGODB_DUPLICATE_KEY_ERROR 11000
+
+// Pipelines for a batch of Redis commands: one on a standalone server, and
+// in cluster mode one per shard, matched through the shards pool the same
+// way HomeTimelineHandler batches its fan-out.
+class RedisPipelines {
+ public:
+  RedisPipelines(Redis *redis_client_pool,
+                 RedisCluster *redis_cluster_client_pool);
+
+  // The pipeline of the shard holding key
+  Pipeline *For(const std::string &key);
+  void Exec();
+
+ private:
+  Redis *_redis_client_pool;
+  RedisCluster *_redis_cluster_client_pool;
+  std::shared_ptr<Pipeline> _standalone_pipe;
+  std::map<std::shared_ptr<ConnectionPool>, std::shared_ptr<Pipeline>>
+      _pipe_map;
+};
+
+RedisPipelines::RedisPipelines(Redis *redis_client_pool,
+                               RedisCluster *redis_cluster_client_pool) {
+  _redis_client_pool = redis_client_pool;
+  _redis_cluster_client_pool = redis_cluster_client_pool;
+}
+
+Pipeline *RedisPipelines::For(const std::string &key) {
+  if (_redis_client_pool) {
+    if (!_standalone_pipe) {
+      _standalone_pipe =
+          std::make_shared<Pipeline>(_redis_client_pool->pipeline(false));
+    }
+    return _standalone_pipe.get();
+  }
+  auto conn = _redis_cluster_client_pool->get_shards_pool()->fetch(key);
+  auto pipe = _pipe_map.find(conn);
+  if (pipe == _pipe_map.end()) {
+    pipe = _pipe_map
+               .emplace(conn, std::make_shared<Pipeline>(
+                                  _redis_cluster_client_pool->pipeline(
+                                      key, false)))
+               .first;
+  }
+  return pipe->second.get();
+}
+
+void RedisPipelines::Exec() {
+  if (_standalone_pipe) {
+    _standalone_pipe->exec();
+  }
+  for (auto const &it : _pipe_map) {
+    it.second->exec();
+  }
+}
+
 class SocialGraphHandler : public SocialGraphServiceIf {
  public:
   SocialGraphHandler(mongoc_client_pool_t *, Redis *,
-                     ClientPool<ThriftClient<UserServiceClient>> *);
+                     ClientPool<ThriftClient<UserServiceClient>> *,
+                     SocialGraphSnapshot *snapshot = nullptr);
   SocialGraphHandler(mongoc_client_pool_t *, RedisCluster *,
-                     ClientPool<ThriftClient<UserServiceClient>> *);
+                     ClientPool<ThriftClient<UserServiceClient>> *,
+                     SocialGraphSnapshot *snapshot = nullptr);
   ~SocialGraphHandler() override = default;
   void GetFollowers(std::vector<int64_t> &, int64_t, int64_t,
                     const std::map<std::string, std::string> &) override;
@@ -49,31 +162,111 @@ class SocialGraphHandler : public SocialGraphServiceIf {
       const std::map<std::string, std::string> &) override;
   void InsertUser(int64_t, int64_t,
                   const std::map<std::string, std::string> &) override;
+  void InsertUsers(int64_t, const std::vector<int64_t> &,
+                   const std::map<std::string, std::string> &) override;
+  void FollowMany(int64_t, const std::vector<int64_t> &,
+                  const std::vector<int64_t> &,
+                  const std::map<std::string, std::string> &) override;
+  void UnfollowMany(int64_t, const std::vector<int64_t> &,
+                    const std::vector<int64_t> &,
+                    const std::map<std::string, std::string> &) override;
+  void GetMutualFollows(std::vector<int64_t> &, int64_t, int64_t, int64_t,
+                        const std::map<std::string, std::string> &) override;
+  void GetFollowersInCommon(
+      std::vector<int64_t> &, int64_t, const std::vector<int64_t> &,
+      const std::map<std::string, std::string> &) override;
+  void IsFollowing(std::vector<bool> &, int64_t, const std::vector<int64_t> &,
+                   const std::vector<int64_t> &,
+                   const std::map<std::string, std::string> &) override;
+  int64_t GetFollowerCount(int64_t, int64_t,
+                           const std::map<std::string, std::string> &) override;
+  void GetFollowersPage(FollowersPage &, int64_t, int64_t, int64_t, int64_t,
+                        int32_t,
+                        const std::map<std::string, std::string> &) override;
+
+  // MongoDB indexes this handler's queries rely on, and sample queries of
+  // each shape it issues, for SetUpMongoIndexes
+  static std::vector<MongoIndexSpec> IndexSpecs();
+  static std::vector<MongoQueryShape> QueryShapes();
 
  private:
   mongoc_client_pool_t *_mongodb_client_pool;
   Redis *_redis_client_pool;
   RedisCluster *_redis_cluster_client_pool;
   ClientPool<ThriftClient<UserServiceClient>> *_user_service_client_pool;
+  SocialGraphSnapshot *_snapshot;
+  std::atomic<int64_t> _mongo_lookups_avoided{0};
+  std::mutex _warming_mutex;
+  std::unordered_set<std::string> _warming_keys;
+
+  // user_id and followee_id of FollowWithUsername/UnfollowWithUsername, in
+  // one UserService::GetUserIds call
+  void _GetUserIds(int64_t, const std::string &, const std::string &,
+                   const std::map<std::string, std::string> &, int64_t *,
+                   int64_t *);
+  static std::string _EmptyMarkerKey(const std::string &key);
+  static std::string _NewClaimToken();
+  bool _IsKnownEmpty(const std::string &key, std::string *claim);
+  std::vector<bool> _AreKnownEmpty(const std::vector<std::string> &keys,
+                                   std::vector<std::string> *claims);
+  void _MarkKnownEmpty(const std::string &key, const std::string &claim);
+  void _ClearKnownEmpty(const std::vector<std::string> &keys);
+  void _CountAvoidedLookup();
+  void _UpdateEdges(const std::vector<int64_t> &, const std::vector<int64_t> &,
+                    bool, const opentracing::SpanContext &);
+  // The filters of the MongoDB reads and writes, also used by QueryShapes,
+  // to be destroyed by the caller. _NewEdgeAbsentQuery matches the document
+  // of owner_id unless its field array already holds an edge to other_id.
+  static bson_t *_NewUserIdQuery(int64_t user_id);
+  static bson_t *_NewUserIdsQuery(const std::vector<int64_t> &user_ids);
+  static bson_t *_NewEdgeAbsentQuery(int64_t owner_id, const char *field,
+                                     int64_t other_id);
+  static void _ParseEdges(const bson_t *, const std::string &,
+                          std::vector<std::pair<int64_t, int64_t>> *);
+  bool _ReadEdgesFromMongo(int64_t, const std::string &,
+                           std::vector<std::pair<int64_t, int64_t>> *);
+  void _ReadEdgesFromMongo(
+      const std::vector<int64_t> &, const std::string &,
+      std::unordered_map<int64_t, std::vector<std::pair<int64_t, int64_t>>> *);
+  void _ReadEdgePageFromMongo(int64_t, const std::string &, int64_t, int64_t,
+                              int32_t,
+                              std::vector<std::pair<int64_t, int64_t>> *);
+  bool _CountEdgesInMongo(int64_t, const std::string &, int64_t *);
+  void _Zadd(const std::string &,
+             std::vector<std::pair<std::string, double>>::const_iterator,
+             std::vector<std::pair<std::string, double>>::const_iterator);
+  template <typename Interval>
+  void _ZrangeByScore(const std::string &, const Interval &, int64_t,
+                      std::vector<std::pair<std::string, double>> *);
+  void _WarmCacheAsync(const std::string &,
+                       std::function<int64_t(const std::string &)>);
+  void _WarmCacheAsync(const std::string &,
+                       std::vector<std::pair<std::string, double>>);
+  void _WarmCacheFromMongoAsync(int64_t, const std::string &);
+  static void _SortIds(std::vector<int64_t> *ids);
 };
 
 SocialGraphHandler::SocialGraphHandler(
     mongoc_client_pool_t *mongodb_client_pool, Redis *redis_client_pool,
-    ClientPool<ThriftClient<UserServiceClient>> *user_service_client_pool) {
+    ClientPool<ThriftClient<UserServiceClient>> *user_service_client_pool,
+    SocialGraphSnapshot *snapshot) {
   _mongodb_client_pool = mongodb_client_pool;
   _redis_client_pool = redis_client_pool;
   _redis_cluster_client_pool = nullptr;
   _user_service_client_pool = user_service_client_pool;
+  _snapshot = snapshot;
 }
 
 SocialGraphHandler::SocialGraphHandler(
     mongoc_client_pool_t *mongodb_client_pool,
     RedisCluster *redis_cluster_client_pool,
-    ClientPool<ThriftClient<UserServiceClient>> *user_service_client_pool) {
+    ClientPool<ThriftClient<UserServiceClient>> *user_service_client_pool,
+    SocialGraphSnapshot *snapshot) {
   _mongodb_client_pool = mongodb_client_pool;
   _redis_client_pool = nullptr;
   _redis_cluster_client_pool = redis_cluster_client_pool;
   _user_service_client_pool = user_service_client_pool;
+  _snapshot = snapshot;
 }
 
 void SocialGraphHandler::Follow(
@@ -114,10 +307,8 @@ void SocialGraphHandler::Follow(
 
         // Update follower->followee edges
         const bson_t *doc;
-        bson_t *search_not_exist = BCON_NEW(
-            "$and", "[", "{", "user_id", BCON_INT64(user_id), "}", "{",
-            "followees", "{", "$not", "{", "$elemMatch", "{", "user_id",
-            BCON_INT64(followee_id), "}", "}", "}", "}", "]");
+        bson_t *search_not_exist =
+            _NewEdgeAbsentQuery(user_id, "followees", followee_id);
         bson_t *update = BCON_NEW("$push", "{", "followees", "{", "user_id",
                                   BCON_INT64(followee_id), "timestamp",
                                   BCON_INT64(timestamp), "}", "}");
@@ -147,6 +338,7 @@ void SocialGraphHandler::Follow(
         bson_destroy(search_not_exist);
         mongoc_collection_destroy(collection);
         mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+        _ClearKnownEmpty({std::to_string(user_id) + ":followees"});
       });
 
   std::future<void> mongo_update_followee_future =
@@ -171,9 +363,7 @@ void SocialGraphHandler::Follow(
 
         // Update followee->follower edges
         bson_t *search_not_exist =
-            BCON_NEW("$and", "[", "{", "user_id", BCON_INT64(followee_id), "}",
-                     "{", "followers", "{", "$not", "{", "$elemMatch", "{",
-                     "user_id", BCON_INT64(user_id), "}", "}", "}", "}", "]");
+            _NewEdgeAbsentQuery(followee_id, "followers", user_id);
         bson_t *update = BCON_NEW("$push", "{", "followers", "{", "user_id",
                                   BCON_INT64(user_id), "timestamp",
                                   BCON_INT64(timestamp), "}", "}");
@@ -204,6 +394,7 @@ void SocialGraphHandler::Follow(
         bson_destroy(search_not_exist);
         mongoc_collection_destroy(collection);
         mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+        _ClearKnownEmpty({std::to_string(followee_id) + ":followers"});
       });
 
   std::future<void> redis_update_future = std::async(std::launch::async, [&]() {
@@ -258,6 +449,9 @@ void SocialGraphHandler::Follow(
     throw;
   }
 
+  if (_snapshot) {
+    _snapshot->Follow(user_id, followee_id);
+  }
   span->Finish();
 }
 
@@ -292,10 +486,8 @@ void SocialGraphHandler::Unfollow(
           mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
           throw se;
         }
-        bson_t *query = bson_new();
-
         // Update follower->followee edges
-        BSON_APPEND_INT64(query, "user_id", user_id);
+        bson_t *query = _NewUserIdQuery(user_id);
         bson_t *update = BCON_NEW("$pull", "{", "followees", "{", "user_id",
                                   BCON_INT64(followee_id), "}", "}");
         bson_t reply;
@@ -346,10 +538,8 @@ void SocialGraphHandler::Unfollow(
           mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
           throw se;
         }
-        bson_t *query = bson_new();
-
         // Update followee->follower edges
-        BSON_APPEND_INT64(query, "user_id", followee_id);
+        bson_t *query = _NewUserIdQuery(followee_id);
         bson_t *update = BCON_NEW("$pull", "{", "followers", "{", "user_id",
                                   BCON_INT64(user_id), "}", "}");
         bson_t reply;
@@ -424,6 +614,9 @@ void SocialGraphHandler::Unfollow(
     throw;
   }
 
+  if (_snapshot) {
+    _snapshot->Unfollow(user_id, followee_id);
+  }
   span->Finish();
 }
 
@@ -439,12 +632,18 @@ void SocialGraphHandler::GetFollowers(
       "get_followers_server", {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
+  if (_snapshot && _snapshot->GetFollowers(user_id, &_return)) {
+    span->Finish();
+    return;
+  }
+
   auto redis_span = opentracing::Tracer::Global()->StartSpan(
       "social_graph_redis_get_client",
       {opentracing::ChildOf(&span->context())});
 
   std::vector<std::string> followers_str;
   std::string key = std::to_string(user_id) + ":followers";
+  std::string claim;
   try {
     if (_redis_client_pool) {
       _redis_client_pool->zrange(key, 0, -1, std::back_inserter(followers_str));
@@ -464,6 +663,10 @@ void SocialGraphHandler::GetFollowers(
       _return.emplace_back(std::stoul(follower_str));
     }
   }
+  // The user is known to have no followers, skip MongoDB
+  else if (_IsKnownEmpty(key, &claim)) {
+    _CountAvoidedLookup();
+  }
   // If user_id in the sodical graph Redis server, read from MongoDB and
   // update Redis.
   else {
@@ -484,8 +687,7 @@ void SocialGraphHandler::GetFollowers(
       mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
       throw se;
     }
-    bson_t *query = bson_new();
-    BSON_APPEND_INT64(query, "user_id", user_id);
+    bson_t *query = _NewUserIdQuery(user_id);
     auto find_span = opentracing::Tracer::Global()->StartSpan(
         "social_graph_mongo_find_client",
         {opentracing::ChildOf(&span->context())});
@@ -528,17 +730,17 @@ void SocialGraphHandler::GetFollowers(
       mongoc_collection_destroy(collection);
       mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
 
-      // Update Redis
+      // Update Redis in the background
       std::string key = std::to_string(user_id) + ":followers";
       auto redis_insert_span = opentracing::Tracer::Global()->StartSpan(
           "social_graph_redis_insert_client",
           {opentracing::ChildOf(&span->context())});
       try {
-        if (_redis_client_pool) {
-          _redis_client_pool->zadd(key, redis_zset.begin(), redis_zset.end());
+        if (redis_zset.empty()) {
+          _MarkKnownEmpty(key, claim);
         } else {
-          _redis_cluster_client_pool->zadd(key, redis_zset.begin(),
-                                           redis_zset.end());
+          _WarmCacheAsync(key, std::vector<std::pair<std::string, double>>(
+                                   redis_zset.begin(), redis_zset.end()));
         }
       } catch (const Error &err) {
         LOG(error) << err.what();
@@ -569,12 +771,18 @@ void SocialGraphHandler::GetFollowees(
       "get_followees_server", {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
+  if (_snapshot && _snapshot->GetFollowees(user_id, &_return)) {
+    span->Finish();
+    return;
+  }
+
   auto redis_span = opentracing::Tracer::Global()->StartSpan(
       "social_graph_redis_get_client",
       {opentracing::ChildOf(&span->context())});
 
   std::vector<std::string> followees_str;
   std::string key = std::to_string(user_id) + ":followees";
+  std::string claim;
   try {
     if (_redis_client_pool) {
       _redis_client_pool->zrange(key, 0, -1, std::back_inserter(followees_str));
@@ -594,6 +802,10 @@ void SocialGraphHandler::GetFollowees(
       _return.emplace_back(std::stoul(followee_str));
     }
   }
+  // The user is known to follow nobody, skip MongoDB
+  else if (_IsKnownEmpty(key, &claim)) {
+    _CountAvoidedLookup();
+  }
   // If user_id in the sodical graph Redis server, read from MongoDB and
   // update Redis.
   else {
@@ -615,8 +827,7 @@ void SocialGraphHandler::GetFollowees(
       mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
       throw se;
     }
-    bson_t *query = bson_new();
-    BSON_APPEND_INT64(query, "user_id", user_id);
+    bson_t *query = _NewUserIdQuery(user_id);
     auto find_span = opentracing::Tracer::Global()->StartSpan(
         "social_graph_mongo_find_client",
         {opentracing::ChildOf(&span->context())});
@@ -672,17 +883,17 @@ void SocialGraphHandler::GetFollowees(
       mongoc_collection_destroy(collection);
       mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
 
-      // Update redis
+      // Update redis in the background
       std::string key = std::to_string(user_id) + ":followees";
       auto redis_insert_span = opentracing::Tracer::Global()->StartSpan(
           "social_graph_redis_insert_client",
           {opentracing::ChildOf(&span->context())});
       try {
-        if (_redis_client_pool) {
-          _redis_client_pool->zadd(key, redis_zset.begin(), redis_zset.end());
+        if (redis_zset.empty()) {
+          _MarkKnownEmpty(key, claim);
         } else {
-          _redis_cluster_client_pool->zadd(key, redis_zset.begin(),
-                                           redis_zset.end());
+          _WarmCacheAsync(key, std::vector<std::pair<std::string, double>>(
+                                   redis_zset.begin(), redis_zset.end()));
         }
       } catch (const Error &err) {
         LOG(error) << err.what();
@@ -724,6 +935,22 @@ void SocialGraphHandler::InsertUser(
     throw se;
   }
 
+  // Claimed before the insert, so a Follow of the new user that lands
+  // before the markers are set keeps them unset
+  std::vector<std::string> keys = {std::to_string(user_id) + ":followers",
+                                   std::to_string(user_id) + ":followees"};
+  std::vector<std::string> claims(keys.size());
+  bool claimed = true;
+  try {
+    for (size_t i = 0; i < keys.size(); i++) {
+      _IsKnownEmpty(keys[i], &claims[i]);
+    }
+  } catch (const Error &err) {
+    LOG(warning) << "Failed to claim the empty markers of user " << user_id
+                 << ": " << err.what();
+    claimed = false;
+  }
+
   bson_t *new_doc = BCON_NEW("user_id", BCON_INT64(user_id), "followers", "[",
                              "]", "followees", "[", "]");
   bson_error_t error;
@@ -747,7 +974,196 @@ void SocialGraphHandler::InsertUser(
   bson_destroy(new_doc);
   mongoc_collection_destroy(collection);
   mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+
+  // A new user has neither followers nor followees
+  if (_snapshot) {
+    _snapshot->InsertUser(user_id);
+  }
+  try {
+    for (size_t i = 0; claimed && i < keys.size(); i++) {
+      _MarkKnownEmpty(keys[i], claims[i]);
+    }
+  } catch (const Error &err) {
+    LOG(warning) << "Failed to mark social graph of user " << user_id
+                 << " as empty: " << err.what();
+  }
+  span->Finish();
+}
+
+// InsertUser for many users, with one unordered bulk insert to MongoDB and
+// the empty markers of all of them in one Redis pipeline per shard. A user
+// whose document already exists is left as it is; the users that were
+// inserted are always marked, even if the insert of another one failed.
+void SocialGraphHandler::InsertUsers(
+    int64_t req_id, const std::vector<int64_t> &user_ids,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "insert_users_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  if (user_ids.empty()) {
+    span->Finish();
+    return;
+  }
+
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(_mongodb_client_pool);
+  if (!mongodb_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    throw se;
+  }
+  auto collection = mongoc_client_get_collection(mongodb_client, "social-graph",
+                                                 "social-graph");
+  if (!collection) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to create collection social_graph from MongoDB";
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
+
+  // The follower and followee markers of user_ids[i] are markers[2 * i] and
+  // markers[2 * i + 1], claimed before the insert as in InsertUser
+  std::vector<std::string> markers;
+  std::vector<std::string> claims;
+  std::string claim_ttl = std::to_string(EMPTY_MARKER_CLAIM_TTL);
+  bool claimed = true;
+  try {
+    RedisPipelines pipes(_redis_client_pool, _redis_cluster_client_pool);
+    for (auto user_id : user_ids) {
+      for (auto field : {":followers", ":followees"}) {
+        markers.emplace_back(_EmptyMarkerKey(std::to_string(user_id) + field));
+        claims.emplace_back(_NewClaimToken());
+        pipes.For(markers.back())
+            ->eval(EMPTY_MARKER_CLAIM_SCRIPT, {markers.back()},
+                   {claims.back(), claim_ttl});
+      }
+    }
+    pipes.Exec();
+  } catch (const Error &err) {
+    LOG(warning) << "Failed to claim the empty markers of " << user_ids.size()
+                 << " users: " << err.what();
+    claimed = false;
+  }
+
+  bson_t *bulk_opts = BCON_NEW("ordered", BCON_BOOL(false));
+  mongoc_bulk_operation_t *bulk =
+      mongoc_collection_create_bulk_operation_with_opts(collection, bulk_opts);
+  for (auto user_id : user_ids) {
+    bson_t *new_doc = BCON_NEW("user_id", BCON_INT64(user_id), "followers",
+                               "[", "]", "followees", "[", "]");
+    mongoc_bulk_operation_insert(bulk, new_doc);
+    bson_destroy(new_doc);
+  }
+  bson_error_t error;
+  bson_t reply;
+  auto insert_span = opentracing::Tracer::Global()->StartSpan(
+      "social_graph_mongo_bulk_insert_client",
+      {opentracing::ChildOf(&span->context())});
+  bool ok = mongoc_bulk_operation_execute(bulk, &reply, &error);
+  insert_span->Finish();
+  // An unordered bulk write reports the items it rejected in "writeErrors",
+  // by their index in the bulk; a duplicate key means the user is already
+  // in the social graph
+  std::vector<bool> inserted(user_ids.size(), ok);
+  std::string item_error;
+  bson_iter_t iter;
+  bson_iter_t iter_errors;
+  if (!ok && bson_iter_init_find(&iter, &reply, "writeErrors") &&
+      BSON_ITER_HOLDS_ARRAY(&iter) &&
+      bson_iter_recurse(&iter, &iter_errors)) {
+    inserted.assign(user_ids.size(), true);
+    while (bson_iter_next(&iter_errors)) {
+      bson_iter_t iter_error;
+      if (!BSON_ITER_HOLDS_DOCUMENT(&iter_errors) ||
+          !bson_iter_recurse(&iter_errors, &iter_error)) {
+        continue;
+      }
+      int64_t index = -1;
+      int64_t code = 0;
+      std::string errmsg = error.message;
+      while (bson_iter_next(&iter_error)) {
+        const char *field = bson_iter_key(&iter_error);
+        if (std::strcmp(field, "index") == 0) {
+          index = bson_iter_as_int64(&iter_error);
+        } else if (std::strcmp(field, "code") == 0) {
+          code = bson_iter_as_int64(&iter_error);
+        } else if (std::strcmp(field, "errmsg") == 0 &&
+                   BSON_ITER_HOLDS_UTF8(&iter_error)) {
+          errmsg = bson_iter_utf8(&iter_error, nullptr);
+        }
+      }
+      if (index < 0 || (size_t)index >= user_ids.size()) {
+        continue;
+      }
+      inserted[index] = false;
+      if (code != MONGODB_DUPLICATE_KEY_ERROR && item_error.empty()) {
+        item_error = "Failed to insert social graph for user " +
+                     std::to_string(user_ids[index]) + ": " + errmsg;
+      }
+    }
+  } else if (!ok) {
+    item_error = error.message;
+  }
+  bson_destroy(&reply);
+  mongoc_bulk_operation_destroy(bulk);
+  bson_destroy(bulk_opts);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+
+  std::vector<int64_t> new_user_ids;
+  for (size_t i = 0; i < user_ids.size(); i++) {
+    if (inserted[i]) {
+      new_user_ids.emplace_back(user_ids[i]);
+    }
+  }
+  if (_snapshot) {
+    for (auto user_id : new_user_ids) {
+      _snapshot->InsertUser(user_id);
+    }
+  }
+  auto redis_span = opentracing::Tracer::Global()->StartSpan(
+      "social_graph_redis_insert_client",
+      {opentracing::ChildOf(&span->context())});
+  try {
+    RedisPipelines pipes(_redis_client_pool, _redis_cluster_client_pool);
+    for (size_t i = 0; claimed && i < user_ids.size(); i++) {
+      if (!inserted[i]) {
+        continue;
+      }
+      std::string user_id_str = std::to_string(user_ids[i]);
+      std::string keys[] = {user_id_str + ":followers",
+                            user_id_str + ":followees"};
+      for (size_t j = 0; j < 2; j++) {
+        pipes.For(markers[2 * i + j])
+            ->eval(EMPTY_MARKER_SET_SCRIPT, {markers[2 * i + j], keys[j]},
+                   {claims[2 * i + j]});
+      }
+    }
+    pipes.Exec();
+  } catch (const Error &err) {
+    LOG(warning) << "Failed to mark social graph of " << new_user_ids.size()
+                 << " users as empty: " << err.what();
+  }
+  redis_span->Finish();
   span->Finish();
+
+  if (!item_error.empty()) {
+    LOG(error) << "Inserted social graph for " << new_user_ids.size()
+               << " of " << user_ids.size()
+               << " users to MongoDB: " << item_error;
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = item_error;
+    throw se;
+  }
 }
 
 void SocialGraphHandler::FollowWithUsername(
@@ -764,59 +1180,10 @@ void SocialGraphHandler::FollowWithUsername(
       {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
-  std::future<int64_t> user_id_future = std::async(std::launch::async, [&]() {
-    auto user_client_wrapper = _user_service_client_pool->Pop();
-    if (!user_client_wrapper) {
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
-      se.message = "Failed to connect to social-graph-service";
-      throw se;
-    }
-    auto user_client = user_client_wrapper->GetClient();
-    int64_t _return;
-    try {
-      _return = user_client->GetUserId(req_id, user_name, writer_text_map);
-    } catch (...) {
-      _user_service_client_pool->Remove(user_client_wrapper);
-      LOG(error) << "Failed to get user_id from user-service";
-      throw;
-    }
-    _user_service_client_pool->Keepalive(user_client_wrapper);
-    return _return;
-  });
-
-  std::future<int64_t> followee_id_future =
-      std::async(std::launch::async, [&]() {
-        auto user_client_wrapper = _user_service_client_pool->Pop();
-        if (!user_client_wrapper) {
-          ServiceException se;
-          se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
-          se.message = "Failed to connect to social-graph-service";
-          throw se;
-        }
-        auto user_client = user_client_wrapper->GetClient();
-        int64_t _return;
-        try {
-          _return =
-              user_client->GetUserId(req_id, followee_name, writer_text_map);
-        } catch (...) {
-          _user_service_client_pool->Remove(user_client_wrapper);
-          LOG(error) << "Failed to get user_id from user-service";
-          throw;
-        }
-        _user_service_client_pool->Keepalive(user_client_wrapper);
-        return _return;
-      });
-
   int64_t user_id;
   int64_t followee_id;
-  try {
-    user_id = user_id_future.get();
-    followee_id = followee_id_future.get();
-  } catch (const std::exception &e) {
-    LOG(warning) << e.what();
-    throw;
-  }
+  _GetUserIds(req_id, user_name, followee_name, writer_text_map, &user_id,
+              &followee_id);
 
   if (user_id >= 0 && followee_id >= 0) {
     Follow(req_id, user_id, followee_id, writer_text_map);
@@ -838,69 +1205,1228 @@ void SocialGraphHandler::UnfollowWithUsername(
       {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
-  std::future<int64_t> user_id_future = std::async(std::launch::async, [&]() {
-    auto user_client_wrapper = _user_service_client_pool->Pop();
-    if (!user_client_wrapper) {
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
-      se.message = "Failed to connect to social-graph-service";
-      throw se;
-    }
-    auto user_client = user_client_wrapper->GetClient();
-    int64_t _return;
+  int64_t user_id;
+  int64_t followee_id;
+  _GetUserIds(req_id, user_name, followee_name, writer_text_map, &user_id,
+              &followee_id);
+
+  if (user_id >= 0 && followee_id >= 0) {
     try {
-      _return = user_client->GetUserId(req_id, user_name, writer_text_map);
+      Unfollow(req_id, user_id, followee_id, writer_text_map);
     } catch (...) {
-      _user_service_client_pool->Remove(user_client_wrapper);
-      LOG(error) << "Failed to get user_id from user-service";
       throw;
     }
-    _user_service_client_pool->Keepalive(user_client_wrapper);
-    return _return;
-  });
-
-  std::future<int64_t> followee_id_future =
-      std::async(std::launch::async, [&]() {
-        auto user_client_wrapper = _user_service_client_pool->Pop();
-        if (!user_client_wrapper) {
-          ServiceException se;
-          se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
-          se.message = "Failed to connect to social-graph-service";
-          throw se;
-        }
-        auto user_client = user_client_wrapper->GetClient();
-        int64_t _return;
-        try {
-          _return =
-              user_client->GetUserId(req_id, followee_name, writer_text_map);
-        } catch (...) {
-          _user_service_client_pool->Remove(user_client_wrapper);
-          LOG(error) << "Failed to get user_id from user-service";
-          throw;
-        }
-        _user_service_client_pool->Keepalive(user_client_wrapper);
-        return _return;
-      });
+  }
+  span->Finish();
+}
 
-  int64_t user_id;
-  int64_t followee_id;
+void SocialGraphHandler::_GetUserIds(
+    int64_t req_id, const std::string &user_name,
+    const std::string &followee_name,
+    const std::map<std::string, std::string> &carrier, int64_t *user_id,
+    int64_t *followee_id) {
+  auto user_client_wrapper = _user_service_client_pool->Pop();
+  if (!user_client_wrapper) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
+    se.message = "Failed to connect to user-service";
+    throw se;
+  }
+  auto user_client = user_client_wrapper->GetClient();
+  std::map<std::string, int64_t> user_ids;
   try {
-    user_id = user_id_future.get();
-    followee_id = followee_id_future.get();
+    user_client->GetUserIds(user_ids, req_id, {user_name, followee_name},
+                            carrier);
   } catch (...) {
+    _user_service_client_pool->Remove(user_client_wrapper);
+    LOG(error) << "Failed to get user_ids from user-service";
     throw;
   }
+  _user_service_client_pool->Keepalive(user_client_wrapper);
 
-  if (user_id >= 0 && followee_id >= 0) {
-    try {
-      Unfollow(req_id, user_id, followee_id, writer_text_map);
-    } catch (...) {
-      throw;
+  for (auto &username : {user_name, followee_name}) {
+    if (!user_ids.count(username)) {
+      LOG(warning) << "User: " << username << " is not registered";
+      ServiceException se;
+      se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+      se.message = "User: " + username + " is not registered";
+      throw se;
     }
   }
+  *user_id = user_ids[user_name];
+  *followee_id = user_ids[followee_name];
+}
+
+void SocialGraphHandler::FollowMany(
+    int64_t req_id, const std::vector<int64_t> &user_ids,
+    const std::vector<int64_t> &followee_ids,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "follow_many_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  _UpdateEdges(user_ids, followee_ids, true, span->context());
+  span->Finish();
+}
+
+void SocialGraphHandler::UnfollowMany(
+    int64_t req_id, const std::vector<int64_t> &user_ids,
+    const std::vector<int64_t> &followee_ids,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "unfollow_many_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  _UpdateEdges(user_ids, followee_ids, false, span->context());
   span->Finish();
 }
 
+// Applies the edges user_ids[i] -> followee_ids[i] with one unordered bulk
+// write to MongoDB and one Redis pipeline per shard, instead of the two
+// find_and_modify calls and one pipeline per edge that Follow/Unfollow use.
+void SocialGraphHandler::_UpdateEdges(
+    const std::vector<int64_t> &user_ids,
+    const std::vector<int64_t> &followee_ids, bool follow,
+    const opentracing::SpanContext &span_context) {
+  if (user_ids.size() != followee_ids.size()) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "user_ids and followee_ids must have the same length";
+    throw se;
+  }
+  if (user_ids.empty()) {
+    return;
+  }
+
+  int64_t timestamp =
+      duration_cast<milliseconds>(system_clock::now().time_since_epoch())
+          .count();
+
+  std::future<void> mongo_update_future = std::async(std::launch::async, [&]() {
+    mongoc_client_t *mongodb_client =
+        mongoc_client_pool_pop(_mongodb_client_pool);
+    if (!mongodb_client) {
+      ServiceException se;
+      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+      se.message = "Failed to pop a client from MongoDB pool";
+      throw se;
+    }
+    auto collection = mongoc_client_get_collection(
+        mongodb_client, "social-graph", "social-graph");
+    if (!collection) {
+      ServiceException se;
+      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+      se.message = "Failed to create collection social_graph from MongoDB";
+      mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+      throw se;
+    }
+
+    bson_t *bulk_opts = BCON_NEW("ordered", BCON_BOOL(false));
+    mongoc_bulk_operation_t *bulk =
+        mongoc_collection_create_bulk_operation_with_opts(collection,
+                                                          bulk_opts);
+    bson_error_t error;
+    bool queued = true;
+    // Each edge updates both endpoints: <user_id>.followees and
+    // <followee_id>.followers
+    auto queue_update = [&](int64_t owner_id, const char *field,
+                            int64_t other_id) {
+      bson_t *selector;
+      bson_t *update;
+      if (follow) {
+        selector = _NewEdgeAbsentQuery(owner_id, field, other_id);
+        update = BCON_NEW("$push", "{", field, "{", "user_id",
+                          BCON_INT64(other_id), "timestamp",
+                          BCON_INT64(timestamp), "}", "}");
+      } else {
+        selector = _NewUserIdQuery(owner_id);
+        update = BCON_NEW("$pull", "{", field, "{", "user_id",
+                          BCON_INT64(other_id), "}", "}");
+      }
+      if (!mongoc_bulk_operation_update_one_with_opts(bulk, selector, update,
+                                                      nullptr, &error)) {
+        queued = false;
+      }
+      bson_destroy(update);
+      bson_destroy(selector);
+    };
+    for (size_t i = 0; i < user_ids.size() && queued; ++i) {
+      queue_update(user_ids[i], "followees", followee_ids[i]);
+      queue_update(followee_ids[i], "followers", user_ids[i]);
+    }
+
+    bson_t reply;
+    auto update_span = opentracing::Tracer::Global()->StartSpan(
+        "social_graph_mongo_bulk_update_client",
+        {opentracing::ChildOf(&span_context)});
+    bool updated =
+        queued && mongoc_bulk_operation_execute(bulk, &reply, &error);
+    update_span->Finish();
+    if (queued) {
+      bson_destroy(&reply);
+    }
+    mongoc_bulk_operation_destroy(bulk);
+    bson_destroy(bulk_opts);
+    mongoc_collection_destroy(collection);
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    // Even a failed unordered bulk may have pushed some of the edges
+    if (follow) {
+      std::vector<std::string> keys;
+      for (size_t i = 0; i < user_ids.size(); ++i) {
+        keys.emplace_back(std::to_string(user_ids[i]) + ":followees");
+        keys.emplace_back(std::to_string(followee_ids[i]) + ":followers");
+      }
+      _ClearKnownEmpty(keys);
+    }
+    if (!updated) {
+      LOG(error) << "Failed to update " << user_ids.size()
+                 << " social graph edges to MongoDB: " << error.message;
+      ServiceException se;
+      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+      se.message = error.message;
+      throw se;
+    }
+  });
+
+  std::future<void> redis_update_future = std::async(std::launch::async, [&]() {
+    auto redis_span = opentracing::Tracer::Global()->StartSpan(
+        "social_graph_redis_update_client",
+        {opentracing::ChildOf(&span_context)});
+
+    RedisPipelines pipes(_redis_client_pool, _redis_cluster_client_pool);
+    try {
+      for (size_t i = 0; i < user_ids.size(); ++i) {
+        std::string user_id_str = std::to_string(user_ids[i]);
+        std::string followee_id_str = std::to_string(followee_ids[i]);
+        std::string followee_key = user_id_str + ":followees";
+        std::string follower_key = followee_id_str + ":followers";
+        if (follow) {
+          pipes.For(followee_key)
+              ->zadd(followee_key, followee_id_str, timestamp,
+                     UpdateType::NOT_EXIST);
+          pipes.For(follower_key)
+              ->zadd(follower_key, user_id_str, timestamp,
+                     UpdateType::NOT_EXIST);
+        } else {
+          pipes.For(followee_key)->zrem(followee_key, followee_id_str);
+          pipes.For(follower_key)->zrem(follower_key, user_id_str);
+        }
+      }
+      pipes.Exec();
+    } catch (const Error &err) {
+      LOG(error) << err.what();
+      throw err;
+    }
+    redis_span->Finish();
+  });
+
+  try {
+    redis_update_future.get();
+    mongo_update_future.get();
+  } catch (const std::exception &e) {
+    LOG(warning) << e.what();
+    throw;
+  }
+
+  if (_snapshot) {
+    for (size_t i = 0; i < user_ids.size(); ++i) {
+      if (follow) {
+        _snapshot->Follow(user_ids[i], followee_ids[i]);
+      } else {
+        _snapshot->Unfollow(user_ids[i], followee_ids[i]);
+      }
+    }
+  }
+}
+
+// Users followed by both user_id and other_user_id, in ascending order.
+void SocialGraphHandler::GetMutualFollows(
+    std::vector<int64_t> &_return, int64_t req_id, int64_t user_id,
+    int64_t other_user_id, const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "get_mutual_follows_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  std::vector<int64_t> followees;
+  std::vector<int64_t> other_followees;
+  std::future<void> other_followees_future =
+      std::async(std::launch::async, [&]() {
+        GetFollowees(other_followees, req_id, other_user_id, writer_text_map);
+        _SortIds(&other_followees);
+      });
+  try {
+    GetFollowees(followees, req_id, user_id, writer_text_map);
+    _SortIds(&followees);
+    other_followees_future.get();
+  } catch (const std::exception &e) {
+    LOG(warning) << e.what();
+    throw;
+  }
+
+  IntersectSorted(followees, other_followees, &_return);
+  span->Finish();
+}
+
+// Users following every one of user_ids, in ascending order. The lists the
+// snapshot lacks are read with one Redis pipeline, and those Redis lacks with
+// one MongoDB $in query and warmed, so a call costs a fixed number of round
+// trips and no threads however many user_ids it is given.
+void SocialGraphHandler::GetFollowersInCommon(
+    std::vector<int64_t> &_return, int64_t req_id,
+    const std::vector<int64_t> &user_ids,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "get_followers_in_common_server",
+      {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  std::vector<std::vector<int64_t>> followers(user_ids.size());
+  std::vector<size_t> pending;
+  for (size_t i = 0; i < user_ids.size(); ++i) {
+    if (!_snapshot || !_snapshot->GetFollowers(user_ids[i], &followers[i])) {
+      pending.emplace_back(i);
+    }
+  }
+
+  std::vector<size_t> uncached;
+  auto add_cached = [&](size_t i,
+                        const std::vector<std::string> &followers_str) {
+    if (followers_str.empty()) {
+      uncached.emplace_back(i);
+      return;
+    }
+    for (auto const &follower_str : followers_str) {
+      followers[i].emplace_back(std::stoul(follower_str));
+    }
+  };
+  if (!pending.empty()) {
+    auto redis_span = opentracing::Tracer::Global()->StartSpan(
+        "social_graph_redis_get_client",
+        {opentracing::ChildOf(&span->context())});
+    try {
+      if (_redis_client_pool) {
+        auto pipe = _redis_client_pool->pipeline(false);
+        for (auto i : pending) {
+          pipe.zrange(std::to_string(user_ids[i]) + ":followers", 0, -1);
+        }
+        auto replies = pipe.exec();
+        for (size_t k = 0; k < pending.size(); ++k) {
+          std::vector<std::string> followers_str;
+          replies.get(k, std::back_inserter(followers_str));
+          add_cached(pending[k], followers_str);
+        }
+      } else {
+        // One request per user, see the note on cluster pipelines in Follow
+        for (auto i : pending) {
+          std::vector<std::string> followers_str;
+          _redis_cluster_client_pool->zrange(
+              std::to_string(user_ids[i]) + ":followers", 0, -1,
+              std::back_inserter(followers_str));
+          add_cached(i, followers_str);
+        }
+      }
+    } catch (const Error &err) {
+      LOG(error) << err.what();
+      throw err;
+    }
+    redis_span->Finish();
+  }
+
+  if (!uncached.empty()) {
+    std::vector<std::string> keys;
+    for (auto i : uncached) {
+      keys.emplace_back(std::to_string(user_ids[i]) + ":followers");
+    }
+    std::vector<std::string> claims;
+    auto known_empty = _AreKnownEmpty(keys, &claims);
+    std::vector<int64_t> mongo_user_ids;
+    for (size_t k = 0; k < uncached.size(); ++k) {
+      if (known_empty[k]) {
+        _CountAvoidedLookup();
+      } else {
+        mongo_user_ids.emplace_back(user_ids[uncached[k]]);
+      }
+    }
+
+    std::unordered_map<int64_t, std::vector<std::pair<int64_t, int64_t>>>
+        edges;
+    if (!mongo_user_ids.empty()) {
+      auto find_span = opentracing::Tracer::Global()->StartSpan(
+          "social_graph_mongo_find_client",
+          {opentracing::ChildOf(&span->context())});
+      _ReadEdgesFromMongo(mongo_user_ids, "followers", &edges);
+      find_span->Finish();
+    }
+
+    // Update Redis in the background
+    try {
+      for (size_t k = 0; k < uncached.size(); ++k) {
+        if (known_empty[k]) {
+          continue;
+        }
+        size_t i = uncached[k];
+        auto user_edges = edges.find(user_ids[i]);
+        if (user_edges == edges.end()) {
+          LOG(warning) << "user_id: " << user_ids[i] << " not found";
+          continue;
+        }
+        if (user_edges->second.empty()) {
+          _MarkKnownEmpty(keys[k], claims[k]);
+          continue;
+        }
+        std::vector<std::pair<std::string, double>> members;
+        for (auto const &edge : user_edges->second) {
+          followers[i].emplace_back(edge.first);
+          members.emplace_back(std::to_string(edge.first),
+                               (double)edge.second);
+        }
+        _WarmCacheAsync(keys[k], std::move(members));
+      }
+    } catch (const Error &err) {
+      LOG(error) << err.what();
+      throw err;
+    }
+  }
+
+  std::vector<const std::vector<int64_t> *> lists;
+  for (auto &list : followers) {
+    _SortIds(&list);
+    lists.emplace_back(&list);
+  }
+  IntersectSorted(lists, &_return);
+  span->Finish();
+}
+
+// _return[i] is whether user_ids[i] follows followee_ids[i]. Each pair is
+// answered by the snapshot or a ZSCORE on "<user_id>:followees" rather than by
+// reading the whole list; a missing score only means "not following" when
+// the ZSET is cached, otherwise the list is loaded once through GetFollowees,
+// which also warms Redis for the next call.
+void SocialGraphHandler::IsFollowing(
+    std::vector<bool> &_return, int64_t req_id,
+    const std::vector<int64_t> &user_ids,
+    const std::vector<int64_t> &followee_ids,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "is_following_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  if (user_ids.size() != followee_ids.size()) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "user_ids and followee_ids must have the same length";
+    throw se;
+  }
+  _return.assign(user_ids.size(), false);
+
+  std::vector<size_t> pending;
+  for (size_t i = 0; i < user_ids.size(); ++i) {
+    bool following;
+    if (_snapshot &&
+        _snapshot->IsFollowing(user_ids[i], followee_ids[i], &following)) {
+      _return[i] = following;
+    } else {
+      pending.emplace_back(i);
+    }
+  }
+  if (pending.empty()) {
+    span->Finish();
+    return;
+  }
+
+  std::vector<size_t> uncached;
+  auto redis_span = opentracing::Tracer::Global()->StartSpan(
+      "social_graph_redis_zscore_client",
+      {opentracing::ChildOf(&span->context())});
+  try {
+    if (_redis_client_pool) {
+      auto pipe = _redis_client_pool->pipeline(false);
+      for (auto i : pending) {
+        std::string key = std::to_string(user_ids[i]) + ":followees";
+        pipe.zscore(key, std::to_string(followee_ids[i])).exists(key);
+      }
+      auto replies = pipe.exec();
+      for (size_t k = 0; k < pending.size(); ++k) {
+        if (replies.get<OptionalDouble>(2 * k)) {
+          _return[pending[k]] = true;
+        } else if (replies.get<long long>(2 * k + 1) == 0) {
+          uncached.emplace_back(pending[k]);
+        }
+      }
+    } else {
+      // One request per pair, see the note on cluster pipelines in Follow
+      for (auto i : pending) {
+        std::string key = std::to_string(user_ids[i]) + ":followees";
+        if (_redis_cluster_client_pool->zscore(
+                key, std::to_string(followee_ids[i]))) {
+          _return[i] = true;
+        } else if (_redis_cluster_client_pool->exists(key) == 0) {
+          uncached.emplace_back(i);
+        }
+      }
+    }
+  } catch (const Error &err) {
+    LOG(error) << err.what();
+    throw err;
+  }
+  redis_span->Finish();
+
+  std::unordered_map<int64_t, std::vector<int64_t>> followees_cache;
+  for (auto i : uncached) {
+    auto followees = followees_cache.find(user_ids[i]);
+    if (followees == followees_cache.end()) {
+      followees =
+          followees_cache.emplace(user_ids[i], std::vector<int64_t>()).first;
+      GetFollowees(followees->second, req_id, user_ids[i], writer_text_map);
+      _SortIds(&followees->second);
+    }
+    _return[i] = std::binary_search(followees->second.begin(),
+                                    followees->second.end(), followee_ids[i]);
+  }
+  span->Finish();
+}
+
+// Number of followers of user_id, without reading the list. ZCARD answers
+// for a cached user; a cold one is counted by MongoDB with $size and is not
+// warmed, since the caller does not need the list.
+int64_t SocialGraphHandler::GetFollowerCount(
+    int64_t req_id, int64_t user_id,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "get_follower_count_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  int64_t count = 0;
+  if (_snapshot && _snapshot->GetFollowerCount(user_id, &count)) {
+    span->Finish();
+    return count;
+  }
+
+  std::string key = std::to_string(user_id) + ":followers";
+  auto redis_span = opentracing::Tracer::Global()->StartSpan(
+      "social_graph_redis_zcard_client",
+      {opentracing::ChildOf(&span->context())});
+  try {
+    if (_redis_client_pool) {
+      count = _redis_client_pool->zcard(key);
+    } else {
+      count = _redis_cluster_client_pool->zcard(key);
+    }
+  } catch (const Error &err) {
+    LOG(error) << err.what();
+    throw err;
+  }
+  redis_span->Finish();
+
+  if (count == 0) {
+    std::string claim;
+    if (_IsKnownEmpty(key, &claim)) {
+      _CountAvoidedLookup();
+    } else {
+      auto find_span = opentracing::Tracer::Global()->StartSpan(
+          "social_graph_mongo_count_client",
+          {opentracing::ChildOf(&span->context())});
+      bool found = _CountEdgesInMongo(user_id, "followers", &count);
+      find_span->Finish();
+      if (!found) {
+        LOG(warning) << "user_id: " << user_id << " not found";
+      } else if (count == 0) {
+        try {
+          _MarkKnownEmpty(key, claim);
+        } catch (const Error &err) {
+          LOG(error) << err.what();
+          throw err;
+        }
+      }
+    }
+  }
+  span->Finish();
+  return count;
+}
+
+// Up to limit followers of user_id in (follow timestamp, user_id) order,
+// starting after (after_timestamp, after_user_id); after_timestamp -1 starts
+// at the first follower. The snapshot keeps no follow timestamps, so pages
+// are read from Redis or, for a cold user, sorted by MongoDB while the full
+// list is warmed in the background.
+void SocialGraphHandler::GetFollowersPage(
+    FollowersPage &_return, int64_t req_id, int64_t user_id,
+    int64_t after_timestamp, int64_t after_user_id, int32_t limit,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "get_followers_page_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  if (after_timestamp < -1 || limit < 0) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "after_timestamp must be -1 or a timestamp and limit must "
+                 "not be negative";
+    throw se;
+  }
+  _return.next_timestamp = after_timestamp;
+  _return.next_user_id = after_user_id;
+  if (limit == 0) {
+    span->Finish();
+    return;
+  }
+
+  // (timestamp, user_id) of the followers after the cursor
+  std::vector<std::pair<int64_t, int64_t>> page;
+  std::vector<std::pair<std::string, double>> ties;
+  std::vector<std::pair<std::string, double>> rest;
+  bool cached;
+  std::string key = std::to_string(user_id) + ":followers";
+  std::string claim;
+  auto redis_span = opentracing::Tracer::Global()->StartSpan(
+      "social_graph_redis_get_client",
+      {opentracing::ChildOf(&span->context())});
+  try {
+    // Redis orders equal scores by member string rather than by user_id, so
+    // a run of followers with the same timestamp is always read whole:
+    // the rest of the run at the cursor, and the run LIMIT cut off last.
+    if (after_timestamp >= 0) {
+      _ZrangeByScore(key,
+                     BoundedInterval<double>(after_timestamp, after_timestamp,
+                                             BoundType::CLOSED),
+                     -1, &ties);
+    }
+    _ZrangeByScore(key,
+                   LeftBoundedInterval<double>(after_timestamp,
+                                               BoundType::LEFT_OPEN),
+                   limit, &rest);
+    if (rest.size() == (size_t)limit) {
+      double last = rest.back().second;
+      while (!rest.empty() && rest.back().second == last) {
+        rest.pop_back();
+      }
+      _ZrangeByScore(key,
+                     BoundedInterval<double>(last, last, BoundType::CLOSED),
+                     -1, &rest);
+    }
+    cached = !ties.empty() || !rest.empty();
+    if (!cached) {
+      cached = _redis_client_pool ? _redis_client_pool->exists(key) > 0
+                                  : _redis_cluster_client_pool->exists(key) > 0;
+    }
+  } catch (const Error &err) {
+    LOG(error) << err.what();
+    throw err;
+  }
+  redis_span->Finish();
+
+  if (cached) {
+    for (auto const &member : ties) {
+      int64_t follower_id = std::stoll(member.first);
+      if (follower_id > after_user_id) {
+        page.emplace_back(after_timestamp, follower_id);
+      }
+    }
+    for (auto const &member : rest) {
+      page.emplace_back((int64_t)member.second, std::stoll(member.first));
+    }
+    std::sort(page.begin(), page.end());
+    if (page.size() > (size_t)limit) {
+      page.resize(limit);
+    }
+  } else if (_IsKnownEmpty(key, &claim)) {
+    _CountAvoidedLookup();
+  } else {
+    auto find_span = opentracing::Tracer::Global()->StartSpan(
+        "social_graph_mongo_find_client",
+        {opentracing::ChildOf(&span->context())});
+    _ReadEdgePageFromMongo(user_id, "followers", after_timestamp,
+                           after_user_id, limit, &page);
+    find_span->Finish();
+    _WarmCacheFromMongoAsync(user_id, "followers");
+  }
+
+  for (auto const &edge : page) {
+    _return.followers.emplace_back(edge.second);
+  }
+  if (!page.empty()) {
+    _return.next_timestamp = page.back().first;
+    _return.next_user_id = page.back().second;
+  }
+  span->Finish();
+}
+
+std::string SocialGraphHandler::_EmptyMarkerKey(const std::string &key) {
+  return "{" + key + "}" EMPTY_MARKER_SUFFIX;
+}
+
+std::string SocialGraphHandler::_NewClaimToken() {
+  thread_local std::mt19937_64 gen(std::random_device{}());
+  return "claim:" + std::to_string(gen());
+}
+
+// Returns true if key is known to be empty. Otherwise claims its marker and
+// sets *claim to the token _MarkKnownEmpty takes once MongoDB has been read.
+bool SocialGraphHandler::_IsKnownEmpty(const std::string &key,
+                                       std::string *claim) {
+  *claim = _NewClaimToken();
+  std::string ttl = std::to_string(EMPTY_MARKER_CLAIM_TTL);
+  try {
+    if (_redis_client_pool) {
+      return _redis_client_pool->eval<long long>(EMPTY_MARKER_CLAIM_SCRIPT,
+                                                 {_EmptyMarkerKey(key)},
+                                                 {*claim, ttl}) == 1;
+    } else {
+      return _redis_cluster_client_pool->eval<long long>(
+                 EMPTY_MARKER_CLAIM_SCRIPT, {_EmptyMarkerKey(key)},
+                 {*claim, ttl}) == 1;
+    }
+  } catch (const Error &err) {
+    LOG(error) << err.what();
+    throw err;
+  }
+}
+
+// _IsKnownEmpty of each of keys, in one pipeline on a standalone server
+std::vector<bool> SocialGraphHandler::_AreKnownEmpty(
+    const std::vector<std::string> &keys, std::vector<std::string> *claims) {
+  std::vector<bool> known_empty(keys.size());
+  claims->resize(keys.size());
+  if (!_redis_client_pool) {
+    for (size_t k = 0; k < keys.size(); ++k) {
+      known_empty[k] = _IsKnownEmpty(keys[k], &(*claims)[k]);
+    }
+    return known_empty;
+  }
+  std::string ttl = std::to_string(EMPTY_MARKER_CLAIM_TTL);
+  try {
+    auto pipe = _redis_client_pool->pipeline(false);
+    for (size_t k = 0; k < keys.size(); ++k) {
+      (*claims)[k] = _NewClaimToken();
+      pipe.eval(EMPTY_MARKER_CLAIM_SCRIPT, {_EmptyMarkerKey(keys[k])},
+                {(*claims)[k], ttl});
+    }
+    auto replies = pipe.exec();
+    for (size_t k = 0; k < keys.size(); ++k) {
+      known_empty[k] = replies.get<long long>(k) == 1;
+    }
+  } catch (const Error &err) {
+    LOG(error) << err.what();
+    throw err;
+  }
+  return known_empty;
+}
+
+// A no-op if a Follow dropped the claim or another reader took it over
+void SocialGraphHandler::_MarkKnownEmpty(const std::string &key,
+                                         const std::string &claim) {
+  if (_redis_client_pool) {
+    _redis_client_pool->eval<long long>(EMPTY_MARKER_SET_SCRIPT,
+                                        {_EmptyMarkerKey(key), key}, {claim});
+  } else {
+    _redis_cluster_client_pool->eval<long long>(
+        EMPTY_MARKER_SET_SCRIPT, {_EmptyMarkerKey(key), key}, {claim});
+  }
+}
+
+// Drops the markers, and any claim, of keys. Called only once the new edges
+// are in MongoDB: a reader that claimed a marker before that may have missed
+// them.
+void SocialGraphHandler::_ClearKnownEmpty(
+    const std::vector<std::string> &keys) {
+  try {
+    RedisPipelines pipes(_redis_client_pool, _redis_cluster_client_pool);
+    for (auto const &key : keys) {
+      std::string marker = _EmptyMarkerKey(key);
+      pipes.For(marker)->del(marker);
+    }
+    pipes.Exec();
+  } catch (const Error &err) {
+    LOG(error) << err.what();
+    throw err;
+  }
+}
+
+void SocialGraphHandler::_CountAvoidedLookup() {
+  int64_t avoided = ++_mongo_lookups_avoided;
+  if (avoided % EMPTY_MARKER_LOG_INTERVAL == 0) {
+    LOG(info) << "Avoided " << avoided
+              << " MongoDB lookups for users with no followers/followees";
+  }
+}
+
+// Reads the (user_id, timestamp) entries of the followers/followees array of
+// user_id. Returns false if user_id is not in MongoDB.
+bool SocialGraphHandler::_ReadEdgesFromMongo(
+    int64_t user_id, const std::string &field,
+    std::vector<std::pair<int64_t, int64_t>> *edges) {
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(_mongodb_client_pool);
+  if (!mongodb_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    throw se;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, "social-graph", "social-graph");
+  if (!collection) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to create collection social_graph from MongoDB";
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
+
+  bson_t *query = _NewUserIdQuery(user_id);
+  bson_t *opts = BCON_NEW("projection", "{", "_id", BCON_INT32(0),
+                          field.c_str(), BCON_INT32(1), "}");
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+  const bson_t *doc;
+  bool found = mongoc_cursor_next(cursor, &doc);
+  if (found) {
+    _ParseEdges(doc, field, edges);
+  }
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_cursor_destroy(cursor);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+  return found;
+}
+
+// Reads the followers/followees arrays of user_ids with one $in query.
+// (*edges)[user_id] holds the entries of each user_id found in MongoDB.
+void SocialGraphHandler::_ReadEdgesFromMongo(
+    const std::vector<int64_t> &user_ids, const std::string &field,
+    std::unordered_map<int64_t, std::vector<std::pair<int64_t, int64_t>>>
+        *edges) {
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(_mongodb_client_pool);
+  if (!mongodb_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    throw se;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, "social-graph", "social-graph");
+  if (!collection) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to create collection social_graph from MongoDB";
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
+
+  bson_t *query = _NewUserIdsQuery(user_ids);
+  bson_t *opts =
+      BCON_NEW("projection", "{", "_id", BCON_INT32(0), "user_id",
+               BCON_INT32(1), field.c_str(), BCON_INT32(1), "}");
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+  const bson_t *doc;
+  while (mongoc_cursor_next(cursor, &doc)) {
+    bson_iter_t iter;
+    if (bson_iter_init_find(&iter, doc, "user_id") &&
+        BSON_ITER_HOLDS_INT64(&iter)) {
+      _ParseEdges(doc, field, &(*edges)[bson_iter_int64(&iter)]);
+    }
+  }
+  bson_error_t error;
+  if (mongoc_cursor_error(cursor, &error)) {
+    LOG(error) << "Failed to read " << field << " of " << user_ids.size()
+               << " users from MongoDB: " << error.message;
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = error.message;
+    bson_destroy(opts);
+    bson_destroy(query);
+    mongoc_cursor_destroy(cursor);
+    mongoc_collection_destroy(collection);
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_cursor_destroy(cursor);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+}
+
+bson_t *SocialGraphHandler::_NewUserIdQuery(int64_t user_id) {
+  bson_t *query = bson_new();
+  BSON_APPEND_INT64(query, "user_id", user_id);
+  return query;
+}
+
+bson_t *SocialGraphHandler::_NewUserIdsQuery(
+    const std::vector<int64_t> &user_ids) {
+  bson_t *query = bson_new();
+  bson_t query_child;
+  bson_t query_user_id_list;
+  const char *key;
+  char buf[16];
+  BSON_APPEND_DOCUMENT_BEGIN(query, "user_id", &query_child);
+  BSON_APPEND_ARRAY_BEGIN(&query_child, "$in", &query_user_id_list);
+  for (uint32_t idx = 0; idx < user_ids.size(); ++idx) {
+    bson_uint32_to_string(idx, &key, buf, sizeof buf);
+    BSON_APPEND_INT64(&query_user_id_list, key, user_ids[idx]);
+  }
+  bson_append_array_end(&query_child, &query_user_id_list);
+  bson_append_document_end(query, &query_child);
+  return query;
+}
+
+bson_t *SocialGraphHandler::_NewEdgeAbsentQuery(int64_t owner_id,
+                                                const char *field,
+                                                int64_t other_id) {
+  std::string edge_field = std::string(field) + ".user_id";
+  return BCON_NEW("user_id", BCON_INT64(owner_id), edge_field.c_str(), "{",
+                  "$ne", BCON_INT64(other_id), "}");
+}
+
+// Appends the (user_id, timestamp) entries of the field array of doc
+void SocialGraphHandler::_ParseEdges(
+    const bson_t *doc, const std::string &field,
+    std::vector<std::pair<int64_t, int64_t>> *edges) {
+  bson_iter_t iter;
+  bson_iter_t array_child;
+  if (!bson_iter_init_find(&iter, doc, field.c_str()) ||
+      !BSON_ITER_HOLDS_ARRAY(&iter) ||
+      !bson_iter_recurse(&iter, &array_child)) {
+    return;
+  }
+  while (bson_iter_next(&array_child)) {
+    bson_iter_t user_id_child;
+    bson_iter_t timestamp_child;
+    if (BSON_ITER_HOLDS_DOCUMENT(&array_child) &&
+        bson_iter_recurse(&array_child, &user_id_child) &&
+        bson_iter_find(&user_id_child, "user_id") &&
+        BSON_ITER_HOLDS_INT64(&user_id_child) &&
+        bson_iter_recurse(&array_child, &timestamp_child) &&
+        bson_iter_find(&timestamp_child, "timestamp") &&
+        BSON_ITER_HOLDS_INT64(&timestamp_child)) {
+      edges->emplace_back(bson_iter_int64(&user_id_child),
+                          bson_iter_int64(&timestamp_child));
+    }
+  }
+}
+
+// Appends up to limit (timestamp, user_id) entries of the followers/followees
+// array of user_id that come after (after_timestamp, after_user_id) in that
+// order, unwound and sorted by MongoDB.
+void SocialGraphHandler::_ReadEdgePageFromMongo(
+    int64_t user_id, const std::string &field, int64_t after_timestamp,
+    int64_t after_user_id, int32_t limit,
+    std::vector<std::pair<int64_t, int64_t>> *edges) {
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(_mongodb_client_pool);
+  if (!mongodb_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    throw se;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, "social-graph", "social-graph");
+  if (!collection) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to create collection social_graph from MongoDB";
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
+
+  std::string field_path = "$" + field;
+  std::string timestamp_path = field + ".timestamp";
+  std::string user_id_path = field + ".user_id";
+  bson_t *match = _NewUserIdQuery(user_id);
+  bson_t *pipeline = BCON_NEW(
+      "pipeline", "[", "{", "$match", BCON_DOCUMENT(match), "}", "{",
+      "$project", "{", "_id", BCON_INT32(0), field.c_str(),
+      BCON_INT32(1), "}", "}", "{", "$unwind", BCON_UTF8(field_path.c_str()),
+      "}", "{", "$match", "{", "$or", "[", "{", timestamp_path.c_str(), "{",
+      "$gt", BCON_INT64(after_timestamp), "}", "}", "{",
+      timestamp_path.c_str(), BCON_INT64(after_timestamp),
+      user_id_path.c_str(), "{", "$gt", BCON_INT64(after_user_id), "}", "}",
+      "]", "}", "}", "{", "$sort", "{", timestamp_path.c_str(), BCON_INT32(1),
+      user_id_path.c_str(), BCON_INT32(1), "}", "}", "{", "$limit",
+      BCON_INT32(limit), "}", "]");
+  bson_destroy(match);
+  mongoc_cursor_t *cursor = mongoc_collection_aggregate(
+      collection, MONGOC_QUERY_NONE, pipeline, nullptr, nullptr);
+  const bson_t *doc;
+  while (mongoc_cursor_next(cursor, &doc)) {
+    bson_iter_t iter;
+    bson_iter_t user_id_child;
+    bson_iter_t timestamp_child;
+    if (bson_iter_init_find(&iter, doc, field.c_str()) &&
+        BSON_ITER_HOLDS_DOCUMENT(&iter) &&
+        bson_iter_recurse(&iter, &user_id_child) &&
+        bson_iter_find(&user_id_child, "user_id") &&
+        BSON_ITER_HOLDS_INT64(&user_id_child) &&
+        bson_iter_recurse(&iter, &timestamp_child) &&
+        bson_iter_find(&timestamp_child, "timestamp") &&
+        BSON_ITER_HOLDS_INT64(&timestamp_child)) {
+      edges->emplace_back(bson_iter_int64(&timestamp_child),
+                          bson_iter_int64(&user_id_child));
+    }
+  }
+  bson_error_t error;
+  if (mongoc_cursor_error(cursor, &error)) {
+    LOG(error) << "Failed to read " << field << " of user " << user_id
+               << " from MongoDB: " << error.message;
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = error.message;
+    bson_destroy(pipeline);
+    mongoc_cursor_destroy(cursor);
+    mongoc_collection_destroy(collection);
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
+  bson_destroy(pipeline);
+  mongoc_cursor_destroy(cursor);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+}
+
+// Sets *count to the length of the followers/followees array of user_id.
+// Returns false if user_id is not in MongoDB.
+bool SocialGraphHandler::_CountEdgesInMongo(int64_t user_id,
+                                            const std::string &field,
+                                            int64_t *count) {
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(_mongodb_client_pool);
+  if (!mongodb_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    throw se;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, "social-graph", "social-graph");
+  if (!collection) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to create collection social_graph from MongoDB";
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
+
+  std::string field_path = "$" + field;
+  bson_t *match = _NewUserIdQuery(user_id);
+  bson_t *pipeline = BCON_NEW(
+      "pipeline", "[", "{", "$match", BCON_DOCUMENT(match), "}", "{",
+      "$project", "{", "_id", BCON_INT32(0), "count", "{", "$size",
+      "{", "$ifNull", "[", BCON_UTF8(field_path.c_str()), "[", "]", "]", "}",
+      "}", "}", "}", "]");
+  bson_destroy(match);
+  mongoc_cursor_t *cursor = mongoc_collection_aggregate(
+      collection, MONGOC_QUERY_NONE, pipeline, nullptr, nullptr);
+  const bson_t *doc;
+  bool found = mongoc_cursor_next(cursor, &doc);
+  bson_iter_t iter;
+  *count = 0;
+  if (found && bson_iter_init_find(&iter, doc, "count")) {
+    *count = bson_iter_as_int64(&iter);
+  }
+  bson_error_t error;
+  if (mongoc_cursor_error(cursor, &error)) {
+    LOG(error) << "Failed to count " << field << " of user " << user_id
+               << " in MongoDB: " << error.message;
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = error.message;
+    bson_destroy(pipeline);
+    mongoc_cursor_destroy(cursor);
+    mongoc_collection_destroy(collection);
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
+  bson_destroy(pipeline);
+  mongoc_cursor_destroy(cursor);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+  return found;
+}
+
+void SocialGraphHandler::_Zadd(
+    const std::string &key,
+    std::vector<std::pair<std::string, double>>::const_iterator first,
+    std::vector<std::pair<std::string, double>>::const_iterator last) {
+  if (_redis_client_pool) {
+    _redis_client_pool->zadd(key, first, last);
+  } else {
+    _redis_cluster_client_pool->zadd(key, first, last);
+  }
+}
+
+// Appends the members of key with a score in interval and their scores,
+// the first limit of them unless limit is negative
+template <typename Interval>
+void SocialGraphHandler::_ZrangeByScore(
+    const std::string &key, const Interval &interval, int64_t limit,
+    std::vector<std::pair<std::string, double>> *members) {
+  LimitOptions opts;
+  opts.count = limit;
+  if (_redis_client_pool) {
+    _redis_client_pool->zrangebyscore(key, interval, opts,
+                                      std::back_inserter(*members));
+  } else {
+    _redis_cluster_client_pool->zrangebyscore(key, interval, opts,
+                                              std::back_inserter(*members));
+  }
+}
+
+// Runs fill(warming_key) on a detached thread and merges warming_key into key
+// if it wrote any member, or marks key as known empty if it wrote none and no
+// Follow raced it. fill returns -1 if the owner of the list does not exist.
+// At most one warm per key is in flight; readers keep falling back to
+// MongoDB until the merge. The merge is a ZUNIONSTORE rather than a RENAME so
+// that an edge a concurrent Follow ZADDs to key while fill runs is kept; the
+// warming key hashes to the slot of key, so this also holds in cluster mode.
+void SocialGraphHandler::_WarmCacheAsync(
+    const std::string &key,
+    std::function<int64_t(const std::string &)> fill) {
+  {
+    std::lock_guard<std::mutex> lock(_warming_mutex);
+    if (!_warming_keys.insert(key).second) {
+      return;
+    }
+  }
+  std::thread([this, key, fill]() {
+    std::string warming_key = "{" + key + "}" WARMING_KEY_SUFFIX;
+    try {
+      if (_redis_client_pool) {
+        _redis_client_pool->del(warming_key);
+      } else {
+        _redis_cluster_client_pool->del(warming_key);
+      }
+      std::vector<std::string> keys = {key, warming_key};
+      // Claimed before fill reads MongoDB, as GetFollowers does
+      std::string claim;
+      int64_t filled = _IsKnownEmpty(key, &claim) ? -1 : fill(warming_key);
+      if (filled == 0) {
+        _MarkKnownEmpty(key, claim);
+      } else if (filled < 0) {
+        LOG(warning) << "Not warming " << key
+                     << ": user not found or known to be empty";
+      } else if (_redis_client_pool) {
+        _redis_client_pool->zunionstore(key, keys.begin(), keys.end(),
+                                        Aggregation::MIN);
+        _redis_client_pool->del(warming_key);
+      } else {
+        _redis_cluster_client_pool->zunionstore(key, keys.begin(), keys.end(),
+                                                Aggregation::MIN);
+        _redis_cluster_client_pool->del(warming_key);
+      }
+    } catch (const std::exception &e) {
+      LOG(warning) << "Failed to warm " << key << ": " << e.what();
+    }
+    std::lock_guard<std::mutex> lock(_warming_mutex);
+    _warming_keys.erase(key);
+  }).detach();
+}
+
+// Warms key with members already read from MongoDB
+void SocialGraphHandler::_WarmCacheAsync(
+    const std::string &key,
+    std::vector<std::pair<std::string, double>> members) {
+  auto shared_members =
+      std::make_shared<std::vector<std::pair<std::string, double>>>(
+          std::move(members));
+  _WarmCacheAsync(key, [this, shared_members](const std::string &warming_key) {
+    for (size_t i = 0; i < shared_members->size();
+         i += SOCIAL_GRAPH_WARM_CHUNK) {
+      size_t last =
+          std::min(shared_members->size(), i + SOCIAL_GRAPH_WARM_CHUNK);
+      _Zadd(warming_key, shared_members->begin() + i,
+            shared_members->begin() + last);
+    }
+    return (int64_t)shared_members->size();
+  });
+}
+
+// Warms "<user_id>:<field>" from a single read of the MongoDB array, ZADDed
+// in chunks so no one command holds Redis for a high-degree user.
+void SocialGraphHandler::_WarmCacheFromMongoAsync(int64_t user_id,
+                                                  const std::string &field) {
+  std::string key = std::to_string(user_id) + ":" + field;
+  _WarmCacheAsync(key, [this, user_id, field](const std::string &warming_key) {
+    std::vector<std::pair<int64_t, int64_t>> edges;
+    if (!_ReadEdgesFromMongo(user_id, field, &edges)) {
+      return (int64_t)-1;
+    }
+    std::vector<std::pair<std::string, double>> members;
+    members.reserve(edges.size());
+    for (auto const &edge : edges) {
+      members.emplace_back(std::to_string(edge.first), (double)edge.second);
+    }
+    for (size_t i = 0; i < members.size(); i += SOCIAL_GRAPH_WARM_CHUNK) {
+      size_t last = std::min(members.size(), i + SOCIAL_GRAPH_WARM_CHUNK);
+      _Zadd(warming_key, members.begin() + i, members.begin() + last);
+    }
+    return (int64_t)members.size();
+  });
+}
+
+// Redis and MongoDB return followers/followees in follow order, so lists are
+// sorted before intersecting; snapshot lists are already sorted.
+void SocialGraphHandler::_SortIds(std::vector<int64_t> *ids) {
+  if (!std::is_sorted(ids->begin(), ids->end())) {
+    std::sort(ids->begin(), ids->end());
+  }
+}
+
+std::vector<MongoIndexSpec> SocialGraphHandler::IndexSpecs() {
+  return {
+      {"social-graph", "social-graph", {{"user_id", 1}}, true, ""},
+  };
+}
+
+std::vector<MongoQueryShape> SocialGraphHandler::QueryShapes() {
+  return {
+      MongoQueryShapeOf("social-graph", "social-graph", _NewUserIdQuery(0)),
+      MongoQueryShapeOf("social-graph", "social-graph",
+                        _NewUserIdsQuery({0, 1})),
+      MongoQueryShapeOf("social-graph", "social-graph",
+                        _NewEdgeAbsentQuery(0, "followees", 1)),
+  };
+}
+
 }  // namespace social_network
 
 #endif  // SOCIAL_NETWORK_MICROSERVICES_SOCIALGRAPHHANDLER_H
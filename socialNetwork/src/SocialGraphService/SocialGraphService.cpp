@@ -78,20 +78,24 @@ int main(int argc, char *argv[]) {
       "social-graph", user_addr, user_port, 0, user_conns, user_timeout,
       user_keepalive, config_json);
 
-  mongoc_client_t *mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
-  if (!mongodb_client) {
-    LOG(fatal) << "Failed to pop mongoc client";
+  if (!SetUpMongoIndexes(mongodb_client_pool, SocialGraphHandler::IndexSpecs(),
+                         SocialGraphHandler::QueryShapes(),
+                         config_json.value("mongodb_index_check", false))) {
+    LOG(fatal) << "Failed to set up the MongoDB indexes of SocialGraphHandler";
     return EXIT_FAILURE;
   }
-  bool r = false;
-  while (!r) {
-    r = CreateIndex(mongodb_client, "social-graph", "user_id", true);
-    if (!r) {
-      LOG(error) << "Failed to create mongodb index, try again";
-      sleep(1);
+
+  std::unique_ptr<SocialGraphSnapshot> snapshot;
+  if (config_json["social-graph-service"].value("csr_snapshot", false)) {
+    snapshot.reset(new SocialGraphSnapshot(
+        config_json["social-graph-service"].value(
+            "csr_compact_threshold", SOCIAL_GRAPH_SNAPSHOT_COMPACT_THRESHOLD)));
+    if (!snapshot->Build(mongodb_client_pool)) {
+      LOG(error) << "Failed to build social graph snapshot, serving from "
+                    "Redis/MongoDB only";
+      snapshot.reset();
     }
   }
-  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
 
   std::shared_ptr<TServerSocket> server_socket =
       get_server_socket(config_json, "0.0.0.0", port);
@@ -101,9 +105,9 @@ int main(int argc, char *argv[]) {
         init_redis_cluster_client_pool(config_json, "social-graph");
     TThreadedServer server(
         std::make_shared<SocialGraphServiceProcessor>(
-            std::make_shared<SocialGraphHandler>(mongodb_client_pool,
-                                                 &redis_cluster_client_pool,
-                                                 &user_client_pool)),
+            std::make_shared<SocialGraphHandler>(
+                mongodb_client_pool, &redis_cluster_client_pool,
+                &user_client_pool, snapshot.get())),
         server_socket, std::make_shared<TFramedTransportFactory>(),
         std::make_shared<TBinaryProtocolFactory>());
     LOG(info) << "Starting the social-graph-service server with Resis cluster...";
@@ -114,7 +118,8 @@ int main(int argc, char *argv[]) {
     TThreadedServer server(
         std::make_shared<SocialGraphServiceProcessor>(
             std::make_shared<SocialGraphHandler>(
-                mongodb_client_pool, &redis_client_pool, &user_client_pool)),
+                mongodb_client_pool, &redis_client_pool, &user_client_pool,
+                snapshot.get())),
         server_socket, std::make_shared<TFramedTransportFactory>(),
         std::make_shared<TBinaryProtocolFactory>());
     LOG(info) << "Starting the social-graph-service server ...";
@@ -0,0 +1,597 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SOCIALGRAPHSNAPSHOT_H
+#define SOCIAL_NETWORK_MICROSERVICES_SOCIALGRAPHSNAPSHOT_H
+
+#include <bson/bson.h>
+#include <mongoc.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "../logger.h"
+
+#define SOCIAL_GRAPH_SNAPSHOT_COMPACT_THRESHOLD 10000
+
+namespace social_network {
+
+// In-process snapshot of the social graph in compressed sparse row form.
+//
+// For each direction (followers, followees) the snapshot keeps
+//   user_ids:  sorted ids of every user present at build time
+//   offsets:   offsets[i]..offsets[i+1] delimit the neighbors of user_ids[i]
+//   neighbors: all adjacency lists back to back, each sorted ascending
+// so a lookup is a binary search plus a copy out of one contiguous array.
+//
+// Follow/Unfollow handled by this process after the build are kept in a delta
+// log that is merged into the answer on read, and folded into new CSR arrays
+// once it grows past compact_threshold edges. The writer that crosses the
+// threshold moves the log aside as a read-only layer and starts an empty one
+// on top of it, then builds the new arrays without holding the lock; the swap
+// only replaces pointers. The snapshot only sees edges written through this
+// process, so it should only be enabled when a single social-graph-service
+// instance owns the graph.
+class SocialGraphSnapshot {
+ public:
+  explicit SocialGraphSnapshot(size_t compact_threshold);
+
+  bool Build(mongoc_client_pool_t *mongodb_client_pool);
+  // Replaces the snapshot with users 0..num_users-1 and the given
+  // (user_id, followee_id) edges, for SnapshotBenchmark
+  void Load(int64_t num_users,
+            const std::vector<std::pair<int64_t, int64_t>> &edges);
+
+  // Return false if user_id is unknown to the snapshot, in which case the
+  // caller should fall back to Redis/MongoDB. Lists are sorted ascending.
+  bool GetFollowers(int64_t user_id, std::vector<int64_t> *followers);
+  bool GetFollowees(int64_t user_id, std::vector<int64_t> *followees);
+  // Sets *following without copying the followee list of user_id
+  bool IsFollowing(int64_t user_id, int64_t followee_id, bool *following);
+  // Sets *count without copying the follower list of user_id
+  bool GetFollowerCount(int64_t user_id, int64_t *count);
+
+  void InsertUser(int64_t user_id);
+  void Follow(int64_t user_id, int64_t followee_id);
+  void Unfollow(int64_t user_id, int64_t followee_id);
+
+  size_t MemoryUsage();
+
+ private:
+  struct Csr {
+    std::vector<int64_t> user_ids;
+    std::vector<int64_t> offsets;
+    std::vector<int64_t> neighbors;
+  };
+
+  // Edges of one user relative to the layers below: added is disjoint from
+  // them and removed a subset of them, so that re-following or
+  // re-unfollowing never duplicates or loses an edge.
+  struct Delta {
+    std::unordered_set<int64_t> added;
+    std::unordered_set<int64_t> removed;
+  };
+
+  using Deltas = std::unordered_map<int64_t, Delta>;
+  using UserSet = std::unordered_set<int64_t>;
+
+  // One direction of the graph: csr, then compacting while a compaction folds
+  // it into new arrays, then deltas. csr and compacting are replaced, never
+  // modified, so a compaction can read them without the lock.
+  struct Graph {
+    std::shared_ptr<const Csr> csr;
+    std::shared_ptr<const Deltas> compacting;
+    Deltas deltas;
+  };
+
+  using AdjacencyLists = std::vector<std::pair<int64_t, std::vector<int64_t>>>;
+
+  void _Install(AdjacencyLists *followers, AdjacencyLists *followees);
+  static Csr _BuildCsr(AdjacencyLists *lists);
+  static bool _ParseEdges(const bson_t *doc, const char *field,
+                          std::vector<int64_t> *edges);
+  bool _IsKnown(const Csr &csr, int64_t user_id);
+  bool _Lookup(const Graph &graph, int64_t user_id, std::vector<int64_t> *out);
+  static void _ApplyDelta(const Deltas *deltas, int64_t user_id, size_t begin,
+                          std::vector<int64_t> *out);
+  static bool _HasEdge(const Csr &csr, int64_t user_id, int64_t neighbor_id);
+  static bool _HasEdge(const Graph &graph, int64_t user_id,
+                       int64_t neighbor_id, bool in_deltas);
+  static void _AddEdge(Graph *graph, int64_t user_id, int64_t neighbor_id);
+  static void _RemoveEdge(Graph *graph, int64_t user_id, int64_t neighbor_id);
+  void _CompactIfNeeded();
+  static Csr _Compact(const Csr &csr, const Deltas &deltas,
+                      const UserSet &new_users);
+
+  std::shared_timed_mutex _mutex;
+  size_t _compact_threshold;
+  size_t _delta_size;
+  // Bumped by every build, so a compaction that spans one is dropped
+  int64_t _generation;
+  Graph _followers;
+  Graph _followees;
+  // Users inserted since the build or the last compaction started, and those
+  // the running compaction gives a row
+  UserSet _new_users;
+  std::shared_ptr<const UserSet> _compacting_new_users;
+};
+
+SocialGraphSnapshot::SocialGraphSnapshot(size_t compact_threshold) {
+  _compact_threshold = compact_threshold;
+  _delta_size = 0;
+  _generation = 0;
+  _followers.csr = std::make_shared<Csr>();
+  _followees.csr = std::make_shared<Csr>();
+}
+
+bool SocialGraphSnapshot::Build(mongoc_client_pool_t *mongodb_client_pool) {
+  auto start = std::chrono::steady_clock::now();
+
+  mongoc_client_t *mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
+  if (!mongodb_client) {
+    LOG(error) << "Failed to pop a client from MongoDB pool";
+    return false;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, "social-graph", "social-graph");
+  if (!collection) {
+    LOG(error) << "Failed to create collection social_graph from MongoDB";
+    mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+    return false;
+  }
+
+  bson_t *query = bson_new();
+  bson_t *opts = BCON_NEW("projection", "{", "_id", BCON_INT32(0), "user_id",
+                          BCON_INT32(1), "followers.user_id", BCON_INT32(1),
+                          "followees.user_id", BCON_INT32(1), "}");
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+
+  AdjacencyLists followers;
+  AdjacencyLists followees;
+  const bson_t *doc;
+  while (mongoc_cursor_next(cursor, &doc)) {
+    bson_iter_t iter;
+    if (!bson_iter_init_find(&iter, doc, "user_id") ||
+        !BSON_ITER_HOLDS_INT64(&iter)) {
+      continue;
+    }
+    int64_t user_id = bson_iter_int64(&iter);
+    followers.emplace_back(user_id, std::vector<int64_t>());
+    followees.emplace_back(user_id, std::vector<int64_t>());
+    _ParseEdges(doc, "followers", &followers.back().second);
+    _ParseEdges(doc, "followees", &followees.back().second);
+  }
+
+  bson_error_t error;
+  bool ok = !mongoc_cursor_error(cursor, &error);
+  if (!ok) {
+    LOG(error) << "Failed to read social graph from MongoDB: "
+               << error.message;
+  }
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_cursor_destroy(cursor);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+  if (!ok) {
+    return false;
+  }
+
+  size_t num_users = followers.size();
+  size_t num_edges = 0;
+  for (auto const &list : followers) {
+    num_edges += list.second.size();
+  }
+  _Install(&followers, &followees);
+
+  auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+  LOG(info) << "Built social graph snapshot: " << num_users << " users, "
+            << num_edges << " edges, " << MemoryUsage() << " bytes in "
+            << elapsed << " ms";
+  return true;
+}
+
+void SocialGraphSnapshot::Load(
+    int64_t num_users, const std::vector<std::pair<int64_t, int64_t>> &edges) {
+  AdjacencyLists followers(num_users);
+  AdjacencyLists followees(num_users);
+  for (int64_t user_id = 0; user_id < num_users; user_id++) {
+    followers[user_id].first = user_id;
+    followees[user_id].first = user_id;
+  }
+  for (auto const &edge : edges) {
+    followers[edge.second].second.emplace_back(edge.first);
+    followees[edge.first].second.emplace_back(edge.second);
+  }
+  _Install(&followers, &followees);
+}
+
+void SocialGraphSnapshot::_Install(AdjacencyLists *followers,
+                                   AdjacencyLists *followees) {
+  std::shared_ptr<const Csr> followers_csr =
+      std::make_shared<Csr>(_BuildCsr(followers));
+  std::shared_ptr<const Csr> followees_csr =
+      std::make_shared<Csr>(_BuildCsr(followees));
+  std::unique_lock<std::shared_timed_mutex> lock(_mutex);
+  _followers.csr.swap(followers_csr);
+  _followees.csr.swap(followees_csr);
+  for (auto graph : {&_followers, &_followees}) {
+    graph->compacting.reset();
+    graph->deltas.clear();
+  }
+  _new_users.clear();
+  _compacting_new_users.reset();
+  _delta_size = 0;
+  _generation++;
+}
+
+bool SocialGraphSnapshot::GetFollowers(int64_t user_id,
+                                       std::vector<int64_t> *followers) {
+  std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+  return _Lookup(_followers, user_id, followers);
+}
+
+bool SocialGraphSnapshot::GetFollowees(int64_t user_id,
+                                       std::vector<int64_t> *followees) {
+  std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+  return _Lookup(_followees, user_id, followees);
+}
+
+bool SocialGraphSnapshot::IsFollowing(int64_t user_id, int64_t followee_id,
+                                      bool *following) {
+  std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+  if (!_IsKnown(*_followees.csr, user_id)) {
+    return false;
+  }
+  *following = _HasEdge(_followees, user_id, followee_id, true);
+  return true;
+}
+
+// Relies on the Delta invariants of every layer
+bool SocialGraphSnapshot::GetFollowerCount(int64_t user_id, int64_t *count) {
+  std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+  const Csr &csr = *_followers.csr;
+  if (!_IsKnown(csr, user_id)) {
+    return false;
+  }
+
+  *count = 0;
+  auto it = std::lower_bound(csr.user_ids.begin(), csr.user_ids.end(),
+                             user_id);
+  if (it != csr.user_ids.end() && *it == user_id) {
+    auto idx = it - csr.user_ids.begin();
+    *count = csr.offsets[idx + 1] - csr.offsets[idx];
+  }
+  const Deltas *layers[] = {_followers.compacting.get(), &_followers.deltas};
+  for (auto deltas : layers) {
+    if (!deltas) {
+      continue;
+    }
+    auto delta = deltas->find(user_id);
+    if (delta != deltas->end()) {
+      *count += delta->second.added.size();
+      *count -= delta->second.removed.size();
+    }
+  }
+  return true;
+}
+
+void SocialGraphSnapshot::InsertUser(int64_t user_id) {
+  std::unique_lock<std::shared_timed_mutex> lock(_mutex);
+  _new_users.insert(user_id);
+}
+
+void SocialGraphSnapshot::Follow(int64_t user_id, int64_t followee_id) {
+  {
+    std::unique_lock<std::shared_timed_mutex> lock(_mutex);
+    _AddEdge(&_followers, followee_id, user_id);
+    _AddEdge(&_followees, user_id, followee_id);
+    _delta_size++;
+  }
+  _CompactIfNeeded();
+}
+
+void SocialGraphSnapshot::Unfollow(int64_t user_id, int64_t followee_id) {
+  {
+    std::unique_lock<std::shared_timed_mutex> lock(_mutex);
+    _RemoveEdge(&_followers, followee_id, user_id);
+    _RemoveEdge(&_followees, user_id, followee_id);
+    _delta_size++;
+  }
+  _CompactIfNeeded();
+}
+
+size_t SocialGraphSnapshot::MemoryUsage() {
+  std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+  size_t usage = 0;
+  for (auto csr : {_followers.csr.get(), _followees.csr.get()}) {
+    usage += (csr->user_ids.capacity() + csr->offsets.capacity() +
+              csr->neighbors.capacity()) *
+             sizeof(int64_t);
+  }
+  return usage;
+}
+
+SocialGraphSnapshot::Csr SocialGraphSnapshot::_BuildCsr(
+    AdjacencyLists *lists) {
+  std::sort(lists->begin(), lists->end(),
+            [](const AdjacencyLists::value_type &a,
+               const AdjacencyLists::value_type &b) {
+              return a.first < b.first;
+            });
+  size_t num_edges = 0;
+  for (auto &list : *lists) {
+    num_edges += list.second.size();
+  }
+
+  Csr csr;
+  csr.user_ids.reserve(lists->size());
+  csr.offsets.reserve(lists->size() + 1);
+  csr.neighbors.reserve(num_edges);
+  csr.offsets.emplace_back(0);
+  for (auto &list : *lists) {
+    std::sort(list.second.begin(), list.second.end());
+    csr.user_ids.emplace_back(list.first);
+    csr.neighbors.insert(csr.neighbors.end(), list.second.begin(),
+                         list.second.end());
+    csr.offsets.emplace_back(csr.neighbors.size());
+    std::vector<int64_t>().swap(list.second);
+  }
+  return csr;
+}
+
+bool SocialGraphSnapshot::_ParseEdges(const bson_t *doc, const char *field,
+                                      std::vector<int64_t> *edges) {
+  bson_iter_t iter;
+  bson_iter_t array_child;
+  if (!bson_iter_init_find(&iter, doc, field) ||
+      !BSON_ITER_HOLDS_ARRAY(&iter) ||
+      !bson_iter_recurse(&iter, &array_child)) {
+    return false;
+  }
+  while (bson_iter_next(&array_child)) {
+    bson_iter_t user_id_child;
+    if (BSON_ITER_HOLDS_DOCUMENT(&array_child) &&
+        bson_iter_recurse(&array_child, &user_id_child) &&
+        bson_iter_find(&user_id_child, "user_id") &&
+        BSON_ITER_HOLDS_INT64(&user_id_child)) {
+      edges->emplace_back(bson_iter_int64(&user_id_child));
+    }
+  }
+  return true;
+}
+
+bool SocialGraphSnapshot::_IsKnown(const Csr &csr, int64_t user_id) {
+  return std::binary_search(csr.user_ids.begin(), csr.user_ids.end(),
+                            user_id) ||
+         _new_users.find(user_id) != _new_users.end() ||
+         (_compacting_new_users &&
+          _compacting_new_users->find(user_id) !=
+              _compacting_new_users->end());
+}
+
+bool SocialGraphSnapshot::_Lookup(const Graph &graph, int64_t user_id,
+                                  std::vector<int64_t> *out) {
+  const Csr &csr = *graph.csr;
+  if (!_IsKnown(csr, user_id)) {
+    return false;
+  }
+  size_t begin = out->size();
+  auto it = std::lower_bound(csr.user_ids.begin(), csr.user_ids.end(),
+                             user_id);
+  if (it != csr.user_ids.end() && *it == user_id) {
+    auto idx = it - csr.user_ids.begin();
+    out->insert(out->end(), csr.neighbors.begin() + csr.offsets[idx],
+                csr.neighbors.begin() + csr.offsets[idx + 1]);
+  }
+  _ApplyDelta(graph.compacting.get(), user_id, begin, out);
+  _ApplyDelta(&graph.deltas, user_id, begin, out);
+  return true;
+}
+
+// Applies the delta of user_id to the sorted list (*out)[begin..], keeping it
+// sorted; added is disjoint from the list, so a merge suffices.
+void SocialGraphSnapshot::_ApplyDelta(const Deltas *deltas, int64_t user_id,
+                                      size_t begin,
+                                      std::vector<int64_t> *out) {
+  if (!deltas) {
+    return;
+  }
+  auto delta = deltas->find(user_id);
+  if (delta == deltas->end()) {
+    return;
+  }
+  auto &removed = delta->second.removed;
+  auto &added = delta->second.added;
+  if (!removed.empty()) {
+    out->erase(std::remove_if(out->begin() + begin, out->end(),
+                              [&](int64_t neighbor) {
+                                return removed.count(neighbor) > 0;
+                              }),
+               out->end());
+  }
+  if (!added.empty()) {
+    size_t middle = out->size();
+    out->insert(out->end(), added.begin(), added.end());
+    std::sort(out->begin() + middle, out->end());
+    std::inplace_merge(out->begin() + begin, out->begin() + middle,
+                       out->end());
+  }
+}
+
+bool SocialGraphSnapshot::_HasEdge(const Csr &csr, int64_t user_id,
+                                   int64_t neighbor_id) {
+  auto it = std::lower_bound(csr.user_ids.begin(), csr.user_ids.end(),
+                             user_id);
+  if (it == csr.user_ids.end() || *it != user_id) {
+    return false;
+  }
+  auto idx = it - csr.user_ids.begin();
+  return std::binary_search(csr.neighbors.begin() + csr.offsets[idx],
+                            csr.neighbors.begin() + csr.offsets[idx + 1],
+                            neighbor_id);
+}
+
+// Whether the edge is in graph, counting its deltas only if in_deltas
+bool SocialGraphSnapshot::_HasEdge(const Graph &graph, int64_t user_id,
+                                   int64_t neighbor_id, bool in_deltas) {
+  for (auto deltas :
+       {in_deltas ? &graph.deltas : nullptr, graph.compacting.get()}) {
+    if (!deltas) {
+      continue;
+    }
+    auto delta = deltas->find(user_id);
+    if (delta != deltas->end()) {
+      if (delta->second.added.count(neighbor_id) > 0) {
+        return true;
+      }
+      if (delta->second.removed.count(neighbor_id) > 0) {
+        return false;
+      }
+    }
+  }
+  return _HasEdge(*graph.csr, user_id, neighbor_id);
+}
+
+void SocialGraphSnapshot::_AddEdge(Graph *graph, int64_t user_id,
+                                   int64_t neighbor_id) {
+  bool below = _HasEdge(*graph, user_id, neighbor_id, false);
+  auto &delta = graph->deltas[user_id];
+  if (below) {
+    delta.removed.erase(neighbor_id);
+  } else {
+    delta.added.insert(neighbor_id);
+  }
+}
+
+void SocialGraphSnapshot::_RemoveEdge(Graph *graph, int64_t user_id,
+                                      int64_t neighbor_id) {
+  bool below = _HasEdge(*graph, user_id, neighbor_id, false);
+  auto &delta = graph->deltas[user_id];
+  if (below) {
+    delta.removed.insert(neighbor_id);
+  } else {
+    delta.added.erase(neighbor_id);
+  }
+}
+
+void SocialGraphSnapshot::_CompactIfNeeded() {
+  std::shared_ptr<const Csr> followers;
+  std::shared_ptr<const Csr> followees;
+  std::shared_ptr<const Deltas> follower_deltas;
+  std::shared_ptr<const Deltas> followee_deltas;
+  std::shared_ptr<const UserSet> new_users;
+  int64_t generation;
+  auto start = std::chrono::steady_clock::now();
+  {
+    std::unique_lock<std::shared_timed_mutex> lock(_mutex);
+    if (_followers.compacting || _delta_size < _compact_threshold) {
+      return;
+    }
+    start = std::chrono::steady_clock::now();
+    _followers.compacting =
+        std::make_shared<Deltas>(std::move(_followers.deltas));
+    _followees.compacting =
+        std::make_shared<Deltas>(std::move(_followees.deltas));
+    _compacting_new_users = std::make_shared<UserSet>(std::move(_new_users));
+    _followers.deltas.clear();
+    _followees.deltas.clear();
+    _new_users.clear();
+    _delta_size = 0;
+    followers = _followers.csr;
+    followees = _followees.csr;
+    follower_deltas = _followers.compacting;
+    followee_deltas = _followees.compacting;
+    new_users = _compacting_new_users;
+    generation = _generation;
+  }
+  auto frozen = std::chrono::steady_clock::now();
+
+  std::shared_ptr<const Csr> new_followers =
+      std::make_shared<Csr>(_Compact(*followers, *follower_deltas, *new_users));
+  std::shared_ptr<const Csr> new_followees =
+      std::make_shared<Csr>(_Compact(*followees, *followee_deltas, *new_users));
+  size_t num_users = new_followers->user_ids.size();
+  size_t num_edges = new_followers->neighbors.size();
+  auto built = std::chrono::steady_clock::now();
+
+  // The old arrays and layers are freed with the locals, after the unlock
+  std::chrono::steady_clock::time_point acquired;
+  std::chrono::steady_clock::time_point swapped;
+  {
+    std::unique_lock<std::shared_timed_mutex> lock(_mutex);
+    acquired = std::chrono::steady_clock::now();
+    if (_generation != generation) {
+      return;
+    }
+    _followers.csr.swap(new_followers);
+    _followees.csr.swap(new_followees);
+    _followers.compacting.reset();
+    _followees.compacting.reset();
+    _compacting_new_users.reset();
+    swapped = std::chrono::steady_clock::now();
+  }
+  auto locked = std::chrono::duration_cast<std::chrono::microseconds>(
+                    (frozen - start) + (swapped - acquired))
+                    .count();
+  LOG(info) << "Compacted social graph snapshot: " << num_users << " users, "
+            << num_edges << " edges in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(built -
+                                                                     frozen)
+                   .count()
+            << " ms, " << locked << " us of it under the exclusive lock";
+}
+
+SocialGraphSnapshot::Csr SocialGraphSnapshot::_Compact(
+    const Csr &csr, const Deltas &deltas, const UserSet &new_users) {
+  AdjacencyLists lists;
+  lists.reserve(csr.user_ids.size() + new_users.size());
+  for (size_t i = 0; i < csr.user_ids.size(); i++) {
+    lists.emplace_back(
+        csr.user_ids[i],
+        std::vector<int64_t>(csr.neighbors.begin() + csr.offsets[i],
+                             csr.neighbors.begin() + csr.offsets[i + 1]));
+  }
+  std::unordered_map<int64_t, size_t> index;
+  index.reserve(lists.size());
+  for (size_t i = 0; i < lists.size(); i++) {
+    index.emplace(lists[i].first, i);
+  }
+  // Users inserted without any edge still need a (empty) row
+  for (auto user_id : new_users) {
+    if (index.emplace(user_id, lists.size()).second) {
+      lists.emplace_back(user_id, std::vector<int64_t>());
+    }
+  }
+  for (auto &delta : deltas) {
+    auto it = index.find(delta.first);
+    if (it == index.end()) {
+      // Edges of users the snapshot never knew about are incomplete; leave
+      // those users to the Redis/MongoDB path
+      continue;
+    }
+    auto &neighbors = lists[it->second].second;
+    if (!delta.second.removed.empty()) {
+      neighbors.erase(
+          std::remove_if(neighbors.begin(), neighbors.end(),
+                         [&](int64_t neighbor) {
+                           return delta.second.removed.count(neighbor) > 0;
+                         }),
+          neighbors.end());
+    }
+    neighbors.insert(neighbors.end(), delta.second.added.begin(),
+                     delta.second.added.end());
+  }
+  return _BuildCsr(&lists);
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SOCIALGRAPHSNAPSHOT_H
@@ -0,0 +1,230 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SORTEDINTERSECTION_H
+#define SOCIAL_NETWORK_MICROSERVICES_SORTEDINTERSECTION_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define SORTED_INTERSECTION_X86 1
+#endif
+
+// Switch from a merge to galloping once the longer list is this many times
+// longer than the shorter one.
+#define SORTED_INTERSECTION_GALLOP_RATIO 32
+
+namespace social_network {
+
+// Intersection of adjacency lists
+//
+// All functions below take int64 lists sorted ascending without duplicates
+// (the layout of SocialGraphSnapshot rows) and append the common elements to
+// out in ascending order.
+//
+// Lists of similar length are merged. On x86-64 the merge compares blocks of
+// 4 (AVX2) or 2 (SSE4.1) ids of one list against every rotation of a block
+// of the other, picked at run time so the service does not need to be built
+// with -mavx2. When one list is much longer than the other, each id of the
+// short list is instead located in the long one with an exponential search,
+// which costs O(small * log(large)) rather than O(small + large).
+
+inline void IntersectMergeScalar(const int64_t *a, size_t a_size,
+                                 const int64_t *b, size_t b_size,
+                                 std::vector<int64_t> *out) {
+  size_t i = 0;
+  size_t j = 0;
+  while (i < a_size && j < b_size) {
+    if (a[i] < b[j]) {
+      i++;
+    } else if (a[i] > b[j]) {
+      j++;
+    } else {
+      out->emplace_back(a[i]);
+      i++;
+      j++;
+    }
+  }
+}
+
+#ifdef SORTED_INTERSECTION_X86
+__attribute__((target("avx2"))) inline void IntersectMergeAvx2(
+    const int64_t *a, size_t a_size, const int64_t *b, size_t b_size,
+    std::vector<int64_t> *out) {
+  size_t i = 0;
+  size_t j = 0;
+  while (i + 4 <= a_size && j + 4 <= b_size) {
+    __m256i va =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+    __m256i vb =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + j));
+    __m256i match = _mm256_cmpeq_epi64(va, vb);
+    match = _mm256_or_si256(
+        match, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, 0x39)));
+    match = _mm256_or_si256(
+        match, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, 0x4E)));
+    match = _mm256_or_si256(
+        match, _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, 0x93)));
+    int mask = _mm256_movemask_pd(_mm256_castsi256_pd(match));
+    for (int k = 0; k < 4; k++) {
+      if (mask & (1 << k)) {
+        out->emplace_back(a[i + k]);
+      }
+    }
+    int64_t a_max = a[i + 3];
+    int64_t b_max = b[j + 3];
+    if (a_max <= b_max) {
+      i += 4;
+    }
+    if (b_max <= a_max) {
+      j += 4;
+    }
+  }
+  IntersectMergeScalar(a + i, a_size - i, b + j, b_size - j, out);
+}
+
+__attribute__((target("sse4.1"))) inline void IntersectMergeSse41(
+    const int64_t *a, size_t a_size, const int64_t *b, size_t b_size,
+    std::vector<int64_t> *out) {
+  size_t i = 0;
+  size_t j = 0;
+  while (i + 2 <= a_size && j + 2 <= b_size) {
+    __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+    __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + j));
+    __m128i match = _mm_or_si128(
+        _mm_cmpeq_epi64(va, vb),
+        _mm_cmpeq_epi64(va, _mm_shuffle_epi32(vb, 0x4E)));
+    int mask = _mm_movemask_pd(_mm_castsi128_pd(match));
+    if (mask & 1) {
+      out->emplace_back(a[i]);
+    }
+    if (mask & 2) {
+      out->emplace_back(a[i + 1]);
+    }
+    int64_t a_max = a[i + 1];
+    int64_t b_max = b[j + 1];
+    if (a_max <= b_max) {
+      i += 2;
+    }
+    if (b_max <= a_max) {
+      j += 2;
+    }
+  }
+  IntersectMergeScalar(a + i, a_size - i, b + j, b_size - j, out);
+}
+#endif
+
+inline void IntersectGallop(const int64_t *small, size_t small_size,
+                            const int64_t *large, size_t large_size,
+                            std::vector<int64_t> *out) {
+  size_t low = 0;
+  for (size_t i = 0; i < small_size && low < large_size; i++) {
+    int64_t target = small[i];
+    // Find a window [low, high) whose last element is >= target
+    size_t step = 1;
+    size_t high = low;
+    while (high < large_size && large[high] < target) {
+      low = high + 1;
+      high += step;
+      step <<= 1;
+    }
+    high = std::min(high + 1, large_size);
+    low = std::lower_bound(large + low, large + high, target) - large;
+    if (low < large_size && large[low] == target) {
+      out->emplace_back(target);
+      low++;
+    }
+  }
+}
+
+enum class IntersectKernel { SCALAR, SSE41, AVX2 };
+
+inline IntersectKernel DetectIntersectKernel() {
+#ifdef SORTED_INTERSECTION_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return IntersectKernel::AVX2;
+  }
+  if (__builtin_cpu_supports("sse4.1")) {
+    return IntersectKernel::SSE41;
+  }
+#endif
+  return IntersectKernel::SCALAR;
+}
+
+inline void IntersectSorted(const int64_t *a, size_t a_size, const int64_t *b,
+                            size_t b_size, std::vector<int64_t> *out) {
+  if (a_size > b_size) {
+    std::swap(a, b);
+    std::swap(a_size, b_size);
+  }
+  if (a_size == 0) {
+    return;
+  }
+  if (b_size / a_size >= SORTED_INTERSECTION_GALLOP_RATIO) {
+    IntersectGallop(a, a_size, b, b_size, out);
+    return;
+  }
+  out->reserve(out->size() + a_size);
+  static const IntersectKernel kernel = DetectIntersectKernel();
+  switch (kernel) {
+#ifdef SORTED_INTERSECTION_X86
+    case IntersectKernel::AVX2:
+      IntersectMergeAvx2(a, a_size, b, b_size, out);
+      return;
+    case IntersectKernel::SSE41:
+      IntersectMergeSse41(a, a_size, b, b_size, out);
+      return;
+#endif
+    default:
+      IntersectMergeScalar(a, a_size, b, b_size, out);
+  }
+}
+
+inline void IntersectSorted(const std::vector<int64_t> &a,
+                            const std::vector<int64_t> &b,
+                            std::vector<int64_t> *out) {
+  IntersectSorted(a.data(), a.size(), b.data(), b.size(), out);
+}
+
+// Intersects the lists shortest first, so every step is bounded by the size
+// of the running result, and stops as soon as it is empty.
+inline void IntersectSorted(
+    const std::vector<const std::vector<int64_t> *> &lists,
+    std::vector<int64_t> *out) {
+  if (lists.empty()) {
+    return;
+  }
+  std::vector<const std::vector<int64_t> *> by_size(lists);
+  std::sort(by_size.begin(), by_size.end(),
+            [](const std::vector<int64_t> *x, const std::vector<int64_t> *y) {
+              return x->size() < y->size();
+            });
+  if (by_size.size() == 1) {
+    out->insert(out->end(), by_size[0]->begin(), by_size[0]->end());
+    return;
+  }
+  std::vector<int64_t> current;
+  IntersectSorted(*by_size[0], *by_size[1], &current);
+  std::vector<int64_t> next;
+  for (size_t i = 2; i < by_size.size() && !current.empty(); i++) {
+    next.clear();
+    IntersectSorted(current, *by_size[i], &next);
+    current.swap(next);
+  }
+  out->insert(out->end(), current.begin(), current.end());
+}
+
+// Reference implementation, kept for IntersectionBenchmark.
+inline void IntersectSortedNaive(const std::vector<int64_t> &a,
+                                 const std::vector<int64_t> &b,
+                                 std::vector<int64_t> *out) {
+  std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                        std::back_inserter(*out));
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SORTEDINTERSECTION_H
@@ -0,0 +1,75 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_LOCALTEXTHANDLERS_H
+#define SOCIAL_NETWORK_MICROSERVICES_LOCALTEXTHANDLERS_H
+
+#include <memory>
+#include <string>
+
+#include "../ClientPool.h"
+#include "../ThriftClient.h"
+#include "../UrlShortenService/UrlShortenHandler.h"
+#include "../UserMentionService/UserMentionHandler.h"
+#include "../logger.h"
+#include "../utils.h"
+#include "../utils_memcached.h"
+#include "../utils_mongodb.h"
+
+namespace social_network {
+
+// The url-shorten and user-mention handlers, run inside text-service, so
+// ComposeText calls them without a Thrift hop. url-shorten runs on the
+// memcached/MongoDB instances of the standalone service, user-mention on a
+// pool of user-service connections. Set up as the standalone services are,
+// from the same config sections.
+struct LocalTextHandlers {
+  memcached_pool_st *url_memcached_client_pool = nullptr;
+  mongoc_client_pool_t *url_mongodb_client_pool = nullptr;
+  std::unique_ptr<ClientPool<ThriftClient<UserServiceClient>>>
+      user_client_pool;
+  std::unique_ptr<UrlShortenHandler> url_shorten_handler;
+  std::unique_ptr<UserMentionHandler> user_mention_handler;
+};
+
+bool InitLocalTextHandlers(const json &config_json,
+                           LocalTextHandlers *handlers) {
+  handlers->url_memcached_client_pool = init_memcached_client_pool(
+      config_json, "url-shorten", 32,
+      config_json["url-shorten-memcached"]["connections"]);
+  handlers->url_mongodb_client_pool = init_mongodb_client_pool(
+      config_json, "url-shorten",
+      config_json["url-shorten-mongodb"]["connections"]);
+  if (handlers->url_memcached_client_pool == nullptr ||
+      handlers->url_mongodb_client_pool == nullptr) {
+    return false;
+  }
+
+  if (!SetUpMongoIndexes(handlers->url_mongodb_client_pool,
+                         UrlShortenHandler::IndexSpecs(),
+                         UrlShortenHandler::QueryShapes(),
+                         config_json.value("mongodb_index_check", false))) {
+    LOG(fatal) << "Failed to set up the MongoDB indexes of UrlShortenHandler";
+    return false;
+  }
+
+  std::string secret = config_json["url-shorten-service"].value(
+      "short_code_secret", config_json["secret"].get<std::string>());
+  handlers->url_shorten_handler.reset(new UrlShortenHandler(
+      handlers->url_memcached_client_pool, handlers->url_mongodb_client_pool,
+      secret));
+
+  std::string user_addr = config_json["user-service"]["addr"];
+  int user_port = config_json["user-service"]["port"];
+  int user_conns = config_json["user-service"]["connections"];
+  int user_timeout = config_json["user-service"]["timeout_ms"];
+  int user_keepalive = config_json["user-service"]["keepalive_ms"];
+  handlers->user_client_pool.reset(
+      new ClientPool<ThriftClient<UserServiceClient>>(
+          "user-mention", user_addr, user_port, 0, user_conns, user_timeout,
+          user_keepalive, config_json));
+  handlers->user_mention_handler.reset(
+      new UserMentionHandler(handlers->user_client_pool.get()));
+  return true;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_LOCALTEXTHANDLERS_H
@@ -3,8 +3,10 @@
 
 #include <future>
 #include <iostream>
-#include <regex>
+#include <map>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "../../gen-cpp/TextService.h"
 #include "../../gen-cpp/UrlShortenService.h"
@@ -13,29 +15,125 @@
 #include "../ThriftClient.h"
 #include "../logger.h"
 #include "../tracing.h"
+#include "TextScanner.h"
 
 namespace social_network {
 
 class TextHandler : public TextServiceIf {
  public:
   TextHandler(ClientPool<ThriftClient<UrlShortenServiceClient>> *,
-              ClientPool<ThriftClient<UserMentionServiceClient>> *);
+              ClientPool<ThriftClient<UserMentionServiceClient>> *,
+              UrlShortenServiceIf *url_shorten_handler = nullptr,
+              UserMentionServiceIf *user_mention_handler = nullptr);
   ~TextHandler() override = default;
 
   void ComposeText(TextServiceReturn &_return, int64_t, const std::string &,
                    const std::map<std::string, std::string> &) override;
+  void ComposeTexts(std::vector<TextServiceReturn> &, int64_t,
+                    const std::vector<std::string> &,
+                    const std::map<std::string, std::string> &) override;
 
  private:
+  std::vector<Url> _ComposeUrls(
+      int64_t req_id, const std::vector<std::string> &urls,
+      const opentracing::SpanContext &parent_context);
+  std::vector<UserMention> _ComposeUserMentions(
+      int64_t req_id, const std::vector<std::string> &usernames,
+      const opentracing::SpanContext &parent_context);
+
   ClientPool<ThriftClient<UrlShortenServiceClient>> *_url_client_pool;
   ClientPool<ThriftClient<UserMentionServiceClient>> *_user_mention_client_pool;
+  // Set when url-shorten and user-mention run in this process, see
+  // "url_mention_mode" in TextService.cpp; the client pools are unused then
+  UrlShortenServiceIf *_url_shorten_handler;
+  UserMentionServiceIf *_user_mention_handler;
 };
 
 TextHandler::TextHandler(
     ClientPool<ThriftClient<UrlShortenServiceClient>> *url_client_pool,
     ClientPool<ThriftClient<UserMentionServiceClient>>
-        *user_mention_client_pool) {
+        *user_mention_client_pool,
+    UrlShortenServiceIf *url_shorten_handler,
+    UserMentionServiceIf *user_mention_handler) {
   _url_client_pool = url_client_pool;
   _user_mention_client_pool = user_mention_client_pool;
+  _url_shorten_handler = url_shorten_handler;
+  _user_mention_handler = user_mention_handler;
+}
+
+std::vector<Url> TextHandler::_ComposeUrls(
+    int64_t req_id, const std::vector<std::string> &urls,
+    const opentracing::SpanContext &parent_context) {
+  auto url_span = opentracing::Tracer::Global()->StartSpan(
+      "compose_urls_client", {opentracing::ChildOf(&parent_context)});
+
+  std::map<std::string, std::string> url_writer_text_map;
+  TextMapWriter url_writer(url_writer_text_map);
+  opentracing::Tracer::Global()->Inject(url_span->context(), url_writer);
+
+  std::vector<Url> _return_urls;
+  if (_url_shorten_handler) {
+    _url_shorten_handler->ComposeUrls(_return_urls, req_id, urls,
+                                      url_writer_text_map);
+    return _return_urls;
+  }
+  auto url_client_wrapper = _url_client_pool->Pop();
+  if (!url_client_wrapper) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
+    se.message = "Failed to connect to url-shorten-service";
+    throw se;
+  }
+  auto url_client = url_client_wrapper->GetClient();
+  try {
+    url_client->ComposeUrls(_return_urls, req_id, urls, url_writer_text_map);
+  } catch (...) {
+    LOG(error) << "Failed to upload urls to url-shorten-service";
+    _url_client_pool->Remove(url_client_wrapper);
+    throw;
+  }
+  _url_client_pool->Keepalive(url_client_wrapper);
+  return _return_urls;
+}
+
+std::vector<UserMention> TextHandler::_ComposeUserMentions(
+    int64_t req_id, const std::vector<std::string> &usernames,
+    const opentracing::SpanContext &parent_context) {
+  auto user_mention_span = opentracing::Tracer::Global()->StartSpan(
+      "compose_user_mentions_client", {opentracing::ChildOf(&parent_context)});
+
+  std::map<std::string, std::string> user_mention_writer_text_map;
+  TextMapWriter user_mention_writer(user_mention_writer_text_map);
+  opentracing::Tracer::Global()->Inject(user_mention_span->context(),
+                                        user_mention_writer);
+
+  std::vector<UserMention> _return_user_mentions;
+  if (_user_mention_handler) {
+    _user_mention_handler->ComposeUserMentions(_return_user_mentions, req_id,
+                                               usernames,
+                                               user_mention_writer_text_map);
+    return _return_user_mentions;
+  }
+  auto user_mention_client_wrapper = _user_mention_client_pool->Pop();
+  if (!user_mention_client_wrapper) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
+    se.message = "Failed to connect to user-mention-service";
+    throw se;
+  }
+  auto user_mention_client = user_mention_client_wrapper->GetClient();
+  try {
+    user_mention_client->ComposeUserMentions(_return_user_mentions, req_id,
+                                             usernames,
+                                             user_mention_writer_text_map);
+  } catch (...) {
+    LOG(error) << "Failed to upload user_mentions to user-mention-service";
+    _user_mention_client_pool->Remove(user_mention_client_wrapper);
+    throw;
+  }
+
+  _user_mention_client_pool->Keepalive(user_mention_client_wrapper);
+  return _return_user_mentions;
 }
 
 void TextHandler::ComposeText(
@@ -50,85 +148,28 @@ void TextHandler::ComposeText(
       "compose_text_server", {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
+  std::vector<TextToken> mention_tokens;
+  std::vector<TextToken> url_tokens;
+  ScanText(text, &mention_tokens, &url_tokens);
+
   std::vector<std::string> mention_usernames;
-  std::smatch m;
-  std::regex e("@[a-zA-Z0-9-_]+");
-  auto s = text;
-  while (std::regex_search(s, m, e)) {
-    auto user_mention = m.str();
-    user_mention = user_mention.substr(1, user_mention.length());
-    mention_usernames.emplace_back(user_mention);
-    s = m.suffix().str();
+  mention_usernames.reserve(mention_tokens.size());
+  for (auto const &token : mention_tokens) {
+    mention_usernames.emplace_back(text, token.offset + 1, token.length - 1);
   }
 
   std::vector<std::string> urls;
-  e = "(http://|https://)([a-zA-Z0-9_!~*'().&=+$%-]+)";
-  s = text;
-  while (std::regex_search(s, m, e)) {
-    auto url = m.str();
-    urls.emplace_back(url);
-    s = m.suffix().str();
+  urls.reserve(url_tokens.size());
+  for (auto const &token : url_tokens) {
+    urls.emplace_back(text, token.offset, token.length);
   }
 
   auto shortened_urls_future = std::async(std::launch::async, [&]() {
-    auto url_span = opentracing::Tracer::Global()->StartSpan(
-        "compose_urls_client", {opentracing::ChildOf(&span->context())});
-
-    std::map<std::string, std::string> url_writer_text_map;
-    TextMapWriter url_writer(url_writer_text_map);
-    opentracing::Tracer::Global()->Inject(url_span->context(), url_writer);
-
-    auto url_client_wrapper = _url_client_pool->Pop();
-    if (!url_client_wrapper) {
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
-      se.message = "Failed to connect to url-shorten-service";
-      throw se;
-    }
-    std::vector<Url> _return_urls;
-    auto url_client = url_client_wrapper->GetClient();
-    try {
-      url_client->ComposeUrls(_return_urls, req_id, urls, url_writer_text_map);
-    } catch (...) {
-      LOG(error) << "Failed to upload urls to url-shorten-service";
-      _url_client_pool->Remove(url_client_wrapper);
-      throw;
-    }
-    _url_client_pool->Keepalive(url_client_wrapper);
-    return _return_urls;
+    return _ComposeUrls(req_id, urls, span->context());
   });
 
   auto user_mention_future = std::async(std::launch::async, [&]() {
-    auto user_mention_span = opentracing::Tracer::Global()->StartSpan(
-        "compose_user_mentions_client",
-        {opentracing::ChildOf(&span->context())});
-
-    std::map<std::string, std::string> user_mention_writer_text_map;
-    TextMapWriter user_mention_writer(user_mention_writer_text_map);
-    opentracing::Tracer::Global()->Inject(user_mention_span->context(),
-                                          user_mention_writer);
-
-    auto user_mention_client_wrapper = _user_mention_client_pool->Pop();
-    if (!user_mention_client_wrapper) {
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
-      se.message = "Failed to connect to user-mention-service";
-      throw se;
-    }
-    std::vector<UserMention> _return_user_mentions;
-    auto user_mention_client = user_mention_client_wrapper->GetClient();
-    try {
-      user_mention_client->ComposeUserMentions(_return_user_mentions, req_id,
-                                               mention_usernames,
-                                               user_mention_writer_text_map);
-    } catch (...) {
-      LOG(error) << "Failed to upload user_mentions to user-mention-service";
-      _user_mention_client_pool->Remove(user_mention_client_wrapper);
-      throw;
-    }
-
-    _user_mention_client_pool->Keepalive(user_mention_client_wrapper);
-    return _return_user_mentions;
+    return _ComposeUserMentions(req_id, mention_usernames, span->context());
   });
 
   std::vector<Url> target_urls;
@@ -147,20 +188,19 @@ void TextHandler::ComposeText(
     throw;
   }
 
-  std::string updated_text;
-  if (!urls.empty()) {
-    s = text;
-    int idx = 0;
-    while (std::regex_search(s, m, e)) {
-      auto url = m.str();
-      urls.emplace_back(url);
-      updated_text += m.prefix().str() + target_urls[idx].shortened_url;
-      s = m.suffix().str();
-      idx++;
-    }
-  } else {
-    updated_text = text;
+  if (target_urls.size() != url_tokens.size()) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "url-shorten-service returned " +
+                 std::to_string(target_urls.size()) + " urls for " +
+                 std::to_string(url_tokens.size());
+    throw se;
   }
+  std::string updated_text = ReplaceTokens(
+      text, url_tokens,
+      [&](size_t i) -> const std::string & {
+        return target_urls[i].shortened_url;
+      });
 
   _return.user_mentions = user_mentions;
   _return.text = updated_text;
@@ -168,6 +208,100 @@ void TextHandler::ComposeText(
   span->Finish();
 }
 
+// ComposeText of many texts at once: the urls of all of them are shortened
+// with one ComposeUrls and their mentions resolved with one
+// ComposeUserMentions, which is one GetUserIds, instead of one of each per
+// text
+void TextHandler::ComposeTexts(
+    std::vector<TextServiceReturn> &_return, int64_t req_id,
+    const std::vector<std::string> &texts,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "compose_texts_server", {opentracing::ChildOf(parent_span->get())});
+
+  std::vector<std::vector<TextToken>> mention_tokens(texts.size());
+  std::vector<std::vector<TextToken>> url_tokens(texts.size());
+  std::vector<std::string> urls;
+  std::vector<std::string> mention_usernames;
+  std::map<std::string, int64_t> user_ids;
+  for (size_t i = 0; i < texts.size(); i++) {
+    ScanText(texts[i], &mention_tokens[i], &url_tokens[i]);
+    for (auto const &token : url_tokens[i]) {
+      urls.emplace_back(texts[i], token.offset, token.length);
+    }
+    for (auto const &token : mention_tokens[i]) {
+      std::string username(texts[i], token.offset + 1, token.length - 1);
+      if (user_ids.emplace(username, -1).second) {
+        mention_usernames.emplace_back(std::move(username));
+      }
+    }
+  }
+
+  auto shortened_urls_future = std::async(std::launch::async, [&]() {
+    return _ComposeUrls(req_id, urls, span->context());
+  });
+  std::vector<UserMention> user_mentions;
+  try {
+    user_mentions =
+        _ComposeUserMentions(req_id, mention_usernames, span->context());
+  } catch (...) {
+    LOG(error) << "Failed to upload user mentions to user-mention-service";
+    shortened_urls_future.wait();
+    throw;
+  }
+
+  std::vector<Url> target_urls;
+  try {
+    target_urls = shortened_urls_future.get();
+  } catch (...) {
+    LOG(error) << "Failed to get shortened urls from url-shorten-service";
+    throw;
+  }
+  if (target_urls.size() != urls.size()) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "url-shorten-service returned " +
+                 std::to_string(target_urls.size()) + " urls for " +
+                 std::to_string(urls.size());
+    throw se;
+  }
+  for (auto &user_mention : user_mentions) {
+    user_ids[user_mention.username] = user_mention.user_id;
+  }
+
+  _return.resize(texts.size());
+  size_t first_url = 0;
+  for (size_t i = 0; i < texts.size(); i++) {
+    _return[i].text = ReplaceTokens(
+        texts[i], url_tokens[i], [&](size_t j) -> const std::string & {
+          return target_urls[first_url + j].shortened_url;
+        });
+    _return[i].urls.assign(target_urls.begin() + first_url,
+                           target_urls.begin() + first_url +
+                               url_tokens[i].size());
+    first_url += url_tokens[i].size();
+
+    // As ComposeUserMentions: in the order of the mentions, each username
+    // once, and only those of users that exist
+    std::set<std::string> mentioned;
+    for (auto const &token : mention_tokens[i]) {
+      std::string username(texts[i], token.offset + 1, token.length - 1);
+      auto user_id = user_ids[username];
+      if (user_id < 0 || !mentioned.insert(username).second) {
+        continue;
+      }
+      UserMention user_mention;
+      user_mention.username = std::move(username);
+      user_mention.user_id = user_id;
+      _return[i].user_mentions.emplace_back(std::move(user_mention));
+    }
+  }
+  span->Finish();
+}
+
 }  // namespace social_network
 
 #endif  // SOCIAL_NETWORK_MICROSERVICES_TEXTHANDLER_H
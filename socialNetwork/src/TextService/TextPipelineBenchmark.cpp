@@ -0,0 +1,173 @@
+// Latency of TextHandler::ComposeText with url-shorten and user-mention
+// reached in the two ways "url_mention_mode" allows:
+//   rpc    Thrift calls to the deployed url-shorten-service and
+//          user-mention-service, through the same client pools as
+//          text-service
+//   local  their handlers in this process, url-shorten's on the same
+//          memcached/MongoDB, user-mention's on user-service
+// Both run posts of the same shape in turn, and the difference is the RPC tax
+// removed by co-location. Posts mention username_<i> users, as the
+// scripts/init_social_graph.py dataset registers them, and carry urls.
+// Run it next to the deployment, e.g. inside the text-service container.
+
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../logger.h"
+#include "../utils.h"
+#include "LocalTextHandlers.h"
+#include "TextHandler.h"
+
+using namespace social_network;
+
+static double ReportLatencies(const std::string &mode,
+                              std::vector<double> *latencies_us) {
+  std::sort(latencies_us->begin(), latencies_us->end());
+  double sum = 0;
+  for (double latency : *latencies_us) {
+    sum += latency;
+  }
+  auto percentile = [&](double p) {
+    size_t idx = std::min(latencies_us->size() - 1,
+                          (size_t)(p * latencies_us->size()));
+    return (*latencies_us)[idx];
+  };
+  double mean = sum / latencies_us->size();
+  LOG(info) << mode << ": " << latencies_us->size() << " posts, mean " << mean
+            << " us, p50 " << percentile(0.5) << " us, p99 "
+            << percentile(0.99) << " us";
+  return mean;
+}
+
+static bool TimeComposeText(TextHandler *handler,
+                            const std::vector<std::string> &texts,
+                            std::vector<double> *latencies_us) {
+  std::map<std::string, std::string> carrier;
+  latencies_us->clear();
+  try {
+    for (size_t i = 0; i < texts.size(); i++) {
+      TextServiceReturn text_return;
+      auto start = std::chrono::steady_clock::now();
+      handler->ComposeText(text_return, i, texts[i], carrier);
+      latencies_us->emplace_back(std::chrono::duration<double, std::micro>(
+                                     std::chrono::steady_clock::now() - start)
+                                     .count());
+    }
+  } catch (const ServiceException &e) {
+    LOG(error) << "ComposeText failed: " << e.message;
+    return false;
+  } catch (const std::exception &e) {
+    LOG(error) << "ComposeText failed: " << e.what();
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "config",
+      po::value<std::string>()->default_value("config/service-config.json"),
+      "Service config of the deployment")(
+      "requests", po::value<int>()->default_value(10000),
+      "Number of posts composed in each mode")(
+      "users", po::value<int>()->default_value(962),
+      "Mentioned users are username_0 .. username_<users - 1>")(
+      "mentions", po::value<int>()->default_value(2), "Mentions per post")(
+      "urls", po::value<int>()->default_value(2), "Urls per post")(
+      "seed", po::value<int>()->default_value(1), "Random seed");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  int num_requests = vm["requests"].as<int>();
+  int num_users = vm["users"].as<int>();
+  if (num_requests < 1 || num_users < 1) {
+    LOG(error) << "--requests and --users must be positive";
+    return EXIT_FAILURE;
+  }
+
+  // Each mode gets its own urls, so that neither finds the other's already
+  // shortened
+  std::mt19937 gen(vm["seed"].as<int>());
+  std::uniform_int_distribution<int> user(0, num_users - 1);
+  auto make_texts = [&](std::vector<std::string> *texts) {
+    for (int i = 0; i < num_requests; i++) {
+      std::string text = "Post " + std::to_string(i);
+      for (int j = 0; j < vm["mentions"].as<int>(); j++) {
+        text += " @username_" + std::to_string(user(gen));
+      }
+      for (int j = 0; j < vm["urls"].as<int>(); j++) {
+        text += " http://example.com/" + std::to_string(gen());
+      }
+      texts->emplace_back(text);
+    }
+  };
+  std::vector<std::string> rpc_texts;
+  std::vector<std::string> local_texts;
+  make_texts(&rpc_texts);
+  make_texts(&local_texts);
+
+  json config_json;
+  if (load_config_file(vm["config"].as<std::string>(), &config_json) != 0) {
+    return EXIT_FAILURE;
+  }
+
+  std::string url_addr = config_json["url-shorten-service"]["addr"];
+  int url_port = config_json["url-shorten-service"]["port"];
+  int url_conns = config_json["url-shorten-service"]["connections"];
+  int url_timeout = config_json["url-shorten-service"]["timeout_ms"];
+  int url_keepalive = config_json["url-shorten-service"]["keepalive_ms"];
+  std::string user_mention_addr = config_json["user-mention-service"]["addr"];
+  int user_mention_port = config_json["user-mention-service"]["port"];
+  int user_mention_conns = config_json["user-mention-service"]["connections"];
+  int user_mention_timeout = config_json["user-mention-service"]["timeout_ms"];
+  int user_mention_keepalive =
+      config_json["user-mention-service"]["keepalive_ms"];
+
+  ClientPool<ThriftClient<UrlShortenServiceClient>> url_client_pool(
+      "url-shorten-service", url_addr, url_port, 0, url_conns, url_timeout,
+      url_keepalive, config_json);
+  ClientPool<ThriftClient<UserMentionServiceClient>> user_mention_pool(
+      "user-mention-service", user_mention_addr, user_mention_port, 0,
+      user_mention_conns, user_mention_timeout, user_mention_keepalive,
+      config_json);
+  TextHandler rpc_handler(&url_client_pool, &user_mention_pool);
+
+  LocalTextHandlers local_handlers;
+  if (!InitLocalTextHandlers(config_json, &local_handlers)) {
+    return EXIT_FAILURE;
+  }
+  TextHandler local_handler(nullptr, nullptr,
+                            local_handlers.url_shorten_handler.get(),
+                            local_handlers.user_mention_handler.get());
+
+  std::vector<double> latencies_us;
+  if (!TimeComposeText(&rpc_handler, rpc_texts, &latencies_us)) {
+    return EXIT_FAILURE;
+  }
+  double rpc_mean = ReportLatencies("rpc", &latencies_us);
+  if (!TimeComposeText(&local_handler, local_texts, &latencies_us)) {
+    return EXIT_FAILURE;
+  }
+  double local_mean = ReportLatencies("local", &latencies_us);
+  LOG(info) << "RPC tax: " << rpc_mean - local_mean << " us per post ("
+            << 100.0 * (rpc_mean - local_mean) / rpc_mean
+            << "% of rpc mode)";
+  return 0;
+}
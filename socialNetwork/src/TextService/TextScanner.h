@@ -0,0 +1,161 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_TEXTSCANNER_H
+#define SOCIAL_NETWORK_MICROSERVICES_TEXTSCANNER_H
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace social_network {
+
+// Single-pass scanner for user mentions and urls
+//
+// Finds the same matches as the std::regex patterns TextService used to run
+// over the text, each from where the previous match of the same kind ended:
+//   mention  @[a-zA-Z0-9-_]+
+//   url      (http://|https://)([a-zA-Z0-9_!~*'().&=+$%-]+)
+// Mentions and urls are matched independently, so a url may start inside a
+// mention ("@http://x") as it did with two separate regex passes.
+//
+// Every match contains an '@' or a ':' at a fixed position, and both bytes
+// are rare in post text, so the scanner jumps between occurrences of either
+// byte (16 bytes at a time with SSE2) and only then checks the surrounding
+// bytes against lookup tables.
+
+struct TextToken {
+  size_t offset;
+  size_t length;
+};
+
+class TextByteClasses {
+ public:
+  static const TextByteClasses &Get() {
+    static const TextByteClasses classes;
+    return classes;
+  }
+  bool IsMentionChar(char c) const { return _mention[(unsigned char)c]; }
+  bool IsUrlChar(char c) const { return _url[(unsigned char)c]; }
+
+ private:
+  TextByteClasses() {
+    memset(_mention, 0, sizeof(_mention));
+    memset(_url, 0, sizeof(_url));
+    for (int c = 0; c < 256; c++) {
+      bool alnum = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                   (c >= '0' && c <= '9');
+      _mention[c] = alnum;
+      _url[c] = alnum;
+    }
+    for (const char *c = "-_"; *c; c++) {
+      _mention[(unsigned char)*c] = true;
+    }
+    for (const char *c = "_!~*'().&=+$%-"; *c; c++) {
+      _url[(unsigned char)*c] = true;
+    }
+  }
+
+  bool _mention[256];
+  bool _url[256];
+};
+
+// Position of the first '@' or ':' in data[pos, size), or size
+inline size_t FindMentionOrUrlMarker(const char *data, size_t pos,
+                                     size_t size) {
+#if defined(__SSE2__)
+  const __m128i at = _mm_set1_epi8('@');
+  const __m128i colon = _mm_set1_epi8(':');
+  while (pos + 16 <= size) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + pos));
+    int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, at),
+                                              _mm_cmpeq_epi8(chunk, colon)));
+    if (mask) {
+      return pos + __builtin_ctz(mask);
+    }
+    pos += 16;
+  }
+#endif
+  while (pos < size && data[pos] != '@' && data[pos] != ':') {
+    pos++;
+  }
+  return pos;
+}
+
+// Appends the mention and url matches of text, in order. Mention tokens
+// include the leading '@'.
+inline void ScanText(const std::string &text, std::vector<TextToken> *mentions,
+                     std::vector<TextToken> *urls) {
+  const TextByteClasses &classes = TextByteClasses::Get();
+  const char *data = text.data();
+  size_t size = text.size();
+  // End of the last url match; a scheme starting before it was consumed
+  size_t url_end = 0;
+
+  size_t pos = FindMentionOrUrlMarker(data, 0, size);
+  while (pos < size) {
+    size_t next = pos + 1;
+    if (data[pos] == '@') {
+      size_t end = pos + 1;
+      while (end < size && classes.IsMentionChar(data[end])) {
+        end++;
+      }
+      if (end > pos + 1) {
+        mentions->push_back({pos, end - pos});
+        next = end;
+      }
+    } else {
+      // "http://" or "https://" with the ':' at pos
+      size_t start = size;
+      if (pos >= 5 && memcmp(data + pos - 5, "https", 5) == 0) {
+        start = pos - 5;
+      } else if (pos >= 4 && memcmp(data + pos - 4, "http", 4) == 0) {
+        start = pos - 4;
+      }
+      if (start != size && start >= url_end && pos + 2 < size &&
+          data[pos + 1] == '/' && data[pos + 2] == '/') {
+        size_t end = pos + 3;
+        while (end < size && classes.IsUrlChar(data[end])) {
+          end++;
+        }
+        if (end > pos + 3) {
+          urls->push_back({start, end - start});
+          url_end = end;
+          // A mention cannot start inside a url, '@' is not a url char
+          next = end;
+        }
+      }
+    }
+    pos = FindMentionOrUrlMarker(data, next, size);
+  }
+}
+
+// Returns text with tokens[i] replaced by replacement(i). tokens must be in
+// order and not overlap. The result is built in one pass into a buffer sized
+// up front.
+template <typename Replacement>
+inline std::string ReplaceTokens(const std::string &text,
+                                 const std::vector<TextToken> &tokens,
+                                 const Replacement &replacement) {
+  size_t size = text.size();
+  for (size_t i = 0; i < tokens.size(); i++) {
+    size = size - tokens[i].length + replacement(i).size();
+  }
+  std::string result;
+  result.reserve(size);
+  size_t copied = 0;
+  for (size_t i = 0; i < tokens.size(); i++) {
+    result.append(text, copied, tokens[i].offset - copied);
+    result.append(replacement(i));
+    copied = tokens[i].offset + tokens[i].length;
+  }
+  result.append(text, copied, std::string::npos);
+  return result;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_TEXTSCANNER_H
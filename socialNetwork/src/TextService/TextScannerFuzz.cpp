@@ -0,0 +1,148 @@
+// Differential fuzzer of TextScanner against the std::regex matching that
+// TextHandler::ComposeText used before.
+//
+// Random texts are drawn from fragments that exercise the edges of both
+// patterns ("@", "http://", "https://", ':' and '/', bytes in and out of the
+// mention and url classes, non-ASCII bytes). For each text the mentions, the
+// urls and the text with every url replaced are compared with what the regex
+// loops produce, and the first mismatch is reported. The time spent by each
+// side is reported at the end.
+
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "../logger.h"
+#include "TextScanner.h"
+
+using namespace social_network;
+
+struct ScanResult {
+  std::vector<std::string> mentions;
+  std::vector<std::string> urls;
+  std::string text;
+};
+
+static std::string ShortenedUrl(size_t idx) {
+  return "http://short-url/" + std::to_string(idx);
+}
+
+// The former ComposeText, with the url rewrite keeping the text after the
+// last url
+static void RegexScan(const std::string &text, ScanResult *result) {
+  std::smatch m;
+  std::regex e("@[a-zA-Z0-9-_]+");
+  auto s = text;
+  while (std::regex_search(s, m, e)) {
+    auto user_mention = m.str();
+    result->mentions.emplace_back(user_mention.substr(1));
+    s = m.suffix().str();
+  }
+
+  e = "(http://|https://)([a-zA-Z0-9_!~*'().&=+$%-]+)";
+  s = text;
+  while (std::regex_search(s, m, e)) {
+    result->text += m.prefix().str() + ShortenedUrl(result->urls.size());
+    result->urls.emplace_back(m.str());
+    s = m.suffix().str();
+  }
+  result->text += s;
+}
+
+static void TokenScan(const std::string &text, ScanResult *result) {
+  std::vector<TextToken> mention_tokens;
+  std::vector<TextToken> url_tokens;
+  ScanText(text, &mention_tokens, &url_tokens);
+  for (auto const &token : mention_tokens) {
+    result->mentions.emplace_back(text, token.offset + 1, token.length - 1);
+  }
+  std::vector<std::string> shortened_urls;
+  for (auto const &token : url_tokens) {
+    result->urls.emplace_back(text, token.offset, token.length);
+    shortened_urls.emplace_back(ShortenedUrl(shortened_urls.size()));
+  }
+  result->text = ReplaceTokens(
+      text, url_tokens,
+      [&](size_t i) -> const std::string & { return shortened_urls[i]; });
+}
+
+static std::string Join(const std::vector<std::string> &strs) {
+  std::string joined = "[";
+  for (size_t i = 0; i < strs.size(); i++) {
+    joined += (i ? ", \"" : "\"") + strs[i] + "\"";
+  }
+  return joined + "]";
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "iterations", po::value<int>()->default_value(200000),
+      "Number of random texts")(
+      "max-fragments", po::value<int>()->default_value(64),
+      "Most fragments concatenated into one text")(
+      "seed", po::value<int>()->default_value(1), "Random seed");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  const std::vector<std::string> fragments = {
+      "@", "@@", "http://", "https://", "http:/", "https:", "http", "https",
+      "h", "ttp", "s://", ":", "//", "/", " ", "\n", "a", "Z", "9", "-", "_",
+      ".", "!", "~", "*", "'", "(", ")", "&", "=", "+", "$", "%", "#", "?",
+      ",", "\xc3\xa9", "\xff", std::string(1, '\0'), "user_0", "example.com",
+      "http://example.com/path?q=1", "@user-1:"};
+
+  int iterations = vm["iterations"].as<int>();
+  std::mt19937 gen(vm["seed"].as<int>());
+  std::uniform_int_distribution<int> num_fragments(
+      0, vm["max-fragments"].as<int>());
+  std::uniform_int_distribution<size_t> fragment(0, fragments.size() - 1);
+
+  std::chrono::nanoseconds regex_time(0);
+  std::chrono::nanoseconds scanner_time(0);
+  for (int i = 0; i < iterations; i++) {
+    std::string text;
+    for (int n = num_fragments(gen); n > 0; n--) {
+      text += fragments[fragment(gen)];
+    }
+
+    ScanResult expected, actual;
+    auto start = std::chrono::steady_clock::now();
+    RegexScan(text, &expected);
+    auto mid = std::chrono::steady_clock::now();
+    TokenScan(text, &actual);
+    auto end = std::chrono::steady_clock::now();
+    regex_time += mid - start;
+    scanner_time += end - mid;
+
+    if (expected.mentions != actual.mentions || expected.urls != actual.urls ||
+        expected.text != actual.text) {
+      LOG(error) << "Mismatch on text \"" << text << "\": regex mentions "
+                 << Join(expected.mentions) << " urls " << Join(expected.urls)
+                 << " text \"" << expected.text << "\", scanner mentions "
+                 << Join(actual.mentions) << " urls " << Join(actual.urls)
+                 << " text \"" << actual.text << "\"";
+      return EXIT_FAILURE;
+    }
+  }
+
+  LOG(info) << iterations << " texts agree, std::regex "
+            << regex_time.count() / 1e6 << " ms, TextScanner "
+            << scanner_time.count() / 1e6 << " ms ("
+            << (double)regex_time.count() / scanner_time.count() << "x)";
+  return 0;
+}
@@ -6,6 +6,7 @@
 
 #include "../utils.h"
 #include "../utils_thrift.h"
+#include "LocalTextHandlers.h"
 #include "TextHandler.h"
 
 using apache::thrift::protocol::TBinaryProtocolFactory;
@@ -25,32 +26,58 @@ int main(int argc, char *argv[]) {
   if (load_config_file("config/service-config.json", &config_json) == 0) {
     int port = config_json["text-service"]["port"];
 
-    std::string url_addr = config_json["url-shorten-service"]["addr"];
-    int url_port = config_json["url-shorten-service"]["port"];
-    int url_conns = config_json["url-shorten-service"]["connections"];
-    int url_timeout = config_json["url-shorten-service"]["timeout_ms"];
-    int url_keepalive = config_json["url-shorten-service"]["keepalive_ms"];
+    // "rpc": call url-shorten-service and user-mention-service over Thrift
+    // "local": run their handlers in this process, see LocalTextHandlers
+    std::string url_mention_mode =
+        config_json["text-service"].value("url_mention_mode", "rpc");
 
-    std::string user_mention_addr = config_json["user-mention-service"]["addr"];
-    int user_mention_port = config_json["user-mention-service"]["port"];
-    int user_mention_conns = config_json["user-mention-service"]["connections"];
-    int user_mention_timeout =
-        config_json["user-mention-service"]["timeout_ms"];
-    int user_mention_keepalive =
-        config_json["user-mention-service"]["keepalive_ms"];
+    std::unique_ptr<ClientPool<ThriftClient<UrlShortenServiceClient>>>
+        url_client_pool;
+    std::unique_ptr<ClientPool<ThriftClient<UserMentionServiceClient>>>
+        user_mention_pool;
+    LocalTextHandlers local_handlers;
+    if (url_mention_mode == "rpc") {
+      std::string url_addr = config_json["url-shorten-service"]["addr"];
+      int url_port = config_json["url-shorten-service"]["port"];
+      int url_conns = config_json["url-shorten-service"]["connections"];
+      int url_timeout = config_json["url-shorten-service"]["timeout_ms"];
+      int url_keepalive = config_json["url-shorten-service"]["keepalive_ms"];
 
-    ClientPool<ThriftClient<UrlShortenServiceClient>> url_client_pool(
-        "url-shorten-service", url_addr, url_port, 0, url_conns, url_timeout,
-        url_keepalive, config_json);
+      std::string user_mention_addr =
+          config_json["user-mention-service"]["addr"];
+      int user_mention_port = config_json["user-mention-service"]["port"];
+      int user_mention_conns =
+          config_json["user-mention-service"]["connections"];
+      int user_mention_timeout =
+          config_json["user-mention-service"]["timeout_ms"];
+      int user_mention_keepalive =
+          config_json["user-mention-service"]["keepalive_ms"];
 
-    ClientPool<ThriftClient<UserMentionServiceClient>> user_mention_pool(
-        "user-mention-service", user_mention_addr, user_mention_port, 0,
-        user_mention_conns, user_mention_timeout, user_mention_keepalive, config_json);
+      url_client_pool.reset(
+          new ClientPool<ThriftClient<UrlShortenServiceClient>>(
+              "url-shorten-service", url_addr, url_port, 0, url_conns,
+              url_timeout, url_keepalive, config_json));
+
+      user_mention_pool.reset(
+          new ClientPool<ThriftClient<UserMentionServiceClient>>(
+              "user-mention-service", user_mention_addr, user_mention_port, 0,
+              user_mention_conns, user_mention_timeout,
+              user_mention_keepalive, config_json));
+    } else if (url_mention_mode == "local") {
+      if (!InitLocalTextHandlers(config_json, &local_handlers)) {
+        exit(EXIT_FAILURE);
+      }
+    } else {
+      LOG(fatal) << "Unknown url_mention_mode " << url_mention_mode;
+      exit(EXIT_FAILURE);
+    }
 
     std::shared_ptr<TServerSocket> server_socket = get_server_socket(config_json, "0.0.0.0", port);
     TThreadedServer server(
         std::make_shared<TextServiceProcessor>(std::make_shared<TextHandler>(
-            &url_client_pool, &user_mention_pool)),
+            url_client_pool.get(), user_mention_pool.get(),
+            local_handlers.url_shorten_handler.get(),
+            local_handlers.user_mention_handler.get())),
         server_socket,
         std::make_shared<TFramedTransportFactory>(),
         std::make_shared<TBinaryProtocolFactory>());
@@ -0,0 +1,187 @@
+// Multi-threaded throughput benchmark of UniqueIdGenerator.
+//
+// Each run starts --threads threads that compose --ids ids each, with
+//   mutex    the former ComposeUniqueId: a global lock around the counter and
+//            hex string formatting of the id
+//   next-id  UniqueIdGenerator::NextId
+//   block    UniqueIdGenerator::NextIds, --block ids per call, as a caller
+//            caching ComposeUniqueIds blocks would
+// and reports ids per second. The ids of the generator runs are checked to
+// be unique. The id layout caps any generator at UNIQUE_ID_MAX_BLOCK ids per
+// millisecond, about 4.1M ids/s, which the lock-free runs reach.
+
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../UniqueIdGenerator.h"
+#include "../logger.h"
+
+using namespace social_network;
+
+static std::mutex legacy_lock;
+static int64_t legacy_timestamp = -1;
+static int legacy_counter = 0;
+
+static int64_t LegacyComposeUniqueId(const std::string &machine_id) {
+  legacy_lock.lock();
+  int64_t timestamp =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count() -
+      CUSTOM_EPOCH;
+  if (legacy_timestamp != timestamp) {
+    legacy_timestamp = timestamp;
+    legacy_counter = 0;
+  }
+  int idx = legacy_counter++;
+  legacy_lock.unlock();
+
+  std::stringstream sstream;
+  sstream << std::hex << timestamp;
+  std::string timestamp_hex(sstream.str());
+  if (timestamp_hex.size() > 10) {
+    timestamp_hex.erase(0, timestamp_hex.size() - 10);
+  } else if (timestamp_hex.size() < 10) {
+    timestamp_hex = std::string(10 - timestamp_hex.size(), '0') + timestamp_hex;
+  }
+  sstream.clear();
+  sstream.str(std::string());
+  sstream << std::hex << idx;
+  std::string counter_hex(sstream.str());
+  if (counter_hex.size() > 3) {
+    counter_hex.erase(0, counter_hex.size() - 3);
+  } else if (counter_hex.size() < 3) {
+    counter_hex = std::string(3 - counter_hex.size(), '0') + counter_hex;
+  }
+  std::string id_str = machine_id + timestamp_hex + counter_hex;
+  return stoul(id_str, nullptr, 16) & 0x7FFFFFFFFFFFFFFF;
+}
+
+// Runs compose(&ids[i]) on thread i of num_threads and returns ids/s
+template <typename Compose>
+static double RunThreads(int num_threads, const Compose &compose,
+                         std::vector<std::vector<int64_t>> *ids) {
+  ids->assign(num_threads, std::vector<int64_t>());
+  std::vector<std::thread> threads;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < num_threads; i++) {
+    threads.emplace_back([&, i]() { compose(&(*ids)[i]); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+  size_t total = 0;
+  for (auto const &thread_ids : *ids) {
+    total += thread_ids.size();
+  }
+  return (double)total * 1e9 / (double)elapsed;
+}
+
+static size_t CountDuplicates(const std::vector<std::vector<int64_t>> &ids) {
+  std::vector<int64_t> all;
+  for (auto const &thread_ids : ids) {
+    all.insert(all.end(), thread_ids.begin(), thread_ids.end());
+  }
+  std::sort(all.begin(), all.end());
+  return all.size() - (std::unique(all.begin(), all.end()) - all.begin());
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "threads", po::value<std::vector<int>>()->multitoken()->default_value(
+                     std::vector<int>{1, 2, 4, 8}, "1 2 4 8"),
+      "Thread counts to run")(
+      "ids", po::value<int>()->default_value(1000000),
+      "Number of ids composed by each thread")(
+      "block", po::value<int>()->default_value(64),
+      "Ids reserved per NextIds call in the block run");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  int num_ids = vm["ids"].as<int>();
+  int block = vm["block"].as<int>();
+  if (block < 1 || block > UNIQUE_ID_MAX_BLOCK) {
+    LOG(error) << "--block must be between 1 and " << UNIQUE_ID_MAX_BLOCK;
+    return EXIT_FAILURE;
+  }
+
+  for (int num_threads : vm["threads"].as<std::vector<int>>()) {
+    std::vector<std::vector<int64_t>> ids;
+    double mutex_rate = RunThreads(
+        num_threads,
+        [&](std::vector<int64_t> *out) {
+          out->reserve(num_ids);
+          for (int i = 0; i < num_ids; i++) {
+            out->emplace_back(LegacyComposeUniqueId("123"));
+          }
+        },
+        &ids);
+    size_t mutex_duplicates = CountDuplicates(ids);
+
+    UniqueIdGenerator next_id_generator(0x123);
+    double next_id_rate = RunThreads(
+        num_threads,
+        [&](std::vector<int64_t> *out) {
+          out->reserve(num_ids);
+          int64_t id;
+          for (int i = 0; i < num_ids; i++) {
+            if (!next_id_generator.NextId(&id)) {
+              exit(EXIT_FAILURE);
+            }
+            out->emplace_back(id);
+          }
+        },
+        &ids);
+    size_t next_id_duplicates = CountDuplicates(ids);
+
+    UniqueIdGenerator block_generator(0x123);
+    double block_rate = RunThreads(
+        num_threads,
+        [&](std::vector<int64_t> *out) {
+          out->reserve(num_ids);
+          int64_t first_id;
+          while ((int)out->size() < num_ids) {
+            if (!block_generator.NextIds(block, &first_id)) {
+              exit(EXIT_FAILURE);
+            }
+            for (int i = 0; i < block && (int)out->size() < num_ids; i++) {
+              out->emplace_back(first_id + i);
+            }
+          }
+        },
+        &ids);
+    size_t block_duplicates = CountDuplicates(ids);
+
+    LOG(info) << num_threads << " threads: mutex " << mutex_rate / 1e6
+              << " M ids/s (" << mutex_duplicates << " duplicates), next-id "
+              << next_id_rate / 1e6 << " M ids/s, block of " << block << " "
+              << block_rate / 1e6 << " M ids/s";
+    if (next_id_duplicates > 0 || block_duplicates > 0) {
+      LOG(error) << "UniqueIdGenerator composed " << next_id_duplicates
+                 << " + " << block_duplicates << " duplicate ids";
+      return EXIT_FAILURE;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,112 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_URLSHORTENSERVICE_SHORTCODE_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_URLSHORTENSERVICE_SHORTCODE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#define SHORT_CODE_LENGTH 10
+
+namespace social_network {
+
+#define SIPROUND                     \
+  do {                               \
+    v0 += v1;                        \
+    v1 = (v1 << 13) | (v1 >> 51);    \
+    v1 ^= v0;                        \
+    v0 = (v0 << 32) | (v0 >> 32);    \
+    v2 += v3;                        \
+    v3 = (v3 << 16) | (v3 >> 48);    \
+    v3 ^= v2;                        \
+    v0 += v3;                        \
+    v3 = (v3 << 21) | (v3 >> 43);    \
+    v3 ^= v0;                        \
+    v2 += v1;                        \
+    v1 = (v1 << 17) | (v1 >> 47);    \
+    v1 ^= v2;                        \
+    v2 = (v2 << 32) | (v2 >> 32);    \
+  } while (0)
+
+// SipHash-2-4 of data under the 128-bit key (k0, k1)
+inline uint64_t SipHash24(uint64_t k0, uint64_t k1, const char *data,
+                          size_t length) {
+  uint64_t v0 = 0x736f6d6570736575ULL ^ k0;
+  uint64_t v1 = 0x646f72616e646f6dULL ^ k1;
+  uint64_t v2 = 0x6c7967656e657261ULL ^ k0;
+  uint64_t v3 = 0x7465646279746573ULL ^ k1;
+
+  const unsigned char *in = reinterpret_cast<const unsigned char *>(data);
+  size_t num_words = length / 8;
+  for (size_t i = 0; i < num_words; i++) {
+    uint64_t m = 0;
+    for (int j = 0; j < 8; j++) {
+      m |= (uint64_t)in[i * 8 + j] << (8 * j);
+    }
+    v3 ^= m;
+    SIPROUND;
+    SIPROUND;
+    v0 ^= m;
+  }
+  uint64_t b = (uint64_t)length << 56;
+  for (size_t j = 0; j < length % 8; j++) {
+    b |= (uint64_t)in[num_words * 8 + j] << (8 * j);
+  }
+  v3 ^= b;
+  SIPROUND;
+  SIPROUND;
+  v0 ^= b;
+  v2 ^= 0xff;
+  SIPROUND;
+  SIPROUND;
+  SIPROUND;
+  SIPROUND;
+  return v0 ^ v1 ^ v2 ^ v3;
+}
+
+#undef SIPROUND
+
+// Content-addressed short codes of expanded urls
+//
+// The code of a url is a keyed hash of it, written as SHORT_CODE_LENGTH
+// base62 characters, so shortening the same url twice gives the same code
+// and without the key codes cannot be predicted or collided on purpose. Two
+// urls may still share a code by chance; the caller then moves the later
+// url to the code of the next attempt.
+class ShortCoder {
+ public:
+  explicit ShortCoder(const std::string &secret) {
+    std::string k0_seed = "url-shorten-k0:" + secret;
+    std::string k1_seed = "url-shorten-k1:" + secret;
+    _k0 = SipHash24(0, 0, k0_seed.data(), k0_seed.size());
+    _k1 = SipHash24(0, 0, k1_seed.data(), k1_seed.size());
+  }
+
+  std::string Code(const std::string &url, int attempt) const {
+    uint64_t hash;
+    if (attempt == 0) {
+      hash = SipHash24(_k0, _k1, url.data(), url.size());
+    } else {
+      std::string salted = url;
+      salted.push_back('\0');
+      salted += std::to_string(attempt);
+      hash = SipHash24(_k0, _k1, salted.data(), salted.size());
+    }
+    const char char_map[] =
+        "abcdefghijklmnopqrstuvwxyzABCDEF"
+        "GHIJKLMNOPQRSTUVWXYZ0123456789";
+    std::string code(SHORT_CODE_LENGTH, ' ');
+    for (int i = 0; i < SHORT_CODE_LENGTH; i++) {
+      code[i] = char_map[hash % 62];
+      hash /= 62;
+    }
+    return code;
+  }
+
+ private:
+  uint64_t _k0;
+  uint64_t _k1;
+};
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SRC_URLSHORTENSERVICE_SHORTCODE_H_
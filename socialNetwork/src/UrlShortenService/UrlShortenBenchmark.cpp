@@ -0,0 +1,154 @@
+// Shortening and expansion rate of url-shorten-service.
+//
+// Runs, each over --distinct-urls urls sent --batch at a time:
+//   code     ShortCoder::Code in this process, the cost of a content-addressed
+//            code without any I/O, and how many codes collide
+//   compose  ComposeUrls on urls never shortened before (Mongo inserts)
+//   repeat   ComposeUrls on the same urls again, which must return the same
+//            codes without new inserts
+//   expand   GetExtendedUrls on the codes, which must give the urls back
+// and reports urls per second. The RPC runs use the service in --config,
+// e.g. inside the url-shorten-service container.
+
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../gen-cpp/UrlShortenService.h"
+#include "../ThriftClient.h"
+#include "../logger.h"
+#include "../utils.h"
+#include "ShortCode.h"
+
+using namespace social_network;
+
+template <typename Run>
+static double UrlsPerSecond(size_t num_urls, const Run &run) {
+  auto start = std::chrono::steady_clock::now();
+  run();
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+  return (double)num_urls * 1e9 / (double)elapsed;
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "config",
+      po::value<std::string>()->default_value("config/service-config.json"),
+      "Service config holding the url-shorten-service address")(
+      "distinct-urls", po::value<int>()->default_value(100000),
+      "Number of distinct urls")(
+      "batch", po::value<int>()->default_value(8), "Urls per request")(
+      "seed", po::value<int>()->default_value(1),
+      "Random seed, change it to shorten urls never seen by the service")(
+      "skip-rpc", po::bool_switch()->default_value(false),
+      "Only time the code run");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  int num_urls = vm["distinct-urls"].as<int>();
+  int batch = vm["batch"].as<int>();
+  if (num_urls < 1 || batch < 1) {
+    LOG(error) << "--distinct-urls and --batch must be positive";
+    return EXIT_FAILURE;
+  }
+
+  std::mt19937_64 gen(vm["seed"].as<int>());
+  std::vector<std::string> urls;
+  for (int i = 0; i < num_urls; i++) {
+    urls.emplace_back("http://example.com/" + std::to_string(gen()) + "/" +
+                      std::to_string(i));
+  }
+
+  ShortCoder coder("secret");
+  std::vector<std::string> codes;
+  codes.reserve(num_urls);
+  double code_rate = UrlsPerSecond(num_urls, [&]() {
+    for (auto &url : urls) {
+      codes.emplace_back(coder.Code(url, 0));
+    }
+  });
+  std::sort(codes.begin(), codes.end());
+  size_t collisions =
+      codes.end() - std::unique(codes.begin(), codes.end());
+  LOG(info) << "code: " << code_rate / 1e6 << " M urls/s, " << collisions
+            << " urls sharing a first-attempt code";
+  if (vm["skip-rpc"].as<bool>()) {
+    return 0;
+  }
+
+  json config_json;
+  if (load_config_file(vm["config"].as<std::string>(), &config_json) != 0) {
+    return EXIT_FAILURE;
+  }
+  std::string addr = config_json["url-shorten-service"]["addr"];
+  int port = config_json["url-shorten-service"]["port"];
+  ThriftClient<UrlShortenServiceClient> client(addr, port, 0, config_json);
+  std::map<std::string, std::string> carrier;
+
+  std::vector<std::vector<std::string>> batches;
+  for (int i = 0; i < num_urls; i += batch) {
+    batches.emplace_back(urls.begin() + i,
+                         urls.begin() + std::min(num_urls, i + batch));
+  }
+  std::vector<std::vector<Url>> composed(batches.size());
+  std::vector<std::vector<Url>> recomposed(batches.size());
+  std::vector<std::vector<std::string>> shortened(batches.size());
+  std::vector<std::vector<std::string>> expanded(batches.size());
+  try {
+    client.Connect();
+    double compose_rate = UrlsPerSecond(num_urls, [&]() {
+      for (size_t i = 0; i < batches.size(); i++) {
+        client.GetClient()->ComposeUrls(composed[i], i, batches[i], carrier);
+      }
+    });
+    double repeat_rate = UrlsPerSecond(num_urls, [&]() {
+      for (size_t i = 0; i < batches.size(); i++) {
+        client.GetClient()->ComposeUrls(recomposed[i], i, batches[i], carrier);
+      }
+    });
+    for (size_t i = 0; i < batches.size(); i++) {
+      for (auto &url : composed[i]) {
+        shortened[i].emplace_back(url.shortened_url);
+      }
+    }
+    double expand_rate = UrlsPerSecond(num_urls, [&]() {
+      for (size_t i = 0; i < batches.size(); i++) {
+        client.GetClient()->GetExtendedUrls(expanded[i], i, shortened[i],
+                                            carrier);
+      }
+    });
+    LOG(info) << "compose: " << compose_rate << " urls/s, repeat: "
+              << repeat_rate << " urls/s, expand: " << expand_rate
+              << " urls/s";
+  } catch (const std::exception &e) {
+    LOG(error) << "Failed to call url-shorten-service at " << addr << ":"
+               << port << ": " << e.what();
+    return EXIT_FAILURE;
+  }
+
+  for (size_t i = 0; i < batches.size(); i++) {
+    if (composed[i] != recomposed[i] || expanded[i] != batches[i]) {
+      LOG(error) << "Batch " << i << " did not round-trip";
+      return EXIT_FAILURE;
+    }
+  }
+  return 0;
+}
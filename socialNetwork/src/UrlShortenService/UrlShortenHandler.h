@@ -1,9 +1,11 @@
 #ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_URLSHORTENSERVICE_URLSHORTENHANDLER_H_
 #define SOCIAL_NETWORK_MICROSERVICES_SRC_URLSHORTENSERVICE_URLSHORTENHANDLER_H_
 
-#include <random>
-#include <chrono>
-#include <future>
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
 
 #include <mongoc.h>
 #include <libmemcached/memcached.h>
@@ -12,16 +14,25 @@
 
 #include "../../gen-cpp/UrlShortenService.h"
 #include "../../gen-cpp/social_network_types.h"
+#include "../MongoIndexes.h"
 #include "../logger.h"
 #include "../tracing.h"
+#include "ShortCode.h"
 
 #define HOSTNAME "http://short-url/"
+// Codes tried for one url before ComposeUrls gives up on it
+#define SHORT_CODE_MAX_ATTEMPTS 8
 
 namespace social_network {
 
+// Short codes are content-addressed (see ShortCoder): a url shortened before
+// is found in memcached, keyed by its code, or in MongoDB and is not
+// inserted again. A code already taken by another url moves the url to its
+// next attempt's code.
 class UrlShortenHandler : public UrlShortenServiceIf {
  public:
-  UrlShortenHandler(memcached_pool_st *, mongoc_client_pool_t *, std::mutex *);
+  UrlShortenHandler(memcached_pool_st *, mongoc_client_pool_t *,
+                    const std::string &);
   ~UrlShortenHandler() override = default;
 
   void ComposeUrls(std::vector<Url> &, int64_t,
@@ -32,39 +43,35 @@ class UrlShortenHandler : public UrlShortenServiceIf {
                        const std::vector<std::string> &,
                        const std::map<std::string, std::string> &) override ;
 
+  // MongoDB indexes this handler's queries rely on, and sample queries of
+  // each shape it issues, for SetUpMongoIndexes
+  static std::vector<MongoIndexSpec> IndexSpecs();
+  static std::vector<MongoQueryShape> QueryShapes();
+
  private:
   memcached_pool_st *_memcached_client_pool;
   mongoc_client_pool_t *_mongodb_client_pool;
-  static std::mt19937 _generator;
-  std::uniform_int_distribution<int> _distribution;
-  std::string _GenRandomStr(int length);
-  std::mutex *_thread_lock;
-};
+  ShortCoder _coder;
 
-std::mt19937 UrlShortenHandler::_generator = std::mt19937(std::chrono::duration_cast<std::chrono::milliseconds>(
-          std::chrono::system_clock::now().time_since_epoch()).count() % 0xffffffff);
+  void _MemcachedGet(const std::vector<std::string> &,
+                     std::map<std::string, std::string> *);
+  void _MemcachedSet(const std::map<std::string, std::string> &);
+  void _MongoFind(const std::vector<std::string> &,
+                  std::map<std::string, std::string> *);
+  bool _MongoInsert(const std::vector<Url> &);
+  // The filter of _MongoFind, also used by QueryShapes, to be destroyed by
+  // the caller
+  static bson_t *_NewCodesQuery(const std::vector<std::string> &);
+};
 
 UrlShortenHandler::UrlShortenHandler(
     memcached_pool_st *memcached_client_pool,
     mongoc_client_pool_t *mongodb_client_pool,
-    std::mutex *thread_lock) {
+    const std::string &secret) : _coder(secret) {
   _memcached_client_pool = memcached_client_pool;
   _mongodb_client_pool = mongodb_client_pool;
-  _thread_lock = thread_lock;
-  _distribution = std::uniform_int_distribution<int>(0, 61);
 }
 
-std::string UrlShortenHandler::_GenRandomStr(int length) {
-  const char char_map[] = "abcdefghijklmnopqrstuvwxyzABCDEF"
-                    "GHIJKLMNOPQRSTUVWXYZ0123456789";
-  std::string return_str;
-  _thread_lock->lock();
-  for (int i = 0; i < length; ++i) {
-    return_str.append(1, char_map[_distribution(_generator)]);
-  }
-  _thread_lock->unlock();
-  return return_str;
-}
 void UrlShortenHandler::ComposeUrls(
     std::vector<Url> &_return,
     int64_t req_id,
@@ -81,84 +88,140 @@ void UrlShortenHandler::ComposeUrls(
       { opentracing::ChildOf(parent_span->get()) });
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
-  std::vector<Url> target_urls;
-  std::future<void> mongo_future;
-
-  if (!urls.empty()) {
-    for (auto &url : urls) {
-      Url new_target_url;
-      new_target_url.expanded_url = url;
-      new_target_url.shortened_url = HOSTNAME +
-          _GenRandomStr(10);
-      target_urls.emplace_back(new_target_url);
-    }
-
-    mongo_future = std::async(
-        std::launch::async, [&](){
-          mongoc_client_t *mongodb_client = mongoc_client_pool_pop(
-              _mongodb_client_pool);
-          if (!mongodb_client) {
-            ServiceException se;
-            se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-            se.message = "Failed to pop a client from MongoDB pool";
-            throw se;
-          }
-          auto collection = mongoc_client_get_collection(
-              mongodb_client, "url-shorten", "url-shorten");
-          if (!collection) {
-            ServiceException se;
-            se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-            se.message = "Failed to create collection user from DB user";
-            mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-            throw se;
-          }
+  // Distinct urls and the attempt whose code each is tried with
+  std::map<std::string, int> attempts;
+  for (auto &url : urls) {
+    attempts.emplace(url, 0);
+  }
+  std::vector<std::string> pending;
+  for (auto &item : attempts) {
+    pending.emplace_back(item.first);
+  }
+  auto next_attempt = [&](const std::string &url,
+                          std::vector<std::string> *next_pending) {
+    if (++attempts[url] >= SHORT_CODE_MAX_ATTEMPTS) {
+      ServiceException se;
+      se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+      se.message = "No free short code for url " + url;
+      throw se;
+    }
+    next_pending->emplace_back(url);
+  };
 
-          auto mongo_span = opentracing::Tracer::Global()->StartSpan(
-              "url_mongo_insert_client",
-              { opentracing::ChildOf(&span->context()) });
-
-          mongoc_bulk_operation_t *bulk;
-          bson_t *doc;
-          bson_error_t error;
-          bson_t reply;
-          bool ret;
-          bulk = mongoc_collection_create_bulk_operation_with_opts(
-              collection, nullptr);
-          for (auto &url : target_urls) {
-            doc = bson_new();
-            BSON_APPEND_UTF8(doc, "shortened_url", url.shortened_url.c_str());
-            BSON_APPEND_UTF8(doc, "expanded_url", url.expanded_url.c_str());
-            mongoc_bulk_operation_insert (bulk, doc);
-            bson_destroy(doc);
-          }
-          ret = mongoc_bulk_operation_execute (bulk, &reply, &error);
-          if (!ret) {
-            LOG(error) << "MongoDB error: "<< error.message;
+  // url -> code, once the code is stored for the url
+  std::map<std::string, std::string> codes_of_urls;
+  // code -> url, for the codes memcached did not have
+  std::map<std::string, std::string> to_cache;
+
+  while (!pending.empty()) {
+    std::vector<std::string> next_pending;
+    std::map<std::string, std::string> urls_of_codes;
+    std::vector<std::string> codes;
+    for (auto &url : pending) {
+      std::string code = _coder.Code(url, attempts[url]);
+      if (urls_of_codes.emplace(code, url).second) {
+        codes.emplace_back(code);
+      } else {
+        next_attempt(url, &next_pending);
+      }
+    }
+
+    std::map<std::string, std::string> stored;
+    auto get_span = opentracing::Tracer::Global()->StartSpan(
+        "url_memcached_get_client",
+        { opentracing::ChildOf(&span->context()) });
+    _MemcachedGet(codes, &stored);
+    get_span->Finish();
+
+    std::vector<std::string> not_cached;
+    for (auto &code : codes) {
+      if (stored.find(code) == stored.end()) {
+        not_cached.emplace_back(code);
+      }
+    }
+    if (!not_cached.empty()) {
+      std::map<std::string, std::string> found;
+      auto find_span = opentracing::Tracer::Global()->StartSpan(
+          "url_mongo_find_client",
+          { opentracing::ChildOf(&span->context()) });
+      _MongoFind(not_cached, &found);
+      find_span->Finish();
+      for (auto &item : found) {
+        stored.emplace(item.first, item.second);
+        to_cache.emplace(item.first, item.second);
+      }
+    }
+
+    std::vector<Url> new_urls;
+    for (auto &code : codes) {
+      auto &url = urls_of_codes[code];
+      auto stored_it = stored.find(code);
+      if (stored_it == stored.end()) {
+        Url new_url;
+        new_url.shortened_url = HOSTNAME + code;
+        new_url.expanded_url = url;
+        new_urls.emplace_back(new_url);
+      } else if (stored_it->second == url) {
+        codes_of_urls[url] = code;
+      } else {
+        next_attempt(url, &next_pending);
+      }
+    }
+
+    if (!new_urls.empty()) {
+      auto mongo_span = opentracing::Tracer::Global()->StartSpan(
+          "url_mongo_insert_client",
+          { opentracing::ChildOf(&span->context()) });
+      bool inserted = _MongoInsert(new_urls);
+      mongo_span->Finish();
+
+      // A failed insert may have raced with another request taking the
+      // same code, for the same url or a colliding one
+      std::map<std::string, std::string> found;
+      if (!inserted) {
+        std::vector<std::string> new_codes;
+        for (auto &new_url : new_urls) {
+          new_codes.emplace_back(
+              new_url.shortened_url.substr(std::strlen(HOSTNAME)));
+        }
+        _MongoFind(new_codes, &found);
+      }
+      for (auto &new_url : new_urls) {
+        std::string code = new_url.shortened_url.substr(std::strlen(HOSTNAME));
+        if (!inserted) {
+          auto found_it = found.find(code);
+          if (found_it == found.end()) {
             ServiceException se;
             se.errorCode = ErrorCode::SE_MONGODB_ERROR;
             se.message = "Failed to insert urls to MongoDB";
-            bson_destroy (&reply);
-            mongoc_bulk_operation_destroy(bulk);
-            mongoc_collection_destroy(collection);
-            mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
             throw se;
           }
-          bson_destroy (&reply);
-          mongoc_bulk_operation_destroy(bulk);
-          mongoc_collection_destroy(collection);
-          mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-          mongo_span->Finish();
-        });
+          if (found_it->second != new_url.expanded_url) {
+            next_attempt(new_url.expanded_url, &next_pending);
+            continue;
+          }
+        }
+        codes_of_urls[new_url.expanded_url] = code;
+        to_cache.emplace(code, new_url.expanded_url);
+      }
+    }
+    pending.swap(next_pending);
+  }
 
+  if (!to_cache.empty()) {
+    auto set_span = opentracing::Tracer::Global()->StartSpan(
+        "url_memcached_set_client",
+        { opentracing::ChildOf(&span->context()) });
+    _MemcachedSet(to_cache);
+    set_span->Finish();
   }
 
-  if (!urls.empty()) {
-    try {
-      mongo_future.get();
-    } catch (...) {
-      LOG(error) << "Failed to upload shortened urls from MongoDB";
-      throw;
-    }
+  std::vector<Url> target_urls;
+  for (auto &url : urls) {
+    Url target_url;
+    target_url.expanded_url = url;
+    target_url.shortened_url = HOSTNAME + codes_of_urls[url];
+    target_urls.emplace_back(target_url);
   }
 
   _return = target_urls;
@@ -169,10 +232,292 @@ void UrlShortenHandler::ComposeUrls(
 void UrlShortenHandler::GetExtendedUrls(
     std::vector<std::string> &_return,
     int64_t req_id,
-    const std::vector<std::string> &shortened_id,
+    const std::vector<std::string> &shortened_urls,
     const std::map<std::string, std::string> &carrier) {
 
-  // TODO: Implement GetExtendedUrls
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "get_extended_urls_server",
+      { opentracing::ChildOf(parent_span->get()) });
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  // Both full shortened urls and bare codes are accepted
+  std::vector<std::string> codes;
+  for (auto &shortened_url : shortened_urls) {
+    if (shortened_url.compare(0, std::strlen(HOSTNAME), HOSTNAME) == 0) {
+      codes.emplace_back(shortened_url.substr(std::strlen(HOSTNAME)));
+    } else {
+      codes.emplace_back(shortened_url);
+    }
+  }
+  std::vector<std::string> distinct_codes(codes);
+  std::sort(distinct_codes.begin(), distinct_codes.end());
+  distinct_codes.erase(
+      std::unique(distinct_codes.begin(), distinct_codes.end()),
+      distinct_codes.end());
+
+  std::map<std::string, std::string> expanded_urls;
+  auto get_span = opentracing::Tracer::Global()->StartSpan(
+      "url_memcached_get_client",
+      { opentracing::ChildOf(&span->context()) });
+  _MemcachedGet(distinct_codes, &expanded_urls);
+  get_span->Finish();
+
+  std::vector<std::string> not_cached;
+  for (auto &code : distinct_codes) {
+    if (expanded_urls.find(code) == expanded_urls.end()) {
+      not_cached.emplace_back(code);
+    }
+  }
+  if (!not_cached.empty()) {
+    std::map<std::string, std::string> found;
+    auto find_span = opentracing::Tracer::Global()->StartSpan(
+        "url_mongo_find_client",
+        { opentracing::ChildOf(&span->context()) });
+    _MongoFind(not_cached, &found);
+    find_span->Finish();
+    if (!found.empty()) {
+      auto set_span = opentracing::Tracer::Global()->StartSpan(
+          "url_memcached_set_client",
+          { opentracing::ChildOf(&span->context()) });
+      _MemcachedSet(found);
+      set_span->Finish();
+    }
+    expanded_urls.insert(found.begin(), found.end());
+  }
+
+  std::vector<std::string> extended_urls;
+  for (size_t i = 0; i < codes.size(); i++) {
+    auto it = expanded_urls.find(codes[i]);
+    if (it == expanded_urls.end()) {
+      ServiceException se;
+      se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+      se.message = "Cannot find shortened url " + shortened_urls[i];
+      throw se;
+    }
+    extended_urls.emplace_back(it->second);
+  }
+
+  _return = extended_urls;
+  span->Finish();
+}
+
+void UrlShortenHandler::_MemcachedGet(
+    const std::vector<std::string> &codes,
+    std::map<std::string, std::string> *expanded_urls) {
+  if (codes.empty()) {
+    return;
+  }
+  memcached_return_t rc;
+  auto client = memcached_pool_pop(_memcached_client_pool, true, &rc);
+  if (!client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MEMCACHED_ERROR;
+    se.message = "Failed to pop a client from memcached pool";
+    throw se;
+  }
+
+  std::vector<const char *> keys;
+  std::vector<size_t> key_sizes;
+  for (auto &code : codes) {
+    keys.emplace_back(code.c_str());
+    key_sizes.emplace_back(code.length());
+  }
+  rc = memcached_mget(client, keys.data(), key_sizes.data(), keys.size());
+  if (rc != MEMCACHED_SUCCESS) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MEMCACHED_ERROR;
+    se.message = memcached_strerror(client, rc);
+    memcached_pool_push(_memcached_client_pool, client);
+    throw se;
+  }
+
+  char return_key[MEMCACHED_MAX_KEY];
+  size_t return_key_length;
+  char *return_value;
+  size_t return_value_length;
+  uint32_t flags;
+  while (true) {
+    return_value = memcached_fetch(client, return_key, &return_key_length,
+                                   &return_value_length, &flags, &rc);
+    if (return_value == nullptr) {
+      break;
+    }
+    if (rc != MEMCACHED_SUCCESS) {
+      free(return_value);
+      memcached_quit(client);
+      memcached_pool_push(_memcached_client_pool, client);
+      ServiceException se;
+      se.errorCode = ErrorCode::SE_MEMCACHED_ERROR;
+      se.message = "Cannot get urls from memcached";
+      throw se;
+    }
+    expanded_urls->emplace(
+        std::string(return_key, return_key_length),
+        std::string(return_value, return_value_length));
+    free(return_value);
+  }
+  memcached_quit(client);
+  memcached_pool_push(_memcached_client_pool, client);
+}
+
+void UrlShortenHandler::_MemcachedSet(
+    const std::map<std::string, std::string> &expanded_urls) {
+  memcached_return_t rc;
+  auto client = memcached_pool_pop(_memcached_client_pool, true, &rc);
+  if (!client) {
+    LOG(warning) << "Failed to pop a client from memcached pool";
+    return;
+  }
+  for (auto &item : expanded_urls) {
+    rc = memcached_set(client, item.first.c_str(), item.first.length(),
+                       item.second.c_str(), item.second.length(),
+                       static_cast<time_t>(0), static_cast<uint32_t>(0));
+    if (rc != MEMCACHED_SUCCESS) {
+      LOG(warning) << "Failed to set url to Memcached: "
+                   << memcached_strerror(client, rc);
+    }
+  }
+  memcached_pool_push(_memcached_client_pool, client);
+}
+
+void UrlShortenHandler::_MongoFind(
+    const std::vector<std::string> &codes,
+    std::map<std::string, std::string> *expanded_urls) {
+  mongoc_client_t *mongodb_client = mongoc_client_pool_pop(
+      _mongodb_client_pool);
+  if (!mongodb_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    throw se;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, "url-shorten", "url-shorten");
+  if (!collection) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to create collection url-shorten from MongoDB";
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
+
+  bson_t *query = _NewCodesQuery(codes);
+  bson_t *opts = BCON_NEW("projection", "{", "_id", BCON_INT32(0), "}");
+
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+  const bson_t *doc;
+  while (mongoc_cursor_next(cursor, &doc)) {
+    bson_iter_t iter;
+    std::string shortened_url;
+    std::string expanded_url;
+    if (bson_iter_init_find(&iter, doc, "shortened_url") &&
+        BSON_ITER_HOLDS_UTF8(&iter)) {
+      shortened_url = bson_iter_utf8(&iter, nullptr);
+    }
+    if (bson_iter_init_find(&iter, doc, "expanded_url") &&
+        BSON_ITER_HOLDS_UTF8(&iter)) {
+      expanded_url = bson_iter_utf8(&iter, nullptr);
+    }
+    if (shortened_url.length() <= std::strlen(HOSTNAME)) {
+      continue;
+    }
+    expanded_urls->emplace(shortened_url.substr(std::strlen(HOSTNAME)),
+                           expanded_url);
+  }
+  bson_error_t error;
+  bool failed = mongoc_cursor_error(cursor, &error);
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_cursor_destroy(cursor);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+  if (failed) {
+    LOG(error) << "MongoDB error: " << error.message;
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to find urls in MongoDB";
+    throw se;
+  }
+}
+
+bool UrlShortenHandler::_MongoInsert(const std::vector<Url> &new_urls) {
+  mongoc_client_t *mongodb_client = mongoc_client_pool_pop(
+      _mongodb_client_pool);
+  if (!mongodb_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    throw se;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, "url-shorten", "url-shorten");
+  if (!collection) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to create collection url-shorten from MongoDB";
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
+
+  // Unordered, so one duplicate code does not stop the other inserts
+  bson_t *opts = BCON_NEW("ordered", BCON_BOOL(false));
+  mongoc_bulk_operation_t *bulk =
+      mongoc_collection_create_bulk_operation_with_opts(collection, opts);
+  for (auto &url : new_urls) {
+    bson_t *doc = bson_new();
+    BSON_APPEND_UTF8(doc, "shortened_url", url.shortened_url.c_str());
+    BSON_APPEND_UTF8(doc, "expanded_url", url.expanded_url.c_str());
+    mongoc_bulk_operation_insert(bulk, doc);
+    bson_destroy(doc);
+  }
+  bson_error_t error;
+  bson_t reply;
+  bool ret = mongoc_bulk_operation_execute(bulk, &reply, &error);
+  if (!ret) {
+    LOG(warning) << "MongoDB error: " << error.message;
+  }
+  bson_destroy(&reply);
+  bson_destroy(opts);
+  mongoc_bulk_operation_destroy(bulk);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+  return ret;
+}
+
+std::vector<MongoIndexSpec> UrlShortenHandler::IndexSpecs() {
+  return {
+      {"url-shorten", "url-shorten", {{"shortened_url", 1}}, true, ""},
+  };
+}
+
+bson_t *UrlShortenHandler::_NewCodesQuery(
+    const std::vector<std::string> &codes) {
+  bson_t *query = bson_new();
+  bson_t query_child;
+  bson_t query_url_list;
+  const char *key;
+  char buf[16];
+  BSON_APPEND_DOCUMENT_BEGIN(query, "shortened_url", &query_child);
+  BSON_APPEND_ARRAY_BEGIN(&query_child, "$in", &query_url_list);
+  for (uint32_t idx = 0; idx < codes.size(); idx++) {
+    bson_uint32_to_string(idx, &key, buf, sizeof buf);
+    BSON_APPEND_UTF8(&query_url_list, key, (HOSTNAME + codes[idx]).c_str());
+  }
+  bson_append_array_end(&query_child, &query_url_list);
+  bson_append_document_end(query, &query_child);
+  return query;
+}
+
+std::vector<MongoQueryShape> UrlShortenHandler::QueryShapes() {
+  return {
+      MongoQueryShapeOf("url-shorten", "url-shorten", _NewCodesQuery({"a"})),
+  };
 }
 
 }
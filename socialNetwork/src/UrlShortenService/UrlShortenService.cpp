@@ -38,6 +38,8 @@ int main(int argc, char* argv[]) {
     exit(EXIT_FAILURE);
   }
   int port = config_json["url-shorten-service"]["port"];
+  std::string secret = config_json["url-shorten-service"].value(
+      "short_code_secret", config_json["secret"].get<std::string>());
 
   int mongodb_conns = config_json["url-shorten-mongodb"]["connections"];
   int mongodb_timeout = config_json["url-shorten-mongodb"]["timeout_ms"];
@@ -53,27 +55,18 @@ int main(int argc, char* argv[]) {
     return EXIT_FAILURE;
   }
 
-  mongoc_client_t* mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
-  if (!mongodb_client) {
-    LOG(fatal) << "Failed to pop mongoc client";
+  if (!SetUpMongoIndexes(mongodb_client_pool, UrlShortenHandler::IndexSpecs(),
+                         UrlShortenHandler::QueryShapes(),
+                         config_json.value("mongodb_index_check", false))) {
+    LOG(fatal) << "Failed to set up the MongoDB indexes of UrlShortenHandler";
     return EXIT_FAILURE;
   }
-  bool r = false;
-  while (!r) {
-    r = CreateIndex(mongodb_client, "url-shorten", "shortened_url", true);
-    if (!r) {
-      LOG(error) << "Failed to create mongodb index, try again";
-      sleep(1);
-    }
-  }
-  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
 
-  std::mutex thread_lock;
   std::shared_ptr<TServerSocket> server_socket = get_server_socket(config_json, "0.0.0.0", port);
   TThreadedServer server(
       std::make_shared<UrlShortenServiceProcessor>(
           std::make_shared<UrlShortenHandler>(
-              memcached_client_pool, mongodb_client_pool, &thread_lock)),
+              memcached_client_pool, mongodb_client_pool, secret)),
       server_socket,
       std::make_shared<TFramedTransportFactory>(),
       std::make_shared<TBinaryProtocolFactory>());
@@ -5,8 +5,6 @@
 #include <thrift/transport/TServerSocket.h>
 
 #include "../utils.h"
-#include "../utils_memcached.h"
-#include "../utils_mongodb.h"
 #include "../utils_thrift.h"
 #include "UserMentionHandler.h"
 #include "nlohmann/json.hpp"
@@ -17,18 +15,7 @@ using apache::thrift::transport::TFramedTransportFactory;
 using apache::thrift::transport::TServerSocket;
 using namespace social_network;
 
-static memcached_pool_st* memcached_client_pool;
-static mongoc_client_pool_t* mongodb_client_pool;
-
-void sigintHandler(int sig) {
-  if (memcached_client_pool != nullptr) {
-    memcached_pool_destroy(memcached_client_pool);
-  }
-  if (mongodb_client_pool != nullptr) {
-    mongoc_client_pool_destroy(mongodb_client_pool);
-  }
-  exit(EXIT_SUCCESS);
-}
+void sigintHandler(int sig) { exit(EXIT_SUCCESS); }
 
 int main(int argc, char* argv[]) {
   signal(SIGINT, sigintHandler);
@@ -42,25 +29,21 @@ int main(int argc, char* argv[]) {
 
   int port = config_json["user-mention-service"]["port"];
 
-  int mongodb_conns = config_json["user-mongodb"]["connections"];
-  int mongodb_timeout = config_json["user-mongodb"]["timeout_ms"];
+  std::string user_addr = config_json["user-service"]["addr"];
+  int user_port = config_json["user-service"]["port"];
+  int user_conns = config_json["user-service"]["connections"];
+  int user_timeout = config_json["user-service"]["timeout_ms"];
+  int user_keepalive = config_json["user-service"]["keepalive_ms"];
 
-  int memcached_conns = config_json["user-memcached"]["connections"];
-  int memcached_timeout = config_json["user-memcached"]["timeout_ms"];
-
-  memcached_client_pool =
-      init_memcached_client_pool(config_json, "user", 32, memcached_conns);
-  mongodb_client_pool =
-      init_mongodb_client_pool(config_json, "user", mongodb_conns);
-  if (memcached_client_pool == nullptr || mongodb_client_pool == nullptr) {
-    return EXIT_FAILURE;
-  }
+  ClientPool<ThriftClient<UserServiceClient>> user_client_pool(
+      "user-mention", user_addr, user_port, 0, user_conns, user_timeout,
+      user_keepalive, config_json);
 
   std::shared_ptr<TServerSocket> server_socket = get_server_socket(config_json, "0.0.0.0", port);
 
   TThreadedServer server(std::make_shared<UserMentionServiceProcessor>(
                              std::make_shared<UserMentionHandler>(
-                                 memcached_client_pool, mongodb_client_pool)),
+                                 &user_client_pool)),
                          server_socket,
                          std::make_shared<TFramedTransportFactory>(),
                          std::make_shared<TBinaryProtocolFactory>());
@@ -0,0 +1,245 @@
+// Login throughput of user-service, and the cost of its parts.
+//
+// In this process:
+//   hash     SHA-256 of password + salt, PicoSHA2 (the former scalar code)
+//            against OpenSSL
+//   record   decoding a cached login record, JSON (the former format)
+//            against the binary LoginRecord
+//   sign     issuing a token with JwtCodec
+//   verify   JwtCodec::Verify, and a VerifiedTokenCache hit
+// Against the user-service in --config, from --threads connections:
+//   login    Login of username_<i> with password_<i>, the users
+//            scripts/init_social_graph.py registers
+//   token    VerifyToken on the tokens login returned
+// Rates are operations per second.
+
+#include <algorithm>
+#include <atomic>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../gen-cpp/UserService.h"
+#include "../../third_party/PicoSHA2/picosha2.h"
+#include "../ThriftClient.h"
+#include "../logger.h"
+#include "../utils.h"
+#include "LoginRecord.h"
+#include "LoginToken.h"
+
+using namespace social_network;
+
+template <typename Run>
+static double OpsPerSecond(size_t num_ops, const Run &run) {
+  auto start = std::chrono::steady_clock::now();
+  run();
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+  return (double)num_ops * 1e9 / (double)elapsed;
+}
+
+// Runs call(client, i) for i in [0, num_ops) spread over num_threads
+// connections, false if any call failed
+template <typename Call>
+static bool RunOnThreads(const std::string &addr, int port,
+                         const json &config_json, int num_threads,
+                         size_t num_ops, const Call &call) {
+  std::atomic<bool> ok{true};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; t++) {
+    threads.emplace_back([&, t]() {
+      ThriftClient<UserServiceClient> client(addr, port, 0, config_json);
+      try {
+        client.Connect();
+        for (size_t i = t; i < num_ops; i += num_threads) {
+          call(client.GetClient(), i);
+        }
+      } catch (const ServiceException &e) {
+        LOG(error) << "user-service error: " << e.message;
+        ok = false;
+      } catch (const std::exception &e) {
+        LOG(error) << "Failed to call user-service at " << addr << ":"
+                   << port << ": " << e.what();
+        ok = false;
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  return ok;
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "config",
+      po::value<std::string>()->default_value("config/service-config.json"),
+      "Service config holding the user-service address")(
+      "iterations", po::value<int>()->default_value(1000000),
+      "Operations of each in-process run")(
+      "users", po::value<int>()->default_value(962),
+      "Logins are of username_0 .. username_<users - 1>")(
+      "logins", po::value<int>()->default_value(10000),
+      "Number of Login calls")(
+      "verifies", po::value<int>()->default_value(100000),
+      "Number of VerifyToken calls")(
+      "threads", po::value<int>()->default_value(8),
+      "Concurrent connections to user-service")(
+      "skip-rpc", po::bool_switch()->default_value(false),
+      "Only time the in-process runs");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  int iterations = vm["iterations"].as<int>();
+  int num_users = vm["users"].as<int>();
+  int num_logins = vm["logins"].as<int>();
+  int num_verifies = vm["verifies"].as<int>();
+  int num_threads = vm["threads"].as<int>();
+  if (iterations < 1 || num_users < 1 || num_logins < 1 ||
+      num_verifies < 1 || num_threads < 1) {
+    LOG(error) << "--iterations, --users, --logins, --verifies and "
+                  "--threads must be positive";
+    return EXIT_FAILURE;
+  }
+
+  // Sinks the results, so that the runs are not optimized away
+  size_t checksum = 0;
+  std::string salt = "0123456789ABCDEFGHIJKLMNOPQRSTUV";
+  double picosha2_rate = OpsPerSecond(iterations, [&]() {
+    for (int i = 0; i < iterations; i++) {
+      checksum += picosha2::hash256_hex_string("password_" +
+                                               std::to_string(i) + salt)[0];
+    }
+  });
+  double openssl_rate = OpsPerSecond(iterations, [&]() {
+    for (int i = 0; i < iterations; i++) {
+      checksum += Sha256("password_" + std::to_string(i) + salt)[0];
+    }
+  });
+  LOG(info) << "hash: PicoSHA2 " << picosha2_rate << " /s, OpenSSL "
+            << openssl_rate << " /s";
+
+  LoginRecord record;
+  record.user_id = 42;
+  record.salt = salt;
+  record.password_hash = Sha256("password_42" + salt);
+  std::string binary_value = EncodeLoginRecord(record);
+  nlohmann::json login_json;
+  login_json["password"] = Sha256Hex("password_42" + salt);
+  login_json["salt"] = salt;
+  login_json["user_id"] = 42;
+  std::string json_value = login_json.dump();
+  double json_rate = OpsPerSecond(iterations, [&]() {
+    for (int i = 0; i < iterations; i++) {
+      auto decoded = nlohmann::json::parse(json_value);
+      checksum += decoded["user_id"].get<int64_t>();
+    }
+  });
+  double binary_rate = OpsPerSecond(iterations, [&]() {
+    for (int i = 0; i < iterations; i++) {
+      LoginRecord decoded;
+      DecodeLoginRecord(binary_value.data(), binary_value.size(), &decoded);
+      checksum += decoded.user_id;
+    }
+  });
+  LOG(info) << "record: JSON " << json_rate << " /s, binary " << binary_rate
+            << " /s (" << json_value.size() << " and " << binary_value.size()
+            << " bytes)";
+
+  JwtCodec codec("secret");
+  std::string token = codec.Sign(42, "username_42", 0, LOGIN_TOKEN_TTL_S);
+  double sign_rate = OpsPerSecond(iterations, [&]() {
+    for (int i = 0; i < iterations; i++) {
+      checksum += codec.Sign(i, "username_42", 0, LOGIN_TOKEN_TTL_S).size();
+    }
+  });
+  double verify_rate = OpsPerSecond(iterations, [&]() {
+    for (int i = 0; i < iterations; i++) {
+      TokenClaims claims;
+      codec.Verify(token, &claims);
+      checksum += claims.user_id;
+    }
+  });
+  VerifiedTokenCache token_cache(1);
+  TokenClaims token_claims;
+  codec.Verify(token, &token_claims);
+  token_cache.Put(token, token_claims);
+  double cache_rate = OpsPerSecond(iterations, [&]() {
+    for (int i = 0; i < iterations; i++) {
+      TokenClaims claims;
+      token_cache.Get(token, 0, &claims);
+      checksum += claims.user_id;
+    }
+  });
+  LOG(info) << "sign: " << sign_rate << " /s, verify: " << verify_rate
+            << " /s, cached verify: " << cache_rate << " /s (checksum "
+            << checksum << ")";
+  if (vm["skip-rpc"].as<bool>()) {
+    return 0;
+  }
+
+  json config_json;
+  if (load_config_file(vm["config"].as<std::string>(), &config_json) != 0) {
+    return EXIT_FAILURE;
+  }
+  std::string addr = config_json["user-service"]["addr"];
+  int port = config_json["user-service"]["port"];
+  std::map<std::string, std::string> carrier;
+
+  std::vector<std::string> tokens(num_logins);
+  bool ok = true;
+  double login_rate = OpsPerSecond(num_logins, [&]() {
+    ok = RunOnThreads(
+        addr, port, config_json, num_threads, num_logins,
+        [&](UserServiceClient *client, size_t i) {
+          std::string id = std::to_string(i % num_users);
+          client->Login(tokens[i], i, "username_" + id, "password_" + id,
+                        carrier);
+        });
+  });
+  if (!ok) {
+    return EXIT_FAILURE;
+  }
+  std::vector<int64_t> user_ids(num_verifies);
+  double token_rate = OpsPerSecond(num_verifies, [&]() {
+    ok = RunOnThreads(addr, port, config_json, num_threads, num_verifies,
+                      [&](UserServiceClient *client, size_t i) {
+                        user_ids[i] = client->VerifyToken(
+                            i, tokens[i % num_logins], carrier);
+                      });
+  });
+  if (!ok) {
+    return EXIT_FAILURE;
+  }
+  LOG(info) << "login: " << login_rate << " /s, token: " << token_rate
+            << " /s";
+
+  JwtCodec service_codec(config_json["secret"].get<std::string>());
+  for (int i = 0; i < num_verifies; i++) {
+    TokenClaims claims;
+    if (!service_codec.Verify(tokens[i % num_logins], &claims) ||
+        user_ids[i] != claims.user_id) {
+      LOG(error) << "VerifyToken of login " << i % num_logins
+                 << " returned user_id " << user_ids[i];
+      return EXIT_FAILURE;
+    }
+  }
+  return 0;
+}
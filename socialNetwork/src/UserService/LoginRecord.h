@@ -0,0 +1,105 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_LOGINRECORD_H
+#define SOCIAL_NETWORK_MICROSERVICES_LOGINRECORD_H
+
+#include <cstdint>
+#include <string>
+
+// Bumped whenever the layout below changes, so that a record written by
+// another version reads as a cache miss
+#define LOGIN_RECORD_VERSION 1
+#define LOGIN_RECORD_HASH_LENGTH 32
+
+namespace social_network {
+
+// What Login needs of a user, cached in memcached under "<username>:login":
+//   byte 0      LOGIN_RECORD_VERSION
+//   bytes 1-8   user_id, little-endian
+//   byte 9      salt length n
+//   n bytes     salt
+//   32 bytes    SHA-256 of password + salt, raw (hex in MongoDB)
+struct LoginRecord {
+  int64_t user_id;
+  std::string salt;
+  std::string password_hash;
+};
+
+// Returns an empty string for a salt too long to encode, which is left
+// uncached
+inline std::string EncodeLoginRecord(const LoginRecord &record) {
+  std::string value;
+  if (record.salt.size() > UINT8_MAX ||
+      record.password_hash.size() != LOGIN_RECORD_HASH_LENGTH) {
+    return value;
+  }
+  value.reserve(10 + record.salt.size() + record.password_hash.size());
+  value.push_back((char)LOGIN_RECORD_VERSION);
+  uint64_t user_id = (uint64_t)record.user_id;
+  for (int i = 0; i < 8; i++) {
+    value.push_back((char)(user_id >> (8 * i)));
+  }
+  value.push_back((char)record.salt.size());
+  value.append(record.salt);
+  value.append(record.password_hash);
+  return value;
+}
+
+// Returns false on a value that is not a record of this version, e.g. the
+// JSON written by earlier versions
+inline bool DecodeLoginRecord(const char *value, size_t size,
+                              LoginRecord *record) {
+  if (size < 10 || (uint8_t)value[0] != LOGIN_RECORD_VERSION) {
+    return false;
+  }
+  size_t salt_size = (uint8_t)value[9];
+  if (size != 10 + salt_size + LOGIN_RECORD_HASH_LENGTH) {
+    return false;
+  }
+  uint64_t user_id = 0;
+  for (int i = 0; i < 8; i++) {
+    user_id |= (uint64_t)(uint8_t)value[1 + i] << (8 * i);
+  }
+  record->user_id = (int64_t)user_id;
+  record->salt.assign(value + 10, salt_size);
+  record->password_hash.assign(value + 10 + salt_size,
+                               LOGIN_RECORD_HASH_LENGTH);
+  return true;
+}
+
+// Hex SHA-256 as stored in MongoDB to the raw bytes of a record, false if
+// hex is not one
+inline bool HexToHash(const std::string &hex, std::string *hash) {
+  if (hex.size() != 2 * LOGIN_RECORD_HASH_LENGTH) {
+    return false;
+  }
+  auto nibble = [](char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+  };
+  hash->resize(LOGIN_RECORD_HASH_LENGTH);
+  for (size_t i = 0; i < LOGIN_RECORD_HASH_LENGTH; i++) {
+    int high = nibble(hex[2 * i]);
+    int low = nibble(hex[2 * i + 1]);
+    if (high < 0 || low < 0) {
+      return false;
+    }
+    (*hash)[i] = (char)(high << 4 | low);
+  }
+  return true;
+}
+
+// Lowercase hex, the format of the "password" field in MongoDB
+inline std::string HashToHex(const std::string &hash) {
+  static const char digits[] = "0123456789abcdef";
+  std::string hex(2 * hash.size(), '0');
+  for (size_t i = 0; i < hash.size(); i++) {
+    hex[2 * i] = digits[(uint8_t)hash[i] >> 4];
+    hex[2 * i + 1] = digits[(uint8_t)hash[i] & 0xf];
+  }
+  return hex;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_LOGINRECORD_H
@@ -0,0 +1,287 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_LOGINTOKEN_H
+#define SOCIAL_NETWORK_MICROSERVICES_LOGINTOKEN_H
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "../logger.h"
+#include "LoginRecord.h"
+
+#define LOGIN_TOKEN_TTL_S 3600
+#define TOKEN_CACHE_LOG_INTERVAL 100000
+
+namespace social_network {
+
+// SHA-256 through OpenSSL's EVP interface, which picks the SHA extensions or
+// AVX2 code paths of the CPU it runs on
+inline std::string Sha256(const std::string &data) {
+  unsigned char digest[EVP_MAX_MD_SIZE];
+  unsigned int digest_size = 0;
+  EVP_Digest(data.data(), data.size(), digest, &digest_size, EVP_sha256(),
+             nullptr);
+  return std::string((const char *)digest, digest_size);
+}
+
+inline std::string Sha256Hex(const std::string &data) {
+  return HashToHex(Sha256(data));
+}
+
+inline std::string Base64UrlEncode(const std::string &data) {
+  static const char alphabet[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+  std::string encoded;
+  encoded.reserve((data.size() + 2) / 3 * 4);
+  size_t i = 0;
+  for (; i + 2 < data.size(); i += 3) {
+    uint32_t n = (uint8_t)data[i] << 16 | (uint8_t)data[i + 1] << 8 |
+                 (uint8_t)data[i + 2];
+    encoded.push_back(alphabet[n >> 18]);
+    encoded.push_back(alphabet[(n >> 12) & 0x3f]);
+    encoded.push_back(alphabet[(n >> 6) & 0x3f]);
+    encoded.push_back(alphabet[n & 0x3f]);
+  }
+  if (i + 1 == data.size()) {
+    uint32_t n = (uint8_t)data[i] << 16;
+    encoded.push_back(alphabet[n >> 18]);
+    encoded.push_back(alphabet[(n >> 12) & 0x3f]);
+  } else if (i + 2 == data.size()) {
+    uint32_t n = (uint8_t)data[i] << 16 | (uint8_t)data[i + 1] << 8;
+    encoded.push_back(alphabet[n >> 18]);
+    encoded.push_back(alphabet[(n >> 12) & 0x3f]);
+    encoded.push_back(alphabet[(n >> 6) & 0x3f]);
+  }
+  return encoded;
+}
+
+// Unpadded base64url, as JWTs use it. Returns false on any other input.
+inline bool Base64UrlDecode(const char *data, size_t size,
+                            std::string *decoded) {
+  auto value = [](char c) {
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '-') return 62;
+    if (c == '_') return 63;
+    return -1;
+  };
+  if (size % 4 == 1) {
+    return false;
+  }
+  decoded->clear();
+  decoded->reserve(size / 4 * 3 + 2);
+  uint32_t n = 0;
+  int bits = 0;
+  for (size_t i = 0; i < size; i++) {
+    int v = value(data[i]);
+    if (v < 0) {
+      return false;
+    }
+    n = n << 6 | v;
+    bits += 6;
+    if (bits >= 8) {
+      bits -= 8;
+      decoded->push_back((char)(n >> bits));
+      n &= (1u << bits) - 1;
+    }
+  }
+  return true;
+}
+
+struct TokenClaims {
+  int64_t user_id;
+  std::string username;
+  // Unix seconds after which the token is rejected
+  int64_t expires_at;
+};
+
+// HS256 JWTs with the claims the frontend reads: user_id, username,
+// timestamp and ttl, all strings. Signed and verified with one HMAC-SHA256
+// over the encoded header and payload, instead of through a JSON object model
+// of the whole token.
+class JwtCodec {
+ public:
+  explicit JwtCodec(const std::string &secret);
+
+  std::string Sign(int64_t user_id, const std::string &username,
+                   int64_t timestamp, int64_t ttl) const;
+  // Returns false if token is malformed, not HS256 or not signed with the
+  // secret. Does not look at the expiry.
+  bool Verify(const std::string &token, TokenClaims *claims) const;
+
+ private:
+  std::string _Mac(const char *data, size_t size) const;
+
+  std::string _secret;
+  std::string _encoded_header;
+};
+
+JwtCodec::JwtCodec(const std::string &secret) {
+  _secret = secret;
+  _encoded_header = Base64UrlEncode(R"({"alg":"HS256","typ":"JWT"})");
+}
+
+std::string JwtCodec::_Mac(const char *data, size_t size) const {
+  unsigned char mac[EVP_MAX_MD_SIZE];
+  unsigned int mac_size = 0;
+  HMAC(EVP_sha256(), _secret.data(), (int)_secret.size(),
+       (const unsigned char *)data, size, mac, &mac_size);
+  return std::string((const char *)mac, mac_size);
+}
+
+std::string JwtCodec::Sign(int64_t user_id, const std::string &username,
+                           int64_t timestamp, int64_t ttl) const {
+  nlohmann::json payload = {{"user_id", std::to_string(user_id)},
+                            {"username", username},
+                            {"timestamp", std::to_string(timestamp)},
+                            {"ttl", std::to_string(ttl)}};
+  std::string token = _encoded_header;
+  token.push_back('.');
+  token.append(Base64UrlEncode(payload.dump()));
+  std::string mac = _Mac(token.data(), token.size());
+  token.push_back('.');
+  token.append(Base64UrlEncode(mac));
+  return token;
+}
+
+bool JwtCodec::Verify(const std::string &token, TokenClaims *claims) const {
+  size_t header_end = token.find('.');
+  if (header_end == std::string::npos) {
+    return false;
+  }
+  size_t payload_end = token.find('.', header_end + 1);
+  if (payload_end == std::string::npos ||
+      token.find('.', payload_end + 1) != std::string::npos) {
+    return false;
+  }
+
+  std::string signature;
+  std::string mac = _Mac(token.data(), payload_end);
+  if (!Base64UrlDecode(token.data() + payload_end + 1,
+                       token.size() - payload_end - 1, &signature) ||
+      signature.size() != mac.size() ||
+      CRYPTO_memcmp(signature.data(), mac.data(), mac.size()) != 0) {
+    return false;
+  }
+
+  // The signature is good, so the header and payload are ones this service
+  // issued and only need to be checked for what it issues
+  std::string header;
+  std::string payload;
+  if (!Base64UrlDecode(token.data(), header_end, &header) ||
+      !Base64UrlDecode(token.data() + header_end + 1,
+                       payload_end - header_end - 1, &payload)) {
+    return false;
+  }
+  try {
+    if (nlohmann::json::parse(header).at("alg") != "HS256") {
+      return false;
+    }
+    auto payload_json = nlohmann::json::parse(payload);
+    claims->user_id =
+        std::stoll(payload_json.at("user_id").get<std::string>());
+    claims->username = payload_json.at("username").get<std::string>();
+    claims->expires_at =
+        std::stoll(payload_json.at("timestamp").get<std::string>()) +
+        std::stoll(payload_json.at("ttl").get<std::string>());
+  } catch (const std::exception &) {
+    return false;
+  }
+  return true;
+}
+
+// LRU of tokens VerifyToken has accepted. A session sends the same token
+// with every request, so after the first, its claims come from here without
+// an HMAC or a JSON parse. Only verified tokens are inserted, so a hit needs
+// no signature check, only the expiry one.
+class VerifiedTokenCache {
+ public:
+  explicit VerifiedTokenCache(size_t capacity);
+
+  // Returns false on a miss or an expired token, which is dropped
+  bool Get(const std::string &token, int64_t now, TokenClaims *claims);
+  void Put(const std::string &token, const TokenClaims &claims);
+
+ private:
+  typedef std::list<std::pair<std::string, TokenClaims>> Entries;
+
+  void _CountLookup(bool hit);
+
+  size_t _capacity;
+  std::mutex _mutex;
+  // Most recently used first
+  Entries _entries;
+  std::unordered_map<std::string, Entries::iterator> _index;
+
+  std::atomic<int64_t> _lookups{0};
+  std::atomic<int64_t> _hits{0};
+};
+
+VerifiedTokenCache::VerifiedTokenCache(size_t capacity) {
+  _capacity = capacity;
+}
+
+bool VerifiedTokenCache::Get(const std::string &token, int64_t now,
+                             TokenClaims *claims) {
+  bool hit = false;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _index.find(token);
+    if (it != _index.end()) {
+      if (it->second->second.expires_at < now) {
+        _entries.erase(it->second);
+        _index.erase(it);
+      } else {
+        _entries.splice(_entries.begin(), _entries, it->second);
+        *claims = it->second->second;
+        hit = true;
+      }
+    }
+  }
+  _CountLookup(hit);
+  return hit;
+}
+
+void VerifiedTokenCache::Put(const std::string &token,
+                             const TokenClaims &claims) {
+  if (_capacity == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto it = _index.find(token);
+  if (it != _index.end()) {
+    it->second->second = claims;
+    _entries.splice(_entries.begin(), _entries, it->second);
+    return;
+  }
+  if (_entries.size() >= _capacity) {
+    _index.erase(_entries.back().first);
+    _entries.pop_back();
+  }
+  _entries.emplace_front(token, claims);
+  _index.emplace(token, _entries.begin());
+}
+
+void VerifiedTokenCache::_CountLookup(bool hit) {
+  if (hit) {
+    _hits++;
+  }
+  int64_t lookups = ++_lookups;
+  if (lookups % TOKEN_CACHE_LOG_INTERVAL == 0) {
+    LOG(info) << "Verified token cache: " << lookups << " lookups, "
+              << 100.0 * _hits.load() / lookups << "% hits";
+  }
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_LOGINTOKEN_H
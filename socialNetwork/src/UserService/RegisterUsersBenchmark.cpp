@@ -0,0 +1,260 @@
+// Registration throughput of user-service, one user per RPC against
+// RegisterUsers batches.
+//
+// In this process:
+//   salt     32-character salts, from a std::random_device seeded generator
+//            per salt (the former GenRandomString) against the thread_local
+//            generator
+// Against the user-service in --config, from --threads connections:
+//   single   RegisterUser of <prefix>_single_<i>, --single users
+//   bulk     RegisterUsers of <prefix>_<i>, --users users in --batch sized
+//            calls; every item must succeed
+//   repeat   the first bulk batch again; every item must fail as already
+//            existing
+// Passwords are password_<i>, as scripts/init_social_graph.py uses. Rates
+// are users per second.
+
+#include <algorithm>
+#include <atomic>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../gen-cpp/UserService.h"
+#include "../ThriftClient.h"
+#include "../logger.h"
+#include "../utils.h"
+
+using namespace social_network;
+
+template <typename Run>
+static double OpsPerSecond(size_t num_ops, const Run &run) {
+  auto start = std::chrono::steady_clock::now();
+  run();
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+  return (double)num_ops * 1e9 / (double)elapsed;
+}
+
+static std::string SaltFromRandomDevice() {
+  static const char alphanum[] =
+      "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<int> dist(0, sizeof(alphanum) - 2);
+  std::string s;
+  for (int i = 0; i < 32; ++i) {
+    s += alphanum[dist(gen)];
+  }
+  return s;
+}
+
+static std::string SaltFromThreadLocal() {
+  static const char alphanum[] =
+      "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+  thread_local std::mt19937 gen(std::random_device{}());
+  std::uniform_int_distribution<int> dist(0, sizeof(alphanum) - 2);
+  std::string s;
+  for (int i = 0; i < 32; ++i) {
+    s += alphanum[dist(gen)];
+  }
+  return s;
+}
+
+// Runs call(client, i) for i in [0, num_ops) spread over num_threads
+// connections, false if any call failed
+template <typename Call>
+static bool RunOnThreads(const std::string &addr, int port,
+                         const json &config_json, int num_threads,
+                         size_t num_ops, const Call &call) {
+  std::atomic<bool> ok{true};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; t++) {
+    threads.emplace_back([&, t]() {
+      ThriftClient<UserServiceClient> client(addr, port, 0, config_json);
+      try {
+        client.Connect();
+        for (size_t i = t; i < num_ops && ok; i += num_threads) {
+          if (!call(client.GetClient(), i)) {
+            ok = false;
+          }
+        }
+      } catch (const ServiceException &e) {
+        LOG(error) << "user-service error: " << e.message;
+        ok = false;
+      } catch (const std::exception &e) {
+        LOG(error) << "Failed to call user-service at " << addr << ":"
+                   << port << ": " << e.what();
+        ok = false;
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  return ok;
+}
+
+static std::vector<UserRegistration> Batch(const std::string &prefix,
+                                           size_t begin, size_t end) {
+  std::vector<UserRegistration> users(end - begin);
+  for (size_t i = begin; i < end; i++) {
+    auto &user = users[i - begin];
+    user.user_id = -1;
+    user.first_name = "first_name_" + std::to_string(i);
+    user.last_name = "last_name_" + std::to_string(i);
+    user.username = prefix + "_" + std::to_string(i);
+    user.password = "password_" + std::to_string(i);
+  }
+  return users;
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "config",
+      po::value<std::string>()->default_value("config/service-config.json"),
+      "Service config holding the user-service address")(
+      "prefix", po::value<std::string>()->default_value("bulk_user"),
+      "Usernames are <prefix>_<i>, so must be new to the deployment")(
+      "users", po::value<int>()->default_value(1000000),
+      "Number of users registered with RegisterUsers")(
+      "batch", po::value<int>()->default_value(1000),
+      "Users per RegisterUsers call")(
+      "single", po::value<int>()->default_value(10000),
+      "Number of users registered with RegisterUser")(
+      "salts", po::value<int>()->default_value(100000),
+      "Salts of each in-process run")(
+      "threads", po::value<int>()->default_value(8),
+      "Concurrent connections to user-service")(
+      "skip-rpc", po::bool_switch()->default_value(false),
+      "Only time the in-process runs");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  std::string prefix = vm["prefix"].as<std::string>();
+  int num_users = vm["users"].as<int>();
+  int batch_size = vm["batch"].as<int>();
+  int num_single = vm["single"].as<int>();
+  int num_salts = vm["salts"].as<int>();
+  int num_threads = vm["threads"].as<int>();
+  if (num_users < 1 || batch_size < 1 || num_single < 0 || num_salts < 1 ||
+      num_threads < 1) {
+    LOG(error) << "--users, --batch, --salts and --threads must be positive "
+                  "and --single not negative";
+    return EXIT_FAILURE;
+  }
+
+  // Sinks the results, so that the runs are not optimized away
+  size_t checksum = 0;
+  double random_device_rate = OpsPerSecond(num_salts, [&]() {
+    for (int i = 0; i < num_salts; i++) {
+      checksum += SaltFromRandomDevice()[0];
+    }
+  });
+  double thread_local_rate = OpsPerSecond(num_salts, [&]() {
+    for (int i = 0; i < num_salts; i++) {
+      checksum += SaltFromThreadLocal()[0];
+    }
+  });
+  LOG(info) << "salt: random_device per salt " << random_device_rate
+            << " /s, thread_local " << thread_local_rate << " /s (checksum "
+            << checksum << ")";
+  if (vm["skip-rpc"].as<bool>()) {
+    return 0;
+  }
+
+  json config_json;
+  if (load_config_file(vm["config"].as<std::string>(), &config_json) != 0) {
+    return EXIT_FAILURE;
+  }
+  std::string addr = config_json["user-service"]["addr"];
+  int port = config_json["user-service"]["port"];
+  std::map<std::string, std::string> carrier;
+
+  bool ok = true;
+  double single_rate = 0;
+  if (num_single > 0) {
+    single_rate = OpsPerSecond(num_single, [&]() {
+      ok = RunOnThreads(addr, port, config_json, num_threads, num_single,
+                        [&](UserServiceClient *client, size_t i) {
+                          std::string id = std::to_string(i);
+                          client->RegisterUser(
+                              i, "first_name_" + id, "last_name_" + id,
+                              prefix + "_single_" + id, "password_" + id,
+                              carrier);
+                          return true;
+                        });
+    });
+    if (!ok) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  size_t num_batches = (num_users + batch_size - 1) / batch_size;
+  auto register_batch = [&](UserServiceClient *client, size_t b) {
+    size_t begin = b * batch_size;
+    size_t end = std::min((size_t)num_users, begin + batch_size);
+    std::vector<UserRegistrationResult> results;
+    client->RegisterUsers(results, b, Batch(prefix, begin, end), carrier);
+    for (size_t j = 0; j < results.size(); j++) {
+      if (!results[j].message.empty() || results[j].user_id < 0) {
+        LOG(error) << "RegisterUsers of " << prefix << "_" << begin + j
+                   << ": " << results[j].message;
+        return false;
+      }
+    }
+    return results.size() == end - begin;
+  };
+  double bulk_rate = OpsPerSecond(num_users, [&]() {
+    ok = RunOnThreads(addr, port, config_json, num_threads, num_batches,
+                      register_batch);
+  });
+  if (!ok) {
+    return EXIT_FAILURE;
+  }
+  LOG(info) << "single: " << single_rate << " /s, bulk: " << bulk_rate
+            << " /s (" << num_users << " users, " << batch_size
+            << " per call)";
+
+  // Every user of a batch registered again is reported as existing, and
+  // the call itself still succeeds
+  size_t repeat_size = std::min(num_users, batch_size);
+  std::vector<UserRegistrationResult> results;
+  ok = RunOnThreads(addr, port, config_json, 1, 1,
+                    [&](UserServiceClient *client, size_t i) {
+                      client->RegisterUsers(results, i,
+                                            Batch(prefix, 0, repeat_size),
+                                            carrier);
+                      return true;
+                    });
+  if (!ok) {
+    return EXIT_FAILURE;
+  }
+  for (size_t j = 0; j < results.size(); j++) {
+    if (results[j].user_id >= 0 ||
+        results[j].message.find("already existed") == std::string::npos) {
+      LOG(error) << "Repeated RegisterUsers of " << prefix << "_" << j
+                 << " returned user_id " << results[j].user_id << ": "
+                 << results[j].message;
+      return EXIT_FAILURE;
+    }
+  }
+  return results.size() == repeat_size ? 0 : EXIT_FAILURE;
+}
@@ -6,25 +6,32 @@
 #include <libmemcached/util.h>
 #include <mongoc.h>
 
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
-#include <jwt/jwt.hpp>
-#include <nlohmann/json.hpp>
 #include <random>
 #include <string>
+#include <unordered_set>
 
 #include "../../gen-cpp/SocialGraphService.h"
 #include "../../gen-cpp/UserService.h"
 #include "../../gen-cpp/social_network_types.h"
-#include "../../third_party/PicoSHA2/picosha2.h"
 #include "../ClientPool.h"
+#include "../MongoIndexes.h"
 #include "../ThriftClient.h"
+#include "../UniqueIdGenerator.h"
 #include "../logger.h"
 #include "../tracing.h"
+#include "LoginRecord.h"
+#include "LoginToken.h"
+#include "UsernameIndex.h"
 
-// Custom Epoch (January 1, 2018 Midnight GMT = 2018-01-01T00:00:00Z)
-#define CUSTOM_EPOCH 1514764800000
 #define MONGODB_TIMEOUT_MS 100
+// User_ids RegisterUsers sends per SocialGraphService::InsertUsers call
+#define REGISTER_USERS_SOCIAL_GRAPH_BATCH 1000
+// MongoDB's code for a write rejected by a unique index
+#define MONGODB_DUPLICATE_KEY_ERROR 11000
 
 namespace social_network {
 
@@ -32,32 +39,15 @@ using std::chrono::duration_cast;
 using std::chrono::milliseconds;
 using std::chrono::seconds;
 using std::chrono::system_clock;
-using namespace jwt::params;
-
-static int64_t current_timestamp = -1;
-static int counter = 0;
-
-static int GetCounter(int64_t timestamp) {
-  if (current_timestamp > timestamp) {
-    LOG(fatal) << "Timestamps are not incremental.";
-    exit(EXIT_FAILURE);
-  }
-  if (current_timestamp == timestamp) {
-    return counter++;
-  } else {
-    current_timestamp = timestamp;
-    counter = 0;
-    return counter++;
-  }
-}
 
 std::string GenRandomString(const int len) {
   static const std::string alphanum =
       "0123456789"
       "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
       "abcdefghijklmnopqrstuvwxyz";
-  std::random_device rd;
-  std::mt19937 gen(rd());
+  // Seeded once per thread rather than from a std::random_device read, a
+  // system call, per salt
+  thread_local std::mt19937 gen(std::random_device{}());
   std::uniform_int_distribution<int> dist(
       0, static_cast<int>(alphanum.length() - 1));
   std::string s;
@@ -69,9 +59,10 @@ std::string GenRandomString(const int len) {
 
 class UserHandler : public UserServiceIf {
  public:
-  UserHandler(std::mutex *, const std::string &, const std::string &,
-              memcached_pool_st *, mongoc_client_pool_t *,
-              ClientPool<ThriftClient<SocialGraphServiceClient>> *);
+  UserHandler(UniqueIdGenerator *, const std::string &, memcached_pool_st *, mongoc_client_pool_t *,
+              ClientPool<ThriftClient<SocialGraphServiceClient>> *,
+              VerifiedTokenCache *token_cache = nullptr,
+              UsernameIndex *username_index = nullptr);
   ~UserHandler() override = default;
   void RegisterUser(int64_t, const std::string &, const std::string &,
                     const std::string &, const std::string &,
@@ -90,28 +81,67 @@ class UserHandler : public UserServiceIf {
              const std::map<std::string, std::string> &) override;
   int64_t GetUserId(int64_t, const std::string &,
                     const std::map<std::string, std::string> &) override;
+  int64_t VerifyToken(int64_t, const std::string &,
+                      const std::map<std::string, std::string> &) override;
+  void GetUserIds(std::map<std::string, int64_t> &, int64_t,
+                  const std::vector<std::string> &,
+                  const std::map<std::string, std::string> &) override;
+  void RegisterUsers(std::vector<UserRegistrationResult> &, int64_t,
+                     const std::vector<UserRegistration> &,
+                     const std::map<std::string, std::string> &) override;
+
+  // MongoDB indexes this handler's queries rely on, and sample queries of
+  // each shape it issues, for SetUpMongoIndexes
+  static std::vector<MongoIndexSpec> IndexSpecs();
+  static std::vector<MongoQueryShape> QueryShapes();
 
  private:
-  std::string _machine_id;
+  UniqueIdGenerator *_id_generator;
   std::string _secret;
-  std::mutex *_thread_lock;
   memcached_pool_st *_memcached_client_pool;
   mongoc_client_pool_t *_mongodb_client_pool;
   ClientPool<ThriftClient<SocialGraphServiceClient>> *_social_graph_client_pool;
+  JwtCodec _jwt_codec;
+  VerifiedTokenCache *_token_cache;
+  UsernameIndex *_username_index;
+
+  // Adds the user_id of every registered user among usernames to user_ids:
+  // from the username index, then one memcached mget, then one MongoDB $in
+  // query, back-filling memcached with what MongoDB found
+  void _LookUpUserIds(const std::vector<std::string> &usernames,
+                      const opentracing::SpanContext &span_context,
+                      std::map<std::string, int64_t> *user_ids);
+  void _MemcachedSetUserIds(const std::map<std::string, int64_t> &user_ids);
+  // Sets all (key, value) items with buffered requests, so that they go out
+  // in as few writes as fit the buffer instead of one round trip each
+  void _MemcachedSetMany(
+      const std::vector<std::pair<std::string, std::string>> &items);
+  // Registered users of usernames, for RegisterUsers
+  void _FindUsernames(const std::vector<std::string> &usernames,
+                      const opentracing::SpanContext &span_context,
+                      std::unordered_set<std::string> *found);
+  // The filters of the username lookups, also used by QueryShapes, to be
+  // destroyed by the caller
+  static bson_t *_NewUsernameQuery(const std::string &username);
+  static bson_t *_NewUsernamesQuery(const std::vector<std::string> &usernames);
 };
 
-UserHandler::UserHandler(std::mutex *thread_lock, const std::string &machine_id,
+UserHandler::UserHandler(UniqueIdGenerator *id_generator,
                          const std::string &secret,
                          memcached_pool_st *memcached_client_pool,
                          mongoc_client_pool_t *mongodb_client_pool,
                          ClientPool<ThriftClient<SocialGraphServiceClient>>
-                             *social_graph_client_pool) {
-  _thread_lock = thread_lock;
-  _machine_id = machine_id;
+                             *social_graph_client_pool,
+                         VerifiedTokenCache *token_cache,
+                         UsernameIndex *username_index)
+    : _jwt_codec(secret) {
+  _id_generator = id_generator;
   _memcached_client_pool = memcached_client_pool;
   _mongodb_client_pool = mongodb_client_pool;
   _secret = secret;
   _social_graph_client_pool = social_graph_client_pool;
+  _token_cache = token_cache;
+  _username_index = username_index;
 }
 
 void UserHandler::RegisterUserWithId(
@@ -142,8 +172,7 @@ void UserHandler::RegisterUserWithId(
       mongoc_client_get_collection(mongodb_client, "user", "user");
 
   // Check if the username has existed in the database
-  bson_t *query = bson_new();
-  BSON_APPEND_UTF8(query, "username", username.c_str());
+  bson_t *query = _NewUsernameQuery(username);
   mongoc_cursor_t *cursor =
       mongoc_collection_find_with_opts(collection, query, nullptr, nullptr);
   const bson_t *doc;
@@ -177,7 +206,7 @@ void UserHandler::RegisterUserWithId(
     BSON_APPEND_UTF8(new_doc, "username", username.c_str());
     std::string salt = GenRandomString(32);
     BSON_APPEND_UTF8(new_doc, "salt", salt.c_str());
-    std::string password_hashed = picosha2::hash256_hex_string(password + salt);
+    std::string password_hashed = Sha256Hex(password + salt);
     BSON_APPEND_UTF8(new_doc, "password", password_hashed.c_str());
 
     bson_error_t error;
@@ -208,6 +237,13 @@ void UserHandler::RegisterUserWithId(
   mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
 
   if (!found) {
+    // So that the user is found by username before the username index
+    // of every user-service instance has refreshed
+    _MemcachedSetUserIds({{username, user_id}});
+    if (_username_index) {
+      _username_index->Insert(username, user_id);
+    }
+
     auto social_graph_client_wrapper = _social_graph_client_pool->Pop();
     if (!social_graph_client_wrapper) {
       ServiceException se;
@@ -244,37 +280,13 @@ void UserHandler::RegisterUser(
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
   // Compose user_id
-  _thread_lock->lock();
-  int64_t timestamp =
-      duration_cast<milliseconds>(system_clock::now().time_since_epoch())
-          .count() -
-      CUSTOM_EPOCH;
-  int idx = GetCounter(timestamp);
-  _thread_lock->unlock();
-
-  std::stringstream sstream;
-  sstream << std::hex << timestamp;
-  std::string timestamp_hex(sstream.str());
-  if (timestamp_hex.size() > 10) {
-    timestamp_hex.erase(0, timestamp_hex.size() - 10);
-  } else if (timestamp_hex.size() < 10) {
-    timestamp_hex = std::string(10 - timestamp_hex.size(), '0') + timestamp_hex;
-  }
-  // Empty the sstream buffer.
-  sstream.clear();
-  sstream.str(std::string());
-
-  sstream << std::hex << idx;
-  std::string counter_hex(sstream.str());
-
-  if (counter_hex.size() > 3) {
-    counter_hex.erase(0, counter_hex.size() - 3);
-  } else if (counter_hex.size() < 3) {
-    counter_hex = std::string(3 - counter_hex.size(), '0') + counter_hex;
-  }
-  std::string user_id_str = _machine_id + timestamp_hex + counter_hex;
-  int64_t user_id = stoul(user_id_str, nullptr, 16) & 0x7FFFFFFFFFFFFFFF;
-  ;
+  int64_t user_id;
+  if (!_id_generator->NextId(&user_id)) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "Clock moved backwards, cannot compose a user_id";
+    throw se;
+  }
   LOG(debug) << "The user_id of the request " << req_id << " is " << user_id;
 
   // Store user info into mongodb
@@ -290,8 +302,7 @@ void UserHandler::RegisterUser(
       mongoc_client_get_collection(mongodb_client, "user", "user");
 
   // Check if the username has existed in the database
-  bson_t *query = bson_new();
-  BSON_APPEND_UTF8(query, "username", username.c_str());
+  bson_t *query = _NewUsernameQuery(username);
   mongoc_cursor_t *cursor =
       mongoc_collection_find_with_opts(collection, query, nullptr, nullptr);
   const bson_t *doc;
@@ -325,7 +336,7 @@ void UserHandler::RegisterUser(
     BSON_APPEND_UTF8(new_doc, "username", username.c_str());
     std::string salt = GenRandomString(32);
     BSON_APPEND_UTF8(new_doc, "salt", salt.c_str());
-    std::string password_hashed = picosha2::hash256_hex_string(password + salt);
+    std::string password_hashed = Sha256Hex(password + salt);
     BSON_APPEND_UTF8(new_doc, "password", password_hashed.c_str());
 
     auto user_insert_span = opentracing::Tracer::Global()->StartSpan(
@@ -355,6 +366,13 @@ void UserHandler::RegisterUser(
   mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
 
   if (!found) {
+    // So that the user is found by username before the username index
+    // of every user-service instance has refreshed
+    _MemcachedSetUserIds({{username, user_id}});
+    if (_username_index) {
+      _username_index->Insert(username, user_id);
+    }
+
     auto social_graph_client_wrapper = _social_graph_client_pool->Pop();
     if (!social_graph_client_wrapper) {
       ServiceException se;
@@ -388,150 +406,21 @@ void UserHandler::ComposeCreatorWithUsername(
       "compose_creator_server", {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
-  size_t user_id_size;
-  uint32_t memcached_flags;
-
-  memcached_return_t memcached_rc;
-  memcached_st *memcached_client =
-      memcached_pool_pop(_memcached_client_pool, true, &memcached_rc);
-  char *user_id_mmc;
-  if (memcached_client) {
-    auto id_get_span = opentracing::Tracer::Global()->StartSpan(
-        "user_mmc_get_client", {opentracing::ChildOf(&span->context())});
-    user_id_mmc =
-        memcached_get(memcached_client, (username + ":user_id").c_str(),
-                      (username + ":user_id").length(), &user_id_size,
-                      &memcached_flags, &memcached_rc);
-    id_get_span->Finish();
-    if (!user_id_mmc && memcached_rc != MEMCACHED_NOTFOUND) {
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_MEMCACHED_ERROR;
-      se.message = memcached_strerror(memcached_client, memcached_rc);
-      memcached_pool_push(_memcached_client_pool, memcached_client);
-      throw se;
-    }
-    memcached_pool_push(_memcached_client_pool, memcached_client);
-  } else {
-    LOG(warning) << "Failed to pop a client from memcached pool";
-  }
-
-  int64_t user_id = -1;
-  bool cached = false;
-  if (user_id_mmc) {
-    cached = true;
-    LOG(debug) << "Found user_id of username :" << username << " in Memcached";
-    user_id = std::stoul(user_id_mmc);
-    free(user_id_mmc);
-  }
-
-  // If not cached in memcached
-  else {
-    LOG(debug) << "user_id not cached in Memcached";
-    mongoc_client_t *mongodb_client =
-        mongoc_client_pool_pop(_mongodb_client_pool);
-    if (!mongodb_client) {
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-      se.message = "Failed to pop a client from MongoDB pool";
-      throw se;
-    }
-    auto collection =
-        mongoc_client_get_collection(mongodb_client, "user", "user");
-    if (!collection) {
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-      se.message = "Failed to create collection user from DB user";
-      throw se;
-    }
-    bson_t *query = bson_new();
-    BSON_APPEND_UTF8(query, "username", username.c_str());
-
-    auto find_span = opentracing::Tracer::Global()->StartSpan(
-        "user_mongo_find_client", {opentracing::ChildOf(&span->context())});
-    mongoc_cursor_t *cursor =
-        mongoc_collection_find_with_opts(collection, query, nullptr, nullptr);
-    const bson_t *doc;
-    bool found = mongoc_cursor_next(cursor, &doc);
-    find_span->Finish();
-    if (!found) {
-      bson_error_t error;
-      if (mongoc_cursor_error(cursor, &error)) {
-        LOG(error) << error.message;
-        bson_destroy(query);
-        mongoc_cursor_destroy(cursor);
-        mongoc_collection_destroy(collection);
-        mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-        ServiceException se;
-        se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-        se.message = error.message;
-        throw se;
-      } else {
-        LOG(warning) << "User: " << username << " doesn't exist in MongoDB";
-        bson_destroy(query);
-        mongoc_cursor_destroy(cursor);
-        mongoc_collection_destroy(collection);
-        mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-        ServiceException se;
-        se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
-        se.message = "User: " + username + " is not registered";
-        throw se;
-      }
-    } else {
-      LOG(debug) << "User: " << username << " found in MongoDB";
-      bson_iter_t iter;
-      if (bson_iter_init_find(&iter, doc, "user_id")) {
-        user_id = bson_iter_value(&iter)->value.v_int64;
-      } else {
-        LOG(error) << "user_id attribute of user " << username
-                   << " was not found in the User object";
-        bson_destroy(query);
-        mongoc_cursor_destroy(cursor);
-        mongoc_collection_destroy(collection);
-        mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-        ServiceException se;
-        se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
-        se.message = "user_id attribute of user: " + username +
-                     " was not found in the User object";
-        throw se;
-      }
-    }
-    bson_destroy(query);
-    mongoc_cursor_destroy(cursor);
-    mongoc_collection_destroy(collection);
-    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+  std::map<std::string, int64_t> user_ids;
+  _LookUpUserIds({username}, span->context(), &user_ids);
+  auto it = user_ids.find(username);
+  if (it == user_ids.end()) {
+    LOG(warning) << "User: " << username << " doesn't exist in MongoDB";
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "User: " + username + " is not registered";
+    throw se;
   }
 
   Creator creator;
   creator.username = username;
-  creator.user_id = user_id;
-
-  if (user_id != -1) {
-    _return = creator;
-  }
-
-  memcached_client =
-      memcached_pool_pop(_memcached_client_pool, true, &memcached_rc);
-  if (memcached_client) {
-    if (user_id != -1 && !cached) {
-      auto id_set_span = opentracing::Tracer::Global()->StartSpan(
-          "user_mmc_set_cilent", {opentracing::ChildOf(&span->context())});
-      std::string user_id_str = std::to_string(user_id);
-      memcached_rc =
-          memcached_set(memcached_client, (username + ":user_id").c_str(),
-                        (username + ":user_id").length(), user_id_str.c_str(),
-                        user_id_str.length(), static_cast<time_t>(0),
-                        static_cast<uint32_t>(0));
-      id_set_span->Finish();
-      if (memcached_rc != MEMCACHED_SUCCESS) {
-        LOG(warning) << "Failed to set the user_id of user " << username
-                     << " to Memcached: "
-                     << memcached_strerror(memcached_client, memcached_rc);
-      }
-    }
-    memcached_pool_push(_memcached_client_pool, memcached_client);
-  } else {
-    LOG(warning) << "Failed to pop a client from memcached pool";
-  }
+  creator.user_id = it->second;
+  _return = creator;
   span->Finish();
 }
 
@@ -574,7 +463,7 @@ void UserHandler::Login(std::string &_return, int64_t req_id,
   memcached_return_t memcached_rc;
   memcached_st *memcached_client =
       memcached_pool_pop(_memcached_client_pool, true, &memcached_rc);
-  char *login_mmc;
+  char *login_mmc = nullptr;
   if (!memcached_client) {
     LOG(warning) << "Failed to pop a client from memcached pool";
   } else {
@@ -591,24 +480,21 @@ void UserHandler::Login(std::string &_return, int64_t req_id,
     memcached_pool_push(_memcached_client_pool, memcached_client);
   }
 
-  std::string password_stored;
-  std::string salt_stored;
-  int64_t user_id_stored = -1;
+  LoginRecord record;
   bool cached = false;
-  json login_json;
 
   if (login_mmc) {
-    // If not cached in memcached
-    LOG(debug) << "Found username: " << username << " in Memcached";
-    login_json = json::parse(std::string(login_mmc, login_size));
-    password_stored = login_json["password"];
-    salt_stored = login_json["salt"];
-    user_id_stored = login_json["user_id"];
-    cached = true;
+    cached = DecodeLoginRecord(login_mmc, login_size, &record);
+    if (cached) {
+      LOG(debug) << "Found username: " << username << " in Memcached";
+    } else {
+      LOG(debug) << "Login record of " << username
+                 << " in Memcached has an old format";
+    }
     free(login_mmc);
   }
 
-  else {
+  if (!cached) {
     // If not cached in memcached
     LOG(debug) << "Username: " << username << " NOT cached in Memcached";
 
@@ -628,8 +514,7 @@ void UserHandler::Login(std::string &_return, int64_t req_id,
       se.message = "Failed to create collection user from DB user";
       throw se;
     }
-    bson_t *query = bson_new();
-    BSON_APPEND_UTF8(query, "username", username.c_str());
+    bson_t *query = _NewUsernameQuery(username);
 
     auto find_span = opentracing::Tracer::Global()->StartSpan(
         "user_mongo_find_client", {opentracing::ChildOf(&span->context())});
@@ -669,13 +554,11 @@ void UserHandler::Login(std::string &_return, int64_t req_id,
       bson_iter_t iter_user_id;
       if (bson_iter_init_find(&iter_password, doc, "password") &&
           bson_iter_init_find(&iter_salt, doc, "salt") &&
-          bson_iter_init_find(&iter_user_id, doc, "user_id")) {
-        password_stored = bson_iter_value(&iter_password)->value.v_utf8.str;
-        salt_stored = bson_iter_value(&iter_salt)->value.v_utf8.str;
-        user_id_stored = bson_iter_value(&iter_user_id)->value.v_int64;
-        login_json["password"] = password_stored;
-        login_json["salt"] = salt_stored;
-        login_json["user_id"] = user_id_stored;
+          bson_iter_init_find(&iter_user_id, doc, "user_id") &&
+          HexToHash(bson_iter_value(&iter_password)->value.v_utf8.str,
+                    &record.password_hash)) {
+        record.salt = bson_iter_value(&iter_salt)->value.v_utf8.str;
+        record.user_id = bson_iter_value(&iter_user_id)->value.v_int64;
       } else {
         LOG(error) << "user: " << username << " entry is NOT complete";
         bson_destroy(query);
@@ -694,21 +577,17 @@ void UserHandler::Login(std::string &_return, int64_t req_id,
     }
   }
 
-  if (user_id_stored != -1 && !salt_stored.empty() &&
-      !password_stored.empty()) {
-    bool auth =
-        picosha2::hash256_hex_string(password + salt_stored) == password_stored;
+  if (!record.salt.empty()) {
+    std::string password_hash = Sha256(password + record.salt);
+    bool auth = CRYPTO_memcmp(password_hash.data(),
+                              record.password_hash.data(),
+                              LOGIN_RECORD_HASH_LENGTH) == 0;
     if (auth) {
-      auto user_id_str = std::to_string(user_id_stored);
-      auto timestamp_str = std::to_string(
+      int64_t timestamp =
           duration_cast<seconds>(system_clock::now().time_since_epoch())
-              .count());
-      jwt::jwt_object obj{algorithm("HS256"), secret(_secret),
-                          payload({{"user_id", user_id_str},
-                                   {"username", username},
-                                   {"timestamp", timestamp_str},
-                                   {"ttl", "3600"}})};
-      _return = obj.signature();
+              .count();
+      _return = _jwt_codec.Sign(record.user_id, username, timestamp,
+                                LOGIN_TOKEN_TTL_S);
     } else {
       ServiceException se;
       se.errorCode = ErrorCode::SE_UNAUTHORIZED;
@@ -730,11 +609,14 @@ void UserHandler::Login(std::string &_return, int64_t req_id,
     } else {
       auto set_login_span = opentracing::Tracer::Global()->StartSpan(
           "user_mmc_set_client", {opentracing::ChildOf(&span->context())});
-      std::string login_str = login_json.dump();
-      memcached_rc =
-          memcached_set(memcached_client, (username + ":login").c_str(),
-                        (username + ":login").length(), login_str.c_str(),
-                        login_str.length(), 0, 0);
+      std::string login_str = EncodeLoginRecord(record);
+      memcached_rc = MEMCACHED_SUCCESS;
+      if (!login_str.empty()) {
+        memcached_rc =
+            memcached_set(memcached_client, (username + ":login").c_str(),
+                          (username + ":login").length(), login_str.c_str(),
+                          login_str.length(), 0, 0);
+      }
       set_login_span->Finish();
       if (memcached_rc != MEMCACHED_SUCCESS) {
         LOG(warning) << "Failed to set the login info of user " << username
@@ -757,191 +639,623 @@ int64_t UserHandler::GetUserId(
       "get_user_id_server", {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
-  size_t user_id_size;
-  uint32_t memcached_flags;
+  std::map<std::string, int64_t> user_ids;
+  _LookUpUserIds({username}, span->context(), &user_ids);
+  auto it = user_ids.find(username);
+  if (it == user_ids.end()) {
+    LOG(warning) << "User: " << username << " doesn't exist in MongoDB";
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "User: " + username + " is not registered";
+    throw se;
+  }
+
+  span->Finish();
+  return it->second;
+}
+
+void UserHandler::GetUserIds(
+    std::map<std::string, int64_t> &_return, int64_t req_id,
+    const std::vector<std::string> &usernames,
+    const std::map<std::string, std::string> &carrier) {
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "get_user_ids_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  std::map<std::string, int64_t> user_ids;
+  _LookUpUserIds(usernames, span->context(), &user_ids);
+  _return = std::move(user_ids);
+  span->Finish();
+}
+
+void UserHandler::_LookUpUserIds(const std::vector<std::string> &usernames,
+                                 const opentracing::SpanContext &span_context,
+                                 std::map<std::string, int64_t> *user_ids) {
+  std::vector<std::string> usernames_not_cached;
+  // Usernames the index knows are not registered. They are still looked up
+  // in memcached, which has the ones registered since its last refresh, but
+  // not in MongoDB.
+  std::unordered_set<std::string> usernames_rejected;
+  std::unordered_set<std::string> seen;
+  for (auto &username : usernames) {
+    if (!seen.insert(username).second) {
+      continue;
+    }
+    int64_t user_id;
+    bool known = true;
+    if (_username_index &&
+        _username_index->Lookup(username, &user_id, &known)) {
+      user_ids->emplace(username, user_id);
+      continue;
+    }
+    if (!known) {
+      usernames_rejected.insert(username);
+    }
+    usernames_not_cached.emplace_back(username);
+  }
+  if (usernames_not_cached.empty()) {
+    return;
+  }
 
   memcached_return_t memcached_rc;
   memcached_st *memcached_client =
       memcached_pool_pop(_memcached_client_pool, true, &memcached_rc);
-  char *user_id_mmc;
-  if (memcached_client) {
-    auto id_get_span = opentracing::Tracer::Global()->StartSpan(
-        "user_mmc_get_user_id_client",
-        {opentracing::ChildOf(&span->context())});
-    user_id_mmc =
-        memcached_get(memcached_client, (username + ":user_id").c_str(),
-                      (username + ":user_id").length(), &user_id_size,
-                      &memcached_flags, &memcached_rc);
-    id_get_span->Finish();
-    if (!user_id_mmc && memcached_rc != MEMCACHED_NOTFOUND) {
+  if (!memcached_client) {
+    LOG(warning) << "Failed to pop a client from memcached pool";
+  } else {
+    std::vector<std::string> key_strs;
+    std::vector<const char *> keys;
+    std::vector<size_t> key_sizes;
+    for (auto &username : usernames_not_cached) {
+      key_strs.emplace_back(username + ":user_id");
+    }
+    for (auto &key_str : key_strs) {
+      keys.emplace_back(key_str.c_str());
+      key_sizes.emplace_back(key_str.length());
+    }
+
+    auto get_span = opentracing::Tracer::Global()->StartSpan(
+        "user_mmc_get_user_ids_client", {opentracing::ChildOf(&span_context)});
+    memcached_rc = memcached_mget(memcached_client, keys.data(),
+                                  key_sizes.data(), keys.size());
+    if (memcached_rc != MEMCACHED_SUCCESS) {
       ServiceException se;
       se.errorCode = ErrorCode::SE_MEMCACHED_ERROR;
       se.message = memcached_strerror(memcached_client, memcached_rc);
       memcached_pool_push(_memcached_client_pool, memcached_client);
+      get_span->Finish();
       throw se;
     }
+
+    char return_key[MEMCACHED_MAX_KEY];
+    size_t return_key_length;
+    char *return_value;
+    size_t return_value_length;
+    uint32_t flags;
+    while (true) {
+      return_value =
+          memcached_fetch(memcached_client, return_key, &return_key_length,
+                          &return_value_length, &flags, &memcached_rc);
+      if (return_value == nullptr) {
+        break;
+      }
+      if (memcached_rc != MEMCACHED_SUCCESS) {
+        free(return_value);
+        memcached_quit(memcached_client);
+        memcached_pool_push(_memcached_client_pool, memcached_client);
+        ServiceException se;
+        se.errorCode = ErrorCode::SE_MEMCACHED_ERROR;
+        se.message = "Cannot get user_ids from Memcached";
+        get_span->Finish();
+        throw se;
+      }
+      std::string username(return_key,
+                           return_key_length - std::strlen(":user_id"));
+      int64_t user_id = std::stoll(
+          std::string(return_value, return_value + return_value_length));
+      user_ids->emplace(username, user_id);
+      if (_username_index) {
+        _username_index->Insert(username, user_id);
+      }
+      free(return_value);
+    }
+    memcached_quit(memcached_client);
     memcached_pool_push(_memcached_client_pool, memcached_client);
-  } else {
+    get_span->Finish();
+  }
+
+  std::vector<std::string> usernames_not_found;
+  for (auto &username : usernames_not_cached) {
+    if (!user_ids->count(username) && !usernames_rejected.count(username)) {
+      usernames_not_found.emplace_back(username);
+    }
+  }
+  if (usernames_not_found.empty()) {
+    if (!usernames_rejected.empty()) {
+      _username_index->CountAvoidedMongoQuery();
+    }
+    return;
+  }
+
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(_mongodb_client_pool);
+  if (!mongodb_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    throw se;
+  }
+  auto collection =
+      mongoc_client_get_collection(mongodb_client, "user", "user");
+  if (!collection) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to create collection user from DB user";
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
+
+  bson_t *query = _NewUsernamesQuery(usernames_not_found);
+  bson_t *opts = BCON_NEW("projection", "{", "username", BCON_BOOL(true),
+                          "user_id", BCON_BOOL(true), "_id", BCON_BOOL(false),
+                          "}");
+
+  auto find_span = opentracing::Tracer::Global()->StartSpan(
+      "user_mongo_find_client", {opentracing::ChildOf(&span_context)});
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+  const bson_t *doc;
+  std::map<std::string, int64_t> found_user_ids;
+  bool complete = true;
+  while (mongoc_cursor_next(cursor, &doc)) {
+    bson_iter_t iter_username;
+    bson_iter_t iter_user_id;
+    if (bson_iter_init_find(&iter_username, doc, "username") &&
+        bson_iter_init_find(&iter_user_id, doc, "user_id")) {
+      found_user_ids.emplace(bson_iter_utf8(&iter_username, nullptr),
+                             bson_iter_int64(&iter_user_id));
+    } else {
+      complete = false;
+    }
+  }
+  find_span->Finish();
+  bson_error_t error;
+  bool cursor_error = mongoc_cursor_error(cursor, &error);
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_cursor_destroy(cursor);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+  if (cursor_error) {
+    LOG(error) << error.message;
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = error.message;
+    throw se;
+  }
+  if (!complete) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Attribute of MongoDB item is not complete";
+    throw se;
+  }
+
+  for (auto &user_id : found_user_ids) {
+    user_ids->emplace(user_id);
+    if (_username_index) {
+      _username_index->Insert(user_id.first, user_id.second);
+    }
+  }
+  _MemcachedSetUserIds(found_user_ids);
+}
+
+void UserHandler::_MemcachedSetUserIds(
+    const std::map<std::string, int64_t> &user_ids) {
+  std::vector<std::pair<std::string, std::string>> items;
+  items.reserve(user_ids.size());
+  for (auto &user_id : user_ids) {
+    items.emplace_back(user_id.first + ":user_id",
+                       std::to_string(user_id.second));
+  }
+  _MemcachedSetMany(items);
+}
+
+void UserHandler::_MemcachedSetMany(
+    const std::vector<std::pair<std::string, std::string>> &items) {
+  if (items.empty()) {
+    return;
+  }
+  memcached_return_t memcached_rc;
+  memcached_st *memcached_client =
+      memcached_pool_pop(_memcached_client_pool, true, &memcached_rc);
+  if (!memcached_client) {
     LOG(warning) << "Failed to pop a client from memcached pool";
+    return;
+  }
+  uint64_t buffer_requests = memcached_behavior_get(
+      memcached_client, MEMCACHED_BEHAVIOR_BUFFER_REQUESTS);
+  memcached_behavior_set(memcached_client, MEMCACHED_BEHAVIOR_BUFFER_REQUESTS,
+                         1);
+  for (auto &item : items) {
+    memcached_rc = memcached_set(memcached_client, item.first.c_str(),
+                                 item.first.length(), item.second.c_str(),
+                                 item.second.length(), 0, 0);
+    if (memcached_rc != MEMCACHED_SUCCESS &&
+        memcached_rc != MEMCACHED_BUFFERED) {
+      LOG(warning) << "Failed to set " << item.first << " to Memcached: "
+                   << memcached_strerror(memcached_client, memcached_rc);
+    }
+  }
+  memcached_rc = memcached_flush_buffers(memcached_client);
+  if (memcached_rc != MEMCACHED_SUCCESS) {
+    LOG(warning) << "Failed to set " << items.size()
+                 << " items to Memcached: "
+                 << memcached_strerror(memcached_client, memcached_rc);
   }
+  memcached_behavior_set(memcached_client, MEMCACHED_BEHAVIOR_BUFFER_REQUESTS,
+                         buffer_requests);
+  memcached_pool_push(_memcached_client_pool, memcached_client);
+}
 
-  int64_t user_id = -1;
-  bool cached = false;
-  if (user_id_mmc) {
-    cached = true;
-    LOG(debug) << "Found user_id of username :" << username << " in Memcached";
-    user_id = std::stoul(user_id_mmc);
-    free(user_id_mmc);
-  } else {
-    // If not cached in memcached
-    LOG(debug) << "user_id not cached in Memcached";
-    mongoc_client_t *mongodb_client =
-        mongoc_client_pool_pop(_mongodb_client_pool);
-    if (!mongodb_client) {
+int64_t UserHandler::VerifyToken(
+    int64_t req_id, const std::string &token,
+    const std::map<std::string, std::string> &carrier) {
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "verify_token_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  int64_t now =
+      duration_cast<seconds>(system_clock::now().time_since_epoch()).count();
+  TokenClaims claims;
+  if (!_token_cache || !_token_cache->Get(token, now, &claims)) {
+    if (!_jwt_codec.Verify(token, &claims)) {
       ServiceException se;
-      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-      se.message = "Failed to pop a client from MongoDB pool";
+      se.errorCode = ErrorCode::SE_UNAUTHORIZED;
+      se.message = "Invalid login token";
       throw se;
     }
-    auto collection =
-        mongoc_client_get_collection(mongodb_client, "user", "user");
-    if (!collection) {
+    if (claims.expires_at < now) {
       ServiceException se;
-      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-      se.message = "Failed to create collection user from DB user";
+      se.errorCode = ErrorCode::SE_UNAUTHORIZED;
+      se.message = "Login token expired";
       throw se;
     }
-    bson_t *query = bson_new();
-    BSON_APPEND_UTF8(query, "username", username.c_str());
+    if (_token_cache) {
+      _token_cache->Put(token, claims);
+    }
+  }
 
-    auto find_span = opentracing::Tracer::Global()->StartSpan(
-        "user_mongo_find_client", {opentracing::ChildOf(&span->context())});
-    mongoc_cursor_t *cursor =
-        mongoc_collection_find_with_opts(collection, query, nullptr, nullptr);
-    const bson_t *doc;
-    bool found = mongoc_cursor_next(cursor, &doc);
-    find_span->Finish();
-    if (!found) {
-      bson_error_t error;
-      if (mongoc_cursor_error(cursor, &error)) {
-        LOG(error) << error.message;
-        bson_destroy(query);
-        mongoc_cursor_destroy(cursor);
-        mongoc_collection_destroy(collection);
-        mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-        ServiceException se;
-        se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-        se.message = error.message;
-        throw se;
-      } else {
-        LOG(warning) << "User: " << username << " doesn't exist in MongoDB";
-        bson_destroy(query);
-        mongoc_cursor_destroy(cursor);
-        mongoc_collection_destroy(collection);
-        mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-        ServiceException se;
-        se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
-        se.message = "User: " + username + " is not registered";
-        throw se;
-      }
+  span->Finish();
+  return claims.user_id;
+}
+
+// RegisterUserWithId for a batch, users[i] with users[i].user_id, or a new
+// one from the id generator if that is negative. One MongoDB $in query
+// checks the usernames and one unordered bulk insert writes the users, so
+// that a bad item fails alone: _return[i].message is empty if users[i] was
+// registered, and otherwise says why. _return[i].user_id is -1 if users[i]
+// was not written to MongoDB; it is set but with a message if only the
+// social-graph insert failed.
+void UserHandler::RegisterUsers(
+    std::vector<UserRegistrationResult> &_return, int64_t req_id,
+    const std::vector<UserRegistration> &users,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "register_users_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  std::vector<UserRegistrationResult> results(users.size());
+  for (auto &result : results) {
+    result.user_id = -1;
+  }
+
+  // Each username once, the first item with it registers
+  std::vector<std::string> usernames;
+  std::unordered_set<std::string> usernames_seen;
+  for (size_t i = 0; i < users.size(); i++) {
+    if (usernames_seen.insert(users[i].username).second) {
+      usernames.emplace_back(users[i].username);
     } else {
-      LOG(debug) << "User: " << username << " found in MongoDB";
-      bson_iter_t iter;
-      if (bson_iter_init_find(&iter, doc, "user_id")) {
-        user_id = bson_iter_value(&iter)->value.v_int64;
-      } else {
-        LOG(error) << "user_id attribute of user " << username
-                   << " was not found in the User object";
-        bson_destroy(query);
-        mongoc_cursor_destroy(cursor);
-        mongoc_collection_destroy(collection);
-        mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-        ServiceException se;
-        se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
-        se.message = "user_id attribute of user: " + username +
-                     " was not found in the User object";
-        throw se;
+      results[i].message =
+          "User " + users[i].username + " appears more than once";
+    }
+  }
+  std::unordered_set<std::string> usernames_found;
+  _FindUsernames(usernames, span->context(), &usernames_found);
+
+  // Items queued for insertion, in the order of the bulk write
+  std::vector<size_t> queued;
+  std::vector<LoginRecord> records;
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(_mongodb_client_pool);
+  if (!mongodb_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    throw se;
+  }
+  auto collection =
+      mongoc_client_get_collection(mongodb_client, "user", "user");
+  bson_t *bulk_opts = BCON_NEW("ordered", BCON_BOOL(false));
+  mongoc_bulk_operation_t *bulk =
+      mongoc_collection_create_bulk_operation_with_opts(collection, bulk_opts);
+  for (size_t i = 0; i < users.size(); i++) {
+    auto &user = users[i];
+    if (!results[i].message.empty()) {
+      continue;
+    }
+    if (usernames_found.count(user.username)) {
+      LOG(warning) << "User " << user.username << " already existed.";
+      results[i].message = "User " + user.username + " already existed";
+      continue;
+    }
+    LoginRecord record;
+    record.user_id = user.user_id;
+    if (record.user_id < 0 && !_id_generator->NextId(&record.user_id)) {
+      results[i].message = "Clock moved backwards, cannot compose a user_id";
+      continue;
+    }
+    record.salt = GenRandomString(32);
+    record.password_hash = Sha256(user.password + record.salt);
+
+    bson_t *new_doc = bson_new();
+    BSON_APPEND_INT64(new_doc, "user_id", record.user_id);
+    BSON_APPEND_UTF8(new_doc, "first_name", user.first_name.c_str());
+    BSON_APPEND_UTF8(new_doc, "last_name", user.last_name.c_str());
+    BSON_APPEND_UTF8(new_doc, "username", user.username.c_str());
+    BSON_APPEND_UTF8(new_doc, "salt", record.salt.c_str());
+    BSON_APPEND_UTF8(new_doc, "password",
+                     HashToHex(record.password_hash).c_str());
+    mongoc_bulk_operation_insert(bulk, new_doc);
+    bson_destroy(new_doc);
+    queued.emplace_back(i);
+    records.emplace_back(std::move(record));
+  }
+
+  std::vector<bool> inserted(queued.size(), true);
+  if (!queued.empty()) {
+    bson_error_t error;
+    bson_t reply;
+    auto insert_span = opentracing::Tracer::Global()->StartSpan(
+        "user_mongo_bulk_insert_client",
+        {opentracing::ChildOf(&span->context())});
+    bool ok = mongoc_bulk_operation_execute(bulk, &reply, &error);
+    insert_span->Finish();
+    // An unordered bulk write reports the items it rejected in
+    // "writeErrors", by their index in the bulk
+    bool item_errors = false;
+    bson_iter_t iter;
+    bson_iter_t iter_errors;
+    if (!ok && bson_iter_init_find(&iter, &reply, "writeErrors") &&
+        BSON_ITER_HOLDS_ARRAY(&iter) &&
+        bson_iter_recurse(&iter, &iter_errors)) {
+      while (bson_iter_next(&iter_errors)) {
+        bson_iter_t iter_error;
+        if (!BSON_ITER_HOLDS_DOCUMENT(&iter_errors) ||
+            !bson_iter_recurse(&iter_errors, &iter_error)) {
+          continue;
+        }
+        int64_t index = -1;
+        int64_t code = 0;
+        std::string errmsg = error.message;
+        while (bson_iter_next(&iter_error)) {
+          const char *field = bson_iter_key(&iter_error);
+          if (std::strcmp(field, "index") == 0) {
+            index = bson_iter_as_int64(&iter_error);
+          } else if (std::strcmp(field, "code") == 0) {
+            code = bson_iter_as_int64(&iter_error);
+          } else if (std::strcmp(field, "errmsg") == 0 &&
+                     BSON_ITER_HOLDS_UTF8(&iter_error)) {
+            errmsg = bson_iter_utf8(&iter_error, nullptr);
+          }
+        }
+        if (index < 0 || (size_t)index >= queued.size()) {
+          continue;
+        }
+        auto &user = users[queued[index]];
+        if (code == MONGODB_DUPLICATE_KEY_ERROR &&
+            errmsg.find("username") != std::string::npos) {
+          // Registered by another request since _FindUsernames
+          results[queued[index]].message =
+              "User " + user.username + " already existed";
+        } else {
+          results[queued[index]].message = "Failed to insert user " +
+                                           user.username +
+                                           " to MongoDB: " + errmsg;
+        }
+        inserted[index] = false;
+        item_errors = true;
       }
     }
-    bson_destroy(query);
-    mongoc_cursor_destroy(cursor);
-    mongoc_collection_destroy(collection);
-    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    if (!ok && !item_errors) {
+      LOG(error) << "Failed to insert " << queued.size()
+                 << " users to MongoDB: " << error.message;
+      for (size_t j = 0; j < queued.size(); j++) {
+        results[queued[j]].message = "Failed to insert user " +
+                                     users[queued[j]].username +
+                                     " to MongoDB: " + error.message;
+        inserted[j] = false;
+      }
+    }
+    bson_destroy(&reply);
   }
+  mongoc_bulk_operation_destroy(bulk);
+  bson_destroy(bulk_opts);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
 
-  if (!cached) {
-    memcached_client =
-        memcached_pool_pop(_memcached_client_pool, true, &memcached_rc);
-    if (!memcached_client) {
-      LOG(warning) << "Failed to pop a client from memcached pool";
+  // Results of the users now in MongoDB, whose caches are primed as
+  // RegisterUserWithId does and whose social graphs are still to insert
+  std::vector<size_t> registered;
+  std::vector<std::pair<std::string, std::string>> memcached_items;
+  for (size_t j = 0; j < queued.size(); j++) {
+    if (!inserted[j]) {
+      continue;
+    }
+    auto &user = users[queued[j]];
+    results[queued[j]].user_id = records[j].user_id;
+    registered.emplace_back(queued[j]);
+    memcached_items.emplace_back(user.username + ":user_id",
+                                 std::to_string(records[j].user_id));
+    std::string login_str = EncodeLoginRecord(records[j]);
+    if (!login_str.empty()) {
+      memcached_items.emplace_back(user.username + ":login", login_str);
+    }
+    if (_username_index) {
+      _username_index->Insert(user.username, records[j].user_id);
+    }
+  }
+  auto set_span = opentracing::Tracer::Global()->StartSpan(
+      "user_mmc_set_many_client", {opentracing::ChildOf(&span->context())});
+  _MemcachedSetMany(memcached_items);
+  set_span->Finish();
+
+  for (size_t begin = 0; begin < registered.size();
+       begin += REGISTER_USERS_SOCIAL_GRAPH_BATCH) {
+    size_t end = std::min(registered.size(),
+                          begin + REGISTER_USERS_SOCIAL_GRAPH_BATCH);
+    std::vector<int64_t> user_ids;
+    for (size_t j = begin; j < end; j++) {
+      user_ids.emplace_back(results[registered[j]].user_id);
+    }
+    std::string message;
+    auto social_graph_client_wrapper = _social_graph_client_pool->Pop();
+    if (!social_graph_client_wrapper) {
+      message = "Failed to connect to social-graph-service";
     } else {
-      std::string user_id_str = std::to_string(user_id);
-      auto set_login_span = opentracing::Tracer::Global()->StartSpan(
-          "user_mmc_set_client", {opentracing::ChildOf(&span->context())});
-      memcached_rc =
-          memcached_set(memcached_client, (username + ":user_id").c_str(),
-                        (username + ":user_id").length(), user_id_str.c_str(),
-                        user_id_str.length(), 0, 0);
-      set_login_span->Finish();
-      if (memcached_rc != MEMCACHED_SUCCESS) {
-        LOG(warning) << "Failed to set the login info of user " << username
-                     << " to Memcached: "
-                     << memcached_strerror(memcached_client, memcached_rc);
+      auto social_graph_client = social_graph_client_wrapper->GetClient();
+      try {
+        social_graph_client->InsertUsers(req_id, user_ids, writer_text_map);
+        _social_graph_client_pool->Keepalive(social_graph_client_wrapper);
+      } catch (const ServiceException &e) {
+        _social_graph_client_pool->Keepalive(social_graph_client_wrapper);
+        message = e.message;
+      } catch (const std::exception &e) {
+        _social_graph_client_pool->Remove(social_graph_client_wrapper);
+        message = e.what();
+      }
+    }
+    if (!message.empty()) {
+      LOG(error) << "Failed to insert " << user_ids.size()
+                 << " users to social-graph-service: " << message;
+      for (size_t j = begin; j < end; j++) {
+        results[registered[j]].message =
+            "Failed to insert user to social-graph-service: " + message;
       }
-      memcached_pool_push(_memcached_client_pool, memcached_client);
     }
   }
 
+  LOG(debug) << registered.size() << " of " << users.size()
+             << " users registered";
+  _return = std::move(results);
   span->Finish();
-  return user_id;
 }
 
-/*
- * The following code which obtaines machine ID from machine's MAC address was
- * inspired from https://stackoverflow.com/a/16859693.
- *
- * MAC address is obtained from /sys/class/net/<netif>/address
- */
-u_int16_t HashMacAddressPid(const std::string &mac) {
-  u_int16_t hash = 0;
-  std::string mac_pid = mac + std::to_string(getpid());
-  for (unsigned int i = 0; i < mac_pid.size(); i++) {
-    hash += (mac[i] << ((i & 1) * 8));
-  }
-  return hash;
-}
+void UserHandler::_FindUsernames(
+    const std::vector<std::string> &usernames,
+    const opentracing::SpanContext &span_context,
+    std::unordered_set<std::string> *found) {
+  if (usernames.empty()) {
+    return;
+  }
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(_mongodb_client_pool);
+  if (!mongodb_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    throw se;
+  }
+  auto collection =
+      mongoc_client_get_collection(mongodb_client, "user", "user");
 
-std::string GetMachineId(std::string &netif) {
-  std::string mac_hash;
+  bson_t *query = _NewUsernamesQuery(usernames);
+  bson_t *opts = BCON_NEW("projection", "{", "username", BCON_BOOL(true),
+                          "_id", BCON_BOOL(false), "}");
 
-  std::string mac_addr_filename = "/sys/class/net/" + netif + "/address";
-  std::ifstream mac_addr_file;
-  mac_addr_file.open(mac_addr_filename);
-  if (!mac_addr_file) {
-    LOG(fatal) << "Cannot read MAC address from net interface " << netif;
-    return "";
+  auto find_span = opentracing::Tracer::Global()->StartSpan(
+      "user_mongo_find_client", {opentracing::ChildOf(&span_context)});
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+  const bson_t *doc;
+  while (mongoc_cursor_next(cursor, &doc)) {
+    bson_iter_t iter_username;
+    if (bson_iter_init_find(&iter_username, doc, "username") &&
+        BSON_ITER_HOLDS_UTF8(&iter_username)) {
+      found->emplace(bson_iter_utf8(&iter_username, nullptr));
+    }
   }
-  std::string mac;
-  mac_addr_file >> mac;
-  if (mac == "") {
-    LOG(fatal) << "Cannot read MAC address from net interface " << netif;
-    return "";
+  find_span->Finish();
+  bson_error_t error;
+  bool cursor_error = mongoc_cursor_error(cursor, &error);
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_cursor_destroy(cursor);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+  if (cursor_error) {
+    LOG(error) << error.message;
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = error.message;
+    throw se;
   }
-  mac_addr_file.close();
+}
 
-  LOG(info) << "MAC address = " << mac;
+std::vector<MongoIndexSpec> UserHandler::IndexSpecs() {
+  return {
+      {"user", "user", {{"user_id", 1}}, true, ""},
+      // Login, GetUserIds, ComposeCreatorWithUsername and the duplicate
+      // check of RegisterUser look users up by username
+      {"user", "user", {{"username", 1}}, true, ""},
+  };
+}
 
-  std::stringstream stream;
-  stream << std::hex << HashMacAddressPid(mac);
-  mac_hash = stream.str();
+bson_t *UserHandler::_NewUsernameQuery(const std::string &username) {
+  bson_t *query = bson_new();
+  BSON_APPEND_UTF8(query, "username", username.c_str());
+  return query;
+}
 
-  if (mac_hash.size() > 3) {
-    mac_hash.erase(0, mac_hash.size() - 3);
-  } else if (mac_hash.size() < 3) {
-    mac_hash = std::string(3 - mac_hash.size(), '0') + mac_hash;
+bson_t *UserHandler::_NewUsernamesQuery(
+    const std::vector<std::string> &usernames) {
+  bson_t *query = bson_new();
+  bson_t query_child;
+  bson_t query_username_list;
+  const char *key;
+  char buf[16];
+  BSON_APPEND_DOCUMENT_BEGIN(query, "username", &query_child);
+  BSON_APPEND_ARRAY_BEGIN(&query_child, "$in", &query_username_list);
+  for (uint32_t i = 0; i < usernames.size(); i++) {
+    bson_uint32_to_string(i, &key, buf, sizeof buf);
+    BSON_APPEND_UTF8(&query_username_list, key, usernames[i].c_str());
   }
-  return mac_hash;
+  bson_append_array_end(&query_child, &query_username_list);
+  bson_append_document_end(query, &query_child);
+  return query;
 }
+
+std::vector<MongoQueryShape> UserHandler::QueryShapes() {
+  return {
+      MongoQueryShapeOf("user", "user", _NewUsernameQuery("username_0")),
+      MongoQueryShapeOf("user", "user",
+                        _NewUsernamesQuery({"username_0", "username_1"})),
+  };
+}
+
 }  // namespace social_network
 
 #endif  // SOCIAL_NETWORK_MICROSERVICES_USERHANDLER_H
@@ -62,32 +62,49 @@ int main(int argc, char *argv[]) {
   }
   LOG(info) << "machine_id = " << machine_id;
 
-  std::mutex thread_lock;
+  UniqueIdGenerator id_generator(std::stoul(machine_id, nullptr, 16));
 
   ClientPool<ThriftClient<SocialGraphServiceClient>> social_graph_client_pool(
       "social-graph", social_graph_addr, social_graph_port, 0,
       social_graph_conns, social_graph_timeout, social_graph_keepalive, config_json);
 
-  mongoc_client_t *mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
-  if (!mongodb_client) {
-    LOG(fatal) << "Failed to pop mongoc client";
+  if (!SetUpMongoIndexes(mongodb_client_pool, UserHandler::IndexSpecs(),
+                         UserHandler::QueryShapes(),
+                         config_json.value("mongodb_index_check", false))) {
+    LOG(fatal) << "Failed to set up the MongoDB indexes of UserHandler";
     return EXIT_FAILURE;
   }
-  bool r = false;
-  while (!r) {
-    r = CreateIndex(mongodb_client, "user", "user_id", true);
-    if (!r) {
-      LOG(error) << "Failed to create mongodb index, try again";
-      sleep(1);
+
+  std::unique_ptr<UsernameIndex> username_index;
+  auto service_config = config_json["user-service"];
+  if (service_config.value("username_index", false)) {
+    username_index.reset(new UsernameIndex(
+        service_config.value("username_cache_size", 1000000),
+        service_config.value("username_bloom_false_positive_rate", 0.01)));
+    if (username_index->Build(mongodb_client_pool)) {
+      username_index->StartRefresh(
+          mongodb_client_pool,
+          service_config.value("username_refresh_ms", 1000));
+    } else {
+      LOG(error) << "Failed to build username index, looking up user_ids "
+                    "in memcached/MongoDB";
+      username_index.reset();
     }
   }
-  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+
+  std::unique_ptr<VerifiedTokenCache> token_cache;
+  int token_cache_size = service_config.value("token_cache_size", 0);
+  if (token_cache_size > 0) {
+    token_cache.reset(new VerifiedTokenCache(token_cache_size));
+  }
+
   std::shared_ptr<TServerSocket> server_socket = get_server_socket(config_json, "0.0.0.0", port);
 
   TThreadedServer server(
       std::make_shared<UserServiceProcessor>(std::make_shared<UserHandler>(
-          &thread_lock, machine_id, secret, memcached_client_pool,
-          mongodb_client_pool, &social_graph_client_pool)),
+          &id_generator, secret, memcached_client_pool,
+          mongodb_client_pool, &social_graph_client_pool,
+          token_cache.get(), username_index.get())),
       server_socket,
       std::make_shared<TFramedTransportFactory>(),
       std::make_shared<TBinaryProtocolFactory>());
@@ -0,0 +1,340 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_USERNAMEINDEX_H
+#define SOCIAL_NETWORK_MICROSERVICES_USERNAMEINDEX_H
+
+#include <bson/bson.h>
+#include <mongoc.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../logger.h"
+
+#define USERNAME_INDEX_LOG_INTERVAL 10000
+// Registrations are read back this far before the newest one seen, to cover
+// clock skew between the user-service instances that create the ObjectIds
+#define USERNAME_INDEX_REFRESH_OVERLAP_S 60
+
+namespace social_network {
+
+// Bloom filter over strings with k probes derived from two hashes
+class BloomFilter {
+ public:
+  BloomFilter(size_t capacity, double false_positive_rate) {
+    capacity = std::max<size_t>(capacity, 1);
+    double num_bits = -(double)capacity * std::log(false_positive_rate) /
+                      (std::log(2.0) * std::log(2.0));
+    _num_bits = std::max<uint64_t>(64, (uint64_t)num_bits);
+    _num_hashes = std::max<int>(
+        1, (int)std::round(_num_bits / (double)capacity * std::log(2.0)));
+    _bits.assign((_num_bits + 63) / 64, 0);
+  }
+
+  void Add(const std::string &key) {
+    uint64_t h1, h2;
+    _Hash(key, &h1, &h2);
+    for (int i = 0; i < _num_hashes; i++) {
+      uint64_t bit = (h1 + i * h2) % _num_bits;
+      _bits[bit / 64] |= 1ULL << (bit % 64);
+    }
+  }
+
+  bool MayContain(const std::string &key) const {
+    uint64_t h1, h2;
+    _Hash(key, &h1, &h2);
+    for (int i = 0; i < _num_hashes; i++) {
+      uint64_t bit = (h1 + i * h2) % _num_bits;
+      if (!(_bits[bit / 64] & (1ULL << (bit % 64)))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  size_t MemoryUsage() const { return _bits.size() * sizeof(uint64_t); }
+
+ private:
+  static void _Hash(const std::string &key, uint64_t *h1, uint64_t *h2) {
+    // splitmix64 finalizer, so that the second hash is independent enough
+    uint64_t z = std::hash<std::string>()(key);
+    *h1 = z;
+    z += 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    *h2 = (z ^ (z >> 31)) | 1;
+  }
+
+  uint64_t _num_bits;
+  int _num_hashes;
+  std::vector<uint64_t> _bits;
+};
+
+// In-process username -> user_id resolution for UserHandler::GetUserIds.
+//
+// Build() reads every registered username from the user collection into a
+// Bloom filter, and up to cache_capacity of them with their user_id into a
+// hash map. A username that fails the filter cannot belong to a
+// registered user and is dropped without asking memcached or MongoDB; a
+// cached one is answered from memory.
+//
+// Usernames are never deleted and never change user_id, so the index only
+// has to learn about new registrations: a background thread reads the users
+// whose ObjectId is newer than the last refresh every refresh interval. A
+// user registered since the last refresh is not found until the next.
+class UsernameIndex {
+ public:
+  UsernameIndex(size_t cache_capacity, double false_positive_rate);
+
+  bool Build(mongoc_client_pool_t *mongodb_client_pool);
+  bool Refresh(mongoc_client_pool_t *mongodb_client_pool);
+  void StartRefresh(mongoc_client_pool_t *mongodb_client_pool,
+                    int refresh_interval_ms);
+
+  // Return true and set *user_id if username is cached. Otherwise sets
+  // *known to whether username may belong to a registered user.
+  bool Lookup(const std::string &username, int64_t *user_id, bool *known);
+  void Insert(const std::string &username, int64_t user_id);
+
+  // Called once per GetUserIds that needed no MongoDB query only
+  // because the filter dropped its unknown usernames
+  void CountAvoidedMongoQuery();
+
+ private:
+  bool _ReadUsers(mongoc_client_pool_t *mongodb_client_pool,
+                  int64_t since_seconds,
+                  std::vector<std::pair<std::string, int64_t>> *users,
+                  int64_t *newest_seconds);
+  void _CountLookup();
+
+  size_t _cache_capacity;
+  double _false_positive_rate;
+
+  std::shared_timed_mutex _mutex;
+  std::unique_ptr<BloomFilter> _filter;
+  size_t _filter_capacity;
+  size_t _num_usernames;
+  std::unordered_map<std::string, int64_t> _cache;
+  int64_t _newest_seconds;
+
+  std::atomic<int64_t> _lookups{0};
+  std::atomic<int64_t> _hits{0};
+  std::atomic<int64_t> _rejected{0};
+  std::atomic<int64_t> _mongo_queries_avoided{0};
+};
+
+UsernameIndex::UsernameIndex(size_t cache_capacity,
+                             double false_positive_rate) {
+  _cache_capacity = cache_capacity;
+  _false_positive_rate = false_positive_rate;
+  _filter_capacity = 0;
+  _num_usernames = 0;
+  _newest_seconds = 0;
+}
+
+bool UsernameIndex::Build(mongoc_client_pool_t *mongodb_client_pool) {
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::pair<std::string, int64_t>> users;
+  int64_t newest_seconds = 0;
+  if (!_ReadUsers(mongodb_client_pool, -1, &users, &newest_seconds)) {
+    return false;
+  }
+
+  // Room to double before the false positive rate degrades
+  size_t filter_capacity = std::max<size_t>(users.size() * 2, 1024);
+  std::unique_ptr<BloomFilter> filter(
+      new BloomFilter(filter_capacity, _false_positive_rate));
+  std::unordered_map<std::string, int64_t> cache;
+  for (auto &user : users) {
+    filter->Add(user.first);
+    if (cache.size() < _cache_capacity) {
+      cache.emplace(user.first, user.second);
+    }
+  }
+  size_t filter_bytes = filter->MemoryUsage();
+  {
+    std::unique_lock<std::shared_timed_mutex> lock(_mutex);
+    _filter = std::move(filter);
+    _filter_capacity = filter_capacity;
+    _num_usernames = users.size();
+    _cache = std::move(cache);
+    _newest_seconds = newest_seconds;
+  }
+
+  auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+  LOG(info) << "Built username index: " << users.size() << " usernames, "
+            << filter_bytes << " bytes of Bloom filter in " << elapsed
+            << " ms";
+  return true;
+}
+
+bool UsernameIndex::Refresh(mongoc_client_pool_t *mongodb_client_pool) {
+  int64_t since_seconds;
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+    since_seconds = _newest_seconds - USERNAME_INDEX_REFRESH_OVERLAP_S;
+  }
+  std::vector<std::pair<std::string, int64_t>> users;
+  int64_t newest_seconds = since_seconds;
+  if (!_ReadUsers(mongodb_client_pool, since_seconds, &users,
+                  &newest_seconds)) {
+    return false;
+  }
+  if (users.empty()) {
+    return true;
+  }
+
+  bool full;
+  {
+    std::unique_lock<std::shared_timed_mutex> lock(_mutex);
+    for (auto &user : users) {
+      if (!_filter->MayContain(user.first)) {
+        _filter->Add(user.first);
+        _num_usernames++;
+      }
+      if (_cache.size() < _cache_capacity) {
+        _cache.emplace(user.first, user.second);
+      }
+    }
+    _newest_seconds = std::max(_newest_seconds, newest_seconds);
+    full = _num_usernames > _filter_capacity;
+  }
+  if (full) {
+    LOG(info) << "Username index outgrew its Bloom filter, rebuilding";
+    return Build(mongodb_client_pool);
+  }
+  return true;
+}
+
+void UsernameIndex::StartRefresh(mongoc_client_pool_t *mongodb_client_pool,
+                                 int refresh_interval_ms) {
+  std::thread([this, mongodb_client_pool, refresh_interval_ms]() {
+    while (true) {
+      std::this_thread::sleep_for(
+          std::chrono::milliseconds(refresh_interval_ms));
+      if (!Refresh(mongodb_client_pool)) {
+        LOG(warning) << "Failed to refresh username index";
+      }
+    }
+  }).detach();
+}
+
+bool UsernameIndex::Lookup(const std::string &username, int64_t *user_id,
+                           bool *known) {
+  _CountLookup();
+  std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+  auto it = _cache.find(username);
+  if (it != _cache.end()) {
+    *user_id = it->second;
+    *known = true;
+    ++_hits;
+    return true;
+  }
+  *known = _filter->MayContain(username);
+  if (!*known) {
+    ++_rejected;
+  }
+  return false;
+}
+
+void UsernameIndex::Insert(const std::string &username, int64_t user_id) {
+  std::unique_lock<std::shared_timed_mutex> lock(_mutex);
+  if (_cache.size() < _cache_capacity) {
+    _cache.emplace(username, user_id);
+  }
+}
+
+void UsernameIndex::CountAvoidedMongoQuery() { ++_mongo_queries_avoided; }
+
+void UsernameIndex::_CountLookup() {
+  int64_t lookups = ++_lookups;
+  if (lookups % USERNAME_INDEX_LOG_INTERVAL == 0) {
+    int64_t hits = _hits;
+    LOG(info) << "Username index: " << lookups << " lookups, hit rate "
+              << 100.0 * hits / lookups << "%, " << _rejected
+              << " unknown usernames rejected, " << _mongo_queries_avoided
+              << " MongoDB queries avoided";
+  }
+}
+
+bool UsernameIndex::_ReadUsers(
+    mongoc_client_pool_t *mongodb_client_pool, int64_t since_seconds,
+    std::vector<std::pair<std::string, int64_t>> *users,
+    int64_t *newest_seconds) {
+  mongoc_client_t *mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
+  if (!mongodb_client) {
+    LOG(error) << "Failed to pop a client from MongoDB pool";
+    return false;
+  }
+  auto collection =
+      mongoc_client_get_collection(mongodb_client, "user", "user");
+  if (!collection) {
+    LOG(error) << "Failed to create collection user from DB user";
+    mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+    return false;
+  }
+
+  bson_t *query = bson_new();
+  if (since_seconds >= 0) {
+    // The smallest ObjectId created at since_seconds
+    uint8_t oid_bytes[12] = {0};
+    oid_bytes[0] = (since_seconds >> 24) & 0xFF;
+    oid_bytes[1] = (since_seconds >> 16) & 0xFF;
+    oid_bytes[2] = (since_seconds >> 8) & 0xFF;
+    oid_bytes[3] = since_seconds & 0xFF;
+    bson_oid_t since_oid;
+    bson_oid_init_from_data(&since_oid, oid_bytes);
+    BCON_APPEND(query, "_id", "{", "$gte", BCON_OID(&since_oid), "}");
+  }
+  bson_t *opts = BCON_NEW("projection", "{", "_id", BCON_INT32(1), "username",
+                          BCON_INT32(1), "user_id", BCON_INT32(1), "}");
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+
+  const bson_t *doc;
+  while (mongoc_cursor_next(cursor, &doc)) {
+    bson_iter_t iter;
+    if (bson_iter_init_find(&iter, doc, "_id") && BSON_ITER_HOLDS_OID(&iter)) {
+      *newest_seconds = std::max<int64_t>(
+          *newest_seconds, bson_oid_get_time_t(bson_iter_oid(&iter)));
+    }
+    if (!bson_iter_init_find(&iter, doc, "username") ||
+        !BSON_ITER_HOLDS_UTF8(&iter)) {
+      continue;
+    }
+    std::string username = bson_iter_utf8(&iter, nullptr);
+    if (!bson_iter_init_find(&iter, doc, "user_id") ||
+        !BSON_ITER_HOLDS_INT64(&iter)) {
+      continue;
+    }
+    users->emplace_back(username, bson_iter_int64(&iter));
+  }
+
+  bson_error_t error;
+  bool ok = !mongoc_cursor_error(cursor, &error);
+  if (!ok) {
+    LOG(error) << "Failed to read usernames from MongoDB: " << error.message;
+  }
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_cursor_destroy(cursor);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+  return ok;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_USERNAMEINDEX_H
@@ -0,0 +1,233 @@
+// Converts user-timeline documents from the original single-array schema
+//   user-timeline.user-timeline: {user_id, posts: [{post_id, timestamp}, ...]}
+// to the bucketed schema used by UserTimelineService
+//   user-timeline.user-timeline-bucket:
+//     {user_id, bucket, seq, count, posts: [...]}
+//
+// The posts of a bucket are split into documents of bucket_max_posts posts
+// as GetUserTimelineSeqRange splits them. Documents are written with
+// upserting replaces keyed on (user_id, bucket, seq), so the tool can be
+// re-run safely. It should be run before user-timeline-service
+// starts taking writes on the bucketed schema, since a replace overwrites any
+// bucket the service has already written to.
+
+#include <signal.h>
+
+#include <boost/program_options.hpp>
+#include <map>
+#include <vector>
+
+#include "../MongoIndexes.h"
+#include "../logger.h"
+#include "../utils.h"
+#include "../utils_mongodb.h"
+#include "UserTimelineBucket.h"
+#include "UserTimelineHandler.h"
+
+#define USER_TIMELINE_LEGACY_COLLECTION "user-timeline"
+
+using namespace social_network;
+
+void sigintHandler(int sig) { exit(EXIT_SUCCESS); }
+
+struct TimelineEntry {
+  int64_t post_id;
+  int64_t timestamp;
+};
+
+// Groups one legacy document's posts into buckets, keeping newest-first order
+// inside each bucket.
+static bool ParseLegacyTimeline(
+    const bson_t *doc, int64_t bucket_window_ms, int64_t *user_id,
+    std::map<int64_t, std::vector<TimelineEntry>> *buckets) {
+  bson_iter_t iter;
+  bson_iter_t posts_child;
+  if (!bson_iter_init_find(&iter, doc, "user_id") ||
+      !BSON_ITER_HOLDS_INT64(&iter)) {
+    return false;
+  }
+  *user_id = bson_iter_int64(&iter);
+  if (!bson_iter_init_find(&iter, doc, "posts") ||
+      !BSON_ITER_HOLDS_ARRAY(&iter) ||
+      !bson_iter_recurse(&iter, &posts_child)) {
+    return true;
+  }
+  while (bson_iter_next(&posts_child)) {
+    bson_iter_t post_id_child;
+    bson_iter_t timestamp_child;
+    if (!BSON_ITER_HOLDS_DOCUMENT(&posts_child) ||
+        !bson_iter_recurse(&posts_child, &post_id_child) ||
+        !bson_iter_find(&post_id_child, "post_id") ||
+        !BSON_ITER_HOLDS_INT64(&post_id_child) ||
+        !bson_iter_recurse(&posts_child, &timestamp_child) ||
+        !bson_iter_find(&timestamp_child, "timestamp") ||
+        !BSON_ITER_HOLDS_INT64(&timestamp_child)) {
+      continue;
+    }
+    TimelineEntry entry{bson_iter_int64(&post_id_child),
+                        bson_iter_int64(&timestamp_child)};
+    (*buckets)[GetUserTimelineBucket(entry.timestamp, bucket_window_ms)]
+        .emplace_back(entry);
+  }
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  signal(SIGINT, sigintHandler);
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "config",
+      po::value<std::string>()->default_value("config/service-config.json"),
+      "Path to service-config.json")(
+      "batch-size", po::value<int>()->default_value(1000),
+      "Number of legacy documents converted per bulk write");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  json config_json;
+  if (load_config_file(vm["config"].as<std::string>(), &config_json) != 0) {
+    exit(EXIT_FAILURE);
+  }
+  int64_t bucket_window_ms = config_json["user-timeline-service"].value(
+      "bucket_window_ms", (int64_t)USER_TIMELINE_DEFAULT_BUCKET_WINDOW_MS);
+  int bucket_max_posts = config_json["user-timeline-service"].value(
+      "bucket_max_posts", USER_TIMELINE_DEFAULT_BUCKET_MAX_POSTS);
+  int batch_size = vm["batch-size"].as<int>();
+
+  auto mongodb_client_pool =
+      init_mongodb_client_pool(config_json, "user-timeline", 1);
+  if (mongodb_client_pool == nullptr) {
+    return EXIT_FAILURE;
+  }
+  mongoc_client_t *mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
+  if (!mongodb_client) {
+    LOG(fatal) << "Failed to pop mongoc client";
+    return EXIT_FAILURE;
+  }
+  if (!CreateIndexes(mongodb_client, UserTimelineHandler::IndexSpecs())) {
+    mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+    return EXIT_FAILURE;
+  }
+
+  auto legacy_collection = mongoc_client_get_collection(
+      mongodb_client, USER_TIMELINE_DB, USER_TIMELINE_LEGACY_COLLECTION);
+  auto bucket_collection = mongoc_client_get_collection(
+      mongodb_client, USER_TIMELINE_DB, USER_TIMELINE_BUCKET_COLLECTION);
+
+  bson_t *query = bson_new();
+  mongoc_cursor_t *cursor = mongoc_collection_find_with_opts(
+      legacy_collection, query, nullptr, nullptr);
+  bson_t *bulk_opts = BCON_NEW("ordered", BCON_BOOL(false));
+  bson_t *replace_opts = BCON_NEW("upsert", BCON_BOOL(true));
+
+  mongoc_bulk_operation_t *bulk = nullptr;
+  int pending_docs = 0;
+  int64_t users = 0;
+  int64_t posts = 0;
+  int64_t buckets_written = 0;
+  bool ok = true;
+  bson_error_t error;
+
+  auto flush = [&]() {
+    if (!bulk) {
+      return;
+    }
+    bson_t reply;
+    if (!mongoc_bulk_operation_execute(bulk, &reply, &error)) {
+      LOG(error) << "Failed to write user-timeline buckets: " << error.message;
+      ok = false;
+    }
+    bson_destroy(&reply);
+    mongoc_bulk_operation_destroy(bulk);
+    bulk = nullptr;
+    pending_docs = 0;
+  };
+
+  const bson_t *doc;
+  while (ok && mongoc_cursor_next(cursor, &doc)) {
+    int64_t user_id;
+    std::map<int64_t, std::vector<TimelineEntry>> buckets;
+    if (!ParseLegacyTimeline(doc, bucket_window_ms, &user_id, &buckets)) {
+      LOG(warning) << "Skipping user-timeline document without user_id";
+      continue;
+    }
+    if (!bulk) {
+      bulk = mongoc_collection_create_bulk_operation_with_opts(
+          bucket_collection, bulk_opts);
+    }
+    for (auto &bucket : buckets) {
+      auto &entries = bucket.second;
+      int64_t seqs =
+          GetUserTimelineBucketSeqs(entries.size(), bucket_max_posts);
+      for (int64_t seq = 0; seq < seqs; seq++) {
+        auto range =
+            GetUserTimelineSeqRange(entries.size(), seq, bucket_max_posts);
+        bson_t *selector =
+            BCON_NEW("user_id", BCON_INT64(user_id), "bucket",
+                     BCON_INT64(bucket.first), "seq", BCON_INT64(seq));
+        bson_t *replacement = bson_new();
+        bson_t posts_array;
+        BSON_APPEND_INT64(replacement, "user_id", user_id);
+        BSON_APPEND_INT64(replacement, "bucket", bucket.first);
+        BSON_APPEND_INT64(replacement, "seq", seq);
+        BSON_APPEND_INT32(replacement, "count", range.second - range.first);
+        BSON_APPEND_ARRAY_BEGIN(replacement, "posts", &posts_array);
+        int idx = 0;
+        for (size_t i = range.first; i < range.second; i++) {
+          bson_t post_doc;
+          std::string idx_str = std::to_string(idx++);
+          BSON_APPEND_DOCUMENT_BEGIN(&posts_array, idx_str.c_str(), &post_doc);
+          BSON_APPEND_INT64(&post_doc, "post_id", entries[i].post_id);
+          BSON_APPEND_INT64(&post_doc, "timestamp", entries[i].timestamp);
+          bson_append_document_end(&posts_array, &post_doc);
+        }
+        bson_append_array_end(replacement, &posts_array);
+
+        if (!mongoc_bulk_operation_replace_one_with_opts(
+                bulk, selector, replacement, replace_opts, &error)) {
+          LOG(error) << "Failed to queue bucket " << bucket.first << " of user "
+                     << user_id << ": " << error.message;
+          ok = false;
+        }
+        bson_destroy(replacement);
+        bson_destroy(selector);
+        buckets_written++;
+      }
+      posts += entries.size();
+    }
+    users++;
+    if (++pending_docs >= batch_size) {
+      flush();
+      LOG(info) << "Migrated " << users << " user timelines";
+    }
+  }
+  if (ok && mongoc_cursor_error(cursor, &error)) {
+    LOG(error) << "Failed to read legacy user-timeline: " << error.message;
+    ok = false;
+  }
+  flush();
+
+  LOG(info) << "Migrated " << users << " user timelines, " << posts
+            << " posts into " << buckets_written << " buckets";
+
+  bson_destroy(replace_opts);
+  bson_destroy(bulk_opts);
+  bson_destroy(query);
+  mongoc_cursor_destroy(cursor);
+  mongoc_collection_destroy(bucket_collection);
+  mongoc_collection_destroy(legacy_collection);
+  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+  mongoc_client_pool_destroy(mongodb_client_pool);
+  mongoc_cleanup();
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
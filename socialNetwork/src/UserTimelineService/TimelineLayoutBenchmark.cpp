@@ -0,0 +1,209 @@
+// Memory and read latency of the two timeline layouts, "zset" and "packed"
+// (see PackedTimeline.h), on the user-timeline Redis in --config.
+//
+// For each layout, --users timelines are written --posts-per-user rounds of
+// one post per user, the way WriteUserTimeline writes them (ZADD NX, or the
+// append script), in pipelines of --batch commands. Reports
+//   memory   growth of used_memory, in total and per user
+//   read     latency of --reads ReadUserTimeline style reads of the newest
+//            --page posts of uniformly drawn users, decoding included
+// ZSETs of up to zset-max-listpack-entries (128 by default) members are
+// stored as listpacks, so run it below and above that length. Keys are
+// "timeline-bench:<i>" and "{timeline-bench:<i>}:packed" and are deleted at
+// the end unless --keep is given. Standalone Redis only.
+
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../PackedTimeline.h"
+#include "../logger.h"
+#include "../utils.h"
+#include "../utils_redis.h"
+
+using namespace social_network;
+
+static int64_t UsedMemory(Redis *redis) {
+  std::string info = redis->info("memory");
+  std::string field = "used_memory:";
+  auto pos = info.find(field);
+  if (pos == std::string::npos) {
+    return -1;
+  }
+  return std::stoll(info.substr(pos + field.size()));
+}
+
+static int64_t ElapsedNs(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+static int64_t Percentile(std::vector<int64_t> *latencies, double p) {
+  if (latencies->empty()) {
+    return 0;
+  }
+  size_t idx = std::min(latencies->size() - 1,
+                        (size_t)(p / 100.0 * latencies->size()));
+  std::nth_element(latencies->begin(), latencies->begin() + idx,
+                   latencies->end());
+  return (*latencies)[idx];
+}
+
+static std::string ZsetKey(int64_t user) {
+  return "timeline-bench:" + std::to_string(user);
+}
+
+static std::string PackedKey(int64_t user) {
+  return "{timeline-bench:" + std::to_string(user) + "}:packed";
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "config",
+      po::value<std::string>()->default_value("config/service-config.json"),
+      "Service config holding the user-timeline-redis address")(
+      "users", po::value<int>()->default_value(1000000),
+      "Number of timelines per layout")(
+      "posts-per-user", po::value<int>()->default_value(10),
+      "Posts written to each timeline")(
+      "max-records", po::value<int>()->default_value(
+                         PACKED_TIMELINE_DEFAULT_MAX_RECORDS),
+      "timeline_max_records of the packed layout")(
+      "reads", po::value<int>()->default_value(100000),
+      "Number of timeline reads per layout")(
+      "page", po::value<int>()->default_value(10), "Posts per read")(
+      "batch", po::value<int>()->default_value(1000),
+      "Commands per pipeline")(
+      "keep", po::bool_switch()->default_value(false),
+      "Leave the benchmark keys in Redis")(
+      "seed", po::value<int>()->default_value(1), "Random seed");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  int num_users = vm["users"].as<int>();
+  int posts_per_user = vm["posts-per-user"].as<int>();
+  int max_records = vm["max-records"].as<int>();
+  int num_reads = vm["reads"].as<int>();
+  int page = vm["page"].as<int>();
+  int batch = vm["batch"].as<int>();
+  if (num_users < 1 || posts_per_user < 1 || max_records < 1 ||
+      num_reads < 1 || page < 1 || batch < 1) {
+    LOG(error) << "--users, --posts-per-user, --max-records, --reads, --page "
+                  "and --batch must be positive";
+    return EXIT_FAILURE;
+  }
+
+  json config_json;
+  if (load_config_file(vm["config"].as<std::string>(), &config_json) != 0) {
+    return EXIT_FAILURE;
+  }
+  Redis redis = init_redis_client_pool(config_json, "user-timeline");
+
+  std::string packed_cap =
+      std::to_string(max_records * sizeof(PackedTimelineRecord));
+  std::mt19937_64 gen(vm["seed"].as<int>());
+  std::uniform_int_distribution<int64_t> any_user(0, num_users - 1);
+  int64_t base_timestamp =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count();
+
+  for (bool packed : {false, true}) {
+    const char *layout = packed ? "packed" : "zset";
+    try {
+      int64_t memory_before = UsedMemory(&redis);
+      auto start = std::chrono::steady_clock::now();
+      auto pipe = redis.pipeline(false);
+      size_t queued = 0;
+      for (int p = 0; p < posts_per_user; p++) {
+        int64_t timestamp = base_timestamp + p;
+        for (int64_t user = 0; user < num_users; user++) {
+          // Unique ids are 63-bit, so members are as long as real ones
+          int64_t post_id = (int64_t)(gen() >> 1);
+          if (packed) {
+            pipe.eval(PACKED_TIMELINE_APPEND_SCRIPT, {PackedKey(user)},
+                      {EncodePackedTimelineRecord(timestamp, post_id),
+                       packed_cap});
+          } else {
+            pipe.zadd(ZsetKey(user), std::to_string(post_id), timestamp,
+                      UpdateType::NOT_EXIST);
+          }
+          if (++queued == (size_t)batch) {
+            pipe.exec();
+            queued = 0;
+          }
+        }
+      }
+      if (queued > 0) {
+        pipe.exec();
+      }
+      double write_s = ElapsedNs(start) / 1e9;
+      int64_t memory = UsedMemory(&redis) - memory_before;
+      LOG(info) << layout << " memory: " << num_users << " users x "
+                << posts_per_user << " posts written in " << write_s
+                << " s, used_memory +" << memory << " bytes, "
+                << (double)memory / num_users << " per user";
+
+      std::vector<int64_t> latencies;
+      latencies.reserve(num_reads);
+      size_t total = 0;
+      for (int i = 0; i < num_reads; i++) {
+        int64_t user = any_user(gen);
+        std::vector<int64_t> post_ids;
+        auto call_start = std::chrono::steady_clock::now();
+        if (packed) {
+          DecodePackedTimeline(
+              ReadPackedTimelineRange(&redis, PackedKey(user), 0, page),
+              &post_ids);
+        } else {
+          std::vector<std::string> post_ids_str;
+          redis.zrevrange(ZsetKey(user), 0, page - 1,
+                          std::back_inserter(post_ids_str));
+          for (auto const &post_id_str : post_ids_str) {
+            post_ids.emplace_back(std::stoul(post_id_str));
+          }
+        }
+        latencies.emplace_back(ElapsedNs(call_start));
+        total += post_ids.size();
+      }
+      LOG(info) << layout << " read: " << num_reads << " reads, "
+                << (double)total / num_reads << " posts each, p50 "
+                << Percentile(&latencies, 50) / 1000.0 << " us, p99 "
+                << Percentile(&latencies, 99) / 1000.0 << " us";
+
+      if (!vm["keep"].as<bool>()) {
+        queued = 0;
+        for (int64_t user = 0; user < num_users; user++) {
+          pipe.del(packed ? PackedKey(user) : ZsetKey(user));
+          if (++queued == (size_t)batch) {
+            pipe.exec();
+            queued = 0;
+          }
+        }
+        if (queued > 0) {
+          pipe.exec();
+        }
+      }
+    } catch (const Error &err) {
+      LOG(error) << layout << ": " << err.what();
+      return EXIT_FAILURE;
+    }
+  }
+  return 0;
+}
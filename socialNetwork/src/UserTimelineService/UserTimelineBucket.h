@@ -0,0 +1,50 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_USERTIMELINESERVICE_USERTIMELINEBUCKET_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_USERTIMELINESERVICE_USERTIMELINEBUCKET_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// User timelines are stored as documents of at most about max_posts posts
+// per user per time window:
+//   {user_id, bucket, seq, count, posts: [{post_id, timestamp}, ...]}
+// where bucket = timestamp / bucket_window_ms, posts are newest first, and
+// seq numbers the documents of a bucket from 0, the newest being the highest.
+// A write pushes onto the newest document of its bucket while that holds
+// fewer than max_posts posts, and opens seq + 1 otherwise, so a document
+// holds at most 2 * max_posts - 1 posts as long as no write pushes more than
+// max_posts at once. Reads walk documents by (bucket, seq) from the newest
+// one until the range is covered.
+#define USER_TIMELINE_DB "user-timeline"
+#define USER_TIMELINE_BUCKET_COLLECTION "user-timeline-bucket"
+#define USER_TIMELINE_DEFAULT_BUCKET_WINDOW_MS 86400000
+#define USER_TIMELINE_DEFAULT_BUCKET_MAX_POSTS 1000
+
+namespace social_network {
+
+inline int64_t GetUserTimelineBucket(int64_t timestamp,
+                                     int64_t bucket_window_ms) {
+  return timestamp / bucket_window_ms;
+}
+
+// For writers that know all num_posts posts of a bucket up front, such as
+// the migration and the bulk loader: the number of documents they fill, and
+// the [first, last) range of the newest-first posts that document seq holds.
+// Documents are filled from the oldest posts, so only the newest one is
+// partly full and the service keeps pushing onto it.
+inline int64_t GetUserTimelineBucketSeqs(size_t num_posts, int max_posts) {
+  return (num_posts + max_posts - 1) / max_posts;
+}
+
+inline std::pair<size_t, size_t> GetUserTimelineSeqRange(size_t num_posts,
+                                                         int64_t seq,
+                                                         int max_posts) {
+  size_t oldest_end = num_posts - seq * max_posts;
+  size_t newest_begin =
+      oldest_end > (size_t)max_posts ? oldest_end - max_posts : 0;
+  return {newest_begin, oldest_end};
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SRC_USERTIMELINESERVICE_USERTIMELINEBUCKET_H_
@@ -5,16 +5,29 @@
 #include <mongoc.h>
 #include <sw/redis++/redis++.h>
 
+#include <algorithm>
 #include <future>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "../../gen-cpp/PostStorageService.h"
 #include "../../gen-cpp/UserTimelineService.h"
 #include "../ClientPool.h"
+#include "../MongoIndexes.h"
+#include "../PackedTimeline.h"
+#include "../PostFields.h"
 #include "../ThriftClient.h"
 #include "../logger.h"
 #include "../tracing.h"
+#include "UserTimelineBucket.h"
+
+// Users whose open bucket document is remembered, see _SetOpenSeq
+#define USER_TIMELINE_OPEN_SEQS_CACHE_SIZE 1000000
 
 using namespace sw::redis;
 
@@ -23,41 +36,114 @@ namespace social_network {
 class UserTimelineHandler : public UserTimelineServiceIf {
  public:
   UserTimelineHandler(Redis *, mongoc_client_pool_t *,
-                      ClientPool<ThriftClient<PostStorageServiceClient>> *);
+                      ClientPool<ThriftClient<PostStorageServiceClient>> *,
+                      bool packed_timeline = false,
+                      int packed_timeline_max_records =
+                          PACKED_TIMELINE_DEFAULT_MAX_RECORDS,
+                      int64_t bucket_window_ms =
+                          USER_TIMELINE_DEFAULT_BUCKET_WINDOW_MS,
+                      int bucket_max_posts =
+                          USER_TIMELINE_DEFAULT_BUCKET_MAX_POSTS);
   UserTimelineHandler(RedisCluster *, mongoc_client_pool_t *,
-                      ClientPool<ThriftClient<PostStorageServiceClient>> *);
+                      ClientPool<ThriftClient<PostStorageServiceClient>> *,
+                      bool packed_timeline = false,
+                      int packed_timeline_max_records =
+                          PACKED_TIMELINE_DEFAULT_MAX_RECORDS,
+                      int64_t bucket_window_ms =
+                          USER_TIMELINE_DEFAULT_BUCKET_WINDOW_MS,
+                      int bucket_max_posts =
+                          USER_TIMELINE_DEFAULT_BUCKET_MAX_POSTS);
   ~UserTimelineHandler() override = default;
 
   void WriteUserTimeline(
       int64_t req_id, int64_t post_id, int64_t user_id, int64_t timestamp,
       const std::map<std::string, std::string> &carrier) override;
 
+  void WriteUserTimelines(
+      int64_t req_id, const std::vector<int64_t> &post_ids,
+      const std::vector<int64_t> &user_ids,
+      const std::vector<int64_t> &timestamps,
+      const std::map<std::string, std::string> &carrier) override;
+
   void ReadUserTimeline(std::vector<Post> &, int64_t, int64_t, int, int,
-                        const std::map<std::string, std::string> &) override;
+                        const std::map<std::string, std::string> &,
+                        int32_t) override;
+
+  // MongoDB indexes this handler's queries rely on, and sample queries of
+  // each shape it issues, for SetUpMongoIndexes
+  static std::vector<MongoIndexSpec> IndexSpecs();
+  static std::vector<MongoQueryShape> QueryShapes();
 
  private:
   Redis *_redis_client_pool;
   RedisCluster *_redis_cluster_client_pool;
   mongoc_client_pool_t *_mongodb_client_pool;
   ClientPool<ThriftClient<PostStorageServiceClient>> *_post_client_pool;
+  bool _packed_timeline;
+  int _packed_timeline_max_records;
+  int64_t _bucket_window_ms;
+  int _bucket_max_posts;
+  // The (bucket, seq) last written for each user, so that writes to the
+  // current bucket need no lookup of its newest document
+  std::mutex _open_seqs_mutex;
+  std::unordered_map<int64_t, std::pair<int64_t, int64_t>> _open_seqs;
+
+  // The update pushing the records in [first, last), newest first, onto the
+  // front of a bucket
+  static bson_t *_NewBucketUpdate(const PackedTimelineRecord *first,
+                                  const PackedTimelineRecord *last);
+  // Indexes of the operations an unordered bulk write rejected, from the
+  // "writeErrors" of its reply
+  static std::vector<int64_t> _RejectedWrites(const bson_t *reply);
+  // The seq of the newest document of (user_id, bucket), 0 if it has none
+  int64_t _OpenSeq(mongoc_collection_t *collection, int64_t user_id,
+                   int64_t bucket);
+  void _SetOpenSeq(int64_t user_id, int64_t bucket, int64_t seq);
+  // Applies update to document seq of (user_id, bucket), creating it if
+  // needed, or to the first one after it with room when it is full. Returns
+  // the seq written, or -1 with *error set.
+  int64_t _PushToBucket(mongoc_collection_t *collection, int64_t user_id,
+                        int64_t bucket, int64_t seq, const bson_t *update,
+                        bson_error_t *error);
+  // The filters and sorts of the bucket writes and of the timeline read,
+  // also used by QueryShapes, to be destroyed by the caller.
+  // _NewBucketQuery matches document seq while it has room for more posts.
+  static bson_t *_NewBucketQuery(int64_t user_id, int64_t bucket,
+                                 int64_t seq, int max_posts);
+  static bson_t *_NewBucketSeqQuery(int64_t user_id, int64_t bucket);
+  static bson_t *_NewBucketSeqSort();
+  static bson_t *_NewTimelineQuery(int64_t user_id);
+  static bson_t *_NewTimelineSort();
 };
 
 UserTimelineHandler::UserTimelineHandler(
     Redis *redis_pool, mongoc_client_pool_t *mongodb_pool,
-    ClientPool<ThriftClient<PostStorageServiceClient>> *post_client_pool) {
+    ClientPool<ThriftClient<PostStorageServiceClient>> *post_client_pool,
+    bool packed_timeline, int packed_timeline_max_records,
+    int64_t bucket_window_ms, int bucket_max_posts) {
   _redis_client_pool = redis_pool;
   _redis_cluster_client_pool = nullptr;
   _mongodb_client_pool = mongodb_pool;
   _post_client_pool = post_client_pool;
+  _packed_timeline = packed_timeline;
+  _packed_timeline_max_records = packed_timeline_max_records;
+  _bucket_window_ms = bucket_window_ms;
+  _bucket_max_posts = bucket_max_posts;
 }
 
 UserTimelineHandler::UserTimelineHandler(
     RedisCluster *redis_pool, mongoc_client_pool_t *mongodb_pool,
-    ClientPool<ThriftClient<PostStorageServiceClient>> *post_client_pool) {
+    ClientPool<ThriftClient<PostStorageServiceClient>> *post_client_pool,
+    bool packed_timeline, int packed_timeline_max_records,
+    int64_t bucket_window_ms, int bucket_max_posts) {
   _redis_cluster_client_pool = redis_pool;
   _redis_client_pool = nullptr;
   _mongodb_client_pool = mongodb_pool;
   _post_client_pool = post_client_pool;
+  _packed_timeline = packed_timeline;
+  _packed_timeline_max_records = packed_timeline_max_records;
+  _bucket_window_ms = bucket_window_ms;
+  _bucket_max_posts = bucket_max_posts;
 }
 
 void UserTimelineHandler::WriteUserTimeline(
@@ -81,7 +167,7 @@ void UserTimelineHandler::WriteUserTimeline(
     throw se;
   }
   auto collection = mongoc_client_get_collection(
-      mongodb_client, "user-timeline", "user-timeline");
+      mongodb_client, USER_TIMELINE_DB, USER_TIMELINE_BUCKET_COLLECTION);
   if (!collection) {
     ServiceException se;
     se.errorCode = ErrorCode::SE_MONGODB_ERROR;
@@ -89,46 +175,35 @@ void UserTimelineHandler::WriteUserTimeline(
     mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
     throw se;
   }
-  bson_t *query = bson_new();
-
-  BSON_APPEND_INT64(query, "user_id", user_id);
+  int64_t bucket = GetUserTimelineBucket(timestamp, _bucket_window_ms);
   bson_t *update =
       BCON_NEW("$push", "{", "posts", "{", "$each", "[", "{", "post_id",
                BCON_INT64(post_id), "timestamp", BCON_INT64(timestamp), "}",
-               "]", "$position", BCON_INT32(0), "}", "}");
+               "]", "$position", BCON_INT32(0), "}", "}",
+               "$inc", "{", "count", BCON_INT32(1), "}");
   bson_error_t error;
-  bson_t reply;
   auto update_span = opentracing::Tracer::Global()->StartSpan(
       "write_user_timeline_mongo_insert_client",
       {opentracing::ChildOf(&span->context())});
-  bool updated = mongoc_collection_find_and_modify(collection, query, nullptr,
-                                                   update, nullptr, false, true,
-                                                   true, &reply, &error);
+  int64_t seq = _PushToBucket(collection, user_id, bucket,
+                              _OpenSeq(collection, user_id, bucket), update,
+                              &error);
   update_span->Finish();
 
-  if (!updated) {
-    // update the newly inserted document (upsert: false)
-    updated = mongoc_collection_find_and_modify(collection, query, nullptr,
-                                                update, nullptr, false, false,
-                                                true, &reply, &error);
-    if (!updated) {
-      LOG(error) << "Failed to update user-timeline for user " << user_id
-                 << " to MongoDB: " << error.message;
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-      se.message = error.message;
-      bson_destroy(update);
-      bson_destroy(query);
-      bson_destroy(&reply);
-      mongoc_collection_destroy(collection);
-      mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-      throw se;
-    }
+  if (seq < 0) {
+    LOG(error) << "Failed to update user-timeline for user " << user_id
+               << " to MongoDB: " << error.message;
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = error.message;
+    bson_destroy(update);
+    mongoc_collection_destroy(collection);
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
   }
+  _SetOpenSeq(user_id, bucket, seq);
 
   bson_destroy(update);
-  bson_destroy(&reply);
-  bson_destroy(query);
   mongoc_collection_destroy(collection);
   mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
 
@@ -137,7 +212,20 @@ void UserTimelineHandler::WriteUserTimeline(
       "write_user_timeline_redis_update_client",
       {opentracing::ChildOf(&span->context())});
   try {
-    if (_redis_client_pool)
+    if (_packed_timeline) {
+      std::string packed_record =
+          EncodePackedTimelineRecord(timestamp, post_id);
+      std::string packed_cap = std::to_string(_packed_timeline_max_records *
+                                              sizeof(PackedTimelineRecord));
+      if (_redis_client_pool)
+        _redis_client_pool->eval<long long>(PACKED_TIMELINE_APPEND_SCRIPT,
+                                            {PackedTimelineKey(user_id)},
+                                            {packed_record, packed_cap});
+      else
+        _redis_cluster_client_pool->eval<long long>(
+            PACKED_TIMELINE_APPEND_SCRIPT, {PackedTimelineKey(user_id)},
+            {packed_record, packed_cap});
+    } else if (_redis_client_pool)
       _redis_client_pool->zadd(std::to_string(user_id), std::to_string(post_id),
                               timestamp, UpdateType::NOT_EXIST);
     else
@@ -152,9 +240,276 @@ void UserTimelineHandler::WriteUserTimeline(
   span->Finish();
 }
 
+bson_t *UserTimelineHandler::_NewBucketUpdate(
+    const PackedTimelineRecord *first, const PackedTimelineRecord *last) {
+  bson_t *update = bson_new();
+  bson_t push_doc;
+  bson_t posts_doc;
+  bson_t post_list;
+  BSON_APPEND_DOCUMENT_BEGIN(update, "$push", &push_doc);
+  BSON_APPEND_DOCUMENT_BEGIN(&push_doc, "posts", &posts_doc);
+  BSON_APPEND_ARRAY_BEGIN(&posts_doc, "$each", &post_list);
+  const char *key;
+  char buf[16];
+  uint32_t idx = 0;
+  for (auto *record = first; record != last; ++record) {
+    bson_uint32_to_string(idx++, &key, buf, sizeof buf);
+    bson_t post_doc;
+    BSON_APPEND_DOCUMENT_BEGIN(&post_list, key, &post_doc);
+    BSON_APPEND_INT64(&post_doc, "post_id", record->post_id);
+    BSON_APPEND_INT64(&post_doc, "timestamp", record->timestamp);
+    bson_append_document_end(&post_list, &post_doc);
+  }
+  bson_append_array_end(&posts_doc, &post_list);
+  BSON_APPEND_INT32(&posts_doc, "$position", 0);
+  bson_append_document_end(&push_doc, &posts_doc);
+  bson_append_document_end(update, &push_doc);
+
+  bson_t inc_doc;
+  BSON_APPEND_DOCUMENT_BEGIN(update, "$inc", &inc_doc);
+  BSON_APPEND_INT32(&inc_doc, "count", (int32_t)(last - first));
+  bson_append_document_end(update, &inc_doc);
+  return update;
+}
+
+std::vector<int64_t> UserTimelineHandler::_RejectedWrites(
+    const bson_t *reply) {
+  std::vector<int64_t> rejected;
+  bson_iter_t iter;
+  bson_iter_t iter_errors;
+  if (!bson_iter_init_find(&iter, reply, "writeErrors") ||
+      !BSON_ITER_HOLDS_ARRAY(&iter) ||
+      !bson_iter_recurse(&iter, &iter_errors)) {
+    return rejected;
+  }
+  while (bson_iter_next(&iter_errors)) {
+    bson_iter_t iter_error;
+    if (BSON_ITER_HOLDS_DOCUMENT(&iter_errors) &&
+        bson_iter_recurse(&iter_errors, &iter_error) &&
+        bson_iter_find(&iter_error, "index")) {
+      rejected.emplace_back(bson_iter_as_int64(&iter_error));
+    }
+  }
+  return rejected;
+}
+
+// WriteUserTimeline of many posts at once: the posts of each user and
+// bucket are pushed with one update per bucket_max_posts of them, the
+// oldest onto the bucket's newest document and the others onto the
+// documents after it, all of them in one unordered bulk write. The posts of
+// each user go to Redis with one command.
+void UserTimelineHandler::WriteUserTimelines(
+    int64_t req_id, const std::vector<int64_t> &post_ids,
+    const std::vector<int64_t> &user_ids,
+    const std::vector<int64_t> &timestamps,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "write_user_timelines_server",
+      {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  if (user_ids.size() != post_ids.size() ||
+      timestamps.size() != post_ids.size()) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message =
+        "The lengths of post_ids, user_ids and timestamps are not equal";
+    throw se;
+  }
+  if (post_ids.empty()) {
+    span->Finish();
+    return;
+  }
+
+  // The posts of each user, newest first, so that those of a bucket are
+  // adjacent and in the order the bucket keeps them
+  std::map<int64_t, std::vector<PackedTimelineRecord>> user_posts;
+  for (size_t i = 0; i < post_ids.size(); i++) {
+    user_posts[user_ids[i]].push_back({timestamps[i], post_ids[i]});
+  }
+  for (auto &user : user_posts) {
+    std::stable_sort(user.second.begin(), user.second.end(),
+                     [](const PackedTimelineRecord &a,
+                        const PackedTimelineRecord &b) {
+                       return a.timestamp > b.timestamp;
+                     });
+  }
+
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(_mongodb_client_pool);
+  if (!mongodb_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    throw se;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, USER_TIMELINE_DB, USER_TIMELINE_BUCKET_COLLECTION);
+  if (!collection) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to create collection user-timeline from MongoDB";
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
+
+  // One update per user, bucket and document, in the order of the bulk
+  // write. The posts of a bucket are split as GetUserTimelineSeqRange
+  // splits them: the oldest onto its newest document, the newer ones onto
+  // the documents after it.
+  struct BucketWrite {
+    int64_t user_id;
+    int64_t bucket;
+    int64_t seq;
+    bson_t *update;
+  };
+  std::vector<BucketWrite> writes;
+  bson_t *bulk_opts = BCON_NEW("ordered", BCON_BOOL(false));
+  bson_t *upsert_opts = BCON_NEW("upsert", BCON_BOOL(true));
+  mongoc_bulk_operation_t *bulk =
+      mongoc_collection_create_bulk_operation_with_opts(collection, bulk_opts);
+  for (auto &user : user_posts) {
+    auto &records = user.second;
+    size_t first = 0;
+    while (first < records.size()) {
+      int64_t bucket =
+          GetUserTimelineBucket(records[first].timestamp, _bucket_window_ms);
+      size_t last = first + 1;
+      while (last < records.size() &&
+             GetUserTimelineBucket(records[last].timestamp,
+                                   _bucket_window_ms) == bucket) {
+        last++;
+      }
+      int64_t open_seq = _OpenSeq(collection, user.first, bucket);
+      int64_t seqs = GetUserTimelineBucketSeqs(last - first, _bucket_max_posts);
+      for (int64_t i = 0; i < seqs; i++) {
+        auto range =
+            GetUserTimelineSeqRange(last - first, i, _bucket_max_posts);
+        bson_t *query = _NewBucketQuery(user.first, bucket, open_seq + i,
+                                        _bucket_max_posts);
+        auto *bucket_records = records.data() + first;
+        bson_t *update = _NewBucketUpdate(bucket_records + range.first,
+                                          bucket_records + range.second);
+        mongoc_bulk_operation_update_one_with_opts(bulk, query, update,
+                                                   upsert_opts, nullptr);
+        bson_destroy(query);
+        writes.push_back({user.first, bucket, open_seq + i, update});
+      }
+      first = last;
+    }
+  }
+
+  bson_t reply;
+  bson_error_t error;
+  auto update_span = opentracing::Tracer::Global()->StartSpan(
+      "write_user_timelines_mongo_bulk_update_client",
+      {opentracing::ChildOf(&span->context())});
+  bool updated = mongoc_bulk_operation_execute(bulk, &reply, &error);
+  update_span->Finish();
+  if (!updated) {
+    // The document an update was meant for was full, or a concurrent upsert
+    // created it first; write those updates one by one, as
+    // WriteUserTimeline does
+    auto rejected = _RejectedWrites(&reply);
+    updated = !rejected.empty();
+    for (auto index : rejected) {
+      if (index < 0 || (size_t)index >= writes.size()) {
+        updated = false;
+        break;
+      }
+      auto &write = writes[index];
+      write.seq = _PushToBucket(collection, write.user_id, write.bucket,
+                                write.seq, write.update, &error);
+      if (write.seq < 0) {
+        updated = false;
+        break;
+      }
+    }
+  }
+  bson_destroy(&reply);
+  if (updated) {
+    // The newest (bucket, seq) written for each user
+    std::map<int64_t, std::pair<int64_t, int64_t>> open_seqs;
+    for (auto &write : writes) {
+      auto open = open_seqs.emplace(
+          write.user_id, std::make_pair(write.bucket, write.seq));
+      open.first->second = std::max(open.first->second,
+                                    std::make_pair(write.bucket, write.seq));
+    }
+    for (auto &open : open_seqs) {
+      _SetOpenSeq(open.first, open.second.first, open.second.second);
+    }
+  }
+  for (auto &write : writes) {
+    bson_destroy(write.update);
+  }
+  mongoc_bulk_operation_destroy(bulk);
+  bson_destroy(upsert_opts);
+  bson_destroy(bulk_opts);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+  if (!updated) {
+    LOG(error) << "Failed to update user-timelines of " << user_posts.size()
+               << " users to MongoDB: " << error.message;
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = error.message;
+    throw se;
+  }
+
+  auto redis_span = opentracing::Tracer::Global()->StartSpan(
+      "write_user_timelines_redis_update_client",
+      {opentracing::ChildOf(&span->context())});
+  std::string packed_cap = std::to_string(_packed_timeline_max_records *
+                                          sizeof(PackedTimelineRecord));
+  try {
+    for (auto &user : user_posts) {
+      auto &records = user.second;
+      if (_packed_timeline) {
+        std::string key = PackedTimelineKey(user.first);
+        std::string packed_records = EncodePackedTimeline(records);
+        if (_redis_client_pool)
+          _redis_client_pool->eval<long long>(PACKED_TIMELINE_APPEND_SCRIPT,
+                                              {key},
+                                              {packed_records, packed_cap});
+        else
+          _redis_cluster_client_pool->eval<long long>(
+              PACKED_TIMELINE_APPEND_SCRIPT, {key},
+              {packed_records, packed_cap});
+        continue;
+      }
+      std::vector<std::pair<std::string, double>> members;
+      members.reserve(records.size());
+      for (auto &record : records) {
+        members.emplace_back(std::to_string(record.post_id),
+                             record.timestamp);
+      }
+      if (_redis_client_pool)
+        _redis_client_pool->zadd(std::to_string(user.first), members.begin(),
+                                 members.end(), UpdateType::NOT_EXIST);
+      else
+        _redis_cluster_client_pool->zadd(std::to_string(user.first),
+                                         members.begin(), members.end(),
+                                         UpdateType::NOT_EXIST);
+    }
+  } catch (const Error &err) {
+    LOG(error) << err.what();
+    throw err;
+  }
+  redis_span->Finish();
+  span->Finish();
+}
+
 void UserTimelineHandler::ReadUserTimeline(
     std::vector<Post> &_return, int64_t req_id, int64_t user_id, int start,
-    int stop, const std::map<std::string, std::string> &carrier) {
+    int stop, const std::map<std::string, std::string> &carrier,
+    int32_t fields) {
+  fields &= POST_FIELDS_ALL;
   // Initialize a span
   TextMapReader reader(carrier);
   std::map<std::string, std::string> writer_text_map;
@@ -173,8 +528,17 @@ void UserTimelineHandler::ReadUserTimeline(
       {opentracing::ChildOf(&span->context())});
 
   std::vector<std::string> post_ids_str;
+  std::string packed_timeline;
   try {
-    if (_redis_client_pool)
+    if (_packed_timeline) {
+      if (_redis_client_pool)
+        packed_timeline = ReadPackedTimelineRange(
+            _redis_client_pool, PackedTimelineKey(user_id), start, stop);
+      else
+        packed_timeline = ReadPackedTimelineRange(
+            _redis_cluster_client_pool, PackedTimelineKey(user_id), start,
+            stop);
+    } else if (_redis_client_pool)
       _redis_client_pool->zrevrange(std::to_string(user_id), start, stop - 1,
                                   std::back_inserter(post_ids_str));
     else
@@ -187,13 +551,18 @@ void UserTimelineHandler::ReadUserTimeline(
   redis_span->Finish();
 
   std::vector<int64_t> post_ids;
-  for (auto &post_id_str : post_ids_str) {
-    post_ids.emplace_back(std::stoul(post_id_str));
+  if (_packed_timeline) {
+    DecodePackedTimeline(packed_timeline, &post_ids);
+  } else {
+    for (auto &post_id_str : post_ids_str) {
+      post_ids.emplace_back(std::stoul(post_id_str));
+    }
   }
 
   // find in mongodb
   int mongo_start = start + post_ids.size();
   std::unordered_map<std::string, double> redis_update_map;
+  std::vector<PackedTimelineRecord> packed_update_records;
   if (mongo_start < stop) {
     // Instead find post_ids from mongodb
     mongoc_client_t *mongodb_client =
@@ -205,43 +574,54 @@ void UserTimelineHandler::ReadUserTimeline(
       throw se;
     }
     auto collection = mongoc_client_get_collection(
-        mongodb_client, "user-timeline", "user-timeline");
+        mongodb_client, USER_TIMELINE_DB, USER_TIMELINE_BUCKET_COLLECTION);
     if (!collection) {
       ServiceException se;
       se.errorCode = ErrorCode::SE_MONGODB_ERROR;
       se.message = "Failed to create collection user-timeline from MongoDB";
+      mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
       throw se;
     }
 
-    bson_t *query = BCON_NEW("user_id", BCON_INT64(user_id));
-    bson_t *opts = BCON_NEW("projection", "{", "posts", "{", "$slice", "[",
-                            BCON_INT32(0), BCON_INT32(stop), "]", "}", "}");
+    // Walk the user's bucket documents from the newest one and stop as soon
+    // as the first stop posts are covered. A small batch size keeps the
+    // server from shipping documents that will not be read.
+    bson_t *query = _NewTimelineQuery(user_id);
+    bson_t *sort = _NewTimelineSort();
+    bson_t *opts = BCON_NEW(
+        "sort", BCON_DOCUMENT(sort),
+        "projection", "{", "_id", BCON_INT32(0), "posts", "{", "$slice", "[",
+        BCON_INT32(0), BCON_INT32(stop), "]", "}", "}",
+        "batchSize", BCON_INT32(2));
+    bson_destroy(sort);
 
     auto find_span = opentracing::Tracer::Global()->StartSpan(
         "user_timeline_mongo_find_client",
         {opentracing::ChildOf(&span->context())});
     mongoc_cursor_t *cursor =
         mongoc_collection_find_with_opts(collection, query, opts, nullptr);
-    find_span->Finish();
     const bson_t *doc;
-    bool found = mongoc_cursor_next(cursor, &doc);
-    if (found) {
-      bson_iter_t iter_0;
-      bson_iter_t iter_1;
-      bson_iter_t post_id_child;
-      bson_iter_t timestamp_child;
-      int idx = 0;
-      bson_iter_init(&iter_0, doc);
-      bson_iter_init(&iter_1, doc);
-      while (bson_iter_find_descendant(
-                 &iter_0, ("posts." + std::to_string(idx) + ".post_id").c_str(),
-                 &post_id_child) &&
-             BSON_ITER_HOLDS_INT64(&post_id_child) &&
-             bson_iter_find_descendant(
-                 &iter_1,
-                 ("posts." + std::to_string(idx) + ".timestamp").c_str(),
-                 &timestamp_child) &&
-             BSON_ITER_HOLDS_INT64(&timestamp_child)) {
+    int idx = 0;
+    while (idx < stop && mongoc_cursor_next(cursor, &doc)) {
+      bson_iter_t iter;
+      bson_iter_t posts_child;
+      if (!bson_iter_init_find(&iter, doc, "posts") ||
+          !BSON_ITER_HOLDS_ARRAY(&iter) ||
+          !bson_iter_recurse(&iter, &posts_child)) {
+        continue;
+      }
+      while (idx < stop && bson_iter_next(&posts_child)) {
+        bson_iter_t post_id_child;
+        bson_iter_t timestamp_child;
+        if (!BSON_ITER_HOLDS_DOCUMENT(&posts_child) ||
+            !bson_iter_recurse(&posts_child, &post_id_child) ||
+            !bson_iter_find(&post_id_child, "post_id") ||
+            !BSON_ITER_HOLDS_INT64(&post_id_child) ||
+            !bson_iter_recurse(&posts_child, &timestamp_child) ||
+            !bson_iter_find(&timestamp_child, "timestamp") ||
+            !BSON_ITER_HOLDS_INT64(&timestamp_child)) {
+          continue;
+        }
         auto curr_post_id = bson_iter_int64(&post_id_child);
         auto curr_timestamp = bson_iter_int64(&timestamp_child);
         if (idx >= mongo_start) {
@@ -251,13 +631,16 @@ void UserTimelineHandler::ReadUserTimeline(
             post_ids.emplace_back(curr_post_id);
           }
         }
-        redis_update_map.insert(std::make_pair(std::to_string(curr_post_id),
-                                               (double)curr_timestamp));
-        bson_iter_init(&iter_0, doc);
-        bson_iter_init(&iter_1, doc);
+        if (_packed_timeline) {
+          packed_update_records.push_back({curr_timestamp, curr_post_id});
+        } else {
+          redis_update_map.insert(std::make_pair(
+              std::to_string(curr_post_id), (double)curr_timestamp));
+        }
         idx++;
       }
     }
+    find_span->Finish();
     bson_destroy(opts);
     bson_destroy(query);
     mongoc_cursor_destroy(cursor);
@@ -278,7 +661,7 @@ void UserTimelineHandler::ReadUserTimeline(
         auto post_client = post_client_wrapper->GetClient();
         try {
           post_client->ReadPosts(_return_posts, req_id, post_ids,
-                                 writer_text_map);
+                                 writer_text_map, fields);
         } catch (...) {
           _post_client_pool->Remove(post_client_wrapper);
           LOG(error) << "Failed to read posts from post-storage-service";
@@ -288,6 +671,32 @@ void UserTimelineHandler::ReadUserTimeline(
         return _return_posts;
       });
 
+  // Redis held fewer than stop entries, so the first stop entries from MongoDB
+  // cover the packed timeline as of the MongoDB read. The merge script keeps
+  // whatever WriteUserTimeline appended since.
+  if (packed_update_records.size() > 0) {
+    auto redis_update_span = opentracing::Tracer::Global()->StartSpan(
+        "user_timeline_redis_update_client",
+        {opentracing::ChildOf(&span->context())});
+    std::string packed_records = EncodePackedTimeline(packed_update_records);
+    std::string packed_cap = std::to_string(_packed_timeline_max_records *
+                                            sizeof(PackedTimelineRecord));
+    try {
+      if (_redis_client_pool)
+        _redis_client_pool->eval<long long>(PACKED_TIMELINE_MERGE_SCRIPT,
+                                            {PackedTimelineKey(user_id)},
+                                            {packed_records, packed_cap});
+      else
+        _redis_cluster_client_pool->eval<long long>(
+            PACKED_TIMELINE_MERGE_SCRIPT, {PackedTimelineKey(user_id)},
+            {packed_records, packed_cap});
+    } catch (const Error &err) {
+      LOG(error) << err.what();
+      throw err;
+    }
+    redis_update_span->Finish();
+  }
+
   if (redis_update_map.size() > 0) {
     auto redis_update_span = opentracing::Tracer::Global()->StartSpan(
         "user_timeline_redis_update_client",
@@ -318,6 +727,132 @@ void UserTimelineHandler::ReadUserTimeline(
   span->Finish();
 }
 
+std::vector<MongoIndexSpec> UserTimelineHandler::IndexSpecs() {
+  return {
+      {USER_TIMELINE_DB, USER_TIMELINE_BUCKET_COLLECTION,
+       {{"user_id", 1}, {"bucket", -1}, {"seq", -1}}, true, ""},
+  };
+}
+
+int64_t UserTimelineHandler::_OpenSeq(mongoc_collection_t *collection,
+                                      int64_t user_id, int64_t bucket) {
+  {
+    std::lock_guard<std::mutex> lock(_open_seqs_mutex);
+    auto open = _open_seqs.find(user_id);
+    if (open != _open_seqs.end() && open->second.first == bucket) {
+      return open->second.second;
+    }
+  }
+  bson_t *query = _NewBucketSeqQuery(user_id, bucket);
+  bson_t *sort = _NewBucketSeqSort();
+  bson_t *opts = BCON_NEW("sort", BCON_DOCUMENT(sort), "projection", "{",
+                          "_id", BCON_INT32(0), "seq", BCON_INT32(1), "}",
+                          "limit", BCON_INT64(1));
+  bson_destroy(sort);
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+  const bson_t *doc;
+  bson_iter_t iter;
+  int64_t seq = 0;
+  if (mongoc_cursor_next(cursor, &doc) &&
+      bson_iter_init_find(&iter, doc, "seq")) {
+    seq = bson_iter_as_int64(&iter);
+  }
+  bson_error_t error;
+  if (mongoc_cursor_error(cursor, &error)) {
+    // _PushToBucket moves on from seq 0 to the first document with room
+    LOG(warning) << "Failed to read the newest user-timeline document of user "
+                 << user_id << ": " << error.message;
+  }
+  mongoc_cursor_destroy(cursor);
+  bson_destroy(opts);
+  bson_destroy(query);
+  return seq;
+}
+
+// A stale entry only costs _PushToBucket a step to the next document, so
+// the map is simply emptied once it holds
+// USER_TIMELINE_OPEN_SEQS_CACHE_SIZE users.
+void UserTimelineHandler::_SetOpenSeq(int64_t user_id, int64_t bucket,
+                                      int64_t seq) {
+  std::lock_guard<std::mutex> lock(_open_seqs_mutex);
+  if (_open_seqs.size() >= USER_TIMELINE_OPEN_SEQS_CACHE_SIZE) {
+    _open_seqs.clear();
+  }
+  _open_seqs[user_id] = std::make_pair(bucket, seq);
+}
+
+int64_t UserTimelineHandler::_PushToBucket(mongoc_collection_t *collection,
+                                           int64_t user_id, int64_t bucket,
+                                           int64_t seq, const bson_t *update,
+                                           bson_error_t *error) {
+  bson_t *upsert_opts = BCON_NEW("upsert", BCON_BOOL(true));
+  int64_t written = -1;
+  while (true) {
+    bson_t *query = _NewBucketQuery(user_id, bucket, seq, _bucket_max_posts);
+    bool updated = mongoc_collection_update_one(collection, query, update,
+                                                upsert_opts, nullptr, error);
+    bool full = false;
+    if (!updated && error->code == MONGOC_ERROR_DUPLICATE_KEY) {
+      // Document seq is full, or a concurrent upsert created it first and
+      // it still has room; update it (upsert: false) in the latter case
+      bson_t reply;
+      updated = mongoc_collection_update_one(collection, query, update,
+                                             nullptr, &reply, error);
+      bson_iter_t iter;
+      full = updated && bson_iter_init_find(&iter, &reply, "matchedCount") &&
+             bson_iter_as_int64(&iter) == 0;
+      bson_destroy(&reply);
+    }
+    bson_destroy(query);
+    if (!full) {
+      written = updated ? seq : -1;
+      break;
+    }
+    seq++;
+  }
+  bson_destroy(upsert_opts);
+  return written;
+}
+
+bson_t *UserTimelineHandler::_NewBucketQuery(int64_t user_id, int64_t bucket,
+                                             int64_t seq, int max_posts) {
+  return BCON_NEW("user_id", BCON_INT64(user_id), "bucket",
+                  BCON_INT64(bucket), "seq", BCON_INT64(seq), "count", "{",
+                  "$lt", BCON_INT32(max_posts), "}");
+}
+
+bson_t *UserTimelineHandler::_NewBucketSeqQuery(int64_t user_id,
+                                                int64_t bucket) {
+  bson_t *query = bson_new();
+  BSON_APPEND_INT64(query, "user_id", user_id);
+  BSON_APPEND_INT64(query, "bucket", bucket);
+  return query;
+}
+
+bson_t *UserTimelineHandler::_NewBucketSeqSort() {
+  return BCON_NEW("seq", BCON_INT32(-1));
+}
+
+bson_t *UserTimelineHandler::_NewTimelineQuery(int64_t user_id) {
+  return BCON_NEW("user_id", BCON_INT64(user_id));
+}
+
+bson_t *UserTimelineHandler::_NewTimelineSort() {
+  return BCON_NEW("bucket", BCON_INT32(-1), "seq", BCON_INT32(-1));
+}
+
+std::vector<MongoQueryShape> UserTimelineHandler::QueryShapes() {
+  return {
+      MongoQueryShapeOf(USER_TIMELINE_DB, USER_TIMELINE_BUCKET_COLLECTION,
+                        _NewTimelineQuery(0), _NewTimelineSort()),
+      MongoQueryShapeOf(USER_TIMELINE_DB, USER_TIMELINE_BUCKET_COLLECTION,
+                        _NewBucketQuery(0, 0, 0, 1)),
+      MongoQueryShapeOf(USER_TIMELINE_DB, USER_TIMELINE_BUCKET_COLLECTION,
+                        _NewBucketSeqQuery(0, 0), _NewBucketSeqSort()),
+  };
+}
+
 }  // namespace social_network
 
 #endif  // SOCIAL_NETWORK_MICROSERVICES_SRC_USERTIMELINESERVICE_USERTIMELINEHANDLER_H_
@@ -60,6 +60,16 @@ int main(int argc, char *argv[]) {
   }
 
   int port = config_json["user-timeline-service"]["port"];
+  std::string timeline_layout = config_json["user-timeline-service"].value(
+      "timeline_layout", std::string("zset"));
+  bool packed_timeline = (timeline_layout == "packed");
+  int packed_timeline_max_records =
+      config_json["user-timeline-service"].value(
+          "timeline_max_records", PACKED_TIMELINE_DEFAULT_MAX_RECORDS);
+  int64_t bucket_window_ms = config_json["user-timeline-service"].value(
+      "bucket_window_ms", (int64_t)USER_TIMELINE_DEFAULT_BUCKET_WINDOW_MS);
+  int bucket_max_posts = config_json["user-timeline-service"].value(
+      "bucket_max_posts", USER_TIMELINE_DEFAULT_BUCKET_MAX_POSTS);
 
   int post_storage_port = config_json["post-storage-service"]["port"];
   std::string post_storage_addr = config_json["post-storage-service"]["addr"];
@@ -83,20 +93,12 @@ int main(int argc, char *argv[]) {
       post_storage_conns, post_storage_timeout, post_storage_keepalive,
       config_json);
 
-  mongoc_client_t *mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
-  if (!mongodb_client) {
-    LOG(fatal) << "Failed to pop mongoc client";
+  if (!SetUpMongoIndexes(mongodb_client_pool, UserTimelineHandler::IndexSpecs(),
+                         UserTimelineHandler::QueryShapes(),
+                         config_json.value("mongodb_index_check", false))) {
+    LOG(fatal) << "Failed to set up the MongoDB indexes of UserTimelineHandler";
     return EXIT_FAILURE;
   }
-  bool r = false;
-  while (!r) {
-    r = CreateIndex(mongodb_client, "user-timeline", "user_id", true);
-    if (!r) {
-      LOG(error) << "Failed to create mongodb index, try again";
-      sleep(1);
-    }
-  }
-  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
   std::shared_ptr<TServerSocket> server_socket =
       get_server_socket(config_json, "0.0.0.0", port);
 
@@ -106,11 +108,14 @@ int main(int argc, char *argv[]) {
     TThreadedServer server(std::make_shared<UserTimelineServiceProcessor>(
                                std::make_shared<UserTimelineHandler>(
                                    &redis_client_pool, mongodb_client_pool,
-                                   &post_storage_client_pool)),
+                                   &post_storage_client_pool, packed_timeline,
+                                   packed_timeline_max_records,
+                                   bucket_window_ms, bucket_max_posts)),
                            server_socket,
                            std::make_shared<TFramedTransportFactory>(),
                            std::make_shared<TBinaryProtocolFactory>());
-    LOG(info) << "Starting the user-timeline-service server...";
+    LOG(info) << "Starting the user-timeline-service server ("
+              << timeline_layout << " timeline layout)...";
     server.serve();
   } else {
     Redis redis_client_pool =
@@ -118,11 +123,14 @@ int main(int argc, char *argv[]) {
     TThreadedServer server(std::make_shared<UserTimelineServiceProcessor>(
                                std::make_shared<UserTimelineHandler>(
                                    &redis_client_pool, mongodb_client_pool,
-                                   &post_storage_client_pool)),
+                                   &post_storage_client_pool, packed_timeline,
+                                   packed_timeline_max_records,
+                                   bucket_window_ms, bucket_max_posts)),
                            server_socket,
                            std::make_shared<TFramedTransportFactory>(),
                            std::make_shared<TBinaryProtocolFactory>());
-    LOG(info) << "Starting the user-timeline-service server...";
+    LOG(info) << "Starting the user-timeline-service server ("
+              << timeline_layout << " timeline layout)...";
     server.serve();
   }
 }
\ No newline at end of file
@@ -65,7 +65,7 @@ def read_posts():
   transport.open()
   req_id = random.getrandbits(63)
   post_id = [783799431931478016, 783799431931547648, 783799431931551744]
-  posts = client.ReadPosts(req_id, post_id, {})
+  posts = client.ReadPosts(req_id, post_id, {}, None)
   print(posts)
 
 
@@ -21,7 +21,7 @@ def main():
   user_id = 1
   start = 0
   stop = 10
-  print(client.ReadHomeTimeline(req_id, user_id, start, stop, {}))
+  print(client.ReadHomeTimeline(req_id, user_id, start, stop, {}, None))
   transport.close()
 
 if __name__ == '__main__':
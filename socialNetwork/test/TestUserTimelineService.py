@@ -21,7 +21,7 @@ def main():
   user_id = 0
   start = 0
   stop = 5
-  print(client.ReadUserTimeline(req_id, user_id, start, stop, {}))
+  print(client.ReadUserTimeline(req_id, user_id, start, stop, {}, None))
   transport.close()
 
 if __name__ == '__main__':